@@ -73,6 +73,10 @@ namespace simplex
     my_square_matrix<T>::get_determ() const
     {
         unsigned int l_height = this->get_height();
+        if (1 == l_height)
+        {
+            return this->get_data(0, 0);
+        }
         if (2 == l_height)
         {
             return (this->get_data(0, 0) * this->get_data(1, 1) - this->get_data(0, 1) * this->get_data(1, 0));
@@ -0,0 +1,549 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_ALLOCATOR_H
+#define SIMPLEX_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif // __linux__
+#ifdef _WIN32
+#include <malloc.h>
+#endif // _WIN32
+
+namespace simplex
+{
+    /**
+     * Size of cache line: dense rows are aligned on it and padded to a
+     * multiple of it so that rows updated by different threads never share
+     * a cache line
+     */
+    const std::size_t simplex_cache_line_size = 64;
+
+    /**
+     * Size of transparent huge pages
+     */
+    const std::size_t simplex_huge_page_size = 2 * 1024 * 1024;
+
+    /**
+     * Allocate memory aligned on a power of 2
+     * @param p_size number of bytes
+     * @param p_alignment alignment in bytes, multiple of sizeof(void*)
+     * @return pointer on allocated memory, std::bad_alloc is thrown on failure
+     */
+    inline
+    void *
+    simplex_aligned_malloc(std::size_t p_size,
+                           std::size_t p_alignment
+                          );
+
+    /**
+     * Free memory allocated by simplex_aligned_malloc
+     * @param p_pointer pointer on memory to free
+     */
+    inline
+    void
+    simplex_aligned_free(void * p_pointer);
+
+    /**
+     * Return smallest number of objects greater or equal than p_nb whose
+     * size is a multiple of cache line size, so that an array following
+     * another one of this size starts on a cache line
+     * @tparam T Type of objects
+     * @param p_nb minimum number of objects
+     * @return padded number of objects
+     */
+    template <typename T>
+    inline
+    unsigned int
+    simplex_cache_line_padded_size(unsigned int p_nb);
+
+    /**
+     * Allocator returning memory aligned on a cache line
+     * @tparam T Type of allocated objects
+     * @tparam ALIGNMENT alignment in bytes
+     */
+    template <typename T, std::size_t ALIGNMENT = simplex_cache_line_size>
+    class simplex_aligned_allocator
+    {
+      public:
+        typedef T value_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef simplex_aligned_allocator<U, ALIGNMENT> other;
+        };
+
+        inline
+        simplex_aligned_allocator() = default;
+
+        template <typename U>
+        inline
+        simplex_aligned_allocator(const simplex_aligned_allocator<U, ALIGNMENT> & p_allocator);
+
+        inline
+        T *
+        allocate(std::size_t p_nb);
+
+        inline
+        void
+        deallocate(T * p_pointer,
+                   std::size_t p_nb
+                  );
+    };
+
+    /**
+     * Allocator advising the kernel to back large allocations with
+     * transparent huge pages to reduce TLB misses on big tableaus. Small
+     * allocations and systems without transparent huge pages only get
+     * cache line alignment
+     * @tparam T Type of allocated objects
+     */
+    template <typename T>
+    class simplex_huge_page_allocator
+    {
+      public:
+        typedef T value_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef simplex_huge_page_allocator<U> other;
+        };
+
+        inline
+        simplex_huge_page_allocator() = default;
+
+        template <typename U>
+        inline
+        simplex_huge_page_allocator(const simplex_huge_page_allocator<U> & p_allocator);
+
+        inline
+        T *
+        allocate(std::size_t p_nb);
+
+        inline
+        void
+        deallocate(T * p_pointer,
+                   std::size_t p_nb
+                  );
+    };
+
+    /**
+     * Memory pool from which allocations are taken contiguously. Memory is
+     * only given back when arena is cleared or destroyed so that arrays
+     * built and dropped by successive searches do not go through malloc
+     */
+    class simplex_arena
+    {
+      public:
+        /**
+         * Constructor
+         * @param p_block_size minimum size of blocks requested to system
+         */
+        inline explicit
+        simplex_arena(std::size_t p_block_size = simplex_huge_page_size);
+
+        simplex_arena(const simplex_arena &) = delete;
+
+        simplex_arena &
+        operator=(const simplex_arena &) = delete;
+
+        /**
+         * Return memory aligned on a cache line
+         * @param p_size number of bytes
+         * @return pointer on memory
+         */
+        inline
+        void *
+        allocate(std::size_t p_size);
+
+        /**
+         * Give back memory of all allocations. Memory previously returned
+         * by allocate should not be used anymore
+         */
+        inline
+        void
+        clear();
+
+        /**
+         * Return number of bytes given by allocate since construction or
+         * last clear
+         * @return number of bytes
+         */
+        inline
+        std::size_t
+        get_allocated_size() const;
+
+        inline
+        ~simplex_arena();
+
+      private:
+        /**
+         * Minimum size of blocks
+         */
+        std::size_t m_block_size;
+
+        /**
+         * Blocks requested to system
+         */
+        std::vector<char *> m_blocks;
+
+        /**
+         * Next free byte of last block
+         */
+        char * m_current;
+
+        /**
+         * Number of free bytes in last block
+         */
+        std::size_t m_remaining;
+
+        /**
+         * Number of bytes given by allocate
+         */
+        std::size_t m_allocated_size;
+    };
+
+    /**
+     * Allocator taking memory from an arena, deallocation does nothing
+     * @tparam T Type of allocated objects
+     */
+    template <typename T>
+    class simplex_arena_allocator
+    {
+      public:
+        typedef T value_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef simplex_arena_allocator<U> other;
+        };
+
+        inline explicit
+        simplex_arena_allocator(simplex_arena & p_arena);
+
+        template <typename U>
+        inline
+        simplex_arena_allocator(const simplex_arena_allocator<U> & p_allocator);
+
+        inline
+        T *
+        allocate(std::size_t p_nb);
+
+        inline
+        void
+        deallocate(T * p_pointer,
+                   std::size_t p_nb
+                  );
+
+        /**
+         * Return arena providing memory
+         * @return arena
+         */
+        inline
+        simplex_arena &
+        get_arena() const;
+
+      private:
+        simplex_arena * m_arena;
+    };
+
+    //-------------------------------------------------------------------------
+    void *
+    simplex_aligned_malloc(std::size_t p_size,
+                           std::size_t p_alignment
+                          )
+    {
+#ifdef _WIN32
+        void * l_pointer = _aligned_malloc(p_size ? p_size : 1, p_alignment);
+        if(!l_pointer)
+        {
+            throw std::bad_alloc();
+        }
+#else // _WIN32
+        void * l_pointer = nullptr;
+        if(posix_memalign(&l_pointer, p_alignment, p_size ? p_size : 1))
+        {
+            throw std::bad_alloc();
+        }
+#endif // _WIN32
+        return l_pointer;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_aligned_free(void * p_pointer)
+    {
+#ifdef _WIN32
+        _aligned_free(p_pointer);
+#else // _WIN32
+        free(p_pointer);
+#endif // _WIN32
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    unsigned int
+    simplex_cache_line_padded_size(unsigned int p_nb)
+    {
+        std::size_t l_gcd = simplex_cache_line_size;
+        std::size_t l_size = sizeof(T);
+        while(l_size)
+        {
+            std::size_t l_remainder = l_gcd % l_size;
+            l_gcd = l_size;
+            l_size = l_remainder;
+        }
+        unsigned int l_unit = (unsigned int)(simplex_cache_line_size / l_gcd);
+        return ((p_nb + l_unit - 1) / l_unit) * l_unit;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, std::size_t ALIGNMENT>
+    template <typename U>
+    simplex_aligned_allocator<T, ALIGNMENT>::simplex_aligned_allocator(const simplex_aligned_allocator<U, ALIGNMENT> & p_allocator)
+    {
+        (void)p_allocator;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, std::size_t ALIGNMENT>
+    T *
+    simplex_aligned_allocator<T, ALIGNMENT>::allocate(std::size_t p_nb)
+    {
+        return static_cast<T*>(simplex_aligned_malloc(p_nb * sizeof(T), ALIGNMENT));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, std::size_t ALIGNMENT>
+    void
+    simplex_aligned_allocator<T, ALIGNMENT>::deallocate(T * p_pointer,
+                                                        std::size_t p_nb
+                                                       )
+    {
+        (void)p_nb;
+        simplex_aligned_free(p_pointer);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U, std::size_t ALIGNMENT>
+    bool
+    operator==(const simplex_aligned_allocator<T, ALIGNMENT> &,
+               const simplex_aligned_allocator<U, ALIGNMENT> &
+              )
+    {
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U, std::size_t ALIGNMENT>
+    bool
+    operator!=(const simplex_aligned_allocator<T, ALIGNMENT> &,
+               const simplex_aligned_allocator<U, ALIGNMENT> &
+              )
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename U>
+    simplex_huge_page_allocator<T>::simplex_huge_page_allocator(const simplex_huge_page_allocator<U> & p_allocator)
+    {
+        (void)p_allocator;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T *
+    simplex_huge_page_allocator<T>::allocate(std::size_t p_nb)
+    {
+        std::size_t l_size = p_nb * sizeof(T);
+        if(l_size < simplex_huge_page_size)
+        {
+            return static_cast<T*>(simplex_aligned_malloc(l_size, simplex_cache_line_size));
+        }
+        // Round size to whole huge pages so that no page is shared with
+        // other allocations
+        l_size = ((l_size + simplex_huge_page_size - 1) / simplex_huge_page_size) * simplex_huge_page_size;
+        void * l_pointer = simplex_aligned_malloc(l_size, simplex_huge_page_size);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // Only an advice: failure just means that normal pages are used
+        madvise(l_pointer, l_size, MADV_HUGEPAGE);
+#endif // __linux__ && MADV_HUGEPAGE
+        return static_cast<T*>(l_pointer);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    simplex_huge_page_allocator<T>::deallocate(T * p_pointer,
+                                               std::size_t p_nb
+                                              )
+    {
+        (void)p_nb;
+        simplex_aligned_free(p_pointer);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U>
+    bool
+    operator==(const simplex_huge_page_allocator<T> &,
+               const simplex_huge_page_allocator<U> &
+              )
+    {
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U>
+    bool
+    operator!=(const simplex_huge_page_allocator<T> &,
+               const simplex_huge_page_allocator<U> &
+              )
+    {
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    simplex_arena::simplex_arena(std::size_t p_block_size)
+    :m_block_size(p_block_size)
+    ,m_current(nullptr)
+    ,m_remaining(0)
+    ,m_allocated_size(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    void *
+    simplex_arena::allocate(std::size_t p_size)
+    {
+        // Keep next allocation aligned on a cache line
+        std::size_t l_size = ((p_size + simplex_cache_line_size - 1) / simplex_cache_line_size) * simplex_cache_line_size;
+        if(l_size > m_remaining)
+        {
+            std::size_t l_block_size = l_size > m_block_size ? l_size : m_block_size;
+            m_blocks.push_back(static_cast<char*>(simplex_aligned_malloc(l_block_size, simplex_cache_line_size)));
+            m_current = m_blocks.back();
+            m_remaining = l_block_size;
+        }
+        void * l_pointer = m_current;
+        m_current += l_size;
+        m_remaining -= l_size;
+        m_allocated_size += l_size;
+        return l_pointer;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_arena::clear()
+    {
+        for(auto l_block: m_blocks)
+        {
+            simplex_aligned_free(l_block);
+        }
+        m_blocks.clear();
+        m_current = nullptr;
+        m_remaining = 0;
+        m_allocated_size = 0;
+    }
+
+    //-------------------------------------------------------------------------
+    std::size_t
+    simplex_arena::get_allocated_size() const
+    {
+        return m_allocated_size;
+    }
+
+    //-------------------------------------------------------------------------
+    simplex_arena::~simplex_arena()
+    {
+        clear();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    simplex_arena_allocator<T>::simplex_arena_allocator(simplex_arena & p_arena)
+    :m_arena(&p_arena)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename U>
+    simplex_arena_allocator<T>::simplex_arena_allocator(const simplex_arena_allocator<U> & p_allocator)
+    :m_arena(&p_allocator.get_arena())
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T *
+    simplex_arena_allocator<T>::allocate(std::size_t p_nb)
+    {
+        return static_cast<T*>(m_arena->allocate(p_nb * sizeof(T)));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    simplex_arena_allocator<T>::deallocate(T * p_pointer,
+                                           std::size_t p_nb
+                                          )
+    {
+        // Memory is given back when arena is cleared
+        (void)p_pointer;
+        (void)p_nb;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    simplex_arena &
+    simplex_arena_allocator<T>::get_arena() const
+    {
+        return *m_arena;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U>
+    bool
+    operator==(const simplex_arena_allocator<T> & p_allocator1,
+               const simplex_arena_allocator<U> & p_allocator2
+              )
+    {
+        return &p_allocator1.get_arena() == &p_allocator2.get_arena();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, typename U>
+    bool
+    operator!=(const simplex_arena_allocator<T> & p_allocator1,
+               const simplex_arena_allocator<U> & p_allocator2
+              )
+    {
+        return !(p_allocator1 == p_allocator2);
+    }
+}
+#endif //SIMPLEX_ALLOCATOR_H
+// EOF
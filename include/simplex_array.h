@@ -18,17 +18,30 @@
 #define _SIMPLEX_ARRAY_H_
 
 #include "simplex_array_base.h"
+#include "simplex_allocator.h"
+#include <memory>
 #include <cstring>
+#include <algorithm>
 #include <cassert>
 
 namespace simplex
 {
-  template <typename COEF_TYPE>
+  /**
+     Dense storage of simplex tableau. Lines start on a cache line and are
+     padded to a multiple of cache line size so that vectorized kernels
+     work on aligned data and lines updated by different threads do not
+     share cache lines
+     @tparam COEF_TYPE Type of coefficients
+     @tparam ALLOCATOR Allocator of coefficients, should return memory
+     aligned on a cache line
+  */
+  template <typename COEF_TYPE, typename ALLOCATOR=simplex_aligned_allocator<COEF_TYPE>>
   class simplex_array: public simplex_array_base<COEF_TYPE>
   {
   public:
     simplex_array(const unsigned int & p_nb_equations,
-		  const unsigned int & p_nb_variables
+		  const unsigned int & p_nb_variables,
+		  const ALLOCATOR & p_allocator = ALLOCATOR()
 		  );
 
     /**
@@ -105,9 +118,123 @@ namespace simplex
 		 const unsigned int p_variable_index
 		 ) const;
 
+    /**
+       Return pointer on contiguous A coefficients of an equation
+       @param p_equation_index : the value should be less than total number of equations
+       @return pointer on first coefficient of equation
+    */
+    inline COEF_TYPE * get_row(const unsigned int p_equation_index);
+
+    /**
+       Return pointer on contiguous A coefficients of an equation
+       @param p_equation_index : the value should be less than total number of equations
+       @return pointer on first coefficient of equation
+    */
+    inline const COEF_TYPE * get_row(const unsigned int p_equation_index)const;
+
+    /**
+       Return pointer on contiguous coefficients of objective function
+       @return pointer on first Z coefficient
+    */
+    inline COEF_TYPE * get_Z_row(void);
+
+    /**
+       Return pointer on contiguous B coefficients
+       @return pointer on first B coefficient
+    */
+    inline COEF_TYPE * get_B_column(void);
+
+    /**
+       Append null columns after existing ones
+       @param p_nb_variables : number of columns to add
+    */
+    inline void add_variables(const unsigned int & p_nb_variables);
+
+    /**
+       Insert null columns, following columns are shifted. Storage grows
+       geometrically so that successive insertions have an amortized cost
+       @param p_variable_index : index of first inserted column, should be
+       less or equal than number of variables
+       @param p_nb_variables : number of columns to insert
+    */
+    inline void insert_variables(const unsigned int & p_variable_index,
+				 const unsigned int & p_nb_variables
+				 );
+
+    /**
+       Append null lines after existing ones. Storage grows geometrically
+       so that successive additions have an amortized cost
+       @param p_nb_equations : number of lines to add
+    */
+    inline void add_equations(const unsigned int & p_nb_equations);
+
+    /**
+       Remove columns, following columns are shifted. Storage is kept for
+       later insertions
+       @param p_variable_index : index of first removed column
+       @param p_nb_variables : number of columns to remove
+    */
+    inline void remove_variables(const unsigned int & p_variable_index,
+				 const unsigned int & p_nb_variables
+				 );
+
+    /**
+       Remove last lines. Storage is kept for later additions
+       @param p_nb_equations : number of lines to remove
+    */
+    inline void remove_equations(const unsigned int & p_nb_equations);
+
     inline ~simplex_array(void);
 
   private:
+    /**
+       Copy first p_size coefficients of a line and insert null
+       coefficients, source and destination can be the same line
+       @param p_source : line to copy
+       @param p_destination : line receiving coefficients
+       @param p_size : number of coefficients of source line
+       @param p_index : index of first inserted coefficient
+       @param p_nb : number of inserted coefficients
+    */
+    inline static void insert_in_line(const COEF_TYPE * p_source,
+				      COEF_TYPE * p_destination,
+				      const unsigned int & p_size,
+				      const unsigned int & p_index,
+				      const unsigned int & p_nb
+				      );
+
+    /**
+       Allocate null coefficients
+       @param p_size : number of coefficients
+       @return pointer on first coefficient
+    */
+    inline COEF_TYPE * allocate_coefs(const size_t & p_size);
+
+    /**
+       Destroy and free coefficients returned by allocate_coefs
+       @param p_coefs : pointer on first coefficient
+       @param p_size : number of coefficients
+    */
+    inline void release_coefs(COEF_TYPE * p_coefs,
+			      const size_t & p_size
+			      );
+
+    /**
+       Allocator of coefficients
+    */
+    ALLOCATOR m_allocator;
+
+    /**
+       Number of lines that can be stored without reallocation
+    */
+    unsigned int m_equation_capacity;
+
+    /**
+       Number of coefficients allocated for each line, a line starts
+       m_variable_capacity coefficients after the previous one
+    */
+    unsigned int m_variable_capacity;
+
     /**
        Matrix A coefficients in Ax = b
      */
@@ -129,22 +256,35 @@ namespace simplex
     COEF_TYPE m_z0;
   };
 
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  class simplex_array_traits<simplex_array<COEF_TYPE,ALLOCATOR>>
+  {
+  public:
+    static const bool m_contiguous_rows = true;
+    static const bool m_contiguous_columns = false;
+    static const bool m_concurrent_row_update = true;
+  };
+
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  simplex_array<COEF_TYPE>::simplex_array(const unsigned int & p_nb_equations,
-					  const unsigned int & p_nb_variables
-					  ):
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  simplex_array<COEF_TYPE,ALLOCATOR>::simplex_array(const unsigned int & p_nb_equations,
+						    const unsigned int & p_nb_variables,
+						    const ALLOCATOR & p_allocator
+						    ):
     simplex_array_base<COEF_TYPE>(p_nb_equations,p_nb_variables),
-    m_equation_coefs(new COEF_TYPE[p_nb_variables * p_nb_equations]()),
-    m_b_coefs(new COEF_TYPE[p_nb_equations]()),
-    m_z_coefs(new COEF_TYPE[p_nb_variables]()),
+    m_allocator(p_allocator),
+    m_equation_capacity(p_nb_equations),
+    m_variable_capacity(simplex_cache_line_padded_size<COEF_TYPE>(p_nb_variables)),
+    m_equation_coefs(allocate_coefs((size_t)m_variable_capacity * p_nb_equations)),
+    m_b_coefs(allocate_coefs(p_nb_equations)),
+    m_z_coefs(allocate_coefs(m_variable_capacity)),
     m_z0(0)
     {
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  void simplex_array<COEF_TYPE>::set_Z_coef(const unsigned int p_index,
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::set_Z_coef(const unsigned int p_index,
 				      const COEF_TYPE & p_value
 				      )
     {
@@ -154,8 +294,8 @@ namespace simplex
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  const COEF_TYPE & simplex_array<COEF_TYPE>::get_Z_coef(const unsigned int p_index
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  const COEF_TYPE & simplex_array<COEF_TYPE,ALLOCATOR>::get_Z_coef(const unsigned int p_index
 							 )const
     {
       assert(m_z_coefs);
@@ -164,23 +304,23 @@ namespace simplex
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  void simplex_array<COEF_TYPE>::set_Z0_coef(const COEF_TYPE & p_value
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::set_Z0_coef(const COEF_TYPE & p_value
 					)
     {
       m_z0 = p_value;
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  const COEF_TYPE & simplex_array<COEF_TYPE>::get_Z0_coef(void)const
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  const COEF_TYPE & simplex_array<COEF_TYPE,ALLOCATOR>::get_Z0_coef(void)const
     {
       return m_z0;
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-    void simplex_array<COEF_TYPE>::set_B_coef(const unsigned int p_index,
+  template <typename COEF_TYPE, typename ALLOCATOR>
+    void simplex_array<COEF_TYPE,ALLOCATOR>::set_B_coef(const unsigned int p_index,
 					      const COEF_TYPE & p_value
 					      )
     {
@@ -190,8 +330,8 @@ namespace simplex
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-    const COEF_TYPE & simplex_array<COEF_TYPE>::get_B_coef(const unsigned int p_index
+  template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE & simplex_array<COEF_TYPE,ALLOCATOR>::get_B_coef(const unsigned int p_index
 							   )const
     {
       assert(m_b_coefs);
@@ -200,8 +340,8 @@ namespace simplex
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  void simplex_array<COEF_TYPE>::set_A_coef(const unsigned int p_equation_index,
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::set_A_coef(const unsigned int p_equation_index,
 					    const unsigned int p_variable_index,
 					    const COEF_TYPE & p_value
 					    )
@@ -209,31 +349,216 @@ namespace simplex
     assert(m_equation_coefs);
     assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
     assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
-    m_equation_coefs[p_equation_index * simplex_array_base<COEF_TYPE>::get_nb_variables() + p_variable_index] = p_value;
+    m_equation_coefs[p_equation_index * m_variable_capacity + p_variable_index] = p_value;
   }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
+  template <typename COEF_TYPE, typename ALLOCATOR>
   const COEF_TYPE &
-  simplex_array<COEF_TYPE>::get_A_coef(const unsigned int p_equation_index,
+  simplex_array<COEF_TYPE,ALLOCATOR>::get_A_coef(const unsigned int p_equation_index,
 				       const unsigned int p_variable_index
 				       )const
     {
       assert(m_equation_coefs);
       assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
       assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
-      return m_equation_coefs[p_equation_index * simplex_array_base<COEF_TYPE>::get_nb_variables() + p_variable_index];
+      return m_equation_coefs[p_equation_index * m_variable_capacity + p_variable_index];
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  COEF_TYPE * simplex_array<COEF_TYPE,ALLOCATOR>::get_row(const unsigned int p_equation_index)
+    {
+      assert(m_equation_coefs);
+      assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+      return m_equation_coefs + p_equation_index * m_variable_capacity;
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  const COEF_TYPE * simplex_array<COEF_TYPE,ALLOCATOR>::get_row(const unsigned int p_equation_index)const
+    {
+      assert(m_equation_coefs);
+      assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+      return m_equation_coefs + p_equation_index * m_variable_capacity;
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  COEF_TYPE * simplex_array<COEF_TYPE,ALLOCATOR>::get_Z_row(void)
+    {
+      assert(m_z_coefs);
+      return m_z_coefs;
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  COEF_TYPE * simplex_array<COEF_TYPE,ALLOCATOR>::get_B_column(void)
+    {
+      assert(m_b_coefs);
+      return m_b_coefs;
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::add_variables(const unsigned int & p_nb_variables)
+    {
+      insert_variables(simplex_array_base<COEF_TYPE>::get_nb_variables(), p_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::insert_variables(const unsigned int & p_variable_index,
+						  const unsigned int & p_nb_variables
+						  )
+    {
+      unsigned int l_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      unsigned int l_old_nb_variables = simplex_array_base<COEF_TYPE>::get_nb_variables();
+      assert(p_variable_index <= l_old_nb_variables);
+      unsigned int l_nb_variables = l_old_nb_variables + p_nb_variables;
+      if(l_nb_variables <= m_variable_capacity)
+	{
+	  for(unsigned int l_row_index = 0; l_row_index < l_nb_equations; ++l_row_index)
+	    {
+	      COEF_TYPE * l_row = m_equation_coefs + l_row_index * m_variable_capacity;
+	      insert_in_line(l_row, l_row, l_old_nb_variables, p_variable_index, p_nb_variables);
+	    }
+	  insert_in_line(m_z_coefs, m_z_coefs, l_old_nb_variables, p_variable_index, p_nb_variables);
+	}
+      else
+	{
+	  unsigned int l_capacity = simplex_cache_line_padded_size<COEF_TYPE>(std::max(l_nb_variables, 2 * m_variable_capacity));
+	  COEF_TYPE * l_equation_coefs = allocate_coefs((size_t)l_capacity * m_equation_capacity);
+	  for(unsigned int l_row_index = 0; l_row_index < l_nb_equations; ++l_row_index)
+	    {
+	      insert_in_line(m_equation_coefs + l_row_index * m_variable_capacity,
+			     l_equation_coefs + l_row_index * l_capacity,
+			     l_old_nb_variables,
+			     p_variable_index,
+			     p_nb_variables
+			     );
+	    }
+	  COEF_TYPE * l_z_coefs = allocate_coefs(l_capacity);
+	  insert_in_line(m_z_coefs, l_z_coefs, l_old_nb_variables, p_variable_index, p_nb_variables);
+	  release_coefs(m_equation_coefs, (size_t)m_variable_capacity * m_equation_capacity);
+	  m_equation_coefs = l_equation_coefs;
+	  release_coefs(m_z_coefs, m_variable_capacity);
+	  m_z_coefs = l_z_coefs;
+	  m_variable_capacity = l_capacity;
+	}
+      simplex_array_base<COEF_TYPE>::set_nb_variables(l_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::add_equations(const unsigned int & p_nb_equations)
+    {
+      unsigned int l_old_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      unsigned int l_nb_equations = l_old_nb_equations + p_nb_equations;
+      // Lines after the last one are null so only a reallocation is needed
+      if(l_nb_equations > m_equation_capacity)
+	{
+	  unsigned int l_capacity = std::max(l_nb_equations, 2 * m_equation_capacity);
+	  COEF_TYPE * l_equation_coefs = allocate_coefs((size_t)l_capacity * m_variable_capacity);
+	  std::copy(m_equation_coefs, m_equation_coefs + l_old_nb_equations * m_variable_capacity, l_equation_coefs);
+	  COEF_TYPE * l_b_coefs = allocate_coefs(l_capacity);
+	  std::copy(m_b_coefs, m_b_coefs + l_old_nb_equations, l_b_coefs);
+	  release_coefs(m_equation_coefs, (size_t)m_variable_capacity * m_equation_capacity);
+	  m_equation_coefs = l_equation_coefs;
+	  release_coefs(m_b_coefs, m_equation_capacity);
+	  m_b_coefs = l_b_coefs;
+	  m_equation_capacity = l_capacity;
+	}
+      simplex_array_base<COEF_TYPE>::set_nb_equations(l_nb_equations);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::remove_variables(const unsigned int & p_variable_index,
+						  const unsigned int & p_nb_variables
+						  )
+    {
+      unsigned int l_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      unsigned int l_old_nb_variables = simplex_array_base<COEF_TYPE>::get_nb_variables();
+      assert(p_variable_index + p_nb_variables <= l_old_nb_variables);
+      // Freed coefficients are set to 0 like the ones never used
+      for(unsigned int l_row_index = 0; l_row_index <= l_nb_equations; ++l_row_index)
+	{
+	  COEF_TYPE * l_row = l_row_index < l_nb_equations ? m_equation_coefs + l_row_index * m_variable_capacity : m_z_coefs;
+	  std::copy(l_row + p_variable_index + p_nb_variables, l_row + l_old_nb_variables, l_row + p_variable_index);
+	  std::fill(l_row + l_old_nb_variables - p_nb_variables, l_row + l_old_nb_variables, COEF_TYPE(0));
+	}
+      simplex_array_base<COEF_TYPE>::set_nb_variables(l_old_nb_variables - p_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::remove_equations(const unsigned int & p_nb_equations)
+    {
+      unsigned int l_old_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      assert(p_nb_equations <= l_old_nb_equations);
+      unsigned int l_nb_equations = l_old_nb_equations - p_nb_equations;
+      // Lines after the last one should stay null
+      std::fill(m_equation_coefs + l_nb_equations * m_variable_capacity, m_equation_coefs + l_old_nb_equations * m_variable_capacity, COEF_TYPE(0));
+      std::fill(m_b_coefs + l_nb_equations, m_b_coefs + l_old_nb_equations, COEF_TYPE(0));
+      simplex_array_base<COEF_TYPE>::set_nb_equations(l_nb_equations);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::insert_in_line(const COEF_TYPE * p_source,
+						COEF_TYPE * p_destination,
+						const unsigned int & p_size,
+						const unsigned int & p_index,
+						const unsigned int & p_nb
+						)
+    {
+      std::copy_backward(p_source + p_index, p_source + p_size, p_destination + p_size + p_nb);
+      if(p_source != p_destination)
+	{
+	  std::copy(p_source, p_source + p_index, p_destination);
+	}
+      std::fill(p_destination + p_index, p_destination + p_index + p_nb, COEF_TYPE(0));
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  COEF_TYPE * simplex_array<COEF_TYPE,ALLOCATOR>::allocate_coefs(const size_t & p_size)
+    {
+      COEF_TYPE * l_coefs = std::allocator_traits<ALLOCATOR>::allocate(m_allocator, p_size);
+      for(size_t l_index = 0; l_index < p_size; ++l_index)
+	{
+	  std::allocator_traits<ALLOCATOR>::construct(m_allocator, l_coefs + l_index, COEF_TYPE(0));
+	}
+      return l_coefs;
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  void simplex_array<COEF_TYPE,ALLOCATOR>::release_coefs(COEF_TYPE * p_coefs,
+							 const size_t & p_size
+							 )
+    {
+      if(!p_coefs)
+	{
+	  return;
+	}
+      for(size_t l_index = 0; l_index < p_size; ++l_index)
+	{
+	  std::allocator_traits<ALLOCATOR>::destroy(m_allocator, p_coefs + l_index);
+	}
+      std::allocator_traits<ALLOCATOR>::deallocate(m_allocator, p_coefs, p_size);
     }
 
   //----------------------------------------------------------------------------
-  template <typename COEF_TYPE>
-  simplex_array<COEF_TYPE>::~simplex_array(void)
+  template <typename COEF_TYPE, typename ALLOCATOR>
+  simplex_array<COEF_TYPE,ALLOCATOR>::~simplex_array(void)
     {
-      delete[] m_z_coefs;
+      release_coefs(m_z_coefs, m_variable_capacity);
       m_z_coefs = nullptr;
-      delete[] m_b_coefs;
+      release_coefs(m_b_coefs, m_equation_capacity);
       m_b_coefs = nullptr;
-      delete[] m_equation_coefs;
+      release_coefs(m_equation_coefs, (size_t)m_variable_capacity * m_equation_capacity);
       m_equation_coefs = nullptr;
     }
 }
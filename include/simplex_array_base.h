@@ -19,6 +19,33 @@
 
 namespace simplex
 {
+  /**
+     Describe storage capabilities of an array type used by solvers.
+     By default coefficients are only reachable through accessors
+  */
+  template <typename ARRAY_TYPE>
+  class simplex_array_traits
+  {
+  public:
+    /**
+       Indicate if coefficients of a row, Z coefficients and B coefficients
+       are stored contiguously and can be accessed through pointers
+    */
+    static const bool m_contiguous_rows = false;
+
+    /**
+       Indicate if coefficients of a column and B coefficients are stored
+       contiguously and can be accessed through pointers
+    */
+    static const bool m_contiguous_columns = false;
+
+    /**
+       Indicate if different rows can be modified concurrently by several
+       threads
+    */
+    static const bool m_concurrent_row_update = false;
+  };
+
   template <typename COEF_TYPE>
   class simplex_array_base
   {
@@ -30,6 +57,18 @@ namespace simplex
 			      );
     inline const unsigned int & get_nb_equations(void)const;
     inline const unsigned int & get_nb_variables(void)const;
+  protected:
+    /**
+       Update number of columns when array is extended
+       @param p_nb_variables : new number of columns
+    */
+    inline void set_nb_variables(const unsigned int & p_nb_variables);
+
+    /**
+       Update number of lines when array is extended
+       @param p_nb_equations : new number of lines
+    */
+    inline void set_nb_equations(const unsigned int & p_nb_equations);
   private:
     /**
        Number of lines
@@ -65,6 +104,20 @@ namespace simplex
   {
     return m_nb_variables;
   }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_array_base<COEF_TYPE>::set_nb_variables(const unsigned int & p_nb_variables)
+  {
+    m_nb_variables = p_nb_variables;
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_array_base<COEF_TYPE>::set_nb_equations(const unsigned int & p_nb_equations)
+  {
+    m_nb_equations = p_nb_equations;
+  }
 }
 #endif // _SIMPLEX_ARRAY_BASE_H_
 // EOF
@@ -0,0 +1,510 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_BASIS_FACTORIZATION_H
+#define SIMPLEX_BASIS_FACTORIZATION_H
+
+#include "quicky_exception.h"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <string>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Factorization of a square basis matrix B used by revised simplex.
+     * B is factorized as P B = L U with partial pivoting, then each basis
+     * change is recorded as an eta matrix so that B is not factorized again
+     * before a given number of updates. Rows of B, L and U only store their
+     * non null coefficients. Pivots are chosen on magnitude only, without
+     * any ordering limiting fill-in, so factors of large bases with many
+     * coefficients can be much denser than B
+     * @tparam COEF_TYPE Type of matrix coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_basis_factorization
+    {
+      public:
+        simplex_basis_factorization() = delete;
+
+        /**
+         * Constructor
+         * @param p_size number of rows and columns of basis matrix
+         * @param p_refactorization_period number of eta updates accepted before
+         * asking for a new factorization
+         */
+        inline
+        simplex_basis_factorization(unsigned int p_size
+                                   ,unsigned int p_refactorization_period = 100
+                                   );
+
+        /**
+         * Size of basis matrix
+         * @return number of rows and columns of basis matrix
+         */
+        inline
+        unsigned int get_size() const;
+
+        /**
+         * Clear basis matrix before defining its coefficients with set_coef
+         */
+        inline
+        void reset();
+
+        /**
+         * Define coefficient of basis matrix
+         * Only valid between reset and factorize calls
+         * @param p_row_index row index
+         * @param p_column_index column index
+         * @param p_value coefficient value
+         */
+        inline
+        void set_coef(unsigned int p_row_index
+                     ,unsigned int p_column_index
+                     ,const COEF_TYPE & p_value
+                     );
+
+        /**
+         * Compute LU decomposition of matrix defined by set_coef calls
+         * Throw an exception if matrix is singular
+         */
+        inline
+        void factorize();
+
+        /**
+         * Solve B x = a, result is stored in place of a
+         * @param p_vector a as input, x as output
+         */
+        inline
+        void ftran(std::vector<COEF_TYPE> & p_vector) const;
+
+        /**
+         * Solve y B = c, result is stored in place of c
+         * @param p_vector c as input, y as output
+         */
+        inline
+        void btran(std::vector<COEF_TYPE> & p_vector) const;
+
+        /**
+         * Replace column of basis matrix
+         * @param p_column_index index of replaced column
+         * @param p_ftran_column new column already transformed by ftran
+         */
+        inline
+        void update(unsigned int p_column_index
+                   ,const std::vector<COEF_TYPE> & p_ftran_column
+                   );
+
+        /**
+         * Indicate if enough updates have been done to make a new
+         * factorization cheaper than applying eta matrices
+         * @return true if basis should be factorized again
+         */
+        inline
+        bool need_refactorization() const;
+
+      private:
+
+        /**
+         * Absolute value usable with any signed coefficient type
+         * @param p_value value
+         * @return absolute value
+         */
+        inline static
+        COEF_TYPE absolute(const COEF_TYPE & p_value);
+
+        /**
+         * Non null coefficients of a row sorted by column index
+         */
+        typedef std::vector<std::pair<unsigned int, COEF_TYPE> > t_sparse_row;
+
+        /**
+         * Eta matrix representing a basis column replacement
+         */
+        class eta
+        {
+          public:
+            inline
+            eta(unsigned int p_column_index
+               ,const COEF_TYPE & p_pivot
+               );
+
+            /**
+             * Index of replaced column
+             */
+            unsigned int m_column_index;
+
+            /**
+             * Coefficient of ftran column at replaced index
+             */
+            COEF_TYPE m_pivot;
+
+            /**
+             * Other non null coefficients of ftran column
+             */
+            std::vector<std::pair<unsigned int, COEF_TYPE> > m_coefs;
+        };
+
+        /**
+         * Matrix size
+         */
+        unsigned int m_size;
+
+        /**
+         * Number of eta matrices accepted before refactorization
+         */
+        unsigned int m_refactorization_period;
+
+        /**
+         * Rows of B before factorization, rows of U after. First coefficient
+         * of row i of U is its diagonal coefficient
+         */
+        std::vector<t_sparse_row> m_u_rows;
+
+        /**
+         * Rows of L without diagonal coefficients which are 1
+         */
+        std::vector<t_sparse_row> m_l_rows;
+
+        /**
+         * Row permutation: row i of P B is row m_permutation[i] of B
+         */
+        std::vector<unsigned int> m_permutation;
+
+        /**
+         * Eta matrices applied since last factorization
+         */
+        std::vector<eta> m_etas;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_basis_factorization<COEF_TYPE>::eta::eta(unsigned int p_column_index
+                                                    ,const COEF_TYPE & p_pivot
+                                                    )
+    :m_column_index(p_column_index)
+    ,m_pivot(p_pivot)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_basis_factorization<COEF_TYPE>::simplex_basis_factorization(unsigned int p_size
+                                                                       ,unsigned int p_refactorization_period
+                                                                       )
+    :m_size(p_size)
+    ,m_refactorization_period(p_refactorization_period)
+    ,m_u_rows(p_size)
+    ,m_l_rows(p_size)
+    ,m_permutation(p_size)
+    {
+        for(unsigned int l_index = 0; l_index < m_size; ++l_index)
+        {
+            m_permutation[l_index] = l_index;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_basis_factorization<COEF_TYPE>::get_size() const
+    {
+        return m_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::reset()
+    {
+        for(unsigned int l_index = 0; l_index < m_size; ++l_index)
+        {
+            m_u_rows[l_index].clear();
+            m_l_rows[l_index].clear();
+            m_permutation[l_index] = l_index;
+        }
+        m_etas.clear();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::set_coef(unsigned int p_row_index
+                                                    ,unsigned int p_column_index
+                                                    ,const COEF_TYPE & p_value
+                                                    )
+    {
+        assert(p_row_index < m_size);
+        assert(p_column_index < m_size);
+        t_sparse_row & l_row = m_u_rows[p_row_index];
+        auto l_iter = std::lower_bound(l_row.begin(),
+                                       l_row.end(),
+                                       p_column_index,
+                                       [](const std::pair<unsigned int, COEF_TYPE> & p_coef, unsigned int p_index)
+                                       {
+                                           return p_coef.first < p_index;
+                                       }
+                                      );
+        if(l_row.end() != l_iter && p_column_index == l_iter->first)
+        {
+            l_iter->second = p_value;
+        }
+        else
+        {
+            l_row.insert(l_iter, std::pair<unsigned int, COEF_TYPE>(p_column_index, p_value));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    simplex_basis_factorization<COEF_TYPE>::absolute(const COEF_TYPE & p_value)
+    {
+        return p_value < COEF_TYPE(0) ? -p_value : p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::factorize()
+    {
+        m_etas.clear();
+        t_sparse_row l_new_row;
+        for(unsigned int l_k = 0; l_k < m_size; ++l_k)
+        {
+            // Columns before k have been eliminated from rows after k so
+            // their coefficient in column k is the first one if any.
+            // Partial pivoting: choose the biggest coefficient of the column
+            unsigned int l_pivot_row = m_size;
+            COEF_TYPE l_max = COEF_TYPE(0);
+            for(unsigned int l_row_index = l_k; l_row_index < m_size; ++l_row_index)
+            {
+                const t_sparse_row & l_row = m_u_rows[l_row_index];
+                if(!l_row.empty() && l_k == l_row.front().first)
+                {
+                    COEF_TYPE l_value = absolute(l_row.front().second);
+                    if(m_size == l_pivot_row || l_max < l_value)
+                    {
+                        l_max = l_value;
+                        l_pivot_row = l_row_index;
+                    }
+                }
+            }
+            if(m_size == l_pivot_row || COEF_TYPE(0) == l_max)
+            {
+                throw quicky_exception::quicky_runtime_exception("Basis matrix is singular at column " + std::to_string(l_k), __LINE__, __FILE__);
+            }
+            if(l_pivot_row != l_k)
+            {
+                m_u_rows[l_k].swap(m_u_rows[l_pivot_row]);
+                m_l_rows[l_k].swap(m_l_rows[l_pivot_row]);
+                std::swap(m_permutation[l_k], m_permutation[l_pivot_row]);
+            }
+            const t_sparse_row & l_pivot_u_row = m_u_rows[l_k];
+            const COEF_TYPE l_pivot = l_pivot_u_row.front().second;
+            for(unsigned int l_row_index = l_k + 1; l_row_index < m_size; ++l_row_index)
+            {
+                t_sparse_row & l_row = m_u_rows[l_row_index];
+                if(l_row.empty() || l_k != l_row.front().first)
+                {
+                    continue;
+                }
+                COEF_TYPE l_l_coef = l_row.front().second / l_pivot;
+                m_l_rows[l_row_index].push_back(std::pair<unsigned int, COEF_TYPE>(l_k, l_l_coef));
+                // Merge row without its first coefficient with pivot row
+                // multiplied by L coefficient
+                l_new_row.clear();
+                auto l_iter = l_row.begin() + 1;
+                auto l_pivot_iter = l_pivot_u_row.begin() + 1;
+                while(l_row.end() != l_iter || l_pivot_u_row.end() != l_pivot_iter)
+                {
+                    if(l_pivot_u_row.end() == l_pivot_iter || (l_row.end() != l_iter && l_iter->first < l_pivot_iter->first))
+                    {
+                        l_new_row.push_back(*l_iter);
+                        ++l_iter;
+                    }
+                    else if(l_row.end() == l_iter || l_pivot_iter->first < l_iter->first)
+                    {
+                        l_new_row.push_back(std::pair<unsigned int, COEF_TYPE>(l_pivot_iter->first, -l_l_coef * l_pivot_iter->second));
+                        ++l_pivot_iter;
+                    }
+                    else
+                    {
+                        COEF_TYPE l_value = l_iter->second - l_l_coef * l_pivot_iter->second;
+                        if(COEF_TYPE(0) != l_value)
+                        {
+                            l_new_row.push_back(std::pair<unsigned int, COEF_TYPE>(l_iter->first, l_value));
+                        }
+                        ++l_iter;
+                        ++l_pivot_iter;
+                    }
+                }
+                l_row.swap(l_new_row);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::ftran(std::vector<COEF_TYPE> & p_vector) const
+    {
+        assert(p_vector.size() == m_size);
+        // Apply permutation: L U x = P a
+        std::vector<COEF_TYPE> l_permuted(m_size);
+        for(unsigned int l_index = 0; l_index < m_size; ++l_index)
+        {
+            l_permuted[l_index] = p_vector[m_permutation[l_index]];
+        }
+        // Forward substitution with unit lower triangular L
+        for(unsigned int l_row_index = 1; l_row_index < m_size; ++l_row_index)
+        {
+            COEF_TYPE l_sum = l_permuted[l_row_index];
+            for(const auto & l_coef: m_l_rows[l_row_index])
+            {
+                if(COEF_TYPE(0) != l_permuted[l_coef.first])
+                {
+                    l_sum = l_sum - l_coef.second * l_permuted[l_coef.first];
+                }
+            }
+            l_permuted[l_row_index] = l_sum;
+        }
+        // Backward substitution with U
+        for(unsigned int l_row_index = m_size; l_row_index > 0; --l_row_index)
+        {
+            unsigned int l_row = l_row_index - 1;
+            const t_sparse_row & l_u_row = m_u_rows[l_row];
+            COEF_TYPE l_sum = l_permuted[l_row];
+            for(auto l_iter = l_u_row.begin() + 1; l_u_row.end() != l_iter; ++l_iter)
+            {
+                if(COEF_TYPE(0) != l_permuted[l_iter->first])
+                {
+                    l_sum = l_sum - l_iter->second * l_permuted[l_iter->first];
+                }
+            }
+            l_permuted[l_row] = l_sum / l_u_row.front().second;
+        }
+        p_vector.swap(l_permuted);
+
+        // Apply eta matrices in order of creation
+        for(const auto & l_eta: m_etas)
+        {
+            COEF_TYPE & l_pivot_value = p_vector[l_eta.m_column_index];
+            if(COEF_TYPE(0) == l_pivot_value)
+            {
+                continue;
+            }
+            l_pivot_value = l_pivot_value / l_eta.m_pivot;
+            for(const auto & l_iter: l_eta.m_coefs)
+            {
+                p_vector[l_iter.first] = p_vector[l_iter.first] - l_iter.second * l_pivot_value;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::btran(std::vector<COEF_TYPE> & p_vector) const
+    {
+        assert(p_vector.size() == m_size);
+        // Apply eta matrices in reverse order of creation
+        for(auto l_iter = m_etas.rbegin(); l_iter != m_etas.rend(); ++l_iter)
+        {
+            COEF_TYPE l_sum = p_vector[l_iter->m_column_index];
+            for(const auto & l_coef: l_iter->m_coefs)
+            {
+                if(COEF_TYPE(0) != p_vector[l_coef.first])
+                {
+                    l_sum = l_sum - l_coef.second * p_vector[l_coef.first];
+                }
+            }
+            p_vector[l_iter->m_column_index] = l_sum / l_iter->m_pivot;
+        }
+
+        // Solve U^T s = w: once s[i] is known it is removed from following
+        // components using row i of U
+        for(unsigned int l_row_index = 0; l_row_index < m_size; ++l_row_index)
+        {
+            const t_sparse_row & l_u_row = m_u_rows[l_row_index];
+            COEF_TYPE & l_value = p_vector[l_row_index];
+            l_value = l_value / l_u_row.front().second;
+            if(COEF_TYPE(0) == l_value)
+            {
+                continue;
+            }
+            for(auto l_iter = l_u_row.begin() + 1; l_u_row.end() != l_iter; ++l_iter)
+            {
+                p_vector[l_iter->first] = p_vector[l_iter->first] - l_iter->second * l_value;
+            }
+        }
+        // Solve L^T t = s in the same way from last row of L
+        for(unsigned int l_row_index = m_size; l_row_index > 0; --l_row_index)
+        {
+            const COEF_TYPE l_value = p_vector[l_row_index - 1];
+            if(COEF_TYPE(0) == l_value)
+            {
+                continue;
+            }
+            for(const auto & l_coef: m_l_rows[l_row_index - 1])
+            {
+                p_vector[l_coef.first] = p_vector[l_coef.first] - l_coef.second * l_value;
+            }
+        }
+        // Undo permutation: y = P^T t
+        std::vector<COEF_TYPE> l_result(m_size);
+        for(unsigned int l_index = 0; l_index < m_size; ++l_index)
+        {
+            l_result[m_permutation[l_index]] = p_vector[l_index];
+        }
+        p_vector.swap(l_result);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_basis_factorization<COEF_TYPE>::update(unsigned int p_column_index
+                                                  ,const std::vector<COEF_TYPE> & p_ftran_column
+                                                  )
+    {
+        assert(p_column_index < m_size);
+        assert(p_ftran_column.size() == m_size);
+        assert(COEF_TYPE(0) != p_ftran_column[p_column_index]);
+        m_etas.push_back(eta(p_column_index, p_ftran_column[p_column_index]));
+        eta & l_eta = m_etas.back();
+        for(unsigned int l_index = 0; l_index < m_size; ++l_index)
+        {
+            if(l_index != p_column_index && COEF_TYPE(0) != p_ftran_column[l_index])
+            {
+                l_eta.m_coefs.push_back(std::pair<unsigned int, COEF_TYPE>(l_index, p_ftran_column[l_index]));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_basis_factorization<COEF_TYPE>::need_refactorization() const
+    {
+        return m_etas.size() >= m_refactorization_period;
+    }
+
+}
+#endif //SIMPLEX_BASIS_FACTORIZATION_H
+// EOF
@@ -0,0 +1,206 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_BASIS_FILE_H
+#define SIMPLEX_BASIS_FILE_H
+
+#include "quicky_exception.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <limits>
+
+namespace simplex
+{
+    /**
+     * Binary storage of a basis returned by get_basis so that a search can
+     * restart from it in another process.
+     * Format is the 4 bytes "SPXB", a version byte, then number of equations
+     * followed by base variable index of each equation. Integers are stored
+     * with 7 bits per byte, high bit indicating that another byte follows,
+     * so that small indexes use a single byte. Base variable index is
+     * stored plus one, 0 meaning that equation has no base variable
+     */
+    class simplex_basis_file
+    {
+      public:
+        /**
+         * Write basis in stream
+         * @param p_stream binary output stream
+         * @param p_basis index of base variable of each equation
+         */
+        inline static
+        void write(std::ostream & p_stream
+                  ,const std::vector<unsigned int> & p_basis
+                  );
+
+        /**
+         * Read basis from stream
+         * @param p_stream binary input stream
+         * @return index of base variable of each equation
+         */
+        inline static
+        std::vector<unsigned int> read(std::istream & p_stream);
+
+        /**
+         * Write basis in file
+         * @param p_file_name name of file
+         * @param p_basis index of base variable of each equation
+         */
+        inline static
+        void save(const std::string & p_file_name
+                 ,const std::vector<unsigned int> & p_basis
+                 );
+
+        /**
+         * Read basis from file
+         * @param p_file_name name of file
+         * @return index of base variable of each equation
+         */
+        inline static
+        std::vector<unsigned int> load(const std::string & p_file_name);
+
+      private:
+        inline static
+        void write_integer(std::ostream & p_stream
+                          ,unsigned long long p_value
+                          );
+
+        inline static
+        unsigned long long read_integer(std::istream & p_stream);
+
+        static const unsigned char m_version = 1;
+    };
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_basis_file::write(std::ostream & p_stream
+                             ,const std::vector<unsigned int> & p_basis
+                             )
+    {
+        p_stream.write("SPXB", 4);
+        p_stream.put((char)m_version);
+        write_integer(p_stream, p_basis.size());
+        for(auto l_variable_index: p_basis)
+        {
+            write_integer(p_stream, std::numeric_limits<unsigned int>::max() == l_variable_index ? 0 : 1ull + l_variable_index);
+        }
+        if(!p_stream)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to write basis", __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<unsigned int>
+    simplex_basis_file::read(std::istream & p_stream)
+    {
+        char l_magic[4];
+        p_stream.read(l_magic, 4);
+        if(!p_stream || std::string(l_magic, 4) != "SPXB")
+        {
+            throw quicky_exception::quicky_runtime_exception("Stream does not contain a basis", __LINE__, __FILE__);
+        }
+        int l_version = p_stream.get();
+        if(m_version != l_version)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unsupported basis format version " + std::to_string(l_version), __LINE__, __FILE__);
+        }
+        unsigned long long l_size = read_integer(p_stream);
+        if(l_size > std::numeric_limits<unsigned int>::max())
+        {
+            throw quicky_exception::quicky_runtime_exception("Invalid number of equations in basis", __LINE__, __FILE__);
+        }
+        // Size is not trusted to reserve memory as a corrupted header would
+        // allocate a huge vector before truncation is detected
+        std::vector<unsigned int> l_basis;
+        for(unsigned long long l_index = 0; l_index < l_size; ++l_index)
+        {
+            unsigned long long l_value = read_integer(p_stream);
+            if(l_value > std::numeric_limits<unsigned int>::max())
+            {
+                throw quicky_exception::quicky_runtime_exception("Invalid variable index in basis", __LINE__, __FILE__);
+            }
+            l_basis.push_back(l_value ? (unsigned int)(l_value - 1) : std::numeric_limits<unsigned int>::max());
+        }
+        return l_basis;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_basis_file::save(const std::string & p_file_name
+                            ,const std::vector<unsigned int> & p_basis
+                            )
+    {
+        std::ofstream l_file(p_file_name, std::ios::binary);
+        if(!l_file)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to create basis file \"" + p_file_name + "\"", __LINE__, __FILE__);
+        }
+        write(l_file, p_basis);
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<unsigned int>
+    simplex_basis_file::load(const std::string & p_file_name)
+    {
+        std::ifstream l_file(p_file_name, std::ios::binary);
+        if(!l_file)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to open basis file \"" + p_file_name + "\"", __LINE__, __FILE__);
+        }
+        return read(l_file);
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_basis_file::write_integer(std::ostream & p_stream
+                                     ,unsigned long long p_value
+                                     )
+    {
+        while(p_value >= 0x80)
+        {
+            p_stream.put((char)(0x80 | (p_value & 0x7F)));
+            p_value >>= 7;
+        }
+        p_stream.put((char)p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    unsigned long long
+    simplex_basis_file::read_integer(std::istream & p_stream)
+    {
+        unsigned long long l_value = 0;
+        for(unsigned int l_shift = 0; l_shift < 64; l_shift += 7)
+        {
+            int l_byte = p_stream.get();
+            if(std::char_traits<char>::eof() == l_byte)
+            {
+                throw quicky_exception::quicky_runtime_exception("Truncated basis", __LINE__, __FILE__);
+            }
+            l_value |= (unsigned long long)(l_byte & 0x7F) << l_shift;
+            if(!(l_byte & 0x80))
+            {
+                return l_value;
+            }
+        }
+        throw quicky_exception::quicky_runtime_exception("Invalid integer in basis", __LINE__, __FILE__);
+    }
+}
+#endif //SIMPLEX_BASIS_FILE_H
+// EOF
@@ -0,0 +1,211 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_CHECKED_ARITHMETIC_H
+#define SIMPLEX_CHECKED_ARITHMETIC_H
+
+#include "quicky_exception.h"
+#include <ostream>
+#include <string>
+#include <limits>
+#include <type_traits>
+
+// 128 bits integer is only integral for standard library type traits and
+// std::abs when GNU extensions are enabled
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__)
+#define SIMPLEX_INT128
+#endif // __SIZEOF_INT128__ && !__STRICT_ANSI__
+
+namespace simplex
+{
+#ifdef SIMPLEX_INT128
+    /**
+     * 128 bits integer provided by GCC and Clang, __extension__ avoids
+     * pedantic warnings
+     */
+    __extension__ typedef __int128 simplex_int128;
+#endif // SIMPLEX_INT128
+
+    /**
+     * Exception thrown when an integer operation does not fit in
+     * coefficient type
+     */
+    class simplex_overflow_exception: public quicky_exception::quicky_runtime_exception
+    {
+      public:
+        inline
+        simplex_overflow_exception(const std::string & p_message
+                                  ,unsigned int p_line
+                                  ,const std::string & p_file
+                                  );
+    };
+
+    /**
+     * Compute p_a * p_b - p_c * p_d and throw simplex_overflow_exception if
+     * any intermediate result does not fit in coefficient type
+     * @tparam COEF_TYPE signed integer type
+     * @return p_a * p_b - p_c * p_d
+     */
+    template <typename COEF_TYPE>
+    inline
+    COEF_TYPE
+    checked_mul_sub(const COEF_TYPE & p_a
+                   ,const COEF_TYPE & p_b
+                   ,const COEF_TYPE & p_c
+                   ,const COEF_TYPE & p_d
+                   );
+
+    /**
+     * Compute p_a * p_b and throw simplex_overflow_exception if result does
+     * not fit in coefficient type
+     * @tparam COEF_TYPE signed integer type
+     * @return p_a * p_b
+     */
+    template <typename COEF_TYPE>
+    inline
+    COEF_TYPE
+    checked_mul(const COEF_TYPE & p_a
+               ,const COEF_TYPE & p_b
+               );
+
+    /**
+     * Compute p_a - p_b and throw simplex_overflow_exception if result does
+     * not fit in coefficient type
+     * @tparam COEF_TYPE signed integer type
+     * @return p_a - p_b
+     */
+    template <typename COEF_TYPE>
+    inline
+    COEF_TYPE
+    checked_sub(const COEF_TYPE & p_a
+               ,const COEF_TYPE & p_b
+               );
+
+#ifdef SIMPLEX_INT128
+    /**
+     * Display 128 bits integer as standard streams do not support it
+     * @param p_stream stream where display is done
+     * @param p_value value to display
+     * @return modified stream
+     */
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const simplex_int128 & p_value
+              );
+#endif // SIMPLEX_INT128
+
+    //-------------------------------------------------------------------------
+    simplex_overflow_exception::simplex_overflow_exception(const std::string & p_message
+                                                          ,unsigned int p_line
+                                                          ,const std::string & p_file
+                                                          )
+    :quicky_exception::quicky_runtime_exception(p_message, p_line, p_file)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    checked_mul(const COEF_TYPE & p_a
+               ,const COEF_TYPE & p_b
+               )
+    {
+        static_assert(std::is_integral<COEF_TYPE>::value && std::is_signed<COEF_TYPE>::value, "Checked arithmetic accept only signed integer types");
+        COEF_TYPE l_result;
+#if defined(__GNUC__)
+        if(__builtin_mul_overflow(p_a, p_b, &l_result))
+#else // __GNUC__
+        if(p_a && p_b &&
+           ((p_a > 0) == (p_b > 0) ?
+            (p_a > 0 ? p_a > std::numeric_limits<COEF_TYPE>::max() / p_b : p_a < std::numeric_limits<COEF_TYPE>::max() / p_b) :
+            (p_a > 0 ? p_b < std::numeric_limits<COEF_TYPE>::min() / p_a : p_a < std::numeric_limits<COEF_TYPE>::min() / p_b)
+           )
+          )
+#endif // __GNUC__
+        {
+            throw simplex_overflow_exception("Integer multiplication overflow", __LINE__, __FILE__);
+        }
+#if !defined(__GNUC__)
+        l_result = p_a * p_b;
+#endif // __GNUC__
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    checked_sub(const COEF_TYPE & p_a
+               ,const COEF_TYPE & p_b
+               )
+    {
+        static_assert(std::is_integral<COEF_TYPE>::value && std::is_signed<COEF_TYPE>::value, "Checked arithmetic accept only signed integer types");
+        COEF_TYPE l_result;
+#if defined(__GNUC__)
+        if(__builtin_sub_overflow(p_a, p_b, &l_result))
+#else // __GNUC__
+        if(p_b > 0 ? p_a < std::numeric_limits<COEF_TYPE>::min() + p_b : p_a > std::numeric_limits<COEF_TYPE>::max() + p_b)
+#endif // __GNUC__
+        {
+            throw simplex_overflow_exception("Integer subtraction overflow", __LINE__, __FILE__);
+        }
+#if !defined(__GNUC__)
+        l_result = p_a - p_b;
+#endif // __GNUC__
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    checked_mul_sub(const COEF_TYPE & p_a
+                   ,const COEF_TYPE & p_b
+                   ,const COEF_TYPE & p_c
+                   ,const COEF_TYPE & p_d
+                   )
+    {
+        return checked_sub(checked_mul(p_a, p_b), checked_mul(p_c, p_d));
+    }
+
+#ifdef SIMPLEX_INT128
+    //-------------------------------------------------------------------------
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const simplex_int128 & p_value
+              )
+    {
+        // Digits are extracted from negative value as its range is larger
+        simplex_int128 l_value = p_value < 0 ? p_value : -p_value;
+        char l_digits[41];
+        unsigned int l_index = sizeof(l_digits);
+        do
+        {
+            l_digits[--l_index] = (char)('0' - (int)(l_value % 10));
+            l_value /= 10;
+        }
+        while(l_value);
+        if(p_value < 0)
+        {
+            l_digits[--l_index] = '-';
+        }
+        return p_stream << std::string(l_digits + l_index, sizeof(l_digits) - l_index);
+    }
+#endif // SIMPLEX_INT128
+}
+
+#endif //SIMPLEX_CHECKED_ARITHMETIC_H
+// EOF
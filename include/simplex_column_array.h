@@ -0,0 +1,577 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_COLUMN_ARRAY_H
+#define SIMPLEX_COLUMN_ARRAY_H
+
+#include "simplex_array_base.h"
+#include "simplex_allocator.h"
+#include <memory>
+#include <algorithm>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Dense column-major storage of simplex tableau. Coefficients of a
+     * column are contiguous so ratio tests, column scans and pivots walk
+     * memory sequentially, which is faster than row-major storage on
+     * tableaus with much more rows than columns. Columns start on a cache
+     * line and are padded to a multiple of cache line size
+     * @tparam COEF_TYPE Type of coefficients
+     * @tparam ALLOCATOR Allocator of coefficients, should return memory
+     * aligned on a cache line
+     */
+    template <typename COEF_TYPE, typename ALLOCATOR=simplex_aligned_allocator<COEF_TYPE>>
+    class simplex_column_array: public simplex_array_base<COEF_TYPE>
+    {
+      public:
+        inline
+        simplex_column_array(const unsigned int & p_nb_equations
+                            ,const unsigned int & p_nb_variables
+                            ,const ALLOCATOR & p_allocator = ALLOCATOR()
+                            );
+
+        simplex_column_array(const simplex_column_array &) = delete;
+
+        simplex_column_array &
+        operator=(const simplex_column_array &) = delete;
+
+        /**
+         * Define coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @return value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        const COEF_TYPE &
+        get_Z_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient Z0 for objective function
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z0_coef(const COEF_TYPE & p_value);
+
+        /**
+         * Return coefficient Z0 for objective function
+         * @return value of Z0 coefficient
+         */
+        inline
+        const COEF_TYPE &
+        get_Z0_coef() const;
+
+        /**
+         * Define coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @param value : value of coefficient in b
+         */
+        inline
+        void set_B_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @return value of coefficient in b
+         */
+        inline
+        const COEF_TYPE &
+        get_B_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param value : value of coefficient in A
+         */
+        inline
+        void set_A_coef(const unsigned int p_equation_index
+                       ,const unsigned int p_variable_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @return value : value of coefficient in A
+         */
+        inline
+        const COEF_TYPE &
+        get_A_coef(const unsigned int p_equation_index
+                  ,const unsigned int p_variable_index
+                  ) const;
+
+        /**
+         * Return pointer on contiguous A coefficients of a variable
+         * @param p_variable_index : the value should be less than number of variables
+         * @return pointer on coefficient of first equation
+         */
+        inline
+        COEF_TYPE *
+        get_column(const unsigned int p_variable_index);
+
+        /**
+         * Return pointer on contiguous A coefficients of a variable
+         * @param p_variable_index : the value should be less than number of variables
+         * @return pointer on coefficient of first equation
+         */
+        inline
+        const COEF_TYPE *
+        get_column(const unsigned int p_variable_index) const;
+
+        /**
+         * Return pointer on contiguous coefficients of objective function
+         * @return pointer on first Z coefficient
+         */
+        inline
+        COEF_TYPE *
+        get_Z_row();
+
+        /**
+         * Return pointer on contiguous B coefficients
+         * @return pointer on first B coefficient
+         */
+        inline
+        COEF_TYPE *
+        get_B_column();
+
+        /**
+         * Append null columns after existing ones. Storage grows
+         * geometrically so that successive additions have an amortized cost
+         * @param p_nb_variables : number of columns to add
+         */
+        inline
+        void add_variables(const unsigned int & p_nb_variables);
+
+        /**
+         * Insert null columns, following columns are shifted
+         * @param p_variable_index : index of first inserted column, should
+         * be less or equal than number of variables
+         * @param p_nb_variables : number of columns to insert
+         */
+        inline
+        void insert_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Append null rows after existing ones. Storage grows geometrically
+         * so that successive additions have an amortized cost
+         * @param p_nb_equations : number of rows to add
+         */
+        inline
+        void add_equations(const unsigned int & p_nb_equations);
+
+        /**
+         * Remove columns, following columns are shifted. Storage is kept
+         * for later insertions
+         * @param p_variable_index : index of first removed column
+         * @param p_nb_variables : number of columns to remove
+         */
+        inline
+        void remove_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Remove last rows. Storage is kept for later additions
+         * @param p_nb_equations : number of rows to remove
+         */
+        inline
+        void remove_equations(const unsigned int & p_nb_equations);
+
+        inline
+        ~simplex_column_array();
+
+      private:
+        /**
+         * Allocate null coefficients
+         * @param p_size : number of coefficients
+         * @return pointer on first coefficient
+         */
+        inline
+        COEF_TYPE *
+        allocate_coefs(const size_t & p_size);
+
+        /**
+         * Destroy and free coefficients returned by allocate_coefs
+         * @param p_coefs : pointer on first coefficient
+         * @param p_size : number of coefficients
+         */
+        inline
+        void release_coefs(COEF_TYPE * p_coefs
+                          ,const size_t & p_size
+                          );
+
+        /**
+         * Allocator of coefficients
+         */
+        ALLOCATOR m_allocator;
+
+        /**
+         * Number of coefficients allocated for each column, a column starts
+         * m_equation_capacity coefficients after the previous one
+         */
+        unsigned int m_equation_capacity;
+
+        /**
+         * Number of columns that can be stored without reallocation
+         */
+        unsigned int m_variable_capacity;
+
+        /**
+         * Matrix A coefficients in Ax = b stored column by column
+         */
+        COEF_TYPE * m_variable_coefs;
+
+        /**
+         * b coefficients in Ax = b
+         */
+        COEF_TYPE * m_b_coefs;
+
+        /**
+         * Coefficients of objective function in the form Z - SUM(Cj * X) = 0
+         */
+        COEF_TYPE * m_z_coefs;
+
+        /**
+         * Z0 coefficient
+         */
+        COEF_TYPE m_z0;
+    };
+
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    class simplex_array_traits<simplex_column_array<COEF_TYPE,ALLOCATOR>>
+    {
+      public:
+        static const bool m_contiguous_rows = false;
+        static const bool m_contiguous_columns = true;
+        static const bool m_concurrent_row_update = false;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::simplex_column_array(const unsigned int & p_nb_equations
+                                                                   ,const unsigned int & p_nb_variables
+                                                                   ,const ALLOCATOR & p_allocator
+                                                                   )
+    :simplex_array_base<COEF_TYPE>(p_nb_equations, p_nb_variables)
+    ,m_allocator(p_allocator)
+    ,m_equation_capacity(simplex_cache_line_padded_size<COEF_TYPE>(p_nb_equations))
+    ,m_variable_capacity(p_nb_variables)
+    ,m_variable_coefs(allocate_coefs((size_t)m_equation_capacity * p_nb_variables))
+    ,m_b_coefs(allocate_coefs(m_equation_capacity))
+    ,m_z_coefs(allocate_coefs(p_nb_variables))
+    ,m_z0(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::set_Z_coef(const unsigned int p_index
+                                                         ,const COEF_TYPE & p_value
+                                                         )
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        m_z_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE &
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_Z_coef(const unsigned int p_index) const
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_z_coefs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::set_Z0_coef(const COEF_TYPE & p_value)
+    {
+        m_z0 = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE &
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_Z0_coef() const
+    {
+        return m_z0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::set_B_coef(const unsigned int p_index
+                                                         ,const COEF_TYPE & p_value
+                                                         )
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        m_b_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE &
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_B_coef(const unsigned int p_index) const
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        return m_b_coefs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::set_A_coef(const unsigned int p_equation_index
+                                                         ,const unsigned int p_variable_index
+                                                         ,const COEF_TYPE & p_value
+                                                         )
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        m_variable_coefs[(size_t)p_variable_index * m_equation_capacity + p_equation_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE &
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_A_coef(const unsigned int p_equation_index
+                                                         ,const unsigned int p_variable_index
+                                                         ) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_variable_coefs[(size_t)p_variable_index * m_equation_capacity + p_equation_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    COEF_TYPE *
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_column(const unsigned int p_variable_index)
+    {
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_variable_coefs + (size_t)p_variable_index * m_equation_capacity;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    const COEF_TYPE *
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_column(const unsigned int p_variable_index) const
+    {
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_variable_coefs + (size_t)p_variable_index * m_equation_capacity;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    COEF_TYPE *
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_Z_row()
+    {
+        return m_z_coefs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    COEF_TYPE *
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::get_B_column()
+    {
+        return m_b_coefs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::add_variables(const unsigned int & p_nb_variables)
+    {
+        insert_variables(this->get_nb_variables(), p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::insert_variables(const unsigned int & p_variable_index
+                                                               ,const unsigned int & p_nb_variables
+                                                               )
+    {
+        unsigned int l_old_nb_variables = this->get_nb_variables();
+        assert(p_variable_index <= l_old_nb_variables);
+        unsigned int l_nb_variables = l_old_nb_variables + p_nb_variables;
+        size_t l_column_size = m_equation_capacity;
+        if(l_nb_variables <= m_variable_capacity)
+        {
+            // Shift following columns, columns after the last one are null
+            std::copy_backward(m_variable_coefs + p_variable_index * l_column_size
+                              ,m_variable_coefs + l_old_nb_variables * l_column_size
+                              ,m_variable_coefs + l_nb_variables * l_column_size
+                              );
+            std::fill(m_variable_coefs + p_variable_index * l_column_size
+                     ,m_variable_coefs + (p_variable_index + p_nb_variables) * l_column_size
+                     ,COEF_TYPE(0)
+                     );
+            std::copy_backward(m_z_coefs + p_variable_index, m_z_coefs + l_old_nb_variables, m_z_coefs + l_nb_variables);
+            std::fill(m_z_coefs + p_variable_index, m_z_coefs + p_variable_index + p_nb_variables, COEF_TYPE(0));
+        }
+        else
+        {
+            unsigned int l_capacity = std::max(l_nb_variables, 2 * m_variable_capacity);
+            COEF_TYPE * l_variable_coefs = allocate_coefs(l_capacity * l_column_size);
+            std::copy(m_variable_coefs, m_variable_coefs + p_variable_index * l_column_size, l_variable_coefs);
+            std::copy(m_variable_coefs + p_variable_index * l_column_size
+                     ,m_variable_coefs + l_old_nb_variables * l_column_size
+                     ,l_variable_coefs + (p_variable_index + p_nb_variables) * l_column_size
+                     );
+            COEF_TYPE * l_z_coefs = allocate_coefs(l_capacity);
+            std::copy(m_z_coefs, m_z_coefs + p_variable_index, l_z_coefs);
+            std::copy(m_z_coefs + p_variable_index, m_z_coefs + l_old_nb_variables, l_z_coefs + p_variable_index + p_nb_variables);
+            release_coefs(m_variable_coefs, m_variable_capacity * l_column_size);
+            m_variable_coefs = l_variable_coefs;
+            release_coefs(m_z_coefs, m_variable_capacity);
+            m_z_coefs = l_z_coefs;
+            m_variable_capacity = l_capacity;
+        }
+        this->set_nb_variables(l_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::add_equations(const unsigned int & p_nb_equations)
+    {
+        unsigned int l_old_nb_equations = this->get_nb_equations();
+        unsigned int l_nb_equations = l_old_nb_equations + p_nb_equations;
+        // Coefficients after the last row are null so only a reallocation
+        // is needed
+        if(l_nb_equations > m_equation_capacity)
+        {
+            unsigned int l_capacity = simplex_cache_line_padded_size<COEF_TYPE>(std::max(l_nb_equations, 2 * m_equation_capacity));
+            COEF_TYPE * l_variable_coefs = allocate_coefs((size_t)l_capacity * m_variable_capacity);
+            for(unsigned int l_variable_index = 0; l_variable_index < this->get_nb_variables(); ++l_variable_index)
+            {
+                const COEF_TYPE * l_column = m_variable_coefs + (size_t)l_variable_index * m_equation_capacity;
+                std::copy(l_column, l_column + l_old_nb_equations, l_variable_coefs + (size_t)l_variable_index * l_capacity);
+            }
+            COEF_TYPE * l_b_coefs = allocate_coefs(l_capacity);
+            std::copy(m_b_coefs, m_b_coefs + l_old_nb_equations, l_b_coefs);
+            release_coefs(m_variable_coefs, (size_t)m_equation_capacity * m_variable_capacity);
+            m_variable_coefs = l_variable_coefs;
+            release_coefs(m_b_coefs, m_equation_capacity);
+            m_b_coefs = l_b_coefs;
+            m_equation_capacity = l_capacity;
+        }
+        this->set_nb_equations(l_nb_equations);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::remove_variables(const unsigned int & p_variable_index
+                                                               ,const unsigned int & p_nb_variables
+                                                               )
+    {
+        unsigned int l_old_nb_variables = this->get_nb_variables();
+        assert(p_variable_index + p_nb_variables <= l_old_nb_variables);
+        size_t l_column_size = m_equation_capacity;
+        // Freed coefficients are set to 0 like the ones never used
+        std::copy(m_variable_coefs + (p_variable_index + p_nb_variables) * l_column_size
+                 ,m_variable_coefs + l_old_nb_variables * l_column_size
+                 ,m_variable_coefs + p_variable_index * l_column_size
+                 );
+        std::fill(m_variable_coefs + (l_old_nb_variables - p_nb_variables) * l_column_size
+                 ,m_variable_coefs + l_old_nb_variables * l_column_size
+                 ,COEF_TYPE(0)
+                 );
+        std::copy(m_z_coefs + p_variable_index + p_nb_variables, m_z_coefs + l_old_nb_variables, m_z_coefs + p_variable_index);
+        std::fill(m_z_coefs + l_old_nb_variables - p_nb_variables, m_z_coefs + l_old_nb_variables, COEF_TYPE(0));
+        this->set_nb_variables(l_old_nb_variables - p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::remove_equations(const unsigned int & p_nb_equations)
+    {
+        unsigned int l_old_nb_equations = this->get_nb_equations();
+        assert(p_nb_equations <= l_old_nb_equations);
+        unsigned int l_nb_equations = l_old_nb_equations - p_nb_equations;
+        // Coefficients after the last row should stay null
+        for(unsigned int l_variable_index = 0; l_variable_index < this->get_nb_variables(); ++l_variable_index)
+        {
+            COEF_TYPE * l_column = m_variable_coefs + (size_t)l_variable_index * m_equation_capacity;
+            std::fill(l_column + l_nb_equations, l_column + l_old_nb_equations, COEF_TYPE(0));
+        }
+        std::fill(m_b_coefs + l_nb_equations, m_b_coefs + l_old_nb_equations, COEF_TYPE(0));
+        this->set_nb_equations(l_nb_equations);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    COEF_TYPE *
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::allocate_coefs(const size_t & p_size)
+    {
+        COEF_TYPE * l_coefs = std::allocator_traits<ALLOCATOR>::allocate(m_allocator, p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            std::allocator_traits<ALLOCATOR>::construct(m_allocator, l_coefs + l_index, COEF_TYPE(0));
+        }
+        return l_coefs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    void
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::release_coefs(COEF_TYPE * p_coefs
+                                                            ,const size_t & p_size
+                                                            )
+    {
+        if(!p_coefs)
+        {
+            return;
+        }
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            std::allocator_traits<ALLOCATOR>::destroy(m_allocator, p_coefs + l_index);
+        }
+        std::allocator_traits<ALLOCATOR>::deallocate(m_allocator, p_coefs, p_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ALLOCATOR>
+    simplex_column_array<COEF_TYPE,ALLOCATOR>::~simplex_column_array()
+    {
+        release_coefs(m_z_coefs, m_variable_capacity);
+        release_coefs(m_b_coefs, m_equation_capacity);
+        release_coefs(m_variable_coefs, (size_t)m_equation_capacity * m_variable_capacity);
+    }
+}
+#endif //SIMPLEX_COLUMN_ARRAY_H
+// EOF
@@ -0,0 +1,104 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_COUNTING_LISTENER_H
+#define SIMPLEX_COUNTING_LISTENER_H
+
+#include "simplex_listener_if.h"
+
+namespace simplex
+{
+    /**
+     * Silent listener only counting the number of pivots done by solver
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_counting_listener: public simplex_listener_if<COEF_TYPE>
+    {
+      public:
+        inline
+        simplex_counting_listener();
+
+        inline
+        void start_iteration(const unsigned int & p_nb_iteration) override;
+
+        inline
+        void new_input_var_event(const unsigned int & p_input_variable_index) override;
+
+        inline
+        void new_output_var_event(const unsigned int & p_output_variable_index) override;
+
+        inline
+        void new_Z0(COEF_TYPE p_z0) override;
+
+        /**
+         * Return number of pivots done since listener creation
+         * @return number of pivots
+         */
+        inline
+        unsigned int get_nb_pivots() const;
+
+      private:
+        unsigned int m_nb_pivots;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_counting_listener<COEF_TYPE>::simplex_counting_listener()
+    :m_nb_pivots(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_counting_listener<COEF_TYPE>::start_iteration(const unsigned int &)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_counting_listener<COEF_TYPE>::new_input_var_event(const unsigned int &)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_counting_listener<COEF_TYPE>::new_output_var_event(const unsigned int &)
+    {
+        ++m_nb_pivots;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_counting_listener<COEF_TYPE>::new_Z0(COEF_TYPE)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_counting_listener<COEF_TYPE>::get_nb_pivots() const
+    {
+        return m_nb_pivots;
+    }
+}
+#endif //SIMPLEX_COUNTING_LISTENER_H
+// EOF
@@ -0,0 +1,713 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_CSR_ARRAY_H
+#define SIMPLEX_CSR_ARRAY_H
+
+#include "simplex_array_base.h"
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Sparse simplex array storing non null A coefficients of each row in
+     * flat arrays of variable indexes and values sorted by variable index.
+     * Each row owns a slice of the flat arrays with some free space to
+     * accept new coefficients created by pivots. When a row slice is full
+     * the row is moved at the end of flat arrays with a bigger capacity.
+     * Space released by moved rows is recovered by a compaction pass when
+     * it exceeds space really used.
+     * B and Z coefficients are stored in dense arrays
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_csr_array: public simplex_array_base<COEF_TYPE>
+    {
+      public:
+        inline
+        simplex_csr_array(const unsigned int & p_nb_equations
+                         ,const unsigned int & p_nb_variables
+                         );
+
+        /**
+         * Define coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @return value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        const COEF_TYPE &
+        get_Z_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient Z0 for objective function
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z0_coef(const COEF_TYPE & p_value);
+
+        /**
+         * Return coefficient Z0 for objective function
+         * @return value of Z0 coefficient
+         */
+        inline
+        const COEF_TYPE &
+        get_Z0_coef() const;
+
+        /**
+         * Define coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @param value : value of coefficient in b
+         */
+        inline
+        void set_B_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @return value of coefficient in b
+         */
+        inline
+        const COEF_TYPE &
+        get_B_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param value : value of coefficient in A
+         */
+        inline
+        void set_A_coef(const unsigned int p_equation_index
+                       ,const unsigned int p_variable_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @return value : value of coefficient in A
+         */
+        inline
+        const COEF_TYPE &
+        get_A_coef(const unsigned int p_equation_index
+                  ,const unsigned int p_variable_index
+                  ) const;
+
+        /**
+         * Return number of non null coefficients stored for a row
+         * @param p_equation_index : the value should be less than total number of equations
+         * @return number of non null coefficients
+         */
+        inline
+        unsigned int
+        get_row_nb_coefs(const unsigned int p_equation_index) const;
+
+        /**
+         * Return variable index of a non null coefficient of a row
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_rank rank of coefficient in row, should be less than row number of coefficients
+         * @return variable index
+         */
+        inline
+        unsigned int
+        get_row_variable_index(const unsigned int p_equation_index
+                              ,const unsigned int p_rank
+                              ) const;
+
+        /**
+         * Return value of a non null coefficient of a row
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_rank rank of coefficient in row, should be less than row number of coefficients
+         * @return coefficient value
+         */
+        inline
+        const COEF_TYPE &
+        get_row_coef(const unsigned int p_equation_index
+                    ,const unsigned int p_rank
+                    ) const;
+
+        /**
+         * Return total number of non null A coefficients
+         * @return number of non null coefficients
+         */
+        inline
+        unsigned int
+        get_nb_coefs() const;
+
+        /**
+         * Return number of slots allocated in flat arrays including
+         * free space of rows and space released by moved rows
+         * @return number of slots
+         */
+        inline
+        unsigned int
+        get_nb_slots() const;
+
+        /**
+         * Pack rows at beginning of flat arrays, keeping free space in each
+         * row, to recover space released by moved rows
+         */
+        inline
+        void compact();
+
+        /**
+         * Append null columns after existing ones
+         * @param p_nb_variables : number of columns to add
+         */
+        inline
+        void add_variables(const unsigned int & p_nb_variables);
+
+        /**
+         * Insert null columns, following columns are shifted
+         * @param p_variable_index : index of first inserted column, should
+         * be less or equal than number of variables
+         * @param p_nb_variables : number of columns to insert
+         */
+        inline
+        void insert_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Append null rows after existing ones. Slices of new rows are
+         * taken at the end of flat arrays
+         * @param p_nb_equations : number of rows to add
+         */
+        inline
+        void add_equations(const unsigned int & p_nb_equations);
+
+        /**
+         * Remove columns, following columns are shifted
+         * @param p_variable_index : index of first removed column
+         * @param p_nb_variables : number of columns to remove
+         */
+        inline
+        void remove_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Remove last rows, their slices are counted as released slots
+         * @param p_nb_equations : number of rows to remove
+         */
+        inline
+        void remove_equations(const unsigned int & p_nb_equations);
+
+      private:
+        /**
+         * Free space given to a row when it is created or moved
+         */
+        static const unsigned int m_min_row_capacity = 4;
+
+        /**
+         * Search position of a variable in row slice
+         * @param p_equation_index equation index
+         * @param p_variable_index variable index
+         * @return absolute position in flat arrays of the first coefficient
+         * whose variable index is not lower than searched one
+         */
+        inline
+        unsigned int
+        find(const unsigned int p_equation_index
+            ,const unsigned int p_variable_index
+            ) const;
+
+        /**
+         * Move row at the end of flat arrays with a bigger capacity
+         * @param p_equation_index equation index
+         */
+        inline
+        void grow_row(const unsigned int p_equation_index);
+
+        /**
+         * Position of first coefficient of each row in flat arrays
+         */
+        std::vector<unsigned int> m_row_starts;
+
+        /**
+         * Number of coefficients of each row
+         */
+        std::vector<unsigned int> m_row_sizes;
+
+        /**
+         * Number of slots owned by each row
+         */
+        std::vector<unsigned int> m_row_capacities;
+
+        /**
+         * Rank in each row of the coefficient found by last search. Rank is
+         * preserved when row is moved and stays valid when a coefficient is
+         * inserted or removed at this rank
+         */
+        mutable std::vector<unsigned int> m_row_cursors;
+
+        /**
+         * Variable index of coefficients
+         */
+        std::vector<unsigned int> m_variable_indexes;
+
+        /**
+         * Value of coefficients
+         */
+        std::vector<COEF_TYPE> m_values;
+
+        /**
+         * Number of slots released by moved rows
+         */
+        unsigned int m_nb_released_slots;
+
+        /**
+         * b coefficients in Ax = b
+         */
+        std::vector<COEF_TYPE> m_b_coefs;
+
+        /**
+         * Coefficients of objective function in the form Z - SUM(Cj * X) = 0
+         */
+        std::vector<COEF_TYPE> m_z_coefs;
+
+        /**
+         * Z0 coefficient
+         */
+        COEF_TYPE m_z0;
+
+        /**
+         * Value returned for coefficients not stored
+         */
+        COEF_TYPE m_zero;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const unsigned int simplex_csr_array<COEF_TYPE>::m_min_row_capacity;
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_csr_array<COEF_TYPE>::simplex_csr_array(const unsigned int & p_nb_equations
+                                                   ,const unsigned int & p_nb_variables
+                                                   )
+    :simplex_array_base<COEF_TYPE>(p_nb_equations, p_nb_variables)
+    ,m_row_starts(p_nb_equations)
+    ,m_row_sizes(p_nb_equations, 0)
+    ,m_row_capacities(p_nb_equations, m_min_row_capacity)
+    ,m_row_cursors(p_nb_equations, 0)
+    ,m_variable_indexes(p_nb_equations * m_min_row_capacity)
+    ,m_values(p_nb_equations * m_min_row_capacity)
+    ,m_nb_released_slots(0)
+    ,m_b_coefs(p_nb_equations, COEF_TYPE(0))
+    ,m_z_coefs(p_nb_variables, COEF_TYPE(0))
+    ,m_z0(0)
+    ,m_zero(0)
+    {
+        for(unsigned int l_index = 0; l_index < p_nb_equations; ++l_index)
+        {
+            m_row_starts[l_index] = l_index * m_min_row_capacity;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::set_Z_coef(const unsigned int p_index
+                                            ,const COEF_TYPE & p_value
+                                            )
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        m_z_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const COEF_TYPE &
+    simplex_csr_array<COEF_TYPE>::get_Z_coef(const unsigned int p_index) const
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_z_coefs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::set_Z0_coef(const COEF_TYPE & p_value)
+    {
+        m_z0 = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const COEF_TYPE &
+    simplex_csr_array<COEF_TYPE>::get_Z0_coef() const
+    {
+        return m_z0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::set_B_coef(const unsigned int p_index
+                                            ,const COEF_TYPE & p_value
+                                            )
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        m_b_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const COEF_TYPE &
+    simplex_csr_array<COEF_TYPE>::get_B_coef(const unsigned int p_index) const
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        return m_b_coefs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_csr_array<COEF_TYPE>::find(const unsigned int p_equation_index
+                                      ,const unsigned int p_variable_index
+                                      ) const
+    {
+        unsigned int l_start = m_row_starts[p_equation_index];
+        unsigned int l_size = m_row_sizes[p_equation_index];
+        unsigned int l_rank = m_row_cursors[p_equation_index];
+        if(l_rank > l_size || (l_rank && m_variable_indexes[l_start + l_rank - 1] >= p_variable_index))
+        {
+            // Searched variable is before cursor
+            l_rank = 0;
+        }
+        else
+        {
+            // Columns are often accessed in increasing order so look at
+            // coefficients following cursor before doing a binary search
+            unsigned int l_nb_steps = 0;
+            while(l_rank < l_size && m_variable_indexes[l_start + l_rank] < p_variable_index && l_nb_steps < 4)
+            {
+                ++l_rank;
+                ++l_nb_steps;
+            }
+        }
+        if(l_rank < l_size && m_variable_indexes[l_start + l_rank] < p_variable_index)
+        {
+            std::vector<unsigned int>::const_iterator l_begin = m_variable_indexes.begin() + l_start;
+            l_rank = std::lower_bound(l_begin + l_rank, l_begin + l_size, p_variable_index) - l_begin;
+        }
+        m_row_cursors[p_equation_index] = l_rank;
+        return l_start + l_rank;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::set_A_coef(const unsigned int p_equation_index
+                                            ,const unsigned int p_variable_index
+                                            ,const COEF_TYPE & p_value
+                                            )
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        unsigned int l_position = find(p_equation_index, p_variable_index);
+        unsigned int l_row_end = m_row_starts[p_equation_index] + m_row_sizes[p_equation_index];
+        if(l_position < l_row_end && m_variable_indexes[l_position] == p_variable_index)
+        {
+            if(p_value)
+            {
+                m_values[l_position] = p_value;
+            }
+            else
+            {
+                // Remove coefficient by shifting end of row
+                std::copy(m_variable_indexes.begin() + l_position + 1, m_variable_indexes.begin() + l_row_end, m_variable_indexes.begin() + l_position);
+                std::copy(m_values.begin() + l_position + 1, m_values.begin() + l_row_end, m_values.begin() + l_position);
+                --m_row_sizes[p_equation_index];
+            }
+            return;
+        }
+        if(!p_value)
+        {
+            return;
+        }
+        if(m_row_sizes[p_equation_index] == m_row_capacities[p_equation_index])
+        {
+            unsigned int l_rank = l_position - m_row_starts[p_equation_index];
+            grow_row(p_equation_index);
+            l_position = m_row_starts[p_equation_index] + l_rank;
+            l_row_end = m_row_starts[p_equation_index] + m_row_sizes[p_equation_index];
+        }
+        // Insert coefficient by shifting end of row
+        std::copy_backward(m_variable_indexes.begin() + l_position, m_variable_indexes.begin() + l_row_end, m_variable_indexes.begin() + l_row_end + 1);
+        std::copy_backward(m_values.begin() + l_position, m_values.begin() + l_row_end, m_values.begin() + l_row_end + 1);
+        m_variable_indexes[l_position] = p_variable_index;
+        m_values[l_position] = p_value;
+        ++m_row_sizes[p_equation_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const COEF_TYPE &
+    simplex_csr_array<COEF_TYPE>::get_A_coef(const unsigned int p_equation_index
+                                            ,const unsigned int p_variable_index
+                                            ) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        unsigned int l_position = find(p_equation_index, p_variable_index);
+        if(l_position < m_row_starts[p_equation_index] + m_row_sizes[p_equation_index] && m_variable_indexes[l_position] == p_variable_index)
+        {
+            return m_values[l_position];
+        }
+        return m_zero;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_csr_array<COEF_TYPE>::get_row_nb_coefs(const unsigned int p_equation_index) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        return m_row_sizes[p_equation_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_csr_array<COEF_TYPE>::get_row_variable_index(const unsigned int p_equation_index
+                                                        ,const unsigned int p_rank
+                                                        ) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_rank < m_row_sizes[p_equation_index]);
+        return m_variable_indexes[m_row_starts[p_equation_index] + p_rank];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const COEF_TYPE &
+    simplex_csr_array<COEF_TYPE>::get_row_coef(const unsigned int p_equation_index
+                                              ,const unsigned int p_rank
+                                              ) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_rank < m_row_sizes[p_equation_index]);
+        return m_values[m_row_starts[p_equation_index] + p_rank];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_csr_array<COEF_TYPE>::get_nb_coefs() const
+    {
+        unsigned int l_result = 0;
+        for(auto l_size: m_row_sizes)
+        {
+            l_result += l_size;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_csr_array<COEF_TYPE>::get_nb_slots() const
+    {
+        return m_variable_indexes.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::grow_row(const unsigned int p_equation_index)
+    {
+        unsigned int l_size = m_row_sizes[p_equation_index];
+        unsigned int l_capacity = m_row_capacities[p_equation_index];
+        unsigned int l_new_capacity = std::max(2 * l_capacity, m_min_row_capacity);
+
+        // Recover released space before allocating a new slice if it would
+        // become bigger than space really owned by rows
+        if(m_nb_released_slots + l_capacity > m_variable_indexes.size() - m_nb_released_slots - l_capacity)
+        {
+            // Row slice will be released so compaction does not need to keep its free space
+            m_row_capacities[p_equation_index] = l_size;
+            compact();
+        }
+        unsigned int l_old_start = m_row_starts[p_equation_index];
+        m_nb_released_slots += m_row_capacities[p_equation_index];
+
+        unsigned int l_new_start = m_variable_indexes.size();
+        m_variable_indexes.resize(l_new_start + l_new_capacity);
+        m_values.resize(l_new_start + l_new_capacity);
+        std::copy(m_variable_indexes.begin() + l_old_start, m_variable_indexes.begin() + l_old_start + l_size, m_variable_indexes.begin() + l_new_start);
+        std::copy(m_values.begin() + l_old_start, m_values.begin() + l_old_start + l_size, m_values.begin() + l_new_start);
+        m_row_starts[p_equation_index] = l_new_start;
+        m_row_capacities[p_equation_index] = l_new_capacity;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::compact()
+    {
+        // Rows are packed in the order of their position in flat arrays
+        std::vector<unsigned int> l_order(m_row_starts.size());
+        for(unsigned int l_index = 0; l_index < l_order.size(); ++l_index)
+        {
+            l_order[l_index] = l_index;
+        }
+        std::sort(l_order.begin()
+                 ,l_order.end()
+                 ,[&](unsigned int p_first, unsigned int p_second)
+                  {
+                      return m_row_starts[p_first] < m_row_starts[p_second];
+                  }
+                 );
+        unsigned int l_position = 0;
+        for(auto l_row_index: l_order)
+        {
+            unsigned int l_start = m_row_starts[l_row_index];
+            unsigned int l_size = m_row_sizes[l_row_index];
+            assert(l_position <= l_start);
+            std::copy(m_variable_indexes.begin() + l_start, m_variable_indexes.begin() + l_start + l_size, m_variable_indexes.begin() + l_position);
+            std::copy(m_values.begin() + l_start, m_values.begin() + l_start + l_size, m_values.begin() + l_position);
+            m_row_starts[l_row_index] = l_position;
+            l_position += m_row_capacities[l_row_index];
+        }
+        m_variable_indexes.resize(l_position);
+        m_values.resize(l_position);
+        m_nb_released_slots = 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::add_variables(const unsigned int & p_nb_variables)
+    {
+        m_z_coefs.resize(this->get_nb_variables() + p_nb_variables, COEF_TYPE(0));
+        this->set_nb_variables(this->get_nb_variables() + p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::insert_variables(const unsigned int & p_variable_index
+                                                  ,const unsigned int & p_nb_variables
+                                                  )
+    {
+        assert(p_variable_index <= this->get_nb_variables());
+        // Rows are sorted by variable index so shifting indexes keeps order
+        for(unsigned int l_row_index = 0; l_row_index < m_row_starts.size(); ++l_row_index)
+        {
+            unsigned int l_start = m_row_starts[l_row_index];
+            for(unsigned int l_position = l_start + m_row_sizes[l_row_index];
+                l_position > l_start && m_variable_indexes[l_position - 1] >= p_variable_index;
+                --l_position
+               )
+            {
+                m_variable_indexes[l_position - 1] += p_nb_variables;
+            }
+        }
+        m_z_coefs.insert(m_z_coefs.begin() + p_variable_index, p_nb_variables, COEF_TYPE(0));
+        this->set_nb_variables(this->get_nb_variables() + p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::add_equations(const unsigned int & p_nb_equations)
+    {
+        for(unsigned int l_index = 0; l_index < p_nb_equations; ++l_index)
+        {
+            m_row_starts.push_back(m_variable_indexes.size());
+            m_row_sizes.push_back(0);
+            m_row_capacities.push_back(m_min_row_capacity);
+            m_row_cursors.push_back(0);
+            m_variable_indexes.resize(m_variable_indexes.size() + m_min_row_capacity);
+            m_values.resize(m_values.size() + m_min_row_capacity);
+            m_b_coefs.push_back(COEF_TYPE(0));
+        }
+        this->set_nb_equations(this->get_nb_equations() + p_nb_equations);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::remove_variables(const unsigned int & p_variable_index
+                                                  ,const unsigned int & p_nb_variables
+                                                  )
+    {
+        assert(p_variable_index + p_nb_variables <= this->get_nb_variables());
+        unsigned int l_end_index = p_variable_index + p_nb_variables;
+        for(unsigned int l_row_index = 0; l_row_index < m_row_starts.size(); ++l_row_index)
+        {
+            unsigned int l_start = m_row_starts[l_row_index];
+            unsigned int l_end = l_start + m_row_sizes[l_row_index];
+            unsigned int l_destination = l_start;
+            for(unsigned int l_position = l_start; l_position < l_end; ++l_position)
+            {
+                unsigned int l_variable_index = m_variable_indexes[l_position];
+                if(l_variable_index >= p_variable_index && l_variable_index < l_end_index)
+                {
+                    continue;
+                }
+                m_variable_indexes[l_destination] = l_variable_index < p_variable_index ? l_variable_index : l_variable_index - p_nb_variables;
+                m_values[l_destination] = m_values[l_position];
+                ++l_destination;
+            }
+            if(l_destination != l_end)
+            {
+                m_row_sizes[l_row_index] = l_destination - l_start;
+                m_row_cursors[l_row_index] = 0;
+            }
+        }
+        m_z_coefs.erase(m_z_coefs.begin() + p_variable_index, m_z_coefs.begin() + l_end_index);
+        this->set_nb_variables(this->get_nb_variables() - p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_csr_array<COEF_TYPE>::remove_equations(const unsigned int & p_nb_equations)
+    {
+        assert(p_nb_equations <= this->get_nb_equations());
+        for(unsigned int l_index = 0; l_index < p_nb_equations; ++l_index)
+        {
+            m_nb_released_slots += m_row_capacities.back();
+            m_row_starts.pop_back();
+            m_row_sizes.pop_back();
+            m_row_capacities.pop_back();
+            m_row_cursors.pop_back();
+            m_b_coefs.pop_back();
+        }
+        this->set_nb_equations(this->get_nb_equations() - p_nb_equations);
+    }
+}
+#endif //SIMPLEX_CSR_ARRAY_H
+// EOF
@@ -0,0 +1,63 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_EQUATION_TYPE_H
+#define SIMPLEX_EQUATION_TYPE_H
+
+#include "quicky_exception.h"
+#include <iostream>
+#include <string>
+
+namespace simplex
+{
+    typedef enum class equation_type
+    {
+        UNDEFINED = 0,
+        EQUATION,
+        INEQUATION_LT,
+        INEQUATION_GT
+    } t_equation_type;
+
+    //-------------------------------------------------------------------------
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream,
+               const t_equation_type & p_equation_type
+              )
+    {
+        switch(p_equation_type)
+        {
+            case t_equation_type::UNDEFINED:
+                p_stream << "\"undef\"";
+                break;
+            case t_equation_type::EQUATION:
+                p_stream << "\"=\"";
+                break;
+            case t_equation_type::INEQUATION_LT:
+                p_stream << "\"<=\"";
+                break;
+            case t_equation_type::INEQUATION_GT:
+                p_stream << "\">=\"";
+                break;
+            default:
+                throw quicky_exception::quicky_logic_exception("Unknown equation_type value : "+ std::to_string((unsigned int)p_equation_type),__LINE__,__FILE__);
+        }
+        return p_stream;
+    }
+}
+#endif //SIMPLEX_EQUATION_TYPE_H
+// EOF
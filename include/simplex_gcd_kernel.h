@@ -0,0 +1,367 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_GCD_KERNEL_H
+#define SIMPLEX_GCD_KERNEL_H
+
+#include "simplex_row_kernel.h"
+#include <type_traits>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Kernels computing PGCD of integer rows used to keep coefficients of
+     * integer solvers small. PGCD is computed with binary (Stein) algorithm
+     * after reducing each coefficient modulo current PGCD, computation stops
+     * as soon as odd part of PGCD reaches 1.
+     * Power of two shared by all coefficients is given by lowest bit set in
+     * bitwise OR of the row, as it is the same for a value and its opposite,
+     * OR reduction is vectorized and dispatched at runtime like row kernels
+     * @tparam COEF_TYPE signed integer type
+     */
+    template <typename COEF_TYPE>
+    class simplex_gcd_kernel
+    {
+      public:
+        /**
+         * Compute PGCD of two values
+         * @param p_a first value
+         * @param p_b second value
+         * @return positive PGCD, 0 if both values are null
+         */
+        inline static
+        COEF_TYPE gcd(const COEF_TYPE & p_a
+                     ,const COEF_TYPE & p_b
+                     );
+
+        /**
+         * Compute PGCD of coefficients of a row
+         * @param p_row row coefficients
+         * @param p_size number of coefficients
+         * @param p_gcd PGCD of coefficients stored outside of row, 0 if none
+         * @return positive PGCD, 0 if all coefficients are null
+         */
+        inline static
+        COEF_TYPE row_gcd(const COEF_TYPE * p_row
+                         ,unsigned int p_size
+                         ,const COEF_TYPE & p_gcd = COEF_TYPE(0)
+                         );
+
+        /**
+         * Compute p_row[i] /= p_divider, division is exact
+         * @param p_row row to update
+         * @param p_divider PGCD of row
+         * @param p_size number of coefficients
+         */
+        inline static
+        void divide(COEF_TYPE * p_row
+                   ,const COEF_TYPE & p_divider
+                   ,unsigned int p_size
+                   );
+
+        /**
+         * Return SIMD level used by OR reduction
+         * @return SIMD level
+         */
+        inline static
+        t_simplex_simd_level get_level();
+
+        /**
+         * Force SIMD level used by OR reduction. Level is limited to the
+         * one supported by CPU
+         * @param p_level SIMD level to use
+         * @return SIMD level really used
+         */
+        inline static
+        t_simplex_simd_level set_level(t_simplex_simd_level p_level);
+
+      private:
+        static_assert(std::is_integral<COEF_TYPE>::value && std::is_signed<COEF_TYPE>::value, "PGCD kernels accept only signed integer types");
+
+        typedef typename std::make_unsigned<COEF_TYPE>::type t_unsigned;
+        typedef COEF_TYPE (*t_or_reduce)(const COEF_TYPE *, unsigned int);
+
+        /**
+         * Kernel implementation for a SIMD level
+         */
+        class implementation
+        {
+          public:
+            t_simplex_simd_level m_level;
+            t_or_reduce m_or_reduce;
+        };
+
+        /**
+         * Absolute value, computed with unsigned type to support min value
+         */
+        inline static
+        t_unsigned absolute(const COEF_TYPE & p_value);
+
+        /**
+         * Number of trailing zero bits of a non null value
+         */
+        inline static
+        unsigned int trailing_zeros(const t_unsigned & p_value);
+
+        /**
+         * Binary PGCD of two odd values
+         */
+        inline static
+        t_unsigned odd_gcd(t_unsigned p_a
+                          ,t_unsigned p_b
+                          );
+
+        inline static
+        implementation get_implementation(t_simplex_simd_level p_level);
+
+        inline static
+        implementation & get_selected();
+    };
+
+    namespace simd_gcd_kernels
+    {
+        //---------------------------------------------------------------------
+        template <typename COEF_TYPE>
+        COEF_TYPE or_reduce_scalar(const COEF_TYPE * p_row
+                                  ,unsigned int p_size
+                                  )
+        {
+            COEF_TYPE l_result = 0;
+            for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+            {
+                l_result |= p_row[l_index];
+            }
+            return l_result;
+        }
+
+#ifdef SIMPLEX_ROW_KERNEL_X86
+// Define OR reduction for an instruction set. Bitwise OR does not depend on
+// integer width so registers are filled with as many coefficients as they
+// can hold and lanes are combined at the end
+#define SIMPLEX_DEFINE_OR_REDUCE(SUFFIX, TARGET, VECTOR, LOAD, STORE, OR, ZERO)                             \
+        template <typename COEF_TYPE>                                                                      \
+        __attribute__((target(TARGET)))                                                                    \
+        COEF_TYPE or_reduce_##SUFFIX(const COEF_TYPE * p_row, unsigned int p_size)                         \
+        {                                                                                                  \
+            const unsigned int l_width = sizeof(VECTOR) / sizeof(COEF_TYPE);                               \
+            VECTOR l_accumulator = ZERO();                                                                 \
+            unsigned int l_index = 0;                                                                      \
+            for(; l_index + l_width <= p_size; l_index += l_width)                                         \
+            {                                                                                              \
+                l_accumulator = OR(l_accumulator, LOAD((const VECTOR *)(p_row + l_index)));                \
+            }                                                                                              \
+            COEF_TYPE l_lanes[l_width];                                                                    \
+            STORE((VECTOR *)l_lanes, l_accumulator);                                                       \
+            return or_reduce_scalar<COEF_TYPE>(l_lanes, l_width) | or_reduce_scalar<COEF_TYPE>(p_row + l_index, p_size - l_index);\
+        }
+
+        SIMPLEX_DEFINE_OR_REDUCE(sse2, "sse2", __m128i, _mm_loadu_si128, _mm_storeu_si128, _mm_or_si128, _mm_setzero_si128)
+        SIMPLEX_DEFINE_OR_REDUCE(avx2, "avx2", __m256i, _mm256_loadu_si256, _mm256_storeu_si256, _mm256_or_si256, _mm256_setzero_si256)
+        SIMPLEX_DEFINE_OR_REDUCE(avx512, "avx512f", __m512i, _mm512_loadu_si512, _mm512_storeu_si512, _mm512_or_si512, _mm512_setzero_si512)
+
+#undef SIMPLEX_DEFINE_OR_REDUCE
+#endif // SIMPLEX_ROW_KERNEL_X86
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    simplex_gcd_kernel<COEF_TYPE>::gcd(const COEF_TYPE & p_a
+                                      ,const COEF_TYPE & p_b
+                                      )
+    {
+        t_unsigned l_a = absolute(p_a);
+        t_unsigned l_b = absolute(p_b);
+        if(!l_a || !l_b)
+        {
+            return COEF_TYPE(l_a | l_b);
+        }
+        unsigned int l_a_shift = trailing_zeros(l_a);
+        unsigned int l_b_shift = trailing_zeros(l_b);
+        unsigned int l_shift = l_a_shift < l_b_shift ? l_a_shift : l_b_shift;
+        return COEF_TYPE(odd_gcd(l_a >> l_a_shift, l_b >> l_b_shift) << l_shift);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    simplex_gcd_kernel<COEF_TYPE>::row_gcd(const COEF_TYPE * p_row
+                                          ,unsigned int p_size
+                                          ,const COEF_TYPE & p_gcd
+                                          )
+    {
+        COEF_TYPE l_or = get_selected().m_or_reduce(p_row, p_size) | p_gcd;
+        if(!l_or)
+        {
+            return COEF_TYPE(0);
+        }
+        unsigned int l_shift = trailing_zeros(t_unsigned(l_or));
+
+        // PGCD of odd parts
+        t_unsigned l_gcd = absolute(p_gcd);
+        if(l_gcd)
+        {
+            l_gcd >>= trailing_zeros(l_gcd);
+        }
+        for(unsigned int l_index = 0;
+            l_index < p_size && 1 != l_gcd;
+            ++l_index
+           )
+        {
+            t_unsigned l_value = absolute(p_row[l_index]);
+            // Once PGCD is known most coefficients are multiple of it so a
+            // first Euclid step avoids binary steps on large values
+            if(l_gcd)
+            {
+                l_value %= l_gcd;
+            }
+            if(l_value)
+            {
+                l_value >>= trailing_zeros(l_value);
+                l_gcd = l_gcd ? odd_gcd(l_gcd, l_value) : l_value;
+            }
+        }
+        return COEF_TYPE(l_gcd << l_shift);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_gcd_kernel<COEF_TYPE>::divide(COEF_TYPE * p_row
+                                         ,const COEF_TYPE & p_divider
+                                         ,unsigned int p_size
+                                         )
+    {
+        for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_row[l_index] = p_row[l_index] / p_divider;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    t_simplex_simd_level
+    simplex_gcd_kernel<COEF_TYPE>::get_level()
+    {
+        return get_selected().m_level;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    t_simplex_simd_level
+    simplex_gcd_kernel<COEF_TYPE>::set_level(t_simplex_simd_level p_level)
+    {
+        t_simplex_simd_level l_supported = simplex_simd_supported_level();
+        get_selected() = get_implementation(p_level < l_supported ? p_level : l_supported);
+        return get_selected().m_level;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_gcd_kernel<COEF_TYPE>::t_unsigned
+    simplex_gcd_kernel<COEF_TYPE>::absolute(const COEF_TYPE & p_value)
+    {
+        return p_value < 0 ? t_unsigned(0) - t_unsigned(p_value) : t_unsigned(p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_gcd_kernel<COEF_TYPE>::trailing_zeros(const t_unsigned & p_value)
+    {
+        assert(p_value);
+#ifdef __GNUC__
+        if(sizeof(t_unsigned) <= sizeof(unsigned long long))
+        {
+            return (unsigned int)__builtin_ctzll((unsigned long long)p_value);
+        }
+#endif // __GNUC__
+        t_unsigned l_value = p_value;
+        unsigned int l_result = 0;
+        while(!(l_value & 1u))
+        {
+            l_value >>= 1;
+            ++l_result;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_gcd_kernel<COEF_TYPE>::t_unsigned
+    simplex_gcd_kernel<COEF_TYPE>::odd_gcd(t_unsigned p_a
+                                          ,t_unsigned p_b
+                                          )
+    {
+        assert(p_a & 1u);
+        assert(p_b & 1u);
+        // Difference of two odd values is even so it can be shifted
+        while(p_a != p_b)
+        {
+            if(p_a > p_b)
+            {
+                p_a -= p_b;
+                p_a >>= trailing_zeros(p_a);
+            }
+            else
+            {
+                p_b -= p_a;
+                p_b >>= trailing_zeros(p_b);
+            }
+        }
+        return p_a;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_gcd_kernel<COEF_TYPE>::implementation
+    simplex_gcd_kernel<COEF_TYPE>::get_implementation(t_simplex_simd_level p_level)
+    {
+        implementation l_implementation;
+        l_implementation.m_level = p_level;
+        switch(p_level)
+        {
+#ifdef SIMPLEX_ROW_KERNEL_X86
+            case t_simplex_simd_level::AVX512:
+                l_implementation.m_or_reduce = simd_gcd_kernels::or_reduce_avx512<COEF_TYPE>;
+                break;
+            case t_simplex_simd_level::AVX2:
+                l_implementation.m_or_reduce = simd_gcd_kernels::or_reduce_avx2<COEF_TYPE>;
+                break;
+            case t_simplex_simd_level::SSE2:
+                l_implementation.m_or_reduce = simd_gcd_kernels::or_reduce_sse2<COEF_TYPE>;
+                break;
+#endif // SIMPLEX_ROW_KERNEL_X86
+            default:
+                l_implementation.m_or_reduce = simd_gcd_kernels::or_reduce_scalar<COEF_TYPE>;
+                break;
+        }
+        return l_implementation;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_gcd_kernel<COEF_TYPE>::implementation &
+    simplex_gcd_kernel<COEF_TYPE>::get_selected()
+    {
+        static implementation l_selected = get_implementation(simplex_simd_supported_level());
+        return l_selected;
+    }
+}
+#endif //SIMPLEX_GCD_KERNEL_H
+// EOF
@@ -20,9 +20,15 @@
 
 #include "simplex_listener.h"
 #include "simplex_array.h"
+#include "simplex_column_array.h"
+#include "simplex_solve_options.h"
+#include "simplex_equation_type.h"
+#include "simplex_tolerance.h"
+#include "quicky_exception.h"
 #include <cassert>
 #include <type_traits>
 #include <string>
+#include <vector>
 #include <iostream>
 
 namespace simplex
@@ -32,12 +38,21 @@ namespace simplex
      * This is the case when there are only inequations of form <
      * General form of simplex is Ax = b
      * Here we assume that A = (A' I) with I identity matrix
+     * Equations of form > or = are also accepted: their I column is an
+     * artificial variable and surplus variables of inequations > are A'
+     * columns. A first phase driving artificial variables out of base is
+     * then automatically done by first search
      * @tparam COEF_TYPE Type of array coef
+     * @tparam ARRAY_TYPE Storage of tableau, row-major simplex_array or
+     * column-major simplex_column_array whose contiguous columns speed up
+     * ratio tests on tableaus with much more rows than columns
      */
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>>
     class simplex_identity_solver: public simplex_listener_target_if<COEF_TYPE>
     {
       public:
+        typedef COEF_TYPE t_coef_type;
+
         /**
          * Constructor
          * @param p_nb_variables Number of variable
@@ -47,8 +62,32 @@ namespace simplex
                                ,unsigned int p_nb_equations
                                );
 
+        /**
+         * Constructor with same parameters than general solvers. Type of
+         * equations should then be defined with define_equation_type
+         * @param p_nb_variables Number of variable
+         * @param p_nb_inequations_lt Number of inequations A x <= b
+         * @param p_nb_equations Number of equations A x = b
+         * @param p_nb_inequations_gt Number of inequations A x >= b
+         */
+        simplex_identity_solver(unsigned int p_nb_variables
+                               ,unsigned int p_nb_inequations_lt
+                               ,unsigned int p_nb_equations
+                               ,unsigned int p_nb_inequations_gt
+                               );
+
         ~simplex_identity_solver();
 
+        /**
+         * Define equation type, equations are inequations A x <= b by
+         * default. Should be called before first search
+         * @param p_equation_index Equation index
+         * @param p_equation_type Equation type
+         */
+        void define_equation_type(const unsigned int & p_equation_index
+                                 ,const t_equation_type & p_equation_type
+                                 );
+
         /**
          * Define coefficient for A' coefficients in A'I x = b
          * @param p_equation_index : the value should be less than number of equations
@@ -97,6 +136,21 @@ namespace simplex
          */
         std::vector<COEF_TYPE> get_variable_values() const override;
 
+        /**
+         * Return dual value of each equation in final base of last search:
+         * variation of optimum when B coefficient of equation increases by 1
+         * @return dual value of each equation
+         */
+        std::vector<COEF_TYPE> get_dual_values() const;
+
+        /**
+         * Return reduced cost of each variable in final base of last search:
+         * variation of optimum when variable increases by 1, 0 for base
+         * variables
+         * @return reduced cost of each variable
+         */
+        std::vector<COEF_TYPE> get_reduced_costs() const;
+
         /**
          * Method implementing simplex algorithm to find max optimum solution
          * The problem must be in solved form
@@ -112,8 +166,120 @@ namespace simplex
                 ,LISTENER * p_listener = NULL
                 );
 
+        /**
+         * Method implementing simplex algorithm to find max optimum solution
+         * within limits of search options
+         * @param p_max reference on variable receiving optimum, or objective
+         * function value of current base when search is stopped
+         * @param p_options search limits
+         * @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_max(COEF_TYPE & p_max
+                ,const simplex_solve_options<COEF_TYPE> & p_options
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing simplex algorithm to find min optimum solution
+         * by searching max of opposite objective function
+         * @param p_min reference on variable where result will be stored
+         * @param p_infinite reference on a boolean value that will receive true if min
+         * is infinite
+         * @return value indicating if a min was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_min(COEF_TYPE & p_min
+                ,bool & p_infinite
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing simplex algorithm to find min optimum solution
+         * within limits of search options
+         * @param p_min reference on variable where result will be stored
+         * @param p_options search limits, search stops on cutoff once
+         * objective function is lower or equal to cutoff
+         * @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_min(COEF_TYPE & p_min
+                ,const simplex_solve_options<COEF_TYPE> & p_options
+                ,LISTENER * p_listener = NULL
+                );
+
       private:
 
+        /**
+         * Replace objective function by its opposite
+         */
+        void negate_objective();
+
+        /**
+         * Iterate until max is reached or search limits are exceeded
+         * @param p_nb_iteration number of iterations already done, updated
+         * @param p_control search limits
+         * @param p_check_cutoff indicate if objective function cutoff applies
+         * @param p_listener listener notified of pivots
+         * @return reason why iterations stopped
+         */
+        template <class LISTENER>
+        t_solve_status
+        iterate(unsigned int & p_nb_iteration
+               ,const simplex_solve_control<COEF_TYPE> & p_control
+               ,bool p_check_cutoff
+               ,LISTENER * p_listener
+               );
+
+        /**
+         * Multiply equations having a negative B coefficient by -1 and use
+         * artificial variables as base variables of equations whose
+         * adjustment variable coefficient is not 1. Objective function is
+         * saved if a first phase is needed
+         */
+        void prepare_equations();
+
+        /**
+         * Search a base where artificial variables are null then restore
+         * objective function
+         * @param p_nb_iteration number of iterations already done, updated
+         * @param p_control search limits
+         * @param p_listener listener notified of pivots
+         * @return OPTIMAL if a feasible base was found
+         */
+        template <class LISTENER>
+        t_solve_status
+        first_phase(unsigned int & p_nb_iteration
+                   ,const simplex_solve_control<COEF_TYPE> & p_control
+                   ,LISTENER * p_listener
+                   );
+
+        /**
+         * Replace null artificial variables remaining in base by any other
+         * variable having a non null coefficient in their equation
+         */
+        void remove_artificial_variables();
+
+        /**
+         * Define Z coefficients and Z0 so that objective function
+         * Z = p_Z0 + SUM(Cj * Xj) is expressed with non base variables
+         * @param p_costs Cj coefficients indexed by variable
+         * @param p_Z0 constant of objective function
+         */
+        void set_objective(const std::vector<COEF_TYPE> & p_costs
+                          ,const COEF_TYPE & p_Z0
+                          );
+
+        /**
+         * Indicate if variable is an artificial variable
+         * @param p_variable_index variable index
+         * @return true if variable is artificial
+         */
+        bool is_artificial_variable(unsigned int p_variable_index) const;
+
         /**
          * Method performing pivot to change the base
          * The A' coefficient A'[row,column] should be !0
@@ -230,25 +396,31 @@ namespace simplex
                                  ) const;
 
         /**
-         * Total number of variables: declared by user + base variables used to
-         * transform < inequations to equations
+         * Number of variables declared by user
+         */
+        unsigned int m_nb_variables;
+
+        /**
+         * Total number of variables: declared by user + adjustment variables
+         * used to transform inequations to equations + artificial variables
          */
         unsigned int m_nb_total_variables;
 
         /**
          * Coefficient array A' in ( Ax =b <=> (A'I x) = B
          */
-        simplex_array<COEF_TYPE> m_array;
+        ARRAY_TYPE m_array;
 
         /**
          Store variable index corresponding to each base variable
          */
          unsigned int * m_base_variables_index;
 
-         /**
-          * Store variable index corresponding to each A' column
-          */
-        unsigned int * m_array_variables_index;
+        /**
+         * Store variable index corresponding to each A' column. Surplus
+         * variables add columns
+         */
+        std::vector<unsigned int> m_array_variables_index;
 
         /**
          * Store base variable index corresponding to an equation
@@ -259,19 +431,57 @@ namespace simplex
          * Variable names
          */
          std::string * m_variable_names;
+
+        /**
+         * Type of each equation
+         */
+        std::vector<t_equation_type> m_equation_types;
+
+        /**
+         * Indicate which equations were multiplied by -1 to get a positive
+         * B coefficient
+         */
+        std::vector<bool> m_negated_equations;
+
+        /**
+         * Indicate if equations were prepared by first search
+         */
+        bool m_prepared;
+
+        /**
+         * Indicate if artificial variables are still in base
+         */
+        bool m_first_phase;
+
+        /**
+         * Objective function coefficients indexed by variable saved during
+         * first phase
+         */
+        std::vector<COEF_TYPE> m_objective_coefs;
+
+        /**
+         * Objective function constant saved during first phase
+         */
+        COEF_TYPE m_objective_Z0;
     };
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
-    simplex_identity_solver<COEF_TYPE>::simplex_identity_solver(unsigned int p_nb_variables
-                                                               ,unsigned int p_nb_equations
-                                                               )
-                                                               :m_nb_total_variables(p_nb_variables + p_nb_equations)
-                                                               ,m_array(p_nb_equations, p_nb_variables)
-                                                               ,m_base_variables_index(new unsigned int[p_nb_equations])
-                                                               ,m_array_variables_index(new unsigned int[p_nb_variables])
-                                                               ,m_equation_base_variable_index(new unsigned int[p_nb_equations])
-                                                               ,m_variable_names( new std::string[m_nb_total_variables])
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::simplex_identity_solver(unsigned int p_nb_variables
+                                                                          ,unsigned int p_nb_equations
+                                                                          )
+                                                                          :m_nb_variables(p_nb_variables)
+                                                                          ,m_nb_total_variables(p_nb_variables + 2 * p_nb_equations)
+                                                                          ,m_array(p_nb_equations, p_nb_variables)
+                                                                          ,m_base_variables_index(new unsigned int[p_nb_equations])
+                                                                          ,m_array_variables_index(p_nb_variables)
+                                                                          ,m_equation_base_variable_index(new unsigned int[p_nb_equations])
+                                                                          ,m_variable_names( new std::string[m_nb_total_variables])
+                                                                          ,m_equation_types(p_nb_equations, t_equation_type::INEQUATION_LT)
+                                                                          ,m_negated_equations(p_nb_equations, false)
+                                                                          ,m_prepared(false)
+                                                                          ,m_first_phase(false)
+                                                                          ,m_objective_Z0(0)
     {
         static_assert(std::is_signed<COEF_TYPE>::value, "Simplex template parameter should be signed");
 
@@ -288,62 +498,92 @@ namespace simplex
             m_base_variables_index[l_index] = l_index + p_nb_variables;
             m_equation_base_variable_index[l_index] = l_index;
             m_variable_names[l_index + p_nb_variables] = "E" + std::to_string(l_index);
+            m_variable_names[l_index + p_nb_variables + p_nb_equations] = "A" + std::to_string(l_index);
         }
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
-    simplex_identity_solver<COEF_TYPE>::~simplex_identity_solver()
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::simplex_identity_solver(unsigned int p_nb_variables
+                                                                          ,unsigned int p_nb_inequations_lt
+                                                                          ,unsigned int p_nb_equations
+                                                                          ,unsigned int p_nb_inequations_gt
+                                                                          )
+                                                                          :simplex_identity_solver(p_nb_variables, p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::~simplex_identity_solver()
     {
-        delete[] m_array_variables_index;
         delete[] m_base_variables_index;
         delete[] m_equation_base_variable_index;
         delete[] m_variable_names;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::define_equation_type(const unsigned int & p_equation_index
+                                                                       ,const t_equation_type & p_equation_type
+                                                                       )
+    {
+        assert(p_equation_index < m_array.get_nb_equations());
+        if(t_equation_type::UNDEFINED == p_equation_type)
+        {
+            throw quicky_exception::quicky_logic_exception("Try to set undefined equation type for equation" + std::to_string(p_equation_index), __LINE__, __FILE__);
+        }
+        if(m_prepared)
+        {
+            throw quicky_exception::quicky_logic_exception("Type of equation " + std::to_string(p_equation_index) + " cannot be changed after a search", __LINE__, __FILE__);
+        }
+        m_equation_types[p_equation_index] = p_equation_type;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_A_coef(const unsigned int p_equation_index
-                                                  ,const unsigned int p_variable_index
-                                                  ,const COEF_TYPE & p_value
-                                                  )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_A_coef(const unsigned int p_equation_index
+                                                             ,const unsigned int p_variable_index
+                                                             ,const COEF_TYPE & p_value
+                                                             )
     {
         m_array.set_A_coef(p_equation_index, p_variable_index, p_value);
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_B_coef(const unsigned int p_equation_index
-                                                  ,const COEF_TYPE & p_value
-                                                  )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_B_coef(const unsigned int p_equation_index
+                                                             ,const COEF_TYPE & p_value
+                                                             )
     {
         m_array.set_B_coef(p_equation_index, p_value);
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_Z_coef(const unsigned int p_variable_index
-                                                  ,const COEF_TYPE & p_value
-                                                  )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_Z_coef(const unsigned int p_variable_index
+                                                             ,const COEF_TYPE & p_value
+                                                             )
     {
         m_array.set_Z_coef(p_variable_index, -p_value);
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_Z0_coef(const COEF_TYPE & p_value)
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_Z0_coef(const COEF_TYPE & p_value)
     {
         m_array.set_Z0_coef(p_value);
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     std::ostream &
-    simplex_identity_solver<COEF_TYPE>::display_array(std::ostream & p_stream) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::display_array(std::ostream & p_stream) const
     {
         // Display variable names
         p_stream << "Z";
@@ -390,58 +630,58 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     const std::string &
-    simplex_identity_solver<COEF_TYPE>::get_variable_name(unsigned int p_index) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_variable_name(unsigned int p_index) const
     {
         assert(p_index < m_nb_total_variables);
         return m_variable_names[p_index];
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     unsigned int
-    simplex_identity_solver<COEF_TYPE>::get_array_variable_index(unsigned int p_column_index) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_array_variable_index(unsigned int p_column_index) const
     {
         assert(p_column_index < m_array.get_nb_variables());
         return m_array_variables_index[p_column_index];
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_array_variable_index(unsigned int p_index
-                                                                ,unsigned int p_variable_index
-                                                                )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_array_variable_index(unsigned int p_index
+                                                                           ,unsigned int p_variable_index
+                                                                           )
     {
         assert(p_index < m_array.get_nb_variables());
         m_array_variables_index[p_index] = p_variable_index;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     unsigned int
-    simplex_identity_solver<COEF_TYPE>::get_equation_base_column_index(unsigned int p_equation_index) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_equation_base_column_index(unsigned int p_equation_index) const
     {
         assert(p_equation_index < m_array.get_nb_equations());
         return m_equation_base_variable_index[p_equation_index];
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     unsigned int
-    simplex_identity_solver<COEF_TYPE>::get_base_variable_index(unsigned int p_index) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_base_variable_index(unsigned int p_index) const
     {
         assert(p_index < m_array.get_nb_equations());
         return m_base_variables_index[p_index];
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::set_base_variable_index(unsigned int p_index
-                                                               ,unsigned int p_variable_index
-                                                               )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_base_variable_index(unsigned int p_index
+                                                                          ,unsigned int p_variable_index
+                                                                          )
     {
         assert(p_index < m_array.get_nb_equations());
         assert(p_variable_index < m_nb_total_variables);
@@ -449,13 +689,14 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     bool
-    simplex_identity_solver<COEF_TYPE>::get_max_input_column_index(unsigned int & p_variable_index) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_max_input_column_index(unsigned int & p_variable_index) const
     {
         for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
         {
-            if(m_array.get_Z_coef(l_index) < 0)
+            // Artificial variables leaving base never come back
+            if(m_array.get_Z_coef(l_index) < -simplex_tolerance<COEF_TYPE>::get() && !is_artificial_variable(get_array_variable_index(l_index)))
             {
                 p_variable_index = l_index;
                 return true;
@@ -465,25 +706,83 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     template <class LISTENER>
     bool
-    simplex_identity_solver<COEF_TYPE>::find_max(COEF_TYPE & p_max
-                                                ,bool & p_infinite
-                                                ,LISTENER *p_listener
-                                                )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::find_max(COEF_TYPE & p_max
+                                                           ,bool & p_infinite
+                                                           ,LISTENER *p_listener
+                                                           )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::find_max(COEF_TYPE & p_max
+                                                           ,const simplex_solve_options<COEF_TYPE> & p_options
+                                                           ,LISTENER *p_listener
+                                                           )
+    {
+        simplex_solve_control<COEF_TYPE> l_control(p_options);
+        unsigned int l_nb_iteration = 0;
+        if(!m_prepared)
+        {
+            prepare_equations();
+        }
+        t_solve_status l_status;
+        if(m_first_phase)
+        {
+            l_status = first_phase(l_nb_iteration, l_control, p_listener);
+            if(t_solve_status::OPTIMAL != l_status)
+            {
+                p_max = m_array.get_Z0_coef();
+                return l_status;
+            }
+        }
+        l_status = iterate(l_nb_iteration, l_control, true, p_listener);
+        if(t_solve_status::UNBOUNDED == l_status)
+        {
+            return l_status;
+        }
+        p_max = m_array.get_Z0_coef();
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::iterate(unsigned int & p_nb_iteration
+                                                          ,const simplex_solve_control<COEF_TYPE> & p_control
+                                                          ,bool p_check_cutoff
+                                                          ,LISTENER * p_listener
+                                                          )
     {
-        p_infinite = false;
+        t_solve_status l_status = t_solve_status::OPTIMAL;
         // A' Column index that will be used for Pivot
         unsigned int l_input_column_index = 0;
-        unsigned int l_nb_iteration = 0;
         while(get_max_input_column_index(l_input_column_index))
         {
+            if(p_control.must_stop(p_nb_iteration, l_status))
+            {
+                break;
+            }
+            if(p_check_cutoff && p_control.is_cutoff_reached(m_array.get_Z0_coef()))
+            {
+                l_status = t_solve_status::CUTOFF;
+                break;
+            }
             // Index of variable corresponding to this column
             unsigned int l_input_variable_index = get_array_variable_index(l_input_column_index);
             if(p_listener)
             {
-                p_listener->start_iteration(l_nb_iteration);
+                p_listener->start_iteration(p_nb_iteration);
                 p_listener->new_input_var_event(l_input_variable_index);
             }
             // A' line/Equation index that will be used for Pivot
@@ -513,25 +812,251 @@ namespace simplex
             }
             else
             {
-                p_infinite = true;
-                return false;
+                return t_solve_status::UNBOUNDED;
+            }
+            ++p_nb_iteration;
+        }
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::prepare_equations()
+    {
+        m_prepared = true;
+        unsigned int l_nb_equations = m_array.get_nb_equations();
+        for(unsigned int l_row_index = 0; l_row_index < l_nb_equations; ++l_row_index)
+        {
+            if(m_array.get_B_coef(l_row_index) < 0)
+            {
+                for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+                {
+                    m_array.set_A_coef(l_row_index, l_index, -m_array.get_A_coef(l_row_index, l_index));
+                }
+                m_array.set_B_coef(l_row_index, -m_array.get_B_coef(l_row_index));
+                m_negated_equations[l_row_index] = true;
+            }
+            // Coefficient of adjustment variable once equation has a
+            // positive B coefficient
+            int l_adjustment_coef = 0;
+            if(t_equation_type::INEQUATION_LT == m_equation_types[l_row_index])
+            {
+                l_adjustment_coef = 1;
+            }
+            else if(t_equation_type::INEQUATION_GT == m_equation_types[l_row_index])
+            {
+                l_adjustment_coef = -1;
+            }
+            if(m_negated_equations[l_row_index])
+            {
+                l_adjustment_coef = -l_adjustment_coef;
+            }
+            if(1 == l_adjustment_coef)
+            {
+                // Adjustment variable is the I column
+                continue;
+            }
+            if(-1 == l_adjustment_coef)
+            {
+                // Surplus variable becomes an A' column
+                unsigned int l_column_index = m_array.get_nb_variables();
+                m_array.add_variables(1);
+                m_array_variables_index.push_back(m_nb_variables + l_row_index);
+                m_array.set_A_coef(l_row_index, l_column_index, COEF_TYPE(-1));
+            }
+            set_base_variable_index(get_equation_base_column_index(l_row_index), m_nb_variables + l_nb_equations + l_row_index);
+            m_first_phase = true;
+        }
+        if(!m_first_phase)
+        {
+            return;
+        }
+        // At this stage user variables are the first A' columns
+        m_objective_coefs.assign(m_nb_total_variables, COEF_TYPE(0));
+        for(unsigned int l_index = 0; l_index < m_nb_variables; ++l_index)
+        {
+            m_objective_coefs[l_index] = -m_array.get_Z_coef(l_index);
+        }
+        m_objective_Z0 = m_array.get_Z0_coef();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::first_phase(unsigned int & p_nb_iteration
+                                                              ,const simplex_solve_control<COEF_TYPE> & p_control
+                                                              ,LISTENER * p_listener
+                                                              )
+    {
+        // Max of -SUM(artificial variables)
+        std::vector<COEF_TYPE> l_costs(m_nb_total_variables, COEF_TYPE(0));
+        for(unsigned int l_index = m_nb_variables + m_array.get_nb_equations(); l_index < m_nb_total_variables; ++l_index)
+        {
+            l_costs[l_index] = COEF_TYPE(-1);
+        }
+        set_objective(l_costs, COEF_TYPE(0));
+        t_solve_status l_status = iterate(p_nb_iteration, p_control, false, p_listener);
+        if(t_solve_status::UNBOUNDED == l_status)
+        {
+            throw quicky_exception::quicky_logic_exception("First phase objective function cannot be infinite", __LINE__, __FILE__);
+        }
+        if(t_solve_status::OPTIMAL == l_status)
+        {
+            if(m_array.get_Z0_coef() < -simplex_tolerance<COEF_TYPE>::get())
+            {
+                l_status = t_solve_status::INFEASIBLE;
+            }
+            else
+            {
+                remove_artificial_variables();
+                m_first_phase = false;
+            }
+        }
+        // Objective function is restored even if search stopped so that
+        // objective function value can be returned
+        set_objective(m_objective_coefs, m_objective_Z0);
+        if(!m_first_phase)
+        {
+            m_objective_coefs.clear();
+        }
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::remove_artificial_variables()
+    {
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        for(unsigned int l_row_index = 0; l_row_index < m_array.get_nb_equations(); ++l_row_index)
+        {
+            unsigned int l_base_column_index = get_equation_base_column_index(l_row_index);
+            unsigned int l_artificial_index = get_base_variable_index(l_base_column_index);
+            if(!is_artificial_variable(l_artificial_index))
+            {
+                continue;
+            }
+            // Artificial variable is null so any variable with a non null
+            // coefficient can replace it without changing values. If there is
+            // none equation is redundant and artificial variable stays null
+            for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+            {
+                unsigned int l_variable_index = get_array_variable_index(l_index);
+                COEF_TYPE l_coef = m_array.get_A_coef(l_row_index, l_index);
+                if(!is_artificial_variable(l_variable_index) && (l_coef < -l_tolerance || l_tolerance < l_coef))
+                {
+                    set_base_variable_index(l_base_column_index, l_variable_index);
+                    set_array_variable_index(l_index, l_artificial_index);
+                    pivot(l_row_index, l_index, l_base_column_index);
+                    break;
+                }
             }
-            ++l_nb_iteration;
         }
-        p_max = m_array.get_Z0_coef();
-        return true;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::set_objective(const std::vector<COEF_TYPE> & p_costs
+                                                                ,const COEF_TYPE & p_Z0
+                                                                )
+    {
+        assert(p_costs.size() == m_nb_total_variables);
+        for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+        {
+            m_array.set_Z_coef(l_index, -p_costs[get_array_variable_index(l_index)]);
+        }
+        // Replace base variables by B - SUM(A'j * Xj)
+        COEF_TYPE l_Z0 = p_Z0;
+        for(unsigned int l_row_index = 0; l_row_index < m_array.get_nb_equations(); ++l_row_index)
+        {
+            const COEF_TYPE & l_cost = p_costs[get_base_variable_index(get_equation_base_column_index(l_row_index))];
+            if(COEF_TYPE(0) == l_cost)
+            {
+                continue;
+            }
+            for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+            {
+                m_array.set_Z_coef(l_index, m_array.get_Z_coef(l_index) + l_cost * m_array.get_A_coef(l_row_index, l_index));
+            }
+            l_Z0 = l_Z0 + l_cost * m_array.get_B_coef(l_row_index);
+        }
+        m_array.set_Z0_coef(l_Z0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     bool
-    simplex_identity_solver<COEF_TYPE>::get_output_equation_index(unsigned int p_column_index
-                                                                 ,unsigned int & p_equation_index
-                                                                 ) const
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::is_artificial_variable(unsigned int p_variable_index) const
+    {
+        return p_variable_index >= m_nb_variables + m_array.get_nb_equations();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::find_min(COEF_TYPE & p_min
+                                                           ,bool & p_infinite
+                                                           ,LISTENER *p_listener
+                                                           )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_min(p_min, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::find_min(COEF_TYPE & p_min
+                                                           ,const simplex_solve_options<COEF_TYPE> & p_options
+                                                           ,LISTENER *p_listener
+                                                           )
+    {
+        simplex_solve_options<COEF_TYPE> l_options(p_options);
+        l_options.m_cutoff = -p_options.m_cutoff;
+        COEF_TYPE l_max = -p_min;
+        negate_objective();
+        t_solve_status l_status = find_max(l_max, l_options, p_listener);
+        negate_objective();
+        p_min = -l_max;
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::negate_objective()
+    {
+        for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+        {
+            m_array.set_Z_coef(l_index, -m_array.get_Z_coef(l_index));
+        }
+        m_array.set_Z0_coef(-m_array.get_Z0_coef());
+        // Objective function saved during an unfinished first phase
+        for(auto & l_coef: m_objective_coefs)
+        {
+            l_coef = -l_coef;
+        }
+        m_objective_Z0 = -m_objective_Z0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    bool
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_output_equation_index(unsigned int p_column_index
+                                                                            ,unsigned int & p_equation_index
+                                                                            ) const
     {
         assert(p_column_index < m_array.get_nb_variables());
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
         unsigned int l_index = 0;
-        while(m_array.get_A_coef(l_index,p_column_index) <= 0 && l_index < m_array.get_nb_equations())
+        while(l_index < m_array.get_nb_equations() && !(m_array.get_A_coef(l_index,p_column_index) > l_tolerance))
         {
             ++l_index;
         }
@@ -545,7 +1070,7 @@ namespace simplex
         while(l_index < m_array.get_nb_equations())
         {
             COEF_TYPE l_divider = m_array.get_A_coef(l_index,p_column_index);
-            if(l_divider > 0)
+            if(l_divider > l_tolerance)
             {
                 COEF_TYPE l_result = m_array.get_B_coef(l_index) / l_divider;
                 if(l_result < l_min)
@@ -560,12 +1085,12 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::pivot(const unsigned int p_pivot_row_index
-                                             ,const unsigned int p_pivot_column_index
-                                             ,const unsigned int p_base_column
-                                             )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::pivot(const unsigned int p_pivot_row_index
+                                                        ,const unsigned int p_pivot_column_index
+                                                        ,const unsigned int p_base_column
+                                                        )
     {
         assert(p_pivot_row_index < m_array.get_nb_equations());
         assert(p_pivot_column_index < m_array.get_nb_variables());
@@ -608,14 +1133,14 @@ namespace simplex
                      l_pivot,
                      p_pivot_row_index,
                      p_pivot_column_index,
-                     0
+                     p_base_column
                     );
         pivot_A_rows(p_pivot_row_index + 1,
                      m_array.get_nb_equations(),
                      l_pivot,
                      p_pivot_row_index,
                      p_pivot_column_index,
-                     0
+                     p_base_column
                     );
 
         // Particular case of pivot row
@@ -642,28 +1167,28 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::pivot_Z(const COEF_TYPE & p_pivot
-                                               ,const COEF_TYPE & p_q
-                                               ,unsigned int p_row_index
-                                               ,unsigned int p_column_index
-                                               )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::pivot_Z(const COEF_TYPE & p_pivot
+                                                          ,const COEF_TYPE & p_q
+                                                          ,unsigned int p_row_index
+                                                          ,unsigned int p_column_index
+                                                          )
     {
         COEF_TYPE l_u = m_array.get_A_coef(p_row_index, p_column_index);
         m_array.set_Z_coef(p_column_index, m_array.get_Z_coef(p_column_index) - p_q * (l_u / p_pivot));
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::pivot_A_rows(unsigned int p_start_row_index
-                                                    ,unsigned int p_end_row_index
-                                                    ,const COEF_TYPE & p_pivot
-                                                    ,unsigned int p_pivot_row_index
-                                                    ,unsigned int p_pivot_column_index
-                                                    ,unsigned int p_base_column
-                                                    )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::pivot_A_rows(unsigned int p_start_row_index
+                                                               ,unsigned int p_end_row_index
+                                                               ,const COEF_TYPE & p_pivot
+                                                               ,unsigned int p_pivot_row_index
+                                                               ,unsigned int p_pivot_column_index
+                                                               ,unsigned int p_base_column
+                                                               )
     {
         assert(p_end_row_index <= m_array.get_nb_equations());
         for(unsigned int l_row_index = p_start_row_index; l_row_index < p_end_row_index; ++l_row_index)
@@ -680,15 +1205,15 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
     void
-    simplex_identity_solver<COEF_TYPE>::pivot_A_coef(unsigned int p_start_column
-                                                    ,unsigned int p_end_column
-                                                    ,COEF_TYPE p_pivot
-                                                    ,COEF_TYPE p_q
-                                                    ,unsigned int p_row_index
-                                                    ,unsigned int p_pivot_row_index
-                                                    )
+    simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::pivot_A_coef(unsigned int p_start_column
+                                                               ,unsigned int p_end_column
+                                                               ,COEF_TYPE p_pivot
+                                                               ,COEF_TYPE p_q
+                                                               ,unsigned int p_row_index
+                                                               ,unsigned int p_pivot_row_index
+                                                               )
     {
         assert(p_end_column <= m_array.get_nb_variables());
         for(unsigned int l_column_index = p_start_column;
@@ -702,13 +1227,13 @@ namespace simplex
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE>
-    std::vector<COEF_TYPE> simplex_identity_solver<COEF_TYPE>::get_variable_values() const
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    std::vector<COEF_TYPE> simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_variable_values() const
     {
-        std::vector<COEF_TYPE> l_result(m_array.get_nb_variables(), 0);
+        std::vector<COEF_TYPE> l_result(m_nb_variables, 0);
         for(unsigned int l_index = 0; l_index < m_array.get_nb_equations(); ++l_index)
         {
-            if(m_base_variables_index[l_index] < m_array.get_nb_variables())
+            if(m_base_variables_index[l_index] < m_nb_variables)
             {
                 l_result[m_base_variables_index[l_index]] = m_array.get_B_coef(l_index);
             }
@@ -716,5 +1241,56 @@ namespace simplex
         return l_result;
     }
 
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    std::vector<COEF_TYPE> simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_dual_values() const
+    {
+        // Adjustment variable of an equation has cost 0 and coefficient 1 so
+        // that its Z coef is the dual value of equation, 0 when in base.
+        // Coefficient is -1 for inequations >. Equations = use their
+        // artificial variable whose coefficient is 1 once equation has a
+        // positive B coefficient
+        std::vector<COEF_TYPE> l_result(m_array.get_nb_equations(), 0);
+        for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+        {
+            unsigned int l_variable_index = get_array_variable_index(l_index);
+            if(l_variable_index < m_nb_variables)
+            {
+                continue;
+            }
+            if(is_artificial_variable(l_variable_index))
+            {
+                unsigned int l_equation_index = l_variable_index - m_nb_variables - m_array.get_nb_equations();
+                if(t_equation_type::EQUATION == m_equation_types[l_equation_index])
+                {
+                    l_result[l_equation_index] = m_negated_equations[l_equation_index] ? -m_array.get_Z_coef(l_index) : m_array.get_Z_coef(l_index);
+                }
+            }
+            else
+            {
+                unsigned int l_equation_index = l_variable_index - m_nb_variables;
+                l_result[l_equation_index] = t_equation_type::INEQUATION_GT == m_equation_types[l_equation_index] ? -m_array.get_Z_coef(l_index) : m_array.get_Z_coef(l_index);
+            }
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    std::vector<COEF_TYPE> simplex_identity_solver<COEF_TYPE,ARRAY_TYPE>::get_reduced_costs() const
+    {
+        // Z coefs are stored as -c
+        std::vector<COEF_TYPE> l_result(m_nb_variables, 0);
+        for(unsigned int l_index = 0; l_index < m_array.get_nb_variables(); ++l_index)
+        {
+            unsigned int l_variable_index = get_array_variable_index(l_index);
+            if(l_variable_index < m_nb_variables)
+            {
+                l_result[l_variable_index] = -m_array.get_Z_coef(l_index);
+            }
+        }
+        return l_result;
+    }
+
 }
 #endif //SIMPLEX_SIMPLEX_IDENTITY_SOLVER_H
@@ -0,0 +1,613 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_IMPLICIT_SLACK_ARRAY_H
+#define SIMPLEX_IMPLICIT_SLACK_ARRAY_H
+
+#include "simplex_array_base.h"
+#include "simplex_array.h"
+#include <vector>
+#include <limits>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Simplex array keeping columns with at most one non null coefficient
+     * implicit: such a column is described by its row and coefficient and
+     * does not use any storage. Adjustment variables, artificial variables
+     * and base variables have unit columns so only columns of non base
+     * variables are stored, number of stored columns follows number of
+     * structural variables instead of number of variables.
+     * A column receiving a second non null coefficient takes a column slot
+     * of underlying storage and gives it back when it becomes a unit column
+     * again, as entering variable column does at the end of a pivot.
+     * Coefficients are only reachable through accessors so solvers use the
+     * pivot restricted to non null coefficients of pivot row and column
+     * @tparam COEF_TYPE Type of coefficients
+     * @tparam STORAGE Array storing explicit columns and B coefficients
+     */
+    template <typename COEF_TYPE, typename STORAGE=simplex_array<COEF_TYPE>>
+    class simplex_implicit_slack_array: public simplex_array_base<COEF_TYPE>
+    {
+      public:
+        inline
+        simplex_implicit_slack_array(const unsigned int & p_nb_equations
+                                    ,const unsigned int & p_nb_variables
+                                    );
+
+        /**
+         * Define coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @return value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        const COEF_TYPE &
+        get_Z_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient Z0 for objective function
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z0_coef(const COEF_TYPE & p_value);
+
+        /**
+         * Return coefficient Z0 for objective function
+         * @return value of Z0 coefficient
+         */
+        inline
+        const COEF_TYPE &
+        get_Z0_coef() const;
+
+        /**
+         * Define coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @param value : value of coefficient in b
+         */
+        inline
+        void set_B_coef(const unsigned int p_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @return value of coefficient in b
+         */
+        inline
+        const COEF_TYPE &
+        get_B_coef(const unsigned int p_index) const;
+
+        /**
+         * Define coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param value : value of coefficient in A
+         */
+        inline
+        void set_A_coef(const unsigned int p_equation_index
+                       ,const unsigned int p_variable_index
+                       ,const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Return coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @return value : value of coefficient in A
+         */
+        inline
+        const COEF_TYPE &
+        get_A_coef(const unsigned int p_equation_index
+                  ,const unsigned int p_variable_index
+                  ) const;
+
+        /**
+         * Indicate if column of a variable is stored
+         * @param p_variable_index : the value should be less than number of variables
+         * @return true if column has more than one non null coefficient
+         */
+        inline
+        bool
+        is_explicit(const unsigned int p_variable_index) const;
+
+        /**
+         * Return number of stored columns
+         * @return number of columns having more than one non null coefficient
+         */
+        inline
+        unsigned int
+        get_nb_explicit_columns() const;
+
+        /**
+         * Return number of column slots allocated in underlying storage,
+         * including slots released by columns that became implicit
+         * @return number of column slots
+         */
+        inline
+        unsigned int
+        get_nb_slots() const;
+
+        /**
+         * Append null columns after existing ones
+         * @param p_nb_variables : number of columns to add
+         */
+        inline
+        void add_variables(const unsigned int & p_nb_variables);
+
+        /**
+         * Insert null columns, following columns are shifted. Inserted
+         * columns are implicit so storage is not modified
+         * @param p_variable_index : index of first inserted column, should
+         * be less or equal than number of variables
+         * @param p_nb_variables : number of columns to insert
+         */
+        inline
+        void insert_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Append null rows after existing ones
+         * @param p_nb_equations : number of rows to add
+         */
+        inline
+        void add_equations(const unsigned int & p_nb_equations);
+
+        /**
+         * Remove columns, following columns are shifted. Slots of removed
+         * explicit columns are kept for later use
+         * @param p_variable_index : index of first removed column
+         * @param p_nb_variables : number of columns to remove
+         */
+        inline
+        void remove_variables(const unsigned int & p_variable_index
+                             ,const unsigned int & p_nb_variables
+                             );
+
+        /**
+         * Remove last rows
+         * @param p_nb_equations : number of rows to remove
+         */
+        inline
+        void remove_equations(const unsigned int & p_nb_equations);
+
+      private:
+        /**
+         * Give a slot of storage to an implicit column and copy its non
+         * null coefficient in it
+         * @param p_variable_index variable index
+         * @return slot index
+         */
+        inline
+        unsigned int
+        make_explicit(const unsigned int p_variable_index);
+
+        /**
+         * Describe column from its remaining non null coefficient if any and
+         * release its slot
+         * @param p_variable_index variable index
+         */
+        inline
+        void
+        make_implicit(const unsigned int p_variable_index);
+
+        /**
+         * Value used to indicate that there is no slot or no row
+         */
+        static const unsigned int m_none = std::numeric_limits<unsigned int>::max();
+
+        /**
+         * Storage of explicit columns and B coefficients
+         */
+        STORAGE m_storage;
+
+        /**
+         * Slot of storage used by each variable, m_none if column is
+         * implicit
+         */
+        std::vector<unsigned int> m_slots;
+
+        /**
+         * Row of non null coefficient of each implicit column, m_none if
+         * column is null
+         */
+        std::vector<unsigned int> m_implicit_rows;
+
+        /**
+         * Non null coefficient of each implicit column
+         */
+        std::vector<COEF_TYPE> m_implicit_coefs;
+
+        /**
+         * Number of non null coefficients stored in each slot
+         */
+        std::vector<unsigned int> m_slot_nb_coefs;
+
+        /**
+         * Slots not used by any column
+         */
+        std::vector<unsigned int> m_free_slots;
+
+        /**
+         * Coefficients of objective function in the form Z - SUM(Cj * X) = 0
+         */
+        std::vector<COEF_TYPE> m_z_coefs;
+
+        /**
+         * Z0 coefficient
+         */
+        COEF_TYPE m_z0;
+
+        /**
+         * Value returned for null coefficients of implicit columns
+         */
+        COEF_TYPE m_zero;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    const unsigned int simplex_implicit_slack_array<COEF_TYPE,STORAGE>::m_none;
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::simplex_implicit_slack_array(const unsigned int & p_nb_equations
+                                                                                 ,const unsigned int & p_nb_variables
+                                                                                 )
+    :simplex_array_base<COEF_TYPE>(p_nb_equations, p_nb_variables)
+    ,m_storage(p_nb_equations, 0)
+    ,m_slots(p_nb_variables, m_none)
+    ,m_implicit_rows(p_nb_variables, m_none)
+    ,m_implicit_coefs(p_nb_variables, COEF_TYPE(0))
+    ,m_z_coefs(p_nb_variables, COEF_TYPE(0))
+    ,m_z0(0)
+    ,m_zero(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::set_Z_coef(const unsigned int p_index
+                                                               ,const COEF_TYPE & p_value
+                                                               )
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        m_z_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    const COEF_TYPE &
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_Z_coef(const unsigned int p_index) const
+    {
+        assert(p_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_z_coefs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::set_Z0_coef(const COEF_TYPE & p_value)
+    {
+        m_z0 = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    const COEF_TYPE &
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_Z0_coef() const
+    {
+        return m_z0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::set_B_coef(const unsigned int p_index
+                                                               ,const COEF_TYPE & p_value
+                                                               )
+    {
+        m_storage.set_B_coef(p_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    const COEF_TYPE &
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_B_coef(const unsigned int p_index) const
+    {
+        return m_storage.get_B_coef(p_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::set_A_coef(const unsigned int p_equation_index
+                                                               ,const unsigned int p_variable_index
+                                                               ,const COEF_TYPE & p_value
+                                                               )
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        bool l_null = !(COEF_TYPE(0) != p_value);
+        unsigned int l_slot = m_slots[p_variable_index];
+        if(m_none == l_slot)
+        {
+            unsigned int l_row_index = m_implicit_rows[p_variable_index];
+            if(m_none == l_row_index || p_equation_index == l_row_index)
+            {
+                // Column stays a unit or null column
+                m_implicit_rows[p_variable_index] = l_null ? m_none : p_equation_index;
+                m_implicit_coefs[p_variable_index] = l_null ? COEF_TYPE(0) : p_value;
+                return;
+            }
+            if(l_null)
+            {
+                return;
+            }
+            l_slot = make_explicit(p_variable_index);
+        }
+        bool l_was_null = !(COEF_TYPE(0) != m_storage.get_A_coef(p_equation_index, l_slot));
+        m_storage.set_A_coef(p_equation_index, l_slot, p_value);
+        if(l_was_null && !l_null)
+        {
+            ++m_slot_nb_coefs[l_slot];
+        }
+        else if(!l_was_null && l_null)
+        {
+            --m_slot_nb_coefs[l_slot];
+            if(m_slot_nb_coefs[l_slot] <= 1)
+            {
+                make_implicit(p_variable_index);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    const COEF_TYPE &
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_A_coef(const unsigned int p_equation_index
+                                                               ,const unsigned int p_variable_index
+                                                               ) const
+    {
+        assert(p_equation_index < simplex_array_base<COEF_TYPE>::get_nb_equations());
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        unsigned int l_slot = m_slots[p_variable_index];
+        if(m_none != l_slot)
+        {
+            return m_storage.get_A_coef(p_equation_index, l_slot);
+        }
+        return p_equation_index == m_implicit_rows[p_variable_index] ? m_implicit_coefs[p_variable_index] : m_zero;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    bool
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::is_explicit(const unsigned int p_variable_index) const
+    {
+        assert(p_variable_index < simplex_array_base<COEF_TYPE>::get_nb_variables());
+        return m_none != m_slots[p_variable_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    unsigned int
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_nb_explicit_columns() const
+    {
+        return (unsigned int)(m_slot_nb_coefs.size() - m_free_slots.size());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    unsigned int
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::get_nb_slots() const
+    {
+        return (unsigned int)m_slot_nb_coefs.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    unsigned int
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::make_explicit(const unsigned int p_variable_index)
+    {
+        assert(m_none == m_slots[p_variable_index]);
+        unsigned int l_slot;
+        if(m_free_slots.empty())
+        {
+            l_slot = (unsigned int)m_slot_nb_coefs.size();
+            m_storage.add_variables(1);
+            m_slot_nb_coefs.push_back(0);
+        }
+        else
+        {
+            l_slot = m_free_slots.back();
+            m_free_slots.pop_back();
+        }
+        // Free slots are null columns
+        unsigned int l_row_index = m_implicit_rows[p_variable_index];
+        if(m_none != l_row_index)
+        {
+            m_storage.set_A_coef(l_row_index, l_slot, m_implicit_coefs[p_variable_index]);
+            m_slot_nb_coefs[l_slot] = 1;
+            m_implicit_rows[p_variable_index] = m_none;
+            m_implicit_coefs[p_variable_index] = COEF_TYPE(0);
+        }
+        m_slots[p_variable_index] = l_slot;
+        return l_slot;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::make_implicit(const unsigned int p_variable_index)
+    {
+        unsigned int l_slot = m_slots[p_variable_index];
+        assert(m_none != l_slot);
+        assert(m_slot_nb_coefs[l_slot] <= 1);
+        m_implicit_rows[p_variable_index] = m_none;
+        m_implicit_coefs[p_variable_index] = COEF_TYPE(0);
+        for(unsigned int l_row_index = 0;
+            m_slot_nb_coefs[l_slot] && l_row_index < m_storage.get_nb_equations();
+            ++l_row_index
+           )
+        {
+            const COEF_TYPE & l_coef = m_storage.get_A_coef(l_row_index, l_slot);
+            if(COEF_TYPE(0) != l_coef)
+            {
+                m_implicit_rows[p_variable_index] = l_row_index;
+                m_implicit_coefs[p_variable_index] = l_coef;
+                m_storage.set_A_coef(l_row_index, l_slot, COEF_TYPE(0));
+                m_slot_nb_coefs[l_slot] = 0;
+            }
+        }
+        m_slots[p_variable_index] = m_none;
+        m_free_slots.push_back(l_slot);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::add_variables(const unsigned int & p_nb_variables)
+    {
+        insert_variables(this->get_nb_variables(), p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::insert_variables(const unsigned int & p_variable_index
+                                                                     ,const unsigned int & p_nb_variables
+                                                                     )
+    {
+        assert(p_variable_index <= this->get_nb_variables());
+        m_slots.insert(m_slots.begin() + p_variable_index, p_nb_variables, m_none);
+        m_implicit_rows.insert(m_implicit_rows.begin() + p_variable_index, p_nb_variables, m_none);
+        m_implicit_coefs.insert(m_implicit_coefs.begin() + p_variable_index, p_nb_variables, COEF_TYPE(0));
+        m_z_coefs.insert(m_z_coefs.begin() + p_variable_index, p_nb_variables, COEF_TYPE(0));
+        this->set_nb_variables(this->get_nb_variables() + p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::add_equations(const unsigned int & p_nb_equations)
+    {
+        m_storage.add_equations(p_nb_equations);
+        this->set_nb_equations(this->get_nb_equations() + p_nb_equations);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::remove_variables(const unsigned int & p_variable_index
+                                                                     ,const unsigned int & p_nb_variables
+                                                                     )
+    {
+        assert(p_variable_index + p_nb_variables <= this->get_nb_variables());
+        for(unsigned int l_variable_index = p_variable_index;
+            l_variable_index < p_variable_index + p_nb_variables;
+            ++l_variable_index
+           )
+        {
+            unsigned int l_slot = m_slots[l_variable_index];
+            if(m_none == l_slot)
+            {
+                continue;
+            }
+            // Released slots should be null columns
+            for(unsigned int l_row_index = 0;
+                m_slot_nb_coefs[l_slot] && l_row_index < m_storage.get_nb_equations();
+                ++l_row_index
+               )
+            {
+                if(COEF_TYPE(0) != m_storage.get_A_coef(l_row_index, l_slot))
+                {
+                    m_storage.set_A_coef(l_row_index, l_slot, COEF_TYPE(0));
+                    --m_slot_nb_coefs[l_slot];
+                }
+            }
+            m_free_slots.push_back(l_slot);
+        }
+        m_slots.erase(m_slots.begin() + p_variable_index, m_slots.begin() + p_variable_index + p_nb_variables);
+        m_implicit_rows.erase(m_implicit_rows.begin() + p_variable_index, m_implicit_rows.begin() + p_variable_index + p_nb_variables);
+        m_implicit_coefs.erase(m_implicit_coefs.begin() + p_variable_index, m_implicit_coefs.begin() + p_variable_index + p_nb_variables);
+        m_z_coefs.erase(m_z_coefs.begin() + p_variable_index, m_z_coefs.begin() + p_variable_index + p_nb_variables);
+        this->set_nb_variables(this->get_nb_variables() - p_nb_variables);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename STORAGE>
+    void
+    simplex_implicit_slack_array<COEF_TYPE,STORAGE>::remove_equations(const unsigned int & p_nb_equations)
+    {
+        assert(p_nb_equations <= this->get_nb_equations());
+        unsigned int l_nb_equations = this->get_nb_equations() - p_nb_equations;
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_variables();
+            ++l_variable_index
+           )
+        {
+            unsigned int l_slot = m_slots[l_variable_index];
+            if(m_none == l_slot)
+            {
+                if(m_none != m_implicit_rows[l_variable_index] && m_implicit_rows[l_variable_index] >= l_nb_equations)
+                {
+                    m_implicit_rows[l_variable_index] = m_none;
+                    m_implicit_coefs[l_variable_index] = COEF_TYPE(0);
+                }
+                continue;
+            }
+            for(unsigned int l_row_index = l_nb_equations;
+                l_row_index < this->get_nb_equations();
+                ++l_row_index
+               )
+            {
+                if(COEF_TYPE(0) != m_storage.get_A_coef(l_row_index, l_slot))
+                {
+                    m_storage.set_A_coef(l_row_index, l_slot, COEF_TYPE(0));
+                    --m_slot_nb_coefs[l_slot];
+                }
+            }
+        }
+        m_storage.remove_equations(p_nb_equations);
+        this->set_nb_equations(l_nb_equations);
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_variables();
+            ++l_variable_index
+           )
+        {
+            unsigned int l_slot = m_slots[l_variable_index];
+            if(m_none != l_slot && m_slot_nb_coefs[l_slot] <= 1)
+            {
+                make_implicit(l_variable_index);
+            }
+        }
+    }
+}
+#endif //SIMPLEX_IMPLICIT_SLACK_ARRAY_H
+// EOF
@@ -35,6 +35,7 @@ namespace simplex
     inline void new_input_var_event(const unsigned int & p_input_variable_index) override;
     inline void new_output_var_event(const unsigned int & p_input_variable_index) override;
     inline void new_Z0(COEF_TYPE p_z0) override;
+    inline void presolve_done(const simplex_presolve_report & p_report) override;
     private:
     unsigned int m_nb_iteration;
     const simplex_listener_target_if<COEF_TYPE> & m_simplex;
@@ -95,6 +96,13 @@ namespace simplex
     }
   }
 
+  //----------------------------------------------------------------------------
+  template<typename COEF_TYPE>
+  void simplex_listener<COEF_TYPE>::presolve_done(const simplex_presolve_report & p_report)
+  {
+    m_ostream << p_report << std::endl;
+  }
+
 }
 #endif // _SIMPLEX_LISTENER_H_
 //EOF
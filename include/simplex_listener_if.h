@@ -18,6 +18,8 @@
 #ifndef SIMPLEX_SIMPLEX_LISTENER_IF_H
 #define SIMPLEX_SIMPLEX_LISTENER_IF_H
 
+#include "simplex_presolve_report.h"
+
 namespace simplex
 {
     template <typename COEF_TYPE>
@@ -29,6 +31,14 @@ namespace simplex
         virtual void new_output_var_event(const unsigned int & p_input_variable_index)=0;
         virtual void new_Z0(COEF_TYPE p_z0)=0;
 
+        /**
+         * Called once presolve is done, default implementation ignores it
+         * @param p_report reductions done by presolve
+         */
+        virtual void presolve_done(const simplex_presolve_report &)
+        {
+        }
+
     };
 }
 #endif //SIMPLEX_SIMPLEX_LISTENER_IF_H
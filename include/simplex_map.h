@@ -20,6 +20,7 @@
 #include "simplex_array_base.h"
 #include <cassert>
 #include <map>
+#include <vector>
 
 namespace simplex
 {
@@ -105,7 +106,42 @@ namespace simplex
 		 const unsigned int p_variable_index
 		 ) const;
 
-    inline ~simplex_map(void);
+    /**
+       Append null columns after existing ones
+       @param p_nb_variables : number of columns to add
+    */
+    inline void add_variables(const unsigned int & p_nb_variables);
+
+    /**
+       Insert null columns, following columns are shifted
+       @param p_variable_index : index of first inserted column, should be
+       less or equal than number of variables
+       @param p_nb_variables : number of columns to insert
+    */
+    inline void insert_variables(const unsigned int & p_variable_index,
+				 const unsigned int & p_nb_variables
+				 );
+
+    /**
+       Append null lines after existing ones
+       @param p_nb_equations : number of lines to add
+    */
+    inline void add_equations(const unsigned int & p_nb_equations);
+
+    /**
+       Remove columns, following columns are shifted
+       @param p_variable_index : index of first removed column
+       @param p_nb_variables : number of columns to remove
+    */
+    inline void remove_variables(const unsigned int & p_variable_index,
+				 const unsigned int & p_nb_variables
+				 );
+
+    /**
+       Remove last lines
+       @param p_nb_equations : number of lines to remove
+    */
+    inline void remove_equations(const unsigned int & p_nb_equations);
 
   private:
     inline
@@ -119,7 +155,12 @@ namespace simplex
 			       const unsigned int & p_column_index
 			       )const;
 
-    std::map<unsigned int,COEF_TYPE> * m_coefs;
+    /**
+       Coefficients of each line indexed by column. Z coefficients are
+       stored in line after last equation, B coefficients and Z0 in column
+       after last variable
+    */
+    std::vector<std::map<unsigned int,COEF_TYPE>> m_coefs;
     COEF_TYPE m_zero;
   };
 
@@ -130,7 +171,7 @@ namespace simplex
 				       const unsigned int & p_nb_variables
 				       ):
     simplex_array_base<COEF_TYPE>(p_nb_equations,p_nb_variables),
-    m_coefs(new std::map<unsigned int,COEF_TYPE>[p_nb_equations + 1]),
+    m_coefs(p_nb_equations + 1),
     m_zero(0)
     {
     }
@@ -144,7 +185,6 @@ namespace simplex
 					)
   {
     assert(p_equation_index <= simplex_array_base<COEF_TYPE>::get_nb_equations());
-    assert(m_coefs);
     typename std::map<unsigned int,COEF_TYPE> & l_line = m_coefs[p_equation_index];
     typename std::map<unsigned int,COEF_TYPE>::iterator l_iter = l_line.find(p_variable_index);
     if(l_iter == l_line.end())
@@ -174,8 +214,7 @@ namespace simplex
 						     )const
   {
     assert(p_line_index <= simplex_array_base<COEF_TYPE>::get_nb_equations());
-    assert(m_coefs);
-    typename std::map<unsigned int,COEF_TYPE>::iterator l_iter = m_coefs[p_line_index].find(p_column_index);
+    typename std::map<unsigned int,COEF_TYPE>::const_iterator l_iter = m_coefs[p_line_index].find(p_column_index);
     if(l_iter != m_coefs[p_line_index].end())
       {
 	return l_iter->second;
@@ -262,9 +301,82 @@ namespace simplex
 
   //----------------------------------------------------------------------------
   template <typename COEF_TYPE>
-  simplex_map<COEF_TYPE>::~simplex_map(void)
+  void simplex_map<COEF_TYPE>::add_variables(const unsigned int & p_nb_variables)
+    {
+      insert_variables(simplex_array_base<COEF_TYPE>::get_nb_variables(), p_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_map<COEF_TYPE>::insert_variables(const unsigned int & p_variable_index,
+						const unsigned int & p_nb_variables
+						)
+    {
+      assert(p_variable_index <= simplex_array_base<COEF_TYPE>::get_nb_variables());
+      // Coefficients of shifted columns including B coefficients and Z0
+      // stored after last column are moved starting from the last one
+      for(auto & l_line: m_coefs)
+	{
+	  typename std::map<unsigned int,COEF_TYPE>::iterator l_iter = l_line.end();
+	  while(l_iter != l_line.begin())
+	    {
+	      --l_iter;
+	      if(l_iter->first < p_variable_index)
+		{
+		  break;
+		}
+	      l_line.insert(typename std::map<unsigned int,COEF_TYPE>::value_type(l_iter->first + p_nb_variables,l_iter->second));
+	      l_iter = l_line.erase(l_iter);
+	    }
+	}
+      simplex_array_base<COEF_TYPE>::set_nb_variables(simplex_array_base<COEF_TYPE>::get_nb_variables() + p_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_map<COEF_TYPE>::add_equations(const unsigned int & p_nb_equations)
+    {
+      // Z line stays after last equation
+      unsigned int l_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      m_coefs.resize(l_nb_equations + p_nb_equations + 1);
+      m_coefs[l_nb_equations].swap(m_coefs[l_nb_equations + p_nb_equations]);
+      simplex_array_base<COEF_TYPE>::set_nb_equations(l_nb_equations + p_nb_equations);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_map<COEF_TYPE>::remove_variables(const unsigned int & p_variable_index,
+						const unsigned int & p_nb_variables
+						)
+    {
+      assert(p_variable_index + p_nb_variables <= simplex_array_base<COEF_TYPE>::get_nb_variables());
+      // Coefficients of shifted columns including B coefficients and Z0
+      // stored after last column are moved starting from the first one
+      for(auto & l_line: m_coefs)
+	{
+	  typename std::map<unsigned int,COEF_TYPE>::iterator l_iter = l_line.lower_bound(p_variable_index);
+	  while(l_iter != l_line.end())
+	    {
+	      if(l_iter->first >= p_variable_index + p_nb_variables)
+		{
+		  l_line.insert(l_iter, typename std::map<unsigned int,COEF_TYPE>::value_type(l_iter->first - p_nb_variables,l_iter->second));
+		}
+	      l_iter = l_line.erase(l_iter);
+	    }
+	}
+      simplex_array_base<COEF_TYPE>::set_nb_variables(simplex_array_base<COEF_TYPE>::get_nb_variables() - p_nb_variables);
+    }
+
+  //----------------------------------------------------------------------------
+  template <typename COEF_TYPE>
+  void simplex_map<COEF_TYPE>::remove_equations(const unsigned int & p_nb_equations)
     {
-      delete[] m_coefs;
+      // Z line stays after last equation
+      unsigned int l_nb_equations = simplex_array_base<COEF_TYPE>::get_nb_equations();
+      assert(p_nb_equations <= l_nb_equations);
+      m_coefs[l_nb_equations - p_nb_equations].swap(m_coefs[l_nb_equations]);
+      m_coefs.resize(l_nb_equations - p_nb_equations + 1);
+      simplex_array_base<COEF_TYPE>::set_nb_equations(l_nb_equations - p_nb_equations);
     }
 }
 #endif // _SIMPLEX_MAP_H_
@@ -0,0 +1,988 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_PRESOLVE_H
+#define SIMPLEX_PRESOLVE_H
+
+#include "simplex_solver_base.h"
+#include "simplex_solver.h"
+#include "simplex_presolve_report.h"
+#include "simplex_tolerance.h"
+#include "quicky_exception.h"
+#include <chrono>
+#include <map>
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <type_traits>
+
+namespace simplex
+{
+    /**
+     * Indicate if a solver handles variable upper bounds itself so that
+     * presolve does not give them as inequations
+     * @tparam SOLVER_TYPE type of solver
+     */
+    template <typename SOLVER_TYPE>
+    struct simplex_native_bounds: public std::false_type
+    {
+    };
+
+    /**
+     * Simplex solver handles bounds with complemented variables
+     */
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    struct simplex_native_bounds<simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>>: public std::true_type
+    {
+    };
+
+    /**
+     * Store a problem Max Z = SUM(Cj * xj) with the same interface as
+     * solvers and reduce it before giving it to a solver:
+     * - equations without coefficient are removed
+     * - equations with a single coefficient become variable bounds
+     * - equations identical to another one are merged
+     * - variables whose bounds are equal are replaced by their value
+     * - variables for which each equation and objective function prefer
+     *   the same bound are set to this bound
+     * Remaining lower bounds are removed by translation. Remaining upper
+     * bounds are given as variable bounds to solvers supporting them and as
+     * inequations to other ones. postsolve maps solution of reduced problem
+     * back to original variables
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_presolve
+    {
+      public:
+        typedef COEF_TYPE t_coef_type;
+
+        /**
+         * Constructor with the same parameters as solvers
+         * @param p_nb_variables number of variables
+         * @param p_nb_inequations_lt number of inequations A x <= b
+         * @param p_nb_equations number of equations A x = b
+         * @param p_nb_inequations_gt number of inequations A x >= b
+         */
+        inline
+        simplex_presolve(unsigned int p_nb_variables,
+                         unsigned int p_nb_inequations_lt,
+                         unsigned int p_nb_equations,
+                         unsigned int p_nb_inequations_gt
+                        );
+
+        /**
+         * Define coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @param p_value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void set_Z_coef(const unsigned int p_index,
+                        const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Define coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value : value of coefficient in A
+         */
+        inline
+        void set_A_coef(const unsigned int p_equation_index,
+                        const unsigned int p_variable_index,
+                        const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Define coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than number of equations
+         * @param p_value : value of coefficient in b
+         */
+        inline
+        void set_B_coef(const unsigned int p_index,
+                        const COEF_TYPE & p_value
+                       );
+
+        /**
+         * Define equation type
+         * @param p_equation_index Equation index
+         * @param p_equation_type Equation type
+         */
+        inline
+        void define_equation_type(const unsigned int & p_equation_index,
+                                  const simplex::equation_type & p_equation_type
+                                 );
+
+        /**
+         * Define lower bound of a variable, default lower bound is 0
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value lower bound
+         */
+        inline
+        void set_variable_lower_bound(const unsigned int p_variable_index,
+                                      const COEF_TYPE & p_value
+                                     );
+
+        /**
+         * Define upper bound of a variable, by default there is no upper
+         * bound
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value upper bound
+         */
+        inline
+        void set_variable_upper_bound(const unsigned int p_variable_index,
+                                      const COEF_TYPE & p_value
+                                     );
+
+        /**
+         * Apply reductions until none applies anymore and build reduced
+         * problem
+         * @param p_infinite reference on a boolean value that will receive
+         * true if a variable can be increased infinitely, meaning that max is
+         * infinite if problem is feasible
+         * @param p_listener optional listener receiving reduction report
+         * @return false if problem is proven infeasible or unbounded
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        presolve(bool & p_infinite,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Return reductions done by presolve
+         * @return presolve report
+         */
+        inline
+        const simplex_presolve_report &
+        get_report() const;
+
+        /**
+         * Return number of variables of reduced problem
+         * @return number of variables
+         */
+        inline
+        unsigned int
+        get_nb_variables() const;
+
+        /**
+         * Return number of inequations A x <= b of reduced problem
+         * @tparam SOLVER_TYPE solver that will be filled, upper bounds are
+         * counted as inequations unless it supports variable bounds
+         * @return number of inequations
+         */
+        template <typename SOLVER_TYPE=void>
+        unsigned int
+        get_nb_inequations_lt() const;
+
+        /**
+         * Return number of equations A x = b of reduced problem
+         * @return number of equations
+         */
+        inline
+        unsigned int
+        get_nb_equations() const;
+
+        /**
+         * Return number of inequations A x >= b of reduced problem
+         * @return number of inequations
+         */
+        inline
+        unsigned int
+        get_nb_inequations_gt() const;
+
+        /**
+         * Give reduced problem to a solver built with reduced problem
+         * dimensions
+         * @param p_solver solver to fill
+         */
+        template <typename SOLVER_TYPE>
+        void
+        fill(SOLVER_TYPE & p_solver) const;
+
+        /**
+         * Compute values of original variables
+         * @param p_values values of reduced problem variables as returned by
+         * get_variable_values
+         * @return values of original variables
+         */
+        inline
+        std::vector<COEF_TYPE>
+        postsolve(const std::vector<COEF_TYPE> & p_values) const;
+
+        /**
+         * Compute max of original problem
+         * @param p_max max of reduced problem
+         * @return max of original problem
+         */
+        inline
+        COEF_TYPE
+        postsolve_max(const COEF_TYPE & p_max) const;
+
+      private:
+
+        /**
+         * Give upper bounds of reduced problem as variable bounds
+         * @param p_solver solver to fill
+         */
+        template <typename SOLVER_TYPE>
+        void
+        fill_upper_bounds(SOLVER_TYPE & p_solver,
+                          std::true_type
+                         ) const;
+
+        /**
+         * Give upper bounds of reduced problem as inequations after original
+         * equations
+         * @param p_solver solver to fill
+         */
+        template <typename SOLVER_TYPE>
+        void
+        fill_upper_bounds(SOLVER_TYPE & p_solver,
+                          std::false_type
+                         ) const;
+
+        /**
+         * Indicate if a value is null regarding tolerance
+         * @param p_value value to check
+         * @return true if value is null
+         */
+        inline static
+        bool
+        is_null(const COEF_TYPE & p_value);
+
+        /**
+         * Check that presolve has been done
+         */
+        inline
+        void
+        check_presolved() const;
+
+        /**
+         * Remove empty equations and replace equations with a single
+         * coefficient by variable bounds
+         * @return false if problem is infeasible
+         */
+        inline
+        bool
+        reduce_small_rows();
+
+        /**
+         * Merge identical equations
+         * @return false if problem is infeasible
+         */
+        inline
+        bool
+        reduce_duplicate_rows();
+
+        /**
+         * Remove variables with equal bounds and variables for which each
+         * equation and objective function prefer the same bound
+         * @param p_infinite receive true if a variable can be increased
+         * infinitely
+         * @return false if problem is unbounded
+         */
+        inline
+        bool
+        reduce_columns(bool & p_infinite);
+
+        /**
+         * Replace a variable by a value in equations and objective function
+         * @param p_variable_index index of variable
+         * @param p_value value of variable
+         */
+        inline
+        void
+        fix_column(unsigned int p_variable_index,
+                   const COEF_TYPE & p_value
+                  );
+
+        /**
+         * Build correspondence between reduced and original problems
+         */
+        inline
+        void
+        build_reduced_problem();
+
+        unsigned int m_nb_variables;
+        unsigned int m_nb_total_equations;
+
+        /**
+         * Non null coefficients of each equation indexed by variable
+         */
+        std::vector<std::map<unsigned int, COEF_TYPE>> m_rows;
+        std::vector<COEF_TYPE> m_B_coefs;
+        std::vector<t_equation_type> m_equation_types;
+        std::vector<COEF_TYPE> m_Z_coefs;
+
+        std::vector<COEF_TYPE> m_lower_bounds;
+        std::vector<COEF_TYPE> m_upper_bounds;
+        std::vector<bool> m_has_upper_bounds;
+
+        /**
+         * Indicate if an equation has been removed
+         */
+        std::vector<bool> m_removed_rows;
+
+        /**
+         * Indicate if a variable has been replaced by a value
+         */
+        std::vector<bool> m_removed_columns;
+
+        /**
+         * Value of removed variables
+         */
+        std::vector<COEF_TYPE> m_column_values;
+
+        /**
+         * Contribution of removed variables and lower bounds to objective
+         * function
+         */
+        COEF_TYPE m_Z0;
+
+        /**
+         * Original index of variables of reduced problem
+         */
+        std::vector<unsigned int> m_reduced_columns;
+
+        /**
+         * Original index of equations of reduced problem
+         */
+        std::vector<unsigned int> m_reduced_rows;
+
+        /**
+         * Reduced problem variables having an upper bound
+         */
+        std::vector<unsigned int> m_bounded_columns;
+
+        unsigned int m_nb_reduced_inequations_lt;
+        unsigned int m_nb_reduced_equations;
+        unsigned int m_nb_reduced_inequations_gt;
+
+        bool m_presolved;
+
+        simplex_presolve_report m_report;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_presolve<COEF_TYPE>::simplex_presolve(unsigned int p_nb_variables,
+                                                  unsigned int p_nb_inequations_lt,
+                                                  unsigned int p_nb_equations,
+                                                  unsigned int p_nb_inequations_gt
+                                                 ):
+            m_nb_variables(p_nb_variables),
+            m_nb_total_equations(p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt),
+            m_rows(m_nb_total_equations),
+            m_B_coefs(m_nb_total_equations, COEF_TYPE(0)),
+            m_equation_types(m_nb_total_equations, t_equation_type::UNDEFINED),
+            m_Z_coefs(p_nb_variables, COEF_TYPE(0)),
+            m_lower_bounds(p_nb_variables, COEF_TYPE(0)),
+            m_upper_bounds(p_nb_variables, COEF_TYPE(0)),
+            m_has_upper_bounds(p_nb_variables, false),
+            m_removed_rows(m_nb_total_equations, false),
+            m_removed_columns(p_nb_variables, false),
+            m_column_values(p_nb_variables, COEF_TYPE(0)),
+            m_Z0(0),
+            m_nb_reduced_inequations_lt(0),
+            m_nb_reduced_equations(0),
+            m_nb_reduced_inequations_gt(0),
+            m_presolved(false)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::set_Z_coef(const unsigned int p_index,
+                                            const COEF_TYPE & p_value
+                                           )
+    {
+        assert(p_index < m_nb_variables);
+        m_Z_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::set_A_coef(const unsigned int p_equation_index,
+                                            const unsigned int p_variable_index,
+                                            const COEF_TYPE & p_value
+                                           )
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        assert(p_variable_index < m_nb_variables);
+        if(COEF_TYPE(0) != p_value)
+        {
+            m_rows[p_equation_index][p_variable_index] = p_value;
+        }
+        else
+        {
+            m_rows[p_equation_index].erase(p_variable_index);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::set_B_coef(const unsigned int p_index,
+                                            const COEF_TYPE & p_value
+                                           )
+    {
+        assert(p_index < m_nb_total_equations);
+        m_B_coefs[p_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::define_equation_type(const unsigned int & p_equation_index,
+                                                      const simplex::equation_type & p_equation_type
+                                                     )
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        if(t_equation_type::UNDEFINED == p_equation_type)
+        {
+            throw quicky_exception::quicky_logic_exception("Try to define an equation of undefined type", __LINE__, __FILE__);
+        }
+        m_equation_types[p_equation_index] = p_equation_type;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::set_variable_lower_bound(const unsigned int p_variable_index,
+                                                          const COEF_TYPE & p_value
+                                                         )
+    {
+        assert(p_variable_index < m_nb_variables);
+        m_lower_bounds[p_variable_index] = p_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::set_variable_upper_bound(const unsigned int p_variable_index,
+                                                          const COEF_TYPE & p_value
+                                                         )
+    {
+        assert(p_variable_index < m_nb_variables);
+        m_upper_bounds[p_variable_index] = p_value;
+        m_has_upper_bounds[p_variable_index] = true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_presolve<COEF_TYPE>::presolve(bool & p_infinite,
+                                          LISTENER * p_listener
+                                         )
+    {
+        if(m_presolved)
+        {
+            throw quicky_exception::quicky_logic_exception("Presolve has already been done", __LINE__, __FILE__);
+        }
+        auto l_start = std::chrono::steady_clock::now();
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(t_equation_type::UNDEFINED == m_equation_types[l_row_index])
+            {
+                throw quicky_exception::quicky_logic_exception("Type of equation " + std::to_string(l_row_index) + " is not defined", __LINE__, __FILE__);
+            }
+        }
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(m_has_upper_bounds[l_variable_index] && m_upper_bounds[l_variable_index] < m_lower_bounds[l_variable_index] - simplex_tolerance<COEF_TYPE>::get())
+            {
+                throw quicky_exception::quicky_logic_exception("Upper bound lower than lower bound for variable " + std::to_string(l_variable_index), __LINE__, __FILE__);
+            }
+        }
+
+        p_infinite = false;
+        bool l_feasible = true;
+        unsigned int l_nb_reductions = 0;
+        unsigned int l_previous_nb_reductions;
+        // Each reduction can enable other ones
+        do
+        {
+            l_previous_nb_reductions = l_nb_reductions;
+            l_feasible = reduce_small_rows() && reduce_duplicate_rows() && reduce_columns(p_infinite);
+            l_nb_reductions = m_report.get_nb_removed_rows() + m_report.get_nb_removed_columns();
+        }
+        while(l_feasible && l_nb_reductions != l_previous_nb_reductions);
+
+        if(l_feasible)
+        {
+            build_reduced_problem();
+        }
+        m_report.m_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start);
+        if(p_listener)
+        {
+            p_listener->presolve_done(m_report);
+        }
+        return l_feasible;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const simplex_presolve_report &
+    simplex_presolve<COEF_TYPE>::get_report() const
+    {
+        return m_report;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_presolve<COEF_TYPE>::get_nb_variables() const
+    {
+        check_presolved();
+        return (unsigned int)m_reduced_columns.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename SOLVER_TYPE>
+    unsigned int
+    simplex_presolve<COEF_TYPE>::get_nb_inequations_lt() const
+    {
+        check_presolved();
+        return simplex_native_bounds<SOLVER_TYPE>::value ? m_nb_reduced_inequations_lt - (unsigned int)m_bounded_columns.size() : m_nb_reduced_inequations_lt;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_presolve<COEF_TYPE>::get_nb_equations() const
+    {
+        check_presolved();
+        return m_nb_reduced_equations;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_presolve<COEF_TYPE>::get_nb_inequations_gt() const
+    {
+        check_presolved();
+        return m_nb_reduced_inequations_gt;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename SOLVER_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::fill(SOLVER_TYPE & p_solver) const
+    {
+        check_presolved();
+        std::vector<unsigned int> l_reduced_indexes(m_nb_variables, std::numeric_limits<unsigned int>::max());
+        for(unsigned int l_index = 0;
+            l_index < m_reduced_columns.size();
+            ++l_index
+           )
+        {
+            unsigned int l_variable_index = m_reduced_columns[l_index];
+            l_reduced_indexes[l_variable_index] = l_index;
+            p_solver.set_Z_coef(l_index, m_Z_coefs[l_variable_index]);
+        }
+        // Original equations with variables translated by their lower bound
+        for(unsigned int l_index = 0;
+            l_index < m_reduced_rows.size();
+            ++l_index
+           )
+        {
+            unsigned int l_row_index = m_reduced_rows[l_index];
+            COEF_TYPE l_B_coef = m_B_coefs[l_row_index];
+            for(auto l_iter: m_rows[l_row_index])
+            {
+                p_solver.set_A_coef(l_index, l_reduced_indexes[l_iter.first], l_iter.second);
+                if(COEF_TYPE(0) != m_lower_bounds[l_iter.first])
+                {
+                    l_B_coef = l_B_coef - l_iter.second * m_lower_bounds[l_iter.first];
+                }
+            }
+            p_solver.set_B_coef(l_index, l_B_coef);
+            p_solver.define_equation_type(l_index, m_equation_types[l_row_index]);
+        }
+        fill_upper_bounds(p_solver, typename simplex_native_bounds<SOLVER_TYPE>::type());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename SOLVER_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::fill_upper_bounds(SOLVER_TYPE & p_solver,
+                                                   std::true_type
+                                                  ) const
+    {
+        for(auto l_column_index: m_bounded_columns)
+        {
+            unsigned int l_variable_index = m_reduced_columns[l_column_index];
+            p_solver.set_variable_upper_bound(l_column_index, m_upper_bounds[l_variable_index] - m_lower_bounds[l_variable_index]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename SOLVER_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::fill_upper_bounds(SOLVER_TYPE & p_solver,
+                                                   std::false_type
+                                                  ) const
+    {
+        for(unsigned int l_index = 0;
+            l_index < m_bounded_columns.size();
+            ++l_index
+           )
+        {
+            unsigned int l_row_index = (unsigned int)m_reduced_rows.size() + l_index;
+            unsigned int l_variable_index = m_reduced_columns[m_bounded_columns[l_index]];
+            p_solver.set_A_coef(l_row_index, m_bounded_columns[l_index], COEF_TYPE(1));
+            p_solver.set_B_coef(l_row_index, m_upper_bounds[l_variable_index] - m_lower_bounds[l_variable_index]);
+            p_solver.define_equation_type(l_row_index, t_equation_type::INEQUATION_LT);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    std::vector<COEF_TYPE>
+    simplex_presolve<COEF_TYPE>::postsolve(const std::vector<COEF_TYPE> & p_values) const
+    {
+        check_presolved();
+        if(p_values.size() < m_reduced_columns.size())
+        {
+            throw quicky_exception::quicky_logic_exception("Number of values " + std::to_string(p_values.size()) + " lower than number of variables of reduced problem " + std::to_string(m_reduced_columns.size()), __LINE__, __FILE__);
+        }
+        std::vector<COEF_TYPE> l_values(m_column_values);
+        for(unsigned int l_index = 0;
+            l_index < m_reduced_columns.size();
+            ++l_index
+           )
+        {
+            unsigned int l_variable_index = m_reduced_columns[l_index];
+            l_values[l_variable_index] = p_values[l_index] + m_lower_bounds[l_variable_index];
+        }
+        return l_values;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    COEF_TYPE
+    simplex_presolve<COEF_TYPE>::postsolve_max(const COEF_TYPE & p_max) const
+    {
+        check_presolved();
+        return p_max + m_Z0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_presolve<COEF_TYPE>::is_null(const COEF_TYPE & p_value)
+    {
+        return !(p_value < -simplex_tolerance<COEF_TYPE>::get() || simplex_tolerance<COEF_TYPE>::get() < p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::check_presolved() const
+    {
+        if(!m_presolved)
+        {
+            throw quicky_exception::quicky_logic_exception("Reduced problem is only available once presolve succeeded", __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_presolve<COEF_TYPE>::reduce_small_rows()
+    {
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(m_removed_rows[l_row_index] || m_rows[l_row_index].size() > 1)
+            {
+                continue;
+            }
+            const COEF_TYPE & l_B_coef = m_B_coefs[l_row_index];
+            t_equation_type l_type = m_equation_types[l_row_index];
+            if(m_rows[l_row_index].empty())
+            {
+                // 0 <= b, 0 = b or 0 >= b
+                if((t_equation_type::INEQUATION_LT == l_type && l_B_coef < -l_tolerance) ||
+                   (t_equation_type::INEQUATION_GT == l_type && l_tolerance < l_B_coef) ||
+                   (t_equation_type::EQUATION == l_type && !is_null(l_B_coef))
+                  )
+                {
+                    return false;
+                }
+                m_removed_rows[l_row_index] = true;
+                ++m_report.m_nb_empty_rows;
+                continue;
+            }
+
+            unsigned int l_variable_index = m_rows[l_row_index].begin()->first;
+            const COEF_TYPE & l_coef = m_rows[l_row_index].begin()->second;
+            COEF_TYPE l_bound = l_B_coef / l_coef;
+            // Equation is kept if bound is not exact for coefficient type
+            if(!is_null(l_bound * l_coef - l_B_coef))
+            {
+                continue;
+            }
+            COEF_TYPE & l_lower = m_lower_bounds[l_variable_index];
+            COEF_TYPE & l_upper = m_upper_bounds[l_variable_index];
+            bool l_upper_bound = t_equation_type::EQUATION == l_type || ((t_equation_type::INEQUATION_LT == l_type) == (COEF_TYPE(0) < l_coef));
+            bool l_lower_bound = t_equation_type::EQUATION == l_type || !l_upper_bound;
+            if(l_upper_bound && (!m_has_upper_bounds[l_variable_index] || l_bound < l_upper))
+            {
+                l_upper = l_bound;
+                m_has_upper_bounds[l_variable_index] = true;
+            }
+            if(l_lower_bound && l_lower < l_bound)
+            {
+                l_lower = l_bound;
+            }
+            if(m_has_upper_bounds[l_variable_index] && l_upper < l_lower - l_tolerance)
+            {
+                return false;
+            }
+            m_rows[l_row_index].clear();
+            m_removed_rows[l_row_index] = true;
+            ++m_report.m_nb_singleton_rows;
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_presolve<COEF_TYPE>::reduce_duplicate_rows()
+    {
+        typedef std::pair<t_equation_type, std::map<unsigned int, COEF_TYPE>> t_row_key;
+        std::map<t_row_key, unsigned int> l_rows;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(m_removed_rows[l_row_index])
+            {
+                continue;
+            }
+            t_equation_type l_type = m_equation_types[l_row_index];
+            auto l_insert = l_rows.insert(typename std::map<t_row_key, unsigned int>::value_type(t_row_key(l_type, m_rows[l_row_index]), l_row_index));
+            if(l_insert.second)
+            {
+                continue;
+            }
+            // Most restrictive B coefficient is kept
+            COEF_TYPE & l_kept_B_coef = m_B_coefs[l_insert.first->second];
+            const COEF_TYPE & l_B_coef = m_B_coefs[l_row_index];
+            switch(l_type)
+            {
+                case t_equation_type::INEQUATION_LT:
+                    if(l_B_coef < l_kept_B_coef)
+                    {
+                        l_kept_B_coef = l_B_coef;
+                    }
+                    break;
+                case t_equation_type::INEQUATION_GT:
+                    if(l_kept_B_coef < l_B_coef)
+                    {
+                        l_kept_B_coef = l_B_coef;
+                    }
+                    break;
+                case t_equation_type::EQUATION:
+                    if(!is_null(l_kept_B_coef - l_B_coef))
+                    {
+                        return false;
+                    }
+                    break;
+                default:
+                    throw quicky_exception::quicky_logic_exception("Unexpected equation_type value : "+ std::to_string((unsigned int)l_type),__LINE__,__FILE__);
+            }
+            m_rows[l_row_index].clear();
+            m_removed_rows[l_row_index] = true;
+            ++m_report.m_nb_duplicate_rows;
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_presolve<COEF_TYPE>::reduce_columns(bool & p_infinite)
+    {
+        // A variable is locked upward (resp. downward) if increasing (resp.
+        // decreasing) it can violate an equation
+        std::vector<bool> l_up_locked(m_nb_variables, false);
+        std::vector<bool> l_down_locked(m_nb_variables, false);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(m_removed_rows[l_row_index])
+            {
+                continue;
+            }
+            t_equation_type l_type = m_equation_types[l_row_index];
+            for(auto l_iter: m_rows[l_row_index])
+            {
+                bool l_positive = COEF_TYPE(0) < l_iter.second;
+                if(t_equation_type::EQUATION == l_type || (t_equation_type::INEQUATION_LT == l_type) == l_positive)
+                {
+                    l_up_locked[l_iter.first] = true;
+                }
+                if(t_equation_type::EQUATION == l_type || (t_equation_type::INEQUATION_GT == l_type) == l_positive)
+                {
+                    l_down_locked[l_iter.first] = true;
+                }
+            }
+        }
+
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(m_removed_columns[l_variable_index])
+            {
+                continue;
+            }
+            const COEF_TYPE & l_Z_coef = m_Z_coefs[l_variable_index];
+            bool l_has_upper = m_has_upper_bounds[l_variable_index];
+            if(l_has_upper && is_null(m_upper_bounds[l_variable_index] - m_lower_bounds[l_variable_index]))
+            {
+                fix_column(l_variable_index, m_lower_bounds[l_variable_index]);
+                ++m_report.m_nb_fixed_columns;
+            }
+            else if(!(COEF_TYPE(0) < l_Z_coef) && !l_down_locked[l_variable_index])
+            {
+                fix_column(l_variable_index, m_lower_bounds[l_variable_index]);
+                ++m_report.m_nb_dominated_columns;
+            }
+            else if(!(l_Z_coef < COEF_TYPE(0)) && !l_up_locked[l_variable_index])
+            {
+                if(l_has_upper)
+                {
+                    fix_column(l_variable_index, m_upper_bounds[l_variable_index]);
+                    ++m_report.m_nb_dominated_columns;
+                }
+                else if(COEF_TYPE(0) < l_Z_coef)
+                {
+                    p_infinite = true;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::fix_column(unsigned int p_variable_index,
+                                            const COEF_TYPE & p_value
+                                           )
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            auto l_iter = m_rows[l_row_index].find(p_variable_index);
+            if(m_rows[l_row_index].end() != l_iter)
+            {
+                m_B_coefs[l_row_index] = m_B_coefs[l_row_index] - l_iter->second * p_value;
+                m_rows[l_row_index].erase(l_iter);
+            }
+        }
+        m_Z0 = m_Z0 + m_Z_coefs[p_variable_index] * p_value;
+        m_column_values[p_variable_index] = p_value;
+        m_removed_columns[p_variable_index] = true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_presolve<COEF_TYPE>::build_reduced_problem()
+    {
+        m_reduced_columns.clear();
+        m_bounded_columns.clear();
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(m_removed_columns[l_variable_index])
+            {
+                continue;
+            }
+            if(m_has_upper_bounds[l_variable_index])
+            {
+                m_bounded_columns.push_back((unsigned int)m_reduced_columns.size());
+            }
+            // Translation of variable by its lower bound
+            m_Z0 = m_Z0 + m_Z_coefs[l_variable_index] * m_lower_bounds[l_variable_index];
+            m_reduced_columns.push_back(l_variable_index);
+        }
+        m_reduced_rows.clear();
+        m_nb_reduced_inequations_lt = (unsigned int)m_bounded_columns.size();
+        m_nb_reduced_equations = 0;
+        m_nb_reduced_inequations_gt = 0;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(m_removed_rows[l_row_index])
+            {
+                continue;
+            }
+            m_reduced_rows.push_back(l_row_index);
+            switch(m_equation_types[l_row_index])
+            {
+                case t_equation_type::INEQUATION_LT:
+                    ++m_nb_reduced_inequations_lt;
+                    break;
+                case t_equation_type::EQUATION:
+                    ++m_nb_reduced_equations;
+                    break;
+                case t_equation_type::INEQUATION_GT:
+                    ++m_nb_reduced_inequations_gt;
+                    break;
+                default:
+                    throw quicky_exception::quicky_logic_exception("Unexpected equation_type value : "+ std::to_string((unsigned int)m_equation_types[l_row_index]),__LINE__,__FILE__);
+            }
+        }
+        m_presolved = true;
+    }
+}
+#endif //SIMPLEX_PRESOLVE_H
+// EOF
@@ -0,0 +1,124 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_PRESOLVE_REPORT_H
+#define SIMPLEX_PRESOLVE_REPORT_H
+
+#include <chrono>
+#include <iostream>
+
+namespace simplex
+{
+    /**
+     * Number of reductions done by presolve and time spent
+     */
+    class simplex_presolve_report
+    {
+      public:
+        inline
+        simplex_presolve_report();
+
+        /**
+         * Number of equations without coefficient removed
+         */
+        unsigned int m_nb_empty_rows;
+
+        /**
+         * Number of equations with a single coefficient replaced by a
+         * variable bound
+         */
+        unsigned int m_nb_singleton_rows;
+
+        /**
+         * Number of equations identical to another one
+         */
+        unsigned int m_nb_duplicate_rows;
+
+        /**
+         * Number of variables whose lower and upper bounds are equal
+         */
+        unsigned int m_nb_fixed_columns;
+
+        /**
+         * Number of variables set to one of their bounds because each
+         * equation and objective function prefer this bound
+         */
+        unsigned int m_nb_dominated_columns;
+
+        /**
+         * Time spent in presolve
+         */
+        std::chrono::microseconds m_duration;
+
+        /**
+         * Return number of removed equations
+         * @return number of removed equations
+         */
+        inline
+        unsigned int
+        get_nb_removed_rows() const;
+
+        /**
+         * Return number of removed variables
+         * @return number of removed variables
+         */
+        inline
+        unsigned int
+        get_nb_removed_columns() const;
+    };
+
+    //-------------------------------------------------------------------------
+    simplex_presolve_report::simplex_presolve_report()
+    :m_nb_empty_rows(0)
+    ,m_nb_singleton_rows(0)
+    ,m_nb_duplicate_rows(0)
+    ,m_nb_fixed_columns(0)
+    ,m_nb_dominated_columns(0)
+    ,m_duration(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    unsigned int
+    simplex_presolve_report::get_nb_removed_rows() const
+    {
+        return m_nb_empty_rows + m_nb_singleton_rows + m_nb_duplicate_rows;
+    }
+
+    //-------------------------------------------------------------------------
+    unsigned int
+    simplex_presolve_report::get_nb_removed_columns() const
+    {
+        return m_nb_fixed_columns + m_nb_dominated_columns;
+    }
+
+    //-------------------------------------------------------------------------
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream,
+               const simplex_presolve_report & p_report
+              )
+    {
+        p_stream << "Presolve removed " << p_report.get_nb_removed_rows() << " rows (empty " << p_report.m_nb_empty_rows;
+        p_stream << ", singleton " << p_report.m_nb_singleton_rows << ", duplicate " << p_report.m_nb_duplicate_rows << ")";
+        p_stream << " and " << p_report.get_nb_removed_columns() << " columns (fixed " << p_report.m_nb_fixed_columns;
+        p_stream << ", dominated " << p_report.m_nb_dominated_columns << ") in " << p_report.m_duration.count() << " us";
+        return p_stream;
+    }
+}
+#endif //SIMPLEX_PRESOLVE_REPORT_H
+// EOF
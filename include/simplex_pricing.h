@@ -0,0 +1,610 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_PRICING_H
+#define SIMPLEX_PRICING_H
+
+#include "simplex_tolerance.h"
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+/**
+ * Pricing policies used by simplex solvers to select input variable.
+ * A policy provides following methods:
+ * - reset(nb_equations, nb_all_variables) called before first iteration
+ * - select_input_variable(view, variable_index) returning true if an input
+ *   variable improving objective was found
+ * - notify_pivot(view, row_index, column_index) called before each pivot
+ *   so that policy can update its internal data
+ * Base variables and Z coefficients that are negative only because of
+ * rounding errors are never selected.
+ * The view give read access to the current simplex array through methods
+ * get_nb_all_variables(), get_nb_total_equations(), get_Z_coef(column),
+ * get_coef(row, column), get_base_variable(row) and is_base_variable(column)
+ */
+namespace simplex
+{
+    /**
+     * Select the first variable with a negative Z coefficient
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_pricing_first
+    {
+      public:
+        inline
+        void reset(unsigned int p_nb_equations
+                  ,unsigned int p_nb_all_variables
+                  );
+
+        template <typename VIEW>
+        inline
+        bool select_input_variable(const VIEW & p_view
+                                  ,unsigned int & p_variable_index
+                                  );
+
+        template <typename VIEW>
+        inline
+        void notify_pivot(const VIEW & p_view
+                         ,unsigned int p_row_index
+                         ,unsigned int p_column_index
+                         );
+    };
+
+    /**
+     * Dantzig rule: select the variable with the most negative Z coefficient
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_pricing_dantzig
+    {
+      public:
+        inline
+        void reset(unsigned int p_nb_equations
+                  ,unsigned int p_nb_all_variables
+                  );
+
+        template <typename VIEW>
+        inline
+        bool select_input_variable(const VIEW & p_view
+                                  ,unsigned int & p_variable_index
+                                  );
+
+        template <typename VIEW>
+        inline
+        void notify_pivot(const VIEW & p_view
+                         ,unsigned int p_row_index
+                         ,unsigned int p_column_index
+                         );
+    };
+
+    /**
+     * Partial pricing: columns are scanned by segments starting where the
+     * previous scan stopped. Most negative Z coefficient of the first segment
+     * containing candidates is selected
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_pricing_partial
+    {
+      public:
+        inline
+        simplex_pricing_partial();
+
+        /**
+         * Define number of columns scanned in a segment
+         * @param p_segment_size number of columns, 0 means automatic size
+         */
+        inline
+        void set_segment_size(unsigned int p_segment_size);
+
+        inline
+        void reset(unsigned int p_nb_equations
+                  ,unsigned int p_nb_all_variables
+                  );
+
+        template <typename VIEW>
+        inline
+        bool select_input_variable(const VIEW & p_view
+                                  ,unsigned int & p_variable_index
+                                  );
+
+        template <typename VIEW>
+        inline
+        void notify_pivot(const VIEW & p_view
+                         ,unsigned int p_row_index
+                         ,unsigned int p_column_index
+                         );
+
+      private:
+        /**
+         * Segment size requested by user, 0 means automatic
+         */
+        unsigned int m_requested_segment_size;
+
+        /**
+         * Segment size used for current resolution
+         */
+        unsigned int m_segment_size;
+
+        /**
+         * Column where next scan starts
+         */
+        unsigned int m_start;
+    };
+
+    /**
+     * Devex pricing: Z coefficients are compared relatively to reference
+     * weights approximating steepest edge norms. Weights are updated at
+     * each pivot from pivot row. COEF_TYPE should be convertible to double
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_pricing_devex
+    {
+      public:
+        inline
+        void reset(unsigned int p_nb_equations
+                  ,unsigned int p_nb_all_variables
+                  );
+
+        template <typename VIEW>
+        inline
+        bool select_input_variable(const VIEW & p_view
+                                  ,unsigned int & p_variable_index
+                                  );
+
+        template <typename VIEW>
+        inline
+        void notify_pivot(const VIEW & p_view
+                         ,unsigned int p_row_index
+                         ,unsigned int p_column_index
+                         );
+
+      private:
+        /**
+         * Reference weight of each variable
+         */
+        std::vector<double> m_weights;
+    };
+
+    /**
+     * Steepest edge pricing: Z coefficient are compared relatively to the
+     * norm of the edge direction 1 + sum of squared column coefficients.
+     * Norms are computed from the simplex array at first selection then
+     * updated at each pivot with Goldfarb-Reid recurrence that only reads
+     * rows with a non null coefficient in pivot column.
+     * COEF_TYPE should be convertible to double
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_pricing_steepest_edge
+    {
+      public:
+        inline
+        void reset(unsigned int p_nb_equations
+                  ,unsigned int p_nb_all_variables
+                  );
+
+        template <typename VIEW>
+        inline
+        bool select_input_variable(const VIEW & p_view
+                                  ,unsigned int & p_variable_index
+                                  );
+
+        template <typename VIEW>
+        inline
+        void notify_pivot(const VIEW & p_view
+                         ,unsigned int p_row_index
+                         ,unsigned int p_column_index
+                         );
+
+      private:
+        /**
+         * Squared norm of edge direction of each non base variable
+         */
+        std::vector<double> m_weights;
+
+        /**
+         * Columns whose norm is modified by current pivot
+         */
+        std::vector<unsigned int> m_updated_columns;
+
+        /**
+         * Scalar product of updated columns with pivot column
+         */
+        std::vector<double> m_dots;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_first<COEF_TYPE>::reset(unsigned int
+                                           ,unsigned int
+                                           )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    bool
+    simplex_pricing_first<COEF_TYPE>::select_input_variable(const VIEW & p_view
+                                                           ,unsigned int & p_variable_index
+                                                           )
+    {
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            if(!p_view.is_base_variable(l_index) && p_view.get_Z_coef(l_index) < -simplex_tolerance<COEF_TYPE>::get())
+            {
+                p_variable_index = l_index;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    void
+    simplex_pricing_first<COEF_TYPE>::notify_pivot(const VIEW &
+                                                  ,unsigned int
+                                                  ,unsigned int
+                                                  )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_dantzig<COEF_TYPE>::reset(unsigned int
+                                             ,unsigned int
+                                             )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    bool
+    simplex_pricing_dantzig<COEF_TYPE>::select_input_variable(const VIEW & p_view
+                                                             ,unsigned int & p_variable_index
+                                                             )
+    {
+        bool l_found = false;
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            const COEF_TYPE & l_coef = p_view.get_Z_coef(l_index);
+            if(l_coef < -simplex_tolerance<COEF_TYPE>::get() && !p_view.is_base_variable(l_index) && (!l_found || l_coef < p_view.get_Z_coef(p_variable_index)))
+            {
+                p_variable_index = l_index;
+                l_found = true;
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    void
+    simplex_pricing_dantzig<COEF_TYPE>::notify_pivot(const VIEW &
+                                                    ,unsigned int
+                                                    ,unsigned int
+                                                    )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_pricing_partial<COEF_TYPE>::simplex_pricing_partial()
+    :m_requested_segment_size(0)
+    ,m_segment_size(1)
+    ,m_start(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_partial<COEF_TYPE>::set_segment_size(unsigned int p_segment_size)
+    {
+        m_requested_segment_size = p_segment_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_partial<COEF_TYPE>::reset(unsigned int
+                                             ,unsigned int p_nb_all_variables
+                                             )
+    {
+        m_start = 0;
+        if(m_requested_segment_size)
+        {
+            m_segment_size = m_requested_segment_size;
+        }
+        else
+        {
+            // Use roughly the square root of number of columns
+            m_segment_size = 1;
+            while(m_segment_size * m_segment_size < p_nb_all_variables)
+            {
+                ++m_segment_size;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    bool
+    simplex_pricing_partial<COEF_TYPE>::select_input_variable(const VIEW & p_view
+                                                             ,unsigned int & p_variable_index
+                                                             )
+    {
+        unsigned int l_nb_variables = p_view.get_nb_all_variables();
+        if(!l_nb_variables)
+        {
+            return false;
+        }
+        assert(m_segment_size);
+        m_start = m_start % l_nb_variables;
+        unsigned int l_nb_checked = 0;
+        bool l_found = false;
+        while(l_nb_checked < l_nb_variables)
+        {
+            unsigned int l_segment_end = std::min(l_nb_checked + m_segment_size, l_nb_variables);
+            for(; l_nb_checked < l_segment_end; ++l_nb_checked)
+            {
+                unsigned int l_index = (m_start + l_nb_checked) % l_nb_variables;
+                const COEF_TYPE & l_coef = p_view.get_Z_coef(l_index);
+                if(l_coef < -simplex_tolerance<COEF_TYPE>::get() && !p_view.is_base_variable(l_index) && (!l_found || l_coef < p_view.get_Z_coef(p_variable_index)))
+                {
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+            if(l_found)
+            {
+                m_start = (m_start + l_nb_checked) % l_nb_variables;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    void
+    simplex_pricing_partial<COEF_TYPE>::notify_pivot(const VIEW &
+                                                    ,unsigned int
+                                                    ,unsigned int
+                                                    )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_devex<COEF_TYPE>::reset(unsigned int
+                                           ,unsigned int p_nb_all_variables
+                                           )
+    {
+        // Reference framework is made of initial non base variables
+        m_weights.assign(p_nb_all_variables, 1.0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    bool
+    simplex_pricing_devex<COEF_TYPE>::select_input_variable(const VIEW & p_view
+                                                           ,unsigned int & p_variable_index
+                                                           )
+    {
+        assert(m_weights.size() == p_view.get_nb_all_variables());
+        bool l_found = false;
+        double l_best = 0.0;
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            const COEF_TYPE & l_coef = p_view.get_Z_coef(l_index);
+            if(l_coef < -simplex_tolerance<COEF_TYPE>::get() && !p_view.is_base_variable(l_index))
+            {
+                double l_value = static_cast<double>(l_coef);
+                double l_score = l_value * l_value / m_weights[l_index];
+                if(!l_found || l_score > l_best)
+                {
+                    l_best = l_score;
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    void
+    simplex_pricing_devex<COEF_TYPE>::notify_pivot(const VIEW & p_view
+                                                  ,unsigned int p_row_index
+                                                  ,unsigned int p_column_index
+                                                  )
+    {
+        double l_pivot = static_cast<double>(p_view.get_coef(p_row_index, p_column_index));
+        assert(l_pivot);
+        double l_input_weight = m_weights[p_column_index];
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            if(l_index == p_column_index || p_view.is_base_variable(l_index))
+            {
+                continue;
+            }
+            double l_ratio = static_cast<double>(p_view.get_coef(p_row_index, l_index)) / l_pivot;
+            if(l_ratio)
+            {
+                m_weights[l_index] = std::max(m_weights[l_index], l_ratio * l_ratio * l_input_weight);
+            }
+        }
+        unsigned int l_output_variable_index = p_view.get_base_variable(p_row_index);
+        m_weights[l_output_variable_index] = std::max(l_input_weight / (l_pivot * l_pivot), 1.0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_pricing_steepest_edge<COEF_TYPE>::reset(unsigned int
+                                                   ,unsigned int
+                                                   )
+    {
+        // Norms are computed at first selection as array is needed
+        m_weights.clear();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    bool
+    simplex_pricing_steepest_edge<COEF_TYPE>::select_input_variable(const VIEW & p_view
+                                                                   ,unsigned int & p_variable_index
+                                                                   )
+    {
+        if(m_weights.empty())
+        {
+            m_weights.assign(p_view.get_nb_all_variables(), 1.0);
+            for(unsigned int l_row_index = 0;
+                l_row_index < p_view.get_nb_total_equations();
+                ++l_row_index
+               )
+            {
+                for(unsigned int l_index = 0;
+                    l_index < p_view.get_nb_all_variables();
+                    ++l_index
+                   )
+                {
+                    double l_column_coef = static_cast<double>(p_view.get_coef(l_row_index, l_index));
+                    m_weights[l_index] += l_column_coef * l_column_coef;
+                }
+            }
+        }
+        assert(m_weights.size() == p_view.get_nb_all_variables());
+        bool l_found = false;
+        double l_best = 0.0;
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            const COEF_TYPE & l_coef = p_view.get_Z_coef(l_index);
+            if(l_coef < -simplex_tolerance<COEF_TYPE>::get() && !p_view.is_base_variable(l_index))
+            {
+                double l_value = static_cast<double>(l_coef);
+                double l_score = l_value * l_value / m_weights[l_index];
+                if(!l_found || l_score > l_best)
+                {
+                    l_best = l_score;
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename VIEW>
+    void
+    simplex_pricing_steepest_edge<COEF_TYPE>::notify_pivot(const VIEW & p_view
+                                                          ,unsigned int p_row_index
+                                                          ,unsigned int p_column_index
+                                                          )
+    {
+        assert(!m_weights.empty());
+        double l_pivot = static_cast<double>(p_view.get_coef(p_row_index, p_column_index));
+        assert(l_pivot);
+        // Only non base columns with a non null coefficient in pivot row
+        // have their norm modified
+        m_updated_columns.clear();
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            if(l_index != p_column_index && !p_view.is_base_variable(l_index) && p_view.get_coef(p_row_index, l_index))
+            {
+                m_updated_columns.push_back(l_index);
+            }
+        }
+        // Products of updated columns with pivot column, accumulated row by
+        // row to follow storage of arrays
+        m_dots.assign(m_updated_columns.size(), 0.0);
+        for(unsigned int l_row_index = 0;
+            l_row_index < p_view.get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            double l_column_coef = static_cast<double>(p_view.get_coef(l_row_index, p_column_index));
+            if(l_column_coef)
+            {
+                for(unsigned int l_updated_index = 0;
+                    l_updated_index < m_updated_columns.size();
+                    ++l_updated_index
+                   )
+                {
+                    m_dots[l_updated_index] += static_cast<double>(p_view.get_coef(l_row_index, m_updated_columns[l_updated_index])) * l_column_coef;
+                }
+            }
+        }
+        // With r = a[row][j] / pivot and d = column j . pivot column, norm
+        // of column j after pivot is exactly w[j] - 2 * r * d + r^2 * w[q]
+        double l_input_weight = m_weights[p_column_index];
+        for(unsigned int l_updated_index = 0;
+            l_updated_index < m_updated_columns.size();
+            ++l_updated_index
+           )
+        {
+            unsigned int l_index = m_updated_columns[l_updated_index];
+            double l_ratio = static_cast<double>(p_view.get_coef(p_row_index, l_index)) / l_pivot;
+            // Rounding errors could make weight smaller than the norm
+            // contribution of pivot row alone
+            m_weights[l_index] = std::max(m_weights[l_index] - 2 * l_ratio * m_dots[l_updated_index] + l_ratio * l_ratio * l_input_weight, 1.0 + l_ratio * l_ratio);
+        }
+        unsigned int l_output_variable_index = p_view.get_base_variable(p_row_index);
+        m_weights[l_output_variable_index] = std::max(l_input_weight / (l_pivot * l_pivot), 1.0);
+    }
+
+}
+#endif //SIMPLEX_PRICING_H
+// EOF
@@ -0,0 +1,146 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_RANGE_H
+#define SIMPLEX_RANGE_H
+
+#include "simplex_tolerance.h"
+#include <iostream>
+
+namespace simplex
+{
+    /**
+     * Allowable decrease and increase of a coefficient for which final base
+     * of a search stays optimal. Default range is not limited
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_range
+    {
+      public:
+        inline
+        simplex_range();
+
+        /**
+         * Reduce range so that p_value + t * p_direction stays positive for
+         * any change t of coefficient in range
+         * @param p_value current value that should stay positive
+         * @param p_direction variation of value when coefficient increases by 1
+         */
+        inline
+        void
+        restrict(const COEF_TYPE & p_value,
+                 const COEF_TYPE & p_direction
+                );
+
+        /**
+         * Maximum decrease of coefficient, meaningful only if
+         * m_decrease_limited is true
+         */
+        COEF_TYPE m_decrease;
+
+        /**
+         * Indicate if decrease of coefficient is limited
+         */
+        bool m_decrease_limited;
+
+        /**
+         * Maximum increase of coefficient, meaningful only if
+         * m_increase_limited is true
+         */
+        COEF_TYPE m_increase;
+
+        /**
+         * Indicate if increase of coefficient is limited
+         */
+        bool m_increase_limited;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_range<COEF_TYPE>::simplex_range()
+    :m_decrease(0)
+    ,m_decrease_limited(false)
+    ,m_increase(0)
+    ,m_increase_limited(false)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_range<COEF_TYPE>::restrict(const COEF_TYPE & p_value,
+                                       const COEF_TYPE & p_direction
+                                      )
+    {
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        if(!(l_tolerance < p_direction) && !(p_direction < -l_tolerance))
+        {
+            return;
+        }
+        // Values slightly negative because of rounding are considered as null
+        COEF_TYPE l_value = p_value < COEF_TYPE(0) ? COEF_TYPE(0) : p_value;
+        if(p_direction < COEF_TYPE(0))
+        {
+            COEF_TYPE l_increase = l_value / -p_direction;
+            if(!m_increase_limited || l_increase < m_increase)
+            {
+                m_increase = l_increase;
+                m_increase_limited = true;
+            }
+        }
+        else
+        {
+            COEF_TYPE l_decrease = l_value / p_direction;
+            if(!m_decrease_limited || l_decrease < m_decrease)
+            {
+                m_decrease = l_decrease;
+                m_decrease_limited = true;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    std::ostream &
+    operator<<(std::ostream & p_stream,
+               const simplex_range<COEF_TYPE> & p_range
+              )
+    {
+        p_stream << "[-";
+        if(p_range.m_decrease_limited)
+        {
+            p_stream << p_range.m_decrease;
+        }
+        else
+        {
+            p_stream << "inf";
+        }
+        p_stream << ",+";
+        if(p_range.m_increase_limited)
+        {
+            p_stream << p_range.m_increase;
+        }
+        else
+        {
+            p_stream << "inf";
+        }
+        return p_stream << "]";
+    }
+}
+#endif //SIMPLEX_RANGE_H
+// EOF
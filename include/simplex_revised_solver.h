@@ -0,0 +1,1290 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_REVISED_SOLVER_H
+#define SIMPLEX_REVISED_SOLVER_H
+
+#include "simplex_solver_base.h"
+#include "simplex_basis_factorization.h"
+#include "simplex_tolerance.h"
+#include "simplex_listener.h"
+#include "simplex_array.h"
+#include "quicky_exception.h"
+#include <type_traits>
+#include <cassert>
+#include <iostream>
+#include <vector>
+#include <limits>
+
+namespace simplex
+{
+    /**
+     * Revised simplex solver
+     * Coefficients stored in simplex array are never modified by pivots. Only
+     * an LU factorization of base matrix B is maintained so that each
+     * iteration computes the Z row through y = cB B^-1 and only the column
+     * of input variable through B^-1 a
+     * @tparam COEF_TYPE Type of coefficients, division should be exact or
+     * floating point
+     * @tparam ARRAY_TYPE Type of array storing original coefficients
+     */
+    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>>
+    class simplex_revised_solver: public simplex_solver_base<COEF_TYPE,ARRAY_TYPE>
+    {
+      public:
+        simplex_revised_solver() = delete;
+
+        /**
+         * This constructor prepare a simplex in Canonical form
+         * Max z = cx
+         * a1 * x1 + a2 * x2 + ... + an * xn <= bn
+         * xi >= 0 for all xi
+         */
+        inline
+        simplex_revised_solver(unsigned int p_nb_variables
+                              ,unsigned int p_nb_inequations_lt
+                              ,unsigned int p_nb_equations
+                              ,unsigned int p_nb_inequations_gt
+                              );
+
+        /**
+         * Method implementing revised simplex algorithm to find max optimum
+         * solution. Search starts from base variables when they define a
+         * feasible base, otherwise a first phase with artificial variables
+         * builds one from adjustment variables
+         * @param p_max reference on variable where result will be stored
+         * @param p_infinite reference on a boolean value that will receive true
+         * if max is infinite
+         * @param p_listener optional listener to treat iterations information
+         * @return value indicating if a max was found, false with infinite
+         * set to false means that problem has no feasible solution
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_max(COEF_TYPE & p_max
+                ,bool & p_infinite
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing revised simplex algorithm to find max optimum
+         * solution within limits of search options
+         * @param p_max reference on variable receiving optimum, or objective
+         * function value of current feasible base when search is stopped
+         * @param p_options search limits
+         * @param p_listener optional listener to treat iterations information
+         * @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_max(COEF_TYPE & p_max
+                ,const simplex_solve_options<COEF_TYPE> & p_options
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing revised simplex algorithm to find min optimum
+         * solution
+         * @param p_min reference on variable where result will be stored
+         * @param p_infinite reference on a boolean value that will receive true
+         * if min is infinite
+         * @param p_listener optional listener to treat iterations information
+         * @return value indicating if a min was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_min(COEF_TYPE & p_min
+                ,bool & p_infinite
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing revised simplex algorithm to find min optimum
+         * solution within limits of search options
+         * @param p_min reference on variable where result will be stored
+         * @param p_options search limits
+         * @param p_listener optional listener to treat iterations information
+         * @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_min(COEF_TYPE & p_min
+                ,const simplex_solve_options<COEF_TYPE> & p_options
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Method implementing dual revised simplex algorithm to find max
+         * optimum solution. Base variables should define a dual feasible
+         * base, typically the optimal base of a previous search after B
+         * coefficients have been modified
+         * @param p_max reference on variable where result will be stored
+         * @param p_infeasible reference on a boolean value that will receive
+         * true if problem has no feasible solution
+         * @param p_listener optional listener to treat iterations information
+         * @return value indicating if a max was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_max_dual(COEF_TYPE & p_max
+                     ,bool & p_infeasible
+                     ,LISTENER * p_listener = NULL
+                     );
+
+        /**
+         * Return value of variables
+         * @return value of variables
+         */
+        inline
+        std::vector<COEF_TYPE> get_variable_values() const override;
+
+        /**
+         * Display original coefficients and current base
+         * @param p_stream stream where the display should be done
+         * @return the modified stream
+         */
+        inline
+        std::ostream & display_array(std::ostream & p_stream) const override;
+
+        /**
+         * Define number of base changes after which base matrix is
+         * factorized again instead of applying eta matrices
+         * @param p_period number of base changes
+         */
+        inline
+        void set_refactorization_period(unsigned int p_period);
+
+        /**
+         * Define base variables from a basis returned by get_basis. Base
+         * matrix is factorized once so that a singular basis is reported
+         * immediately. Equation order of basis is kept
+         * @param p_basis index of base variable of each equation, maximum
+         * value of unsigned int if none
+         */
+        inline
+        void set_basis(const std::vector<unsigned int> & p_basis) override;
+
+        /**
+         * Variable bounds are not supported by revised solver so variable
+         * is fixed by a pair of inequations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value value of variable
+         */
+        inline
+        void fix_variable(const unsigned int p_variable_index
+                         ,const COEF_TYPE & p_value
+                         ) override;
+
+      private:
+
+        /**
+         * Method performing pivot to change the base: base factorization and
+         * base variable values are updated. Column of input variable
+         * should have been computed by compute_input_column
+         * @param p_row_index Row index
+         * @param p_column_index Column index
+         */
+        inline
+        void pivot(const unsigned int p_row_index
+                  ,const unsigned int p_column_index
+                  ) override;
+
+        /**
+         * Method to determine the equation index corresponding to next output
+         * variable for pivot operation. Column of input variable should have
+         * been computed by compute_input_column
+         * @param p_input_variable_index index of input variable
+         * @param p_equation_index reference on variable where to store the
+         * output equation index if any
+         * @return boolean indicating if an output equation was found
+         */
+        inline
+        bool
+        get_output_equation_index(unsigned int p_input_variable_index
+                                 ,unsigned int & p_equation_index
+                                 ) const override;
+
+        /**
+         * Build column storage of original coefficients if they changed
+         * since it was last built, factorize base matrix and compute base
+         * variable values
+         */
+        inline
+        void prepare();
+
+        /**
+         * Factorize base matrix from current base variables and compute
+         * base variable values from B coefficients
+         */
+        inline
+        void refactorize();
+
+        /**
+         * Compute Z coefficient of non base variables in current base and
+         * select the first one that is negative
+         * @param p_variable_index reference on variable where to store the
+         * input variable index if any
+         * @return boolean indicating if an input variable was found
+         */
+        inline
+        bool
+        price_input_variable_index(unsigned int & p_variable_index);
+
+        /**
+         * Compute simplex multipliers y = cB B^-1 of current base
+         * @param p_y vector where multipliers will be stored
+         */
+        inline
+        void compute_multipliers(std::vector<COEF_TYPE> & p_y) const;
+
+        /**
+         * Compute Z coefficient of a variable in current base
+         * @param p_variable_index variable index
+         * @param p_y simplex multipliers of current base
+         * @return Z coefficient
+         */
+        inline
+        COEF_TYPE compute_Z_coef(unsigned int p_variable_index
+                                ,const std::vector<COEF_TYPE> & p_y
+                                ) const;
+
+        /**
+         * Compute variation of Z0 when B coefficient of each equation
+         * increases by 1: opposite of simplex multipliers
+         * @param p_duals vector receiving variation for each equation
+         */
+        inline
+        void compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const override;
+
+        /**
+         * Compute Z coefficient of each variable in current base
+         * @param p_Z_coefs vector receiving Z coefficient of each variable
+         */
+        inline
+        void compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const override;
+
+        /**
+         * Compute value of base variable of each equation
+         * @param p_values vector receiving value of each base variable
+         */
+        inline
+        void compute_base_values(std::vector<COEF_TYPE> & p_values) const override;
+
+        /**
+         * Compute B^-1 e where e is the unit vector of an equation
+         * @param p_equation_index index of equation
+         * @param p_direction vector receiving variation of base variable of
+         * each equation
+         */
+        inline
+        void compute_B_coef_direction(unsigned int p_equation_index
+                                     ,std::vector<COEF_TYPE> & p_direction
+                                     ) const override;
+
+        /**
+         * Compute row of B^-1 A corresponding to an equation
+         * @param p_row_index index of equation
+         * @param p_row vector receiving coefficient of each variable
+         */
+        inline
+        void compute_base_row(unsigned int p_row_index
+                             ,std::vector<COEF_TYPE> & p_row
+                             ) const override;
+
+        /**
+         * Check that a factorization of final base is available
+         */
+        inline
+        void check_factorization() const;
+
+        /**
+         * Compute B^-1 a for column of input variable
+         * @param p_variable_index input variable index
+         */
+        inline
+        void compute_input_column(unsigned int p_variable_index);
+
+        /**
+         * Primal simplex iterations until current objective function cannot
+         * be increased anymore
+         * @param p_nb_iteration iteration counter incremented by each iteration
+         * @param p_control limits of search
+         * @param p_check_cutoff true if objective function is the original
+         * one so that cutoff can be checked
+         * @param p_listener optional listener to treat iterations information
+         * @return OPTIMAL when no input variable remains, UNBOUNDED if
+         * objective function is not bounded or limit that stopped search
+         */
+        template <class LISTENER>
+        t_solve_status
+        primal_iterations(unsigned int & p_nb_iteration
+                         ,const simplex_solve_control<COEF_TYPE> & p_control
+                         ,bool p_check_cutoff
+                         ,LISTENER * p_listener
+                         );
+
+        /**
+         * Replace artificial variables remaining in base at the end of first
+         * phase by any non base variable having a non null coefficient in
+         * their row
+         */
+        inline
+        void remove_artificial_base_variables();
+
+        /**
+         * Indicate if an artificial variable has a positive value in current
+         * base meaning that last search stopped before first phase found a
+         * feasible base
+         * @return true if first phase should be continued
+         */
+        inline
+        bool has_positive_artificial_variable() const;
+
+        /**
+         * Search max with primal algorithm, used by dual algorithm when base
+         * is not a base of the problem
+         * @param p_max reference on variable where to store max
+         * @param p_infeasible reference on variable where to store if problem
+         * is infeasible
+         * @param p_listener optional listener to treat iterations information
+         * @return true if max is found
+         */
+        template <class LISTENER>
+        bool
+        find_max_primal(COEF_TYPE & p_max
+                       ,bool & p_infeasible
+                       ,LISTENER * p_listener
+                       );
+
+        /**
+         * Number of base changes after which base matrix is factorized again
+         */
+        unsigned int m_refactorization_period;
+
+        /**
+         * Factorization of base matrix
+         */
+        simplex_basis_factorization<COEF_TYPE> m_factorization;
+
+        /**
+         * Compressed column storage of original coefficients including
+         * adjustment variables: column j coefficients are stored between
+         * m_column_starts[j] and m_column_starts[j + 1]
+         */
+        std::vector<unsigned int> m_column_starts;
+
+        /**
+         * Row index of each stored coefficient
+         */
+        std::vector<unsigned int> m_column_rows;
+
+        /**
+         * Value of each stored coefficient
+         */
+        std::vector<COEF_TYPE> m_column_values;
+
+        /**
+         * Revision of coefficients when column storage was built
+         */
+        unsigned long long m_columns_revision;
+
+        /**
+         * Indicate if column storage has been built
+         */
+        bool m_columns_prepared;
+
+        /**
+         * Value of base variable stored in each row
+         */
+        std::vector<COEF_TYPE> m_base_values;
+
+        /**
+         * B^-1 a for current input variable
+         */
+        std::vector<COEF_TYPE> m_input_column;
+
+        /**
+         * Z coefficient of current input variable
+         */
+        COEF_TYPE m_input_Z_coef;
+
+        /**
+         * Objective value of current base
+         */
+        COEF_TYPE m_Z0;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::simplex_revised_solver(unsigned int p_nb_variables
+                                                                        ,unsigned int p_nb_inequations_lt
+                                                                        ,unsigned int p_nb_equations
+                                                                        ,unsigned int p_nb_inequations_gt
+                                                                        )
+    :simplex_solver_base<COEF_TYPE,ARRAY_TYPE>(p_nb_variables
+                                              ,p_nb_inequations_lt
+                                              ,p_nb_equations
+                                              ,p_nb_inequations_gt
+                                              )
+    ,m_refactorization_period(100)
+    ,m_factorization(p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt, m_refactorization_period)
+    ,m_columns_revision(0)
+    ,m_columns_prepared(false)
+    ,m_input_Z_coef(0)
+    ,m_Z0(0)
+    {
+        static_assert(!std::is_integral<COEF_TYPE>::value, "Revised simplex solver needs exact or floating point division");
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::set_refactorization_period(unsigned int p_period)
+    {
+        assert(p_period);
+        m_refactorization_period = p_period;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::set_basis(const std::vector<unsigned int> & p_basis)
+    {
+        this->check_basis(p_basis);
+        this->clear_base_variables();
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = p_basis[l_row_index];
+            if(std::numeric_limits<unsigned int>::max() != l_variable_index)
+            {
+                this->set_base_variable(l_row_index, l_variable_index);
+                this->set_base_variables_position(l_variable_index, l_row_index);
+            }
+        }
+        if(this->is_base_complete())
+        {
+            prepare();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::fix_variable(const unsigned int p_variable_index
+                                                              ,const COEF_TYPE & p_value
+                                                              )
+    {
+        this->add_fixing_constraints(p_variable_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::prepare()
+    {
+        if(!m_columns_prepared || this->get_coefs_revision() != m_columns_revision)
+        {
+            m_column_starts.clear();
+            m_column_rows.clear();
+            m_column_values.clear();
+            m_column_starts.reserve(this->get_nb_all_variables() + 1);
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < this->get_nb_all_variables();
+                ++l_variable_index
+               )
+            {
+                m_column_starts.push_back(m_column_rows.size());
+                for(unsigned int l_row_index = 0;
+                    l_row_index < this->get_nb_total_equations();
+                    ++l_row_index
+                   )
+                {
+                    const COEF_TYPE & l_coef = this->get_internal_coef(l_row_index, l_variable_index);
+                    if(COEF_TYPE(0) != l_coef)
+                    {
+                        m_column_rows.push_back(l_row_index);
+                        m_column_values.push_back(l_coef);
+                    }
+                }
+            }
+            m_column_starts.push_back(m_column_rows.size());
+            m_columns_revision = this->get_coefs_revision();
+            m_columns_prepared = true;
+        }
+        m_factorization = simplex_basis_factorization<COEF_TYPE>(this->get_nb_total_equations(), m_refactorization_period);
+        refactorize();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::refactorize()
+    {
+        m_factorization.reset();
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = this->get_base_variable(l_row_index);
+            for(unsigned int l_index = m_column_starts[l_variable_index];
+                l_index < m_column_starts[l_variable_index + 1];
+                ++l_index
+               )
+            {
+                m_factorization.set_coef(m_column_rows[l_index], l_row_index, m_column_values[l_index]);
+            }
+        }
+        m_factorization.factorize();
+
+        // Base variable values: xB = B^-1 b
+        m_base_values.resize(this->get_nb_total_equations());
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            m_base_values[l_row_index] = this->get_array().get_B_coef(l_row_index);
+        }
+        m_factorization.ftran(m_base_values);
+
+        // Z0 = Z0 + cB xB knowing that Z coefs are stored as -c
+        m_Z0 = this->get_array().get_Z0_coef();
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            m_Z0 = m_Z0 - this->get_array().get_Z_coef(this->get_base_variable(l_row_index)) * m_base_values[l_row_index];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::price_input_variable_index(unsigned int & p_variable_index)
+    {
+        std::vector<COEF_TYPE> l_y;
+        compute_multipliers(l_y);
+
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_all_variables();
+            ++l_variable_index
+           )
+        {
+            // Artificial variables out of base never come back
+            if(this->is_base_variable(l_variable_index) || this->is_artificial_variable(l_variable_index))
+            {
+                continue;
+            }
+            COEF_TYPE l_Z_coef = compute_Z_coef(l_variable_index, l_y);
+            if(l_Z_coef < -l_tolerance)
+            {
+                p_variable_index = l_variable_index;
+                m_input_Z_coef = l_Z_coef;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_multipliers(std::vector<COEF_TYPE> & p_y) const
+    {
+        // y = cB B^-1 computed with Z coefs that are stored as -c
+        p_y.resize(this->get_nb_total_equations());
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            p_y[l_row_index] = this->get_array().get_Z_coef(this->get_base_variable(l_row_index));
+        }
+        m_factorization.btran(p_y);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    COEF_TYPE
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_Z_coef(unsigned int p_variable_index
+                                                                ,const std::vector<COEF_TYPE> & p_y
+                                                                ) const
+    {
+        assert(p_variable_index < this->get_nb_all_variables());
+        // Current Z coef is original Z coef - y a
+        COEF_TYPE l_Z_coef = this->get_array().get_Z_coef(p_variable_index);
+        for(unsigned int l_index = m_column_starts[p_variable_index];
+            l_index < m_column_starts[p_variable_index + 1];
+            ++l_index
+           )
+        {
+            l_Z_coef = l_Z_coef - p_y[m_column_rows[l_index]] * m_column_values[l_index];
+        }
+        return l_Z_coef;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::check_factorization() const
+    {
+        if(m_base_values.size() != this->get_nb_total_equations())
+        {
+            throw quicky_exception::quicky_logic_exception("Sensitivity analysis is only available after a search", __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const
+    {
+        check_factorization();
+        // Z0 = Z0 - cB B^-1 b knowing that Z coefs are stored as -c
+        compute_multipliers(p_duals);
+        for(auto & l_dual: p_duals)
+        {
+            l_dual = -l_dual;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const
+    {
+        check_factorization();
+        std::vector<COEF_TYPE> l_y;
+        compute_multipliers(l_y);
+        p_Z_coefs.resize(this->get_nb_all_variables());
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_all_variables();
+            ++l_variable_index
+           )
+        {
+            p_Z_coefs[l_variable_index] = this->is_base_variable(l_variable_index) ? COEF_TYPE(0) : compute_Z_coef(l_variable_index, l_y);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_base_values(std::vector<COEF_TYPE> & p_values) const
+    {
+        check_factorization();
+        p_values = m_base_values;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_B_coef_direction(unsigned int p_equation_index
+                                                                          ,std::vector<COEF_TYPE> & p_direction
+                                                                          ) const
+    {
+        assert(p_equation_index < this->get_nb_total_equations());
+        check_factorization();
+        p_direction.assign(this->get_nb_total_equations(), COEF_TYPE(0));
+        p_direction[p_equation_index] = COEF_TYPE(1);
+        m_factorization.ftran(p_direction);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_base_row(unsigned int p_row_index
+                                                                  ,std::vector<COEF_TYPE> & p_row
+                                                                  ) const
+    {
+        assert(p_row_index < this->get_nb_total_equations());
+        check_factorization();
+        // Row of B^-1 is e B^-1
+        std::vector<COEF_TYPE> l_inverse_row(this->get_nb_total_equations(), COEF_TYPE(0));
+        l_inverse_row[p_row_index] = COEF_TYPE(1);
+        m_factorization.btran(l_inverse_row);
+        p_row.assign(this->get_nb_all_variables(), COEF_TYPE(0));
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_all_variables();
+            ++l_variable_index
+           )
+        {
+            for(unsigned int l_index = m_column_starts[l_variable_index];
+                l_index < m_column_starts[l_variable_index + 1];
+                ++l_index
+               )
+            {
+                p_row[l_variable_index] = p_row[l_variable_index] + l_inverse_row[m_column_rows[l_index]] * m_column_values[l_index];
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::compute_input_column(unsigned int p_variable_index)
+    {
+        assert(p_variable_index < this->get_nb_all_variables());
+        m_input_column.assign(this->get_nb_total_equations(), COEF_TYPE(0));
+        for(unsigned int l_index = m_column_starts[p_variable_index];
+            l_index < m_column_starts[p_variable_index + 1];
+            ++l_index
+           )
+        {
+            m_input_column[m_column_rows[l_index]] = m_column_values[l_index];
+        }
+        m_factorization.ftran(m_input_column);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::get_output_equation_index(unsigned int p_input_variable_index
+                                                                           ,unsigned int & p_equation_index
+                                                                           ) const
+    {
+        assert(p_input_variable_index < this->get_nb_all_variables());
+        assert(m_input_column.size() == this->get_nb_total_equations());
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        bool l_found = false;
+        COEF_TYPE l_min(0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_total_equations();
+            ++l_index
+           )
+        {
+            const COEF_TYPE & l_divider = m_input_column[l_index];
+            if(l_divider > l_tolerance)
+            {
+                COEF_TYPE l_result = m_base_values[l_index] / l_divider;
+                if(!l_found || l_result < l_min)
+                {
+                    l_min = l_result;
+                    p_equation_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::pivot(const unsigned int p_row_index
+                                                       ,const unsigned int p_column_index
+                                                       )
+    {
+        assert(p_row_index < this->get_nb_total_equations());
+        assert(p_column_index < this->get_nb_all_variables());
+        COEF_TYPE l_pivot = m_input_column[p_row_index];
+        assert(l_pivot);
+        const COEF_TYPE l_output_value = m_base_values[p_row_index];
+
+        // Same updates than Z0 and B column of a tableau pivot
+        m_Z0 = m_Z0 - (m_input_Z_coef * l_output_value) / l_pivot;
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            const COEF_TYPE & l_q = m_input_column[l_row_index];
+            if(l_row_index != p_row_index && COEF_TYPE(0) != l_q)
+            {
+                m_base_values[l_row_index] = m_base_values[l_row_index] - (l_q * l_output_value) / l_pivot;
+            }
+        }
+        m_base_values[p_row_index] = l_output_value / l_pivot;
+        m_factorization.update(p_row_index, m_input_column);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_max(COEF_TYPE & p_max
+                                                          ,bool & p_infinite
+                                                          ,LISTENER * p_listener
+                                                          )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_max(COEF_TYPE & p_max
+                                                          ,const simplex_solve_options<COEF_TYPE> & p_options
+                                                          ,LISTENER * p_listener
+                                                          )
+    {
+        if(this->is_bounded() || this->is_translated())
+        {
+            throw quicky_exception::quicky_logic_exception("Variable bounds are not supported by revised simplex solver", __LINE__, __FILE__);
+        }
+        this->scale();
+        this->set_minimized(false);
+        simplex_solve_control<COEF_TYPE> l_control(p_options);
+        unsigned int l_nb_iteration = 0;
+        // Defined base is kept only if it is feasible. Artificial variables
+        // left in base by an unfinished first phase are minimized again
+        // from this base
+        bool l_feasible = this->is_base_complete();
+        if(l_feasible)
+        {
+            prepare();
+            for(unsigned int l_row_index = 0;
+                l_row_index < this->get_nb_total_equations();
+                ++l_row_index
+               )
+            {
+                l_feasible &= !(m_base_values[l_row_index] < -simplex_tolerance<COEF_TYPE>::get());
+            }
+        }
+        bool l_first_phase = false;
+        if(!l_feasible)
+        {
+            this->clear_base_variables();
+            l_first_phase = this->start_first_phase(false);
+        }
+        else if(has_positive_artificial_variable())
+        {
+            this->resume_first_phase();
+            l_first_phase = true;
+        }
+        else
+        {
+            // Null artificial variables would increase with some pivots
+            remove_artificial_base_variables();
+        }
+        if(l_first_phase)
+        {
+            prepare();
+            t_solve_status l_status = primal_iterations(l_nb_iteration, l_control, false, p_listener);
+            if(t_solve_status::UNBOUNDED == l_status)
+            {
+                throw quicky_exception::quicky_logic_exception("First phase objective function cannot be infinite", __LINE__, __FILE__);
+            }
+            if(t_solve_status::OPTIMAL != l_status)
+            {
+                this->end_first_phase();
+                return l_status;
+            }
+            // Z0 is the opposite of the sum of artificial variables
+            if(m_Z0 < -simplex_tolerance<COEF_TYPE>::get())
+            {
+                this->end_first_phase();
+                return t_solve_status::INFEASIBLE;
+            }
+            remove_artificial_base_variables();
+            this->end_first_phase();
+        }
+        prepare();
+        t_solve_status l_status = primal_iterations(l_nb_iteration, l_control, true, p_listener);
+        if(t_solve_status::UNBOUNDED != l_status)
+        {
+            p_max = m_Z0;
+        }
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_min(COEF_TYPE & p_min
+                                                          ,bool & p_infinite
+                                                          ,LISTENER * p_listener
+                                                          )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_min(p_min, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_min(COEF_TYPE & p_min
+                                                          ,const simplex_solve_options<COEF_TYPE> & p_options
+                                                          ,LISTENER * p_listener
+                                                          )
+    {
+        return this->minimize(p_min
+                             ,p_options
+                             ,[&](COEF_TYPE & p_max, const simplex_solve_options<COEF_TYPE> & p_max_options)
+                              {
+                                  return find_max(p_max, p_max_options, p_listener);
+                              }
+                             );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    t_solve_status
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::primal_iterations(unsigned int & p_nb_iteration
+                                                                   ,const simplex_solve_control<COEF_TYPE> & p_control
+                                                                   ,bool p_check_cutoff
+                                                                   ,LISTENER * p_listener
+                                                                   )
+    {
+        unsigned int l_input_variable_index = 0;
+        t_solve_status l_status = t_solve_status::OPTIMAL;
+        while(price_input_variable_index(l_input_variable_index))
+        {
+            if(p_control.must_stop(p_nb_iteration, l_status))
+            {
+                return l_status;
+            }
+            if(p_check_cutoff && p_control.is_cutoff_reached(m_Z0))
+            {
+                return t_solve_status::CUTOFF;
+            }
+            if(p_listener)
+            {
+                p_listener->start_iteration(p_nb_iteration);
+                p_listener->new_input_var_event(l_input_variable_index);
+            }
+            assert(!this->is_base_variable(l_input_variable_index));
+            compute_input_column(l_input_variable_index);
+            unsigned int l_output_equation_index = 0;
+            if(!get_output_equation_index(l_input_variable_index, l_output_equation_index))
+            {
+                return t_solve_status::UNBOUNDED;
+            }
+            unsigned int l_output_variable_index = this->get_base_variable(l_output_equation_index);
+            if(p_listener)
+            {
+                p_listener->new_output_var_event(l_output_variable_index);
+            }
+            assert(l_output_equation_index == this->get_base_variables_position(l_output_variable_index));
+            pivot(l_output_equation_index, l_input_variable_index);
+            this->set_base_variables_position(l_output_variable_index, std::numeric_limits<unsigned int>::max());
+            this->set_base_variables_position(l_input_variable_index, l_output_equation_index);
+            this->set_base_variable(l_output_equation_index, l_input_variable_index);
+            if(m_factorization.need_refactorization())
+            {
+                refactorize();
+            }
+
+            if(p_listener)
+            {
+                p_listener->new_Z0(m_Z0);
+            }
+            ++p_nb_iteration;
+        }
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    void
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::remove_artificial_base_variables()
+    {
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        std::vector<COEF_TYPE> l_row;
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            unsigned int l_artificial_index = this->get_base_variable(l_row_index);
+            if(!this->is_artificial_variable(l_artificial_index))
+            {
+                continue;
+            }
+            // Row of artificial variable in current base: e B^-1 A
+            l_row.assign(this->get_nb_total_equations(), COEF_TYPE(0));
+            l_row[l_row_index] = COEF_TYPE(1);
+            m_factorization.btran(l_row);
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < this->get_nb_all_variables() && !this->is_artificial_variable(l_variable_index);
+                ++l_variable_index
+               )
+            {
+                if(this->is_base_variable(l_variable_index))
+                {
+                    continue;
+                }
+                COEF_TYPE l_alpha(0);
+                for(unsigned int l_index = m_column_starts[l_variable_index];
+                    l_index < m_column_starts[l_variable_index + 1];
+                    ++l_index
+                   )
+                {
+                    l_alpha = l_alpha + l_row[m_column_rows[l_index]] * m_column_values[l_index];
+                }
+                if(l_alpha < -l_tolerance || l_tolerance < l_alpha)
+                {
+                    // Artificial variable is null so objective value is
+                    // unchanged
+                    compute_input_column(l_variable_index);
+                    m_input_Z_coef = COEF_TYPE(0);
+                    pivot(l_row_index, l_variable_index);
+                    this->set_base_variables_position(l_artificial_index, std::numeric_limits<unsigned int>::max());
+                    this->set_base_variables_position(l_variable_index, l_row_index);
+                    this->set_base_variable(l_row_index, l_variable_index);
+                    break;
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::has_positive_artificial_variable() const
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            if(this->is_artificial_variable(this->get_base_variable(l_row_index)) && simplex_tolerance<COEF_TYPE>::get() < m_base_values[l_row_index])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_max_dual(COEF_TYPE & p_max
+                                                               ,bool & p_infeasible
+                                                               ,LISTENER * p_listener
+                                                               )
+    {
+        if(!this->is_base_complete())
+        {
+            throw quicky_exception::quicky_runtime_exception("Not enough base variables defined", __LINE__, __FILE__);
+        }
+        if(this->is_bounded() || this->is_translated())
+        {
+            throw quicky_exception::quicky_logic_exception("Variable bounds are not supported by revised simplex solver", __LINE__, __FILE__);
+        }
+        this->scale();
+        this->set_minimized(false);
+        // B coefficients may have changed since last search
+        prepare();
+        p_infeasible = false;
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        if(has_positive_artificial_variable())
+        {
+            return find_max_primal(p_max, p_infeasible, p_listener);
+        }
+        std::vector<COEF_TYPE> l_y;
+        compute_multipliers(l_y);
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < this->get_nb_all_variables();
+            ++l_variable_index
+           )
+        {
+            if(!this->is_base_variable(l_variable_index) && !this->is_artificial_variable(l_variable_index) && compute_Z_coef(l_variable_index, l_y) < -l_tolerance)
+            {
+                throw quicky_exception::quicky_runtime_exception("Base is not dual feasible: Z coef of variable " + std::to_string(l_variable_index) + " is negative", __LINE__, __FILE__);
+            }
+        }
+        std::vector<COEF_TYPE> l_row;
+        unsigned int l_nb_iteration = 0;
+        for(;;)
+        {
+            // Output equation is the one with the most negative base variable
+            bool l_output_found = false;
+            unsigned int l_output_equation_index = 0;
+            for(unsigned int l_row_index = 0;
+                l_row_index < this->get_nb_total_equations();
+                ++l_row_index
+               )
+            {
+                if(m_base_values[l_row_index] < -l_tolerance && (!l_output_found || m_base_values[l_row_index] < m_base_values[l_output_equation_index]))
+                {
+                    l_output_equation_index = l_row_index;
+                    l_output_found = true;
+                }
+            }
+            if(!l_output_found)
+            {
+                break;
+            }
+
+            // Row of output equation in current base: e B^-1 A
+            l_row.assign(this->get_nb_total_equations(), COEF_TYPE(0));
+            l_row[l_output_equation_index] = COEF_TYPE(1);
+            m_factorization.btran(l_row);
+            compute_multipliers(l_y);
+
+            // Dual ratio test among variables that would increase output one
+            bool l_input_found = false;
+            unsigned int l_input_variable_index = 0;
+            COEF_TYPE l_input_Z_coef(0);
+            COEF_TYPE l_min(0);
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < this->get_nb_all_variables();
+                ++l_variable_index
+               )
+            {
+                if(this->is_base_variable(l_variable_index) || this->is_artificial_variable(l_variable_index))
+                {
+                    continue;
+                }
+                COEF_TYPE l_alpha(0);
+                for(unsigned int l_index = m_column_starts[l_variable_index];
+                    l_index < m_column_starts[l_variable_index + 1];
+                    ++l_index
+                   )
+                {
+                    l_alpha = l_alpha + l_row[m_column_rows[l_index]] * m_column_values[l_index];
+                }
+                if(l_alpha < -l_tolerance)
+                {
+                    COEF_TYPE l_Z_coef = compute_Z_coef(l_variable_index, l_y);
+                    COEF_TYPE l_ratio = l_Z_coef / -l_alpha;
+                    if(!l_input_found || l_ratio < l_min)
+                    {
+                        l_min = l_ratio;
+                        l_input_variable_index = l_variable_index;
+                        l_input_Z_coef = l_Z_coef;
+                        l_input_found = true;
+                    }
+                }
+            }
+            if(!l_input_found)
+            {
+                p_infeasible = true;
+                return false;
+            }
+
+            unsigned int l_output_variable_index = this->get_base_variable(l_output_equation_index);
+            if(p_listener)
+            {
+                p_listener->start_iteration(l_nb_iteration);
+                p_listener->new_input_var_event(l_input_variable_index);
+                p_listener->new_output_var_event(l_output_variable_index);
+            }
+            compute_input_column(l_input_variable_index);
+            m_input_Z_coef = l_input_Z_coef;
+            pivot(l_output_equation_index, l_input_variable_index);
+            this->set_base_variables_position(l_output_variable_index, std::numeric_limits<unsigned int>::max());
+            this->set_base_variables_position(l_input_variable_index, l_output_equation_index);
+            this->set_base_variable(l_output_equation_index, l_input_variable_index);
+            if(m_factorization.need_refactorization())
+            {
+                refactorize();
+            }
+            if(p_listener)
+            {
+                p_listener->new_Z0(m_Z0);
+            }
+            ++l_nb_iteration;
+        }
+        // Dual pivots can move artificial variables left null in base by an
+        // unfinished first phase
+        if(has_positive_artificial_variable())
+        {
+            return find_max_primal(p_max, p_infeasible, p_listener);
+        }
+        p_max = m_Z0;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <class LISTENER>
+    bool
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::find_max_primal(COEF_TYPE & p_max
+                                                                 ,bool & p_infeasible
+                                                                 ,LISTENER * p_listener
+                                                                 )
+    {
+        // Base is not a base of the problem, first phase of primal algorithm
+        // has to be continued
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infeasible = t_solve_status::INFEASIBLE == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    std::vector<COEF_TYPE>
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::get_variable_values() const
+    {
+        if(m_base_values.size() != this->get_nb_total_equations())
+        {
+            // No factorization available yet
+            return simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_variable_values();
+        }
+        std::vector<COEF_TYPE> l_result(this->get_nb_variables(), COEF_TYPE(0));
+        for(unsigned int l_index = 0; l_index < this->get_nb_variables(); ++l_index)
+        {
+            if(this->is_base_variable(l_index))
+            {
+                l_result[l_index] = m_base_values[this->get_base_variables_position(l_index)];
+            }
+        }
+        this->unscale_variable_values(l_result);
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    std::ostream &
+    simplex_revised_solver<COEF_TYPE,ARRAY_TYPE>::display_array(std::ostream & p_stream) const
+    {
+        simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::display_array(p_stream);
+        if(m_base_values.size() == this->get_nb_total_equations())
+        {
+            p_stream << "Base values:" << std::endl;
+            for(unsigned int l_row_index = 0;
+                l_row_index < this->get_nb_total_equations();
+                ++l_row_index
+               )
+            {
+                unsigned int l_variable_index = this->get_base_variable(l_row_index);
+                if(l_variable_index < this->get_nb_variables())
+                {
+                    p_stream << "X" << 1 + l_variable_index;
+                }
+                else
+                {
+                    p_stream << "E" << 1 + l_variable_index - this->get_nb_variables();
+                }
+                p_stream << "\t" << m_base_values[l_row_index] << std::endl;
+            }
+            p_stream << "Z0\t" << m_Z0 << std::endl;
+        }
+        return p_stream;
+    }
+
+}
+#endif //SIMPLEX_REVISED_SOLVER_H
+// EOF
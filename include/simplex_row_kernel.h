@@ -0,0 +1,542 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_ROW_KERNEL_H
+#define SIMPLEX_ROW_KERNEL_H
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMPLEX_ROW_KERNEL_X86
+#include <immintrin.h>
+#endif // __GNUC__ && x86
+
+namespace simplex
+{
+    /**
+     * Instruction sets that can be used by row kernels
+     */
+    typedef enum class simplex_simd_level
+    {
+        SCALAR = 0
+       ,SSE2
+       ,AVX2
+       ,AVX512
+    } t_simplex_simd_level;
+
+    /**
+     * Return name of SIMD level
+     * @param p_level SIMD level
+     * @return name of level
+     */
+    inline
+    const char * simplex_simd_level_name(t_simplex_simd_level p_level);
+
+    /**
+     * Return the most powerful SIMD level supported by running CPU
+     * @return SIMD level
+     */
+    inline
+    t_simplex_simd_level simplex_simd_supported_level();
+
+    /**
+     * Kernels applied on contiguous rows of tableau during pivot.
+     * Generic version is scalar, float and double versions dispatch at
+     * runtime to the most powerful instruction set supported by CPU
+     * Formulas are the same whatever the instruction set to keep results
+     * bit identical
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_row_kernel
+    {
+      public:
+        /**
+         * Indicate if kernel is vectorized
+         */
+        static const bool m_vectorized = false;
+
+        /**
+         * Compute p_row[i] -= (p_q * p_pivot_row[i]) / p_pivot
+         * @param p_row row to update
+         * @param p_pivot_row pivot row
+         * @param p_q multiplier of row to update
+         * @param p_pivot pivot value
+         * @param p_size number of coefficients
+         */
+        inline static
+        void eliminate(COEF_TYPE * p_row
+                      ,const COEF_TYPE * p_pivot_row
+                      ,const COEF_TYPE & p_q
+                      ,const COEF_TYPE & p_pivot
+                      ,unsigned int p_size
+                      );
+
+        /**
+         * Compute p_row[i] -= p_q * (p_pivot_row[i] / p_pivot) as done for
+         * objective function row
+         * @param p_row row to update
+         * @param p_pivot_row pivot row
+         * @param p_q multiplier of row to update
+         * @param p_pivot pivot value
+         * @param p_size number of coefficients
+         */
+        inline static
+        void eliminate_objective(COEF_TYPE * p_row
+                                ,const COEF_TYPE * p_pivot_row
+                                ,const COEF_TYPE & p_q
+                                ,const COEF_TYPE & p_pivot
+                                ,unsigned int p_size
+                                );
+
+        /**
+         * Compute p_row[i] /= p_pivot
+         * @param p_row row to update
+         * @param p_pivot pivot value
+         * @param p_size number of coefficients
+         */
+        inline static
+        void divide(COEF_TYPE * p_row
+                   ,const COEF_TYPE & p_pivot
+                   ,unsigned int p_size
+                   );
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_row_kernel<COEF_TYPE>::eliminate(COEF_TYPE * p_row
+                                            ,const COEF_TYPE * p_pivot_row
+                                            ,const COEF_TYPE & p_q
+                                            ,const COEF_TYPE & p_pivot
+                                            ,unsigned int p_size
+                                            )
+    {
+        for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_row[l_index] = p_row[l_index] - (p_q * p_pivot_row[l_index]) / p_pivot;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_row_kernel<COEF_TYPE>::eliminate_objective(COEF_TYPE * p_row
+                                                      ,const COEF_TYPE * p_pivot_row
+                                                      ,const COEF_TYPE & p_q
+                                                      ,const COEF_TYPE & p_pivot
+                                                      ,unsigned int p_size
+                                                      )
+    {
+        for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_row[l_index] = p_row[l_index] - p_q * (p_pivot_row[l_index] / p_pivot);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_row_kernel<COEF_TYPE>::divide(COEF_TYPE * p_row
+                                         ,const COEF_TYPE & p_pivot
+                                         ,unsigned int p_size
+                                         )
+    {
+        for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_row[l_index] = p_row[l_index] / p_pivot;
+        }
+    }
+
+    /**
+     * Kernels for floating point types. Implementation is selected once at
+     * first use depending on CPU capabilities. Selected level can be forced
+     * to a lower level to compare implementations
+     * @tparam COEF_TYPE float or double
+     */
+    template <typename COEF_TYPE>
+    class simplex_float_row_kernel
+    {
+      public:
+        static const bool m_vectorized = true;
+
+        inline static
+        void eliminate(COEF_TYPE * p_row
+                      ,const COEF_TYPE * p_pivot_row
+                      ,const COEF_TYPE & p_q
+                      ,const COEF_TYPE & p_pivot
+                      ,unsigned int p_size
+                      );
+
+        inline static
+        void eliminate_objective(COEF_TYPE * p_row
+                                ,const COEF_TYPE * p_pivot_row
+                                ,const COEF_TYPE & p_q
+                                ,const COEF_TYPE & p_pivot
+                                ,unsigned int p_size
+                                );
+
+        inline static
+        void divide(COEF_TYPE * p_row
+                   ,const COEF_TYPE & p_pivot
+                   ,unsigned int p_size
+                   );
+
+        /**
+         * Return SIMD level used by kernels
+         * @return SIMD level
+         */
+        inline static
+        t_simplex_simd_level get_level();
+
+        /**
+         * Force SIMD level used by kernels. Level is limited to the one
+         * supported by CPU
+         * @param p_level SIMD level to use
+         * @return SIMD level really used
+         */
+        inline static
+        t_simplex_simd_level set_level(t_simplex_simd_level p_level);
+
+      private:
+        typedef void (*t_eliminate)(COEF_TYPE *, const COEF_TYPE *, COEF_TYPE, COEF_TYPE, unsigned int);
+        typedef void (*t_divide)(COEF_TYPE *, COEF_TYPE, unsigned int);
+
+        /**
+         * Kernels implementation for a SIMD level
+         */
+        class implementation
+        {
+          public:
+            t_simplex_simd_level m_level;
+            t_eliminate m_eliminate;
+            t_eliminate m_eliminate_objective;
+            t_divide m_divide;
+        };
+
+        /**
+         * Return kernels implementation of a SIMD level
+         * @param p_level SIMD level
+         * @return kernels implementation
+         */
+        inline static
+        implementation get_implementation(t_simplex_simd_level p_level);
+
+        /**
+         * Return currently selected implementation, initialised at first
+         * call with the most powerful level supported by CPU
+         * @return reference on selected implementation
+         */
+        inline static
+        implementation & get_selected();
+    };
+
+    template <>
+    class simplex_row_kernel<double>: public simplex_float_row_kernel<double>
+    {
+    };
+
+    template <>
+    class simplex_row_kernel<float>: public simplex_float_row_kernel<float>
+    {
+    };
+
+    namespace simd_kernels
+    {
+        //---------------------------------------------------------------------
+        template <typename COEF_TYPE>
+        void eliminate_scalar(COEF_TYPE * p_row
+                             ,const COEF_TYPE * p_pivot_row
+                             ,COEF_TYPE p_q
+                             ,COEF_TYPE p_pivot
+                             ,unsigned int p_size
+                             )
+        {
+            for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+            {
+                p_row[l_index] = p_row[l_index] - (p_q * p_pivot_row[l_index]) / p_pivot;
+            }
+        }
+
+        //---------------------------------------------------------------------
+        template <typename COEF_TYPE>
+        void eliminate_objective_scalar(COEF_TYPE * p_row
+                                       ,const COEF_TYPE * p_pivot_row
+                                       ,COEF_TYPE p_q
+                                       ,COEF_TYPE p_pivot
+                                       ,unsigned int p_size
+                                       )
+        {
+            for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+            {
+                p_row[l_index] = p_row[l_index] - p_q * (p_pivot_row[l_index] / p_pivot);
+            }
+        }
+
+        //---------------------------------------------------------------------
+        template <typename COEF_TYPE>
+        void divide_scalar(COEF_TYPE * p_row
+                          ,COEF_TYPE p_pivot
+                          ,unsigned int p_size
+                          )
+        {
+            for(unsigned int l_index = 0; l_index < p_size; ++l_index)
+            {
+                p_row[l_index] = p_row[l_index] / p_pivot;
+            }
+        }
+
+#ifdef SIMPLEX_ROW_KERNEL_X86
+// Define vectorized kernels for an instruction set. Remaining coefficients
+// that do not fill a whole register are processed by scalar kernels
+#define SIMPLEX_DEFINE_ROW_KERNELS(SUFFIX, TARGET, TYPE, VECTOR, WIDTH, LOAD, STORE, SET1, MUL, DIV, SUB)\
+        __attribute__((target(TARGET)))                                                                    \
+        inline void eliminate_##SUFFIX(TYPE * p_row, const TYPE * p_pivot_row, TYPE p_q, TYPE p_pivot, unsigned int p_size)\
+        {                                                                                                  \
+            const VECTOR l_q = SET1(p_q);                                                                  \
+            const VECTOR l_pivot = SET1(p_pivot);                                                          \
+            unsigned int l_index = 0;                                                                      \
+            for(; l_index + WIDTH <= p_size; l_index += WIDTH)                                             \
+            {                                                                                              \
+                VECTOR l_u = LOAD(p_pivot_row + l_index);                                                  \
+                STORE(p_row + l_index, SUB(LOAD(p_row + l_index), DIV(MUL(l_q, l_u), l_pivot)));           \
+            }                                                                                              \
+            eliminate_scalar<TYPE>(p_row + l_index, p_pivot_row + l_index, p_q, p_pivot, p_size - l_index);\
+        }                                                                                                  \
+                                                                                                           \
+        __attribute__((target(TARGET)))                                                                    \
+        inline void eliminate_objective_##SUFFIX(TYPE * p_row, const TYPE * p_pivot_row, TYPE p_q, TYPE p_pivot, unsigned int p_size)\
+        {                                                                                                  \
+            const VECTOR l_q = SET1(p_q);                                                                  \
+            const VECTOR l_pivot = SET1(p_pivot);                                                          \
+            unsigned int l_index = 0;                                                                      \
+            for(; l_index + WIDTH <= p_size; l_index += WIDTH)                                             \
+            {                                                                                              \
+                VECTOR l_u = LOAD(p_pivot_row + l_index);                                                  \
+                STORE(p_row + l_index, SUB(LOAD(p_row + l_index), MUL(l_q, DIV(l_u, l_pivot))));           \
+            }                                                                                              \
+            eliminate_objective_scalar<TYPE>(p_row + l_index, p_pivot_row + l_index, p_q, p_pivot, p_size - l_index);\
+        }                                                                                                  \
+                                                                                                           \
+        __attribute__((target(TARGET)))                                                                    \
+        inline void divide_##SUFFIX(TYPE * p_row, TYPE p_pivot, unsigned int p_size)                       \
+        {                                                                                                  \
+            const VECTOR l_pivot = SET1(p_pivot);                                                          \
+            unsigned int l_index = 0;                                                                      \
+            for(; l_index + WIDTH <= p_size; l_index += WIDTH)                                             \
+            {                                                                                              \
+                STORE(p_row + l_index, DIV(LOAD(p_row + l_index), l_pivot));                               \
+            }                                                                                              \
+            divide_scalar<TYPE>(p_row + l_index, p_pivot, p_size - l_index);                               \
+        }
+
+        SIMPLEX_DEFINE_ROW_KERNELS(sse2_double, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, _mm_mul_pd, _mm_div_pd, _mm_sub_pd)
+        SIMPLEX_DEFINE_ROW_KERNELS(sse2_float, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps, _mm_mul_ps, _mm_div_ps, _mm_sub_ps)
+        SIMPLEX_DEFINE_ROW_KERNELS(avx2_double, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_mul_pd, _mm256_div_pd, _mm256_sub_pd)
+        SIMPLEX_DEFINE_ROW_KERNELS(avx2_float, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps, _mm256_mul_ps, _mm256_div_ps, _mm256_sub_ps)
+        SIMPLEX_DEFINE_ROW_KERNELS(avx512_double, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd, _mm512_mul_pd, _mm512_div_pd, _mm512_sub_pd)
+        SIMPLEX_DEFINE_ROW_KERNELS(avx512_float, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps, _mm512_mul_ps, _mm512_div_ps, _mm512_sub_ps)
+
+#undef SIMPLEX_DEFINE_ROW_KERNELS
+#endif // SIMPLEX_ROW_KERNEL_X86
+
+        /**
+         * Give access to kernels of an instruction set depending on type
+         * @tparam COEF_TYPE float or double
+         */
+        template <typename COEF_TYPE>
+        class kernels;
+
+#ifdef SIMPLEX_ROW_KERNEL_X86
+#define SIMPLEX_DEFINE_KERNELS_ACCESS(TYPE)                                                                \
+        template <>                                                                                        \
+        class kernels<TYPE>                                                                                \
+        {                                                                                                  \
+          public:                                                                                          \
+            typedef void (*t_eliminate)(TYPE *, const TYPE *, TYPE, TYPE, unsigned int);                   \
+            typedef void (*t_divide)(TYPE *, TYPE, unsigned int);                                          \
+            static t_eliminate get_eliminate(t_simplex_simd_level p_level)                                 \
+            {                                                                                              \
+                switch(p_level)                                                                            \
+                {                                                                                          \
+                    case t_simplex_simd_level::AVX512: return eliminate_avx512_##TYPE;                     \
+                    case t_simplex_simd_level::AVX2: return eliminate_avx2_##TYPE;                         \
+                    case t_simplex_simd_level::SSE2: return eliminate_sse2_##TYPE;                         \
+                    default: return eliminate_scalar<TYPE>;                                                \
+                }                                                                                          \
+            }                                                                                              \
+            static t_eliminate get_eliminate_objective(t_simplex_simd_level p_level)                       \
+            {                                                                                              \
+                switch(p_level)                                                                            \
+                {                                                                                          \
+                    case t_simplex_simd_level::AVX512: return eliminate_objective_avx512_##TYPE;           \
+                    case t_simplex_simd_level::AVX2: return eliminate_objective_avx2_##TYPE;               \
+                    case t_simplex_simd_level::SSE2: return eliminate_objective_sse2_##TYPE;               \
+                    default: return eliminate_objective_scalar<TYPE>;                                      \
+                }                                                                                          \
+            }                                                                                              \
+            static t_divide get_divide(t_simplex_simd_level p_level)                                       \
+            {                                                                                              \
+                switch(p_level)                                                                            \
+                {                                                                                          \
+                    case t_simplex_simd_level::AVX512: return divide_avx512_##TYPE;                        \
+                    case t_simplex_simd_level::AVX2: return divide_avx2_##TYPE;                            \
+                    case t_simplex_simd_level::SSE2: return divide_sse2_##TYPE;                            \
+                    default: return divide_scalar<TYPE>;                                                   \
+                }                                                                                          \
+            }                                                                                              \
+        };
+#else // SIMPLEX_ROW_KERNEL_X86
+#define SIMPLEX_DEFINE_KERNELS_ACCESS(TYPE)                                                                \
+        template <>                                                                                        \
+        class kernels<TYPE>                                                                                \
+        {                                                                                                  \
+          public:                                                                                          \
+            typedef void (*t_eliminate)(TYPE *, const TYPE *, TYPE, TYPE, unsigned int);                   \
+            typedef void (*t_divide)(TYPE *, TYPE, unsigned int);                                          \
+            static t_eliminate get_eliminate(t_simplex_simd_level)                                         \
+            {                                                                                              \
+                return eliminate_scalar<TYPE>;                                                             \
+            }                                                                                              \
+            static t_eliminate get_eliminate_objective(t_simplex_simd_level)                               \
+            {                                                                                              \
+                return eliminate_objective_scalar<TYPE>;                                                   \
+            }                                                                                              \
+            static t_divide get_divide(t_simplex_simd_level)                                               \
+            {                                                                                              \
+                return divide_scalar<TYPE>;                                                                \
+            }                                                                                              \
+        };
+#endif // SIMPLEX_ROW_KERNEL_X86
+
+        SIMPLEX_DEFINE_KERNELS_ACCESS(double)
+        SIMPLEX_DEFINE_KERNELS_ACCESS(float)
+
+#undef SIMPLEX_DEFINE_KERNELS_ACCESS
+    }
+
+    //-------------------------------------------------------------------------
+    const char * simplex_simd_level_name(t_simplex_simd_level p_level)
+    {
+        switch(p_level)
+        {
+            case t_simplex_simd_level::SCALAR: return "scalar";
+            case t_simplex_simd_level::SSE2: return "SSE2";
+            case t_simplex_simd_level::AVX2: return "AVX2";
+            case t_simplex_simd_level::AVX512: return "AVX-512";
+        }
+        return "unknown";
+    }
+
+    //-------------------------------------------------------------------------
+    t_simplex_simd_level simplex_simd_supported_level()
+    {
+#ifdef SIMPLEX_ROW_KERNEL_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+        {
+            return t_simplex_simd_level::AVX512;
+        }
+        if(__builtin_cpu_supports("avx2"))
+        {
+            return t_simplex_simd_level::AVX2;
+        }
+        if(__builtin_cpu_supports("sse2"))
+        {
+            return t_simplex_simd_level::SSE2;
+        }
+#endif // SIMPLEX_ROW_KERNEL_X86
+        return t_simplex_simd_level::SCALAR;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_float_row_kernel<COEF_TYPE>::eliminate(COEF_TYPE * p_row
+                                                  ,const COEF_TYPE * p_pivot_row
+                                                  ,const COEF_TYPE & p_q
+                                                  ,const COEF_TYPE & p_pivot
+                                                  ,unsigned int p_size
+                                                  )
+    {
+        get_selected().m_eliminate(p_row, p_pivot_row, p_q, p_pivot, p_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_float_row_kernel<COEF_TYPE>::eliminate_objective(COEF_TYPE * p_row
+                                                            ,const COEF_TYPE * p_pivot_row
+                                                            ,const COEF_TYPE & p_q
+                                                            ,const COEF_TYPE & p_pivot
+                                                            ,unsigned int p_size
+                                                            )
+    {
+        get_selected().m_eliminate_objective(p_row, p_pivot_row, p_q, p_pivot, p_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_float_row_kernel<COEF_TYPE>::divide(COEF_TYPE * p_row
+                                               ,const COEF_TYPE & p_pivot
+                                               ,unsigned int p_size
+                                               )
+    {
+        get_selected().m_divide(p_row, p_pivot, p_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    t_simplex_simd_level
+    simplex_float_row_kernel<COEF_TYPE>::get_level()
+    {
+        return get_selected().m_level;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    t_simplex_simd_level
+    simplex_float_row_kernel<COEF_TYPE>::set_level(t_simplex_simd_level p_level)
+    {
+        t_simplex_simd_level l_supported = simplex_simd_supported_level();
+        get_selected() = get_implementation(p_level < l_supported ? p_level : l_supported);
+        return get_selected().m_level;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_float_row_kernel<COEF_TYPE>::implementation
+    simplex_float_row_kernel<COEF_TYPE>::get_implementation(t_simplex_simd_level p_level)
+    {
+        implementation l_implementation;
+        l_implementation.m_level = p_level;
+        l_implementation.m_eliminate = simd_kernels::kernels<COEF_TYPE>::get_eliminate(p_level);
+        l_implementation.m_eliminate_objective = simd_kernels::kernels<COEF_TYPE>::get_eliminate_objective(p_level);
+        l_implementation.m_divide = simd_kernels::kernels<COEF_TYPE>::get_divide(p_level);
+        return l_implementation;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    typename simplex_float_row_kernel<COEF_TYPE>::implementation &
+    simplex_float_row_kernel<COEF_TYPE>::get_selected()
+    {
+        static implementation l_selected = get_implementation(simplex_simd_supported_level());
+        return l_selected;
+    }
+}
+#endif //SIMPLEX_ROW_KERNEL_H
+// EOF
@@ -0,0 +1,193 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_SCALING_H
+#define SIMPLEX_SCALING_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Computation of row and column scale factors of a floating point
+     * coefficient matrix. Factors are obtained by geometric mean passes
+     * followed by an equilibration and are rounded to powers of 2
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_scaling
+    {
+      public:
+        /**
+         * Compute scale factors so that R A C has coefficients close to 1
+         * @param p_nb_rows number of rows
+         * @param p_nb_columns number of columns
+         * @param p_rows row index of each non null coefficient
+         * @param p_columns column index of each non null coefficient
+         * @param p_values absolute value of each non null coefficient
+         * @param p_row_scales vector where to store row factors
+         * @param p_column_scales vector where to store column factors
+         */
+        inline static
+        void compute(unsigned int p_nb_rows,
+                     unsigned int p_nb_columns,
+                     const std::vector<unsigned int> & p_rows,
+                     const std::vector<unsigned int> & p_columns,
+                     const std::vector<COEF_TYPE> & p_values,
+                     std::vector<COEF_TYPE> & p_row_scales,
+                     std::vector<COEF_TYPE> & p_column_scales
+                    );
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_scaling<COEF_TYPE>::compute(unsigned int p_nb_rows,
+                                        unsigned int p_nb_columns,
+                                        const std::vector<unsigned int> & p_rows,
+                                        const std::vector<unsigned int> & p_columns,
+                                        const std::vector<COEF_TYPE> & p_values,
+                                        std::vector<COEF_TYPE> & p_row_scales,
+                                        std::vector<COEF_TYPE> & p_column_scales
+                                       )
+    {
+        assert(p_rows.size() == p_values.size());
+        assert(p_columns.size() == p_values.size());
+        p_row_scales.assign(p_nb_rows, COEF_TYPE(1));
+        p_column_scales.assign(p_nb_columns, COEF_TYPE(1));
+        std::vector<COEF_TYPE> l_row_min(p_nb_rows);
+        std::vector<COEF_TYPE> l_row_max(p_nb_rows);
+        std::vector<COEF_TYPE> l_column_min(p_nb_columns);
+        std::vector<COEF_TYPE> l_column_max(p_nb_columns);
+        const COEF_TYPE l_infinity = std::numeric_limits<COEF_TYPE>::max();
+
+        // Geometric mean passes divide each row then each column by square
+        // root of product of its extreme values, until ratio between largest
+        // and smallest coefficient stops decreasing significantly
+        COEF_TYPE l_previous_ratio = l_infinity;
+        for(unsigned int l_pass = 0;
+            l_pass < 20 && !p_values.empty();
+            ++l_pass
+           )
+        {
+            l_row_min.assign(p_nb_rows, l_infinity);
+            l_row_max.assign(p_nb_rows, COEF_TYPE(0));
+            for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
+            {
+                COEF_TYPE l_value = p_values[l_index] * p_column_scales[p_columns[l_index]];
+                l_row_min[p_rows[l_index]] = std::min(l_row_min[p_rows[l_index]], l_value);
+                l_row_max[p_rows[l_index]] = std::max(l_row_max[p_rows[l_index]], l_value);
+            }
+            for(unsigned int l_row_index = 0;
+                l_row_index < p_nb_rows;
+                ++l_row_index
+               )
+            {
+                if(COEF_TYPE(0) != l_row_max[l_row_index])
+                {
+                    p_row_scales[l_row_index] = COEF_TYPE(1) / std::sqrt(l_row_min[l_row_index] * l_row_max[l_row_index]);
+                }
+            }
+
+            l_column_min.assign(p_nb_columns, l_infinity);
+            l_column_max.assign(p_nb_columns, COEF_TYPE(0));
+            for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
+            {
+                COEF_TYPE l_value = p_values[l_index] * p_row_scales[p_rows[l_index]];
+                l_column_min[p_columns[l_index]] = std::min(l_column_min[p_columns[l_index]], l_value);
+                l_column_max[p_columns[l_index]] = std::max(l_column_max[p_columns[l_index]], l_value);
+            }
+            for(unsigned int l_column_index = 0;
+                l_column_index < p_nb_columns;
+                ++l_column_index
+               )
+            {
+                if(COEF_TYPE(0) != l_column_max[l_column_index])
+                {
+                    p_column_scales[l_column_index] = COEF_TYPE(1) / std::sqrt(l_column_min[l_column_index] * l_column_max[l_column_index]);
+                }
+            }
+
+            COEF_TYPE l_min = l_infinity;
+            COEF_TYPE l_max = COEF_TYPE(0);
+            for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
+            {
+                COEF_TYPE l_value = p_values[l_index] * p_row_scales[p_rows[l_index]] * p_column_scales[p_columns[l_index]];
+                l_min = std::min(l_min, l_value);
+                l_max = std::max(l_max, l_value);
+            }
+            COEF_TYPE l_ratio = l_max / l_min;
+            if(l_ratio > COEF_TYPE(0.9) * l_previous_ratio)
+            {
+                break;
+            }
+            l_previous_ratio = l_ratio;
+        }
+
+        // Equilibration so that largest coefficient of each row then of each
+        // column is 1
+        l_row_max.assign(p_nb_rows, COEF_TYPE(0));
+        for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
+        {
+            COEF_TYPE l_value = p_values[l_index] * p_row_scales[p_rows[l_index]] * p_column_scales[p_columns[l_index]];
+            l_row_max[p_rows[l_index]] = std::max(l_row_max[p_rows[l_index]], l_value);
+        }
+        for(unsigned int l_row_index = 0;
+            l_row_index < p_nb_rows;
+            ++l_row_index
+           )
+        {
+            if(COEF_TYPE(0) != l_row_max[l_row_index])
+            {
+                p_row_scales[l_row_index] = p_row_scales[l_row_index] / l_row_max[l_row_index];
+            }
+        }
+        l_column_max.assign(p_nb_columns, COEF_TYPE(0));
+        for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
+        {
+            COEF_TYPE l_value = p_values[l_index] * p_row_scales[p_rows[l_index]] * p_column_scales[p_columns[l_index]];
+            l_column_max[p_columns[l_index]] = std::max(l_column_max[p_columns[l_index]], l_value);
+        }
+        for(unsigned int l_column_index = 0;
+            l_column_index < p_nb_columns;
+            ++l_column_index
+           )
+        {
+            if(COEF_TYPE(0) != l_column_max[l_column_index])
+            {
+                p_column_scales[l_column_index] = p_column_scales[l_column_index] / l_column_max[l_column_index];
+            }
+        }
+
+        // Powers of 2 keep scaled coefficients exact
+        for(auto & l_scale: p_row_scales)
+        {
+            l_scale = std::exp2(std::round(std::log2(l_scale)));
+        }
+        for(auto & l_scale: p_column_scales)
+        {
+            l_scale = std::exp2(std::round(std::log2(l_scale)));
+        }
+    }
+}
+
+#endif //SIMPLEX_SCALING_H
+// EOF
@@ -0,0 +1,257 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_SCOPE_TRAIL_H
+#define SIMPLEX_SCOPE_TRAIL_H
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Stack of scopes opened by push with the changes done inside them.
+     * Changes are only recorded while a scope is opened and are given back
+     * in reverse order when the scope is popped
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_scope_trail
+    {
+      public:
+        /**
+         * Kind of changes recorded in trail
+         */
+        typedef enum class trail_kind
+        {
+            B_COEF,
+            UNIT_COLUMN,
+            EQUATION,
+            BOUNDS
+        } t_trail_kind;
+
+        /**
+         * Change done inside a scope with information needed to undo it
+         */
+        typedef struct
+        {
+            /**
+             * Kind of change
+             */
+            t_trail_kind m_kind;
+
+            /**
+             * Equation index, variable index for BOUNDS
+             */
+            unsigned int m_equation_index;
+
+            /**
+             * Previous unit column of equation for UNIT_COLUMN
+             */
+            unsigned int m_unit_column;
+
+            /**
+             * Previous B coefficient of equation for B_COEF, previous lower
+             * bound of variable in original units for BOUNDS
+             */
+            COEF_TYPE m_B_coef;
+
+            /**
+             * Previous upper bound of variable in original units for BOUNDS
+             */
+            COEF_TYPE m_upper_bound;
+
+            /**
+             * Indicate if variable had an upper bound for BOUNDS
+             */
+            bool m_has_upper_bound;
+        } t_trail_entry;
+
+        /**
+         * State saved by push
+         */
+        typedef struct
+        {
+            /**
+             * Trail size when scope was opened
+             */
+            size_t m_trail_size;
+
+            /**
+             * Indicate if a search had been done when scope was opened
+             */
+            bool m_search_done;
+
+            /**
+             * Base variables when scope was opened
+             */
+            std::vector<unsigned int> m_base_variables;
+
+            /**
+             * Number of base variables defined when scope was opened
+             */
+            unsigned int m_nb_base_variables_defined;
+
+            /**
+             * Complemented variables when scope was opened
+             */
+            std::vector<bool> m_complemented;
+        } t_scope;
+
+        /**
+         * Indicate if no scope is opened
+         */
+        inline
+        bool
+        empty() const;
+
+        /**
+         * Number of opened scopes
+         */
+        inline
+        unsigned int
+        get_nb_scopes() const;
+
+        /**
+         * Open a scope
+         * @param p_scope state to restore when scope is popped, its trail
+         * size is set by this method
+         */
+        inline
+        void
+        push(t_scope & p_scope);
+
+        /**
+         * Record a change if a scope is opened
+         * @param p_kind kind of change
+         * @param p_equation_index equation index, variable index for BOUNDS
+         * @param p_unit_column previous unit column of equation
+         * @param p_B_coef previous B coefficient of equation or lower bound
+         * @param p_upper_bound previous upper bound for BOUNDS
+         * @param p_has_upper_bound previous upper bound existence for BOUNDS
+         */
+        inline
+        void
+        record(t_trail_kind p_kind,
+               unsigned int p_equation_index,
+               unsigned int p_unit_column,
+               const COEF_TYPE & p_B_coef,
+               const COEF_TYPE & p_upper_bound = COEF_TYPE(0),
+               bool p_has_upper_bound = false
+              );
+
+        /**
+         * Close last scope. Changes are given to undo function from the last
+         * one. Changes recorded by undo function are dropped
+         * @param p_undo function called with each change of scope
+         * @return state saved when scope was opened
+         */
+        template <typename UNDO_FUNCTION>
+        inline
+        t_scope
+        pop(UNDO_FUNCTION p_undo);
+
+      private:
+        /**
+         * Changes done inside opened scopes
+         */
+        std::vector<t_trail_entry> m_trail;
+
+        /**
+         * Scopes opened by push
+         */
+        std::vector<t_scope> m_scopes;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_scope_trail<COEF_TYPE>::empty() const
+    {
+        return m_scopes.empty();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    unsigned int
+    simplex_scope_trail<COEF_TYPE>::get_nb_scopes() const
+    {
+        return (unsigned int)m_scopes.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_scope_trail<COEF_TYPE>::push(t_scope & p_scope)
+    {
+        p_scope.m_trail_size = m_trail.size();
+        m_scopes.push_back(p_scope);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    void
+    simplex_scope_trail<COEF_TYPE>::record(t_trail_kind p_kind,
+                                           unsigned int p_equation_index,
+                                           unsigned int p_unit_column,
+                                           const COEF_TYPE & p_B_coef,
+                                           const COEF_TYPE & p_upper_bound,
+                                           bool p_has_upper_bound
+                                          )
+    {
+        if(m_scopes.empty())
+        {
+            return;
+        }
+        t_trail_entry l_entry;
+        l_entry.m_kind = p_kind;
+        l_entry.m_equation_index = p_equation_index;
+        l_entry.m_unit_column = p_unit_column;
+        l_entry.m_B_coef = p_B_coef;
+        l_entry.m_upper_bound = p_upper_bound;
+        l_entry.m_has_upper_bound = p_has_upper_bound;
+        m_trail.push_back(l_entry);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    template <typename UNDO_FUNCTION>
+    typename simplex_scope_trail<COEF_TYPE>::t_scope
+    simplex_scope_trail<COEF_TYPE>::pop(UNDO_FUNCTION p_undo)
+    {
+        assert(!m_scopes.empty());
+        size_t l_trail_size = m_scopes.back().m_trail_size;
+        // Scope stays opened while undoing so that entries are copied as
+        // undo function may record new ones
+        for(size_t l_trail_index = m_trail.size();
+            l_trail_index > l_trail_size;
+            --l_trail_index
+           )
+        {
+            t_trail_entry l_entry = m_trail[l_trail_index - 1];
+            p_undo(l_entry);
+        }
+        m_trail.resize(l_trail_size);
+        t_scope l_scope = m_scopes.back();
+        m_scopes.pop_back();
+        return l_scope;
+    }
+}
+
+#endif //SIMPLEX_SCOPE_TRAIL_H
+// EOF
@@ -0,0 +1,266 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_SOLVE_OPTIONS_H
+#define SIMPLEX_SOLVE_OPTIONS_H
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <iostream>
+#include <string>
+
+namespace simplex
+{
+    /**
+     * Outcome of a search
+     */
+    typedef enum class solve_status
+    {
+        OPTIMAL,
+        INFEASIBLE,
+        UNBOUNDED,
+        ITERATION_LIMIT,
+        TIME_LIMIT,
+        CUTOFF,
+        CANCELLED
+    } t_solve_status;
+
+    /**
+     * Return name of status
+     * @param p_status status
+     * @return status name
+     */
+    inline
+    std::string
+    to_string(t_solve_status p_status)
+    {
+        switch(p_status)
+        {
+            case t_solve_status::OPTIMAL:
+                return "OPTIMAL";
+            case t_solve_status::INFEASIBLE:
+                return "INFEASIBLE";
+            case t_solve_status::UNBOUNDED:
+                return "UNBOUNDED";
+            case t_solve_status::ITERATION_LIMIT:
+                return "ITERATION_LIMIT";
+            case t_solve_status::TIME_LIMIT:
+                return "TIME_LIMIT";
+            case t_solve_status::CUTOFF:
+                return "CUTOFF";
+            case t_solve_status::CANCELLED:
+                return "CANCELLED";
+        }
+        return "UNKNOWN";
+    }
+
+    //-------------------------------------------------------------------------
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream,
+               t_solve_status p_status
+              )
+    {
+        return p_stream << to_string(p_status);
+    }
+
+    /**
+     * Limits of a search. Default values define no limit
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_solve_options
+    {
+      public:
+        inline
+        simplex_solve_options();
+
+        /**
+         * Maximum number of iterations
+         */
+        unsigned int m_iteration_limit;
+
+        /**
+         * Maximum duration of search
+         */
+        std::chrono::microseconds m_time_limit;
+
+        /**
+         * Indicate if search stops once objective function reaches
+         * m_cutoff
+         */
+        bool m_use_cutoff;
+
+        /**
+         * Objective function value considered as good enough
+         */
+        COEF_TYPE m_cutoff;
+
+        /**
+         * Flag owned by caller that another thread can set to stop search,
+         * null if search cannot be cancelled
+         */
+        const std::atomic<bool> * m_cancel;
+    };
+
+    /**
+     * Check of options limits done by solvers between iterations. Time is
+     * measured from construction
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_solve_control
+    {
+      public:
+        inline explicit
+        simplex_solve_control(const simplex_solve_options<COEF_TYPE> & p_options);
+
+        /**
+         * Check iteration and time limits and cancellation
+         * @param p_nb_iteration number of iterations already done
+         * @param p_status receive reason of stop if any
+         * @return true if search should stop
+         */
+        inline
+        bool
+        must_stop(unsigned int p_nb_iteration,
+                  t_solve_status & p_status
+                 ) const;
+
+        /**
+         * Indicate if objective function cutoff is defined
+         * @return true if a cutoff is defined
+         */
+        inline
+        bool
+        has_cutoff() const;
+
+        /**
+         * Check if objective function value reached cutoff
+         * @param p_objective current objective function value
+         * @return true if cutoff is reached
+         */
+        inline
+        bool
+        is_cutoff_reached(const COEF_TYPE & p_objective) const;
+
+        /**
+         * Return time remaining before time limit
+         * @return remaining time, maximum value if there is no time limit
+         */
+        inline
+        std::chrono::microseconds
+        get_remaining_time() const;
+
+        /**
+         * Return options checked by control
+         * @return options
+         */
+        inline
+        const simplex_solve_options<COEF_TYPE> &
+        get_options() const;
+
+      private:
+        const simplex_solve_options<COEF_TYPE> & m_options;
+
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_solve_options<COEF_TYPE>::simplex_solve_options()
+    :m_iteration_limit(std::numeric_limits<unsigned int>::max())
+    ,m_time_limit(std::chrono::microseconds::max())
+    ,m_use_cutoff(false)
+    ,m_cutoff(0)
+    ,m_cancel(NULL)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    simplex_solve_control<COEF_TYPE>::simplex_solve_control(const simplex_solve_options<COEF_TYPE> & p_options)
+    :m_options(p_options)
+    ,m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_solve_control<COEF_TYPE>::must_stop(unsigned int p_nb_iteration,
+                                                t_solve_status & p_status
+                                               ) const
+    {
+        if(m_options.m_cancel && m_options.m_cancel->load(std::memory_order_relaxed))
+        {
+            p_status = t_solve_status::CANCELLED;
+            return true;
+        }
+        if(p_nb_iteration >= m_options.m_iteration_limit)
+        {
+            p_status = t_solve_status::ITERATION_LIMIT;
+            return true;
+        }
+        if(std::chrono::microseconds::max() != m_options.m_time_limit && std::chrono::steady_clock::now() - m_start >= m_options.m_time_limit)
+        {
+            p_status = t_solve_status::TIME_LIMIT;
+            return true;
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_solve_control<COEF_TYPE>::has_cutoff() const
+    {
+        return m_options.m_use_cutoff;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    bool
+    simplex_solve_control<COEF_TYPE>::is_cutoff_reached(const COEF_TYPE & p_objective) const
+    {
+        return m_options.m_use_cutoff && !(p_objective < m_options.m_cutoff);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    std::chrono::microseconds
+    simplex_solve_control<COEF_TYPE>::get_remaining_time() const
+    {
+        if(std::chrono::microseconds::max() == m_options.m_time_limit)
+        {
+            return m_options.m_time_limit;
+        }
+        std::chrono::microseconds l_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start);
+        return l_elapsed < m_options.m_time_limit ? m_options.m_time_limit - l_elapsed : std::chrono::microseconds(0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE>
+    const simplex_solve_options<COEF_TYPE> &
+    simplex_solve_control<COEF_TYPE>::get_options() const
+    {
+        return m_options;
+    }
+}
+#endif //SIMPLEX_SOLVE_OPTIONS_H
+// EOF
@@ -20,6 +20,8 @@
 #include "simplex_solver_base.h"
 #include "simplex_listener.h"
 #include "simplex_array.h"
+#include "simplex_column_array.h"
+#include "simplex_row_kernel.h"
 #include <quicky_exception.h>
 #include "type_string.h"
 #include <cstring>
@@ -29,11 +31,12 @@
 #include <sstream>
 #include <string>
 #include <limits>
+#include <vector>
 		
 namespace simplex
 {
-  template <typename COEF_TYPE,typename ARRAY_TYPE=simplex_array<COEF_TYPE>>
-  class simplex_solver:public simplex_solver_base<COEF_TYPE,ARRAY_TYPE>
+  template <typename COEF_TYPE,typename ARRAY_TYPE=simplex_array<COEF_TYPE>,typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
+  class simplex_solver:public simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>
   {
     public:
       /**
@@ -64,11 +67,58 @@ namespace simplex
                         const unsigned int p_column_index
                        ) override;
 
+      /**
+         Pivot implementation for arrays storing rows contiguously or
+         accessed through coefficient accessors
+         @param p_row_index Row index
+         @param p_column_index Column index
+      */
+      inline void pivot_by_layout(const unsigned int p_row_index,
+                                  const unsigned int p_column_index,
+                                  std::false_type
+                                 );
+
+      /**
+         Pivot implementation working on contiguous columns: each column
+         with a non null coefficient in pivot row is updated by a kernel
+         applied on pivot column
+         @param p_row_index Row index
+         @param p_column_index Column index
+      */
+      inline void pivot_by_layout(const unsigned int p_row_index,
+                                  const unsigned int p_column_index,
+                                  std::true_type
+                                 );
+
+      /**
+         Pivot implementation working on contiguous rows with vectorized
+         kernels
+         @param p_row_index Row index
+         @param p_column_index Column index
+      */
+      inline void pivot(const unsigned int p_row_index,
+                        const unsigned int p_column_index,
+                        std::true_type
+                       );
+
+      /**
+         Pivot implementation using coefficient accessors and restricted
+         to non null coefficients of pivot row and pivot column
+         @param p_row_index Row index
+         @param p_column_index Column index
+      */
+      inline void pivot(const unsigned int p_row_index,
+                        const unsigned int p_column_index,
+                        std::false_type
+                       );
+
       /**
          Method to determine the equation index corresponding to next output
          variable for pivot operation
          @param index of input variable
-         @param reference on variable where to store the output equation index if any
+         @param reference on variable where to store the output equation index if any.
+         Number of equations is stored if input variable reaches its upper
+         bound before any base variable reaches one of its bounds
          @return boolean indicating if an input variable was found
        */
       inline
@@ -77,19 +127,70 @@ namespace simplex
                                 unsigned int & p_equation_index
                                )const override;
 
+      /**
+       * Index of variables with non null coefficient in pivot row
+       */
+      std::vector<unsigned int> m_pivot_row_pattern;
+
+      /**
+       * Index of rows with non null coefficient in pivot column, pivot row
+       * excluded
+       */
+      std::vector<unsigned int> m_pivot_column_pattern;
+
+      /**
+       * Dense copy of pivot column used to update B coefficients, pivot row
+       * coefficient is null
+       */
+      std::vector<COEF_TYPE> m_pivot_column;
   };
 
     //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
     void
-    simplex_solver<COEF_TYPE,ARRAY_TYPE>::pivot(const unsigned int p_row_index,
-                                                const unsigned int p_column_index
-                                               )
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index,
+                                                               const unsigned int p_column_index
+                                                              )
     {
         assert(p_row_index < this->get_nb_total_equations());
         assert(p_column_index < this->get_nb_all_variables());
+        assert(this->get_internal_coef(p_row_index,p_column_index));
+        pivot_by_layout(p_row_index,
+                        p_column_index,
+                        std::integral_constant<bool, simplex_array_traits<ARRAY_TYPE>::m_contiguous_columns>()
+                       );
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot_by_layout(const unsigned int p_row_index,
+                                                                         const unsigned int p_column_index,
+                                                                         std::false_type
+                                                                        )
+    {
+        pivot(p_row_index,
+              p_column_index,
+              std::integral_constant<bool, simplex_row_kernel<COEF_TYPE>::m_vectorized && simplex_array_traits<ARRAY_TYPE>::m_contiguous_rows>()
+             );
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot_by_layout(const unsigned int p_row_index,
+                                                                         const unsigned int p_column_index,
+                                                                         std::true_type
+                                                                        )
+    {
         COEF_TYPE l_pivot = this->get_internal_coef(p_row_index,p_column_index);
-        assert(l_pivot);
+        unsigned int l_nb_total_equations = this->get_nb_total_equations();
+
+        // Columns with null coefficient in pivot row are not modified
+        this->collect_row_pattern(p_row_index, m_pivot_row_pattern);
+        const COEF_TYPE * l_column = this->get_array().get_column(p_column_index);
+        m_pivot_column.assign(l_column, l_column + l_nb_total_equations);
+        m_pivot_column[p_row_index] = COEF_TYPE(0);
 
         // Pivoting Z
         COEF_TYPE l_q = this->get_array().get_Z_coef(p_column_index);
@@ -99,51 +200,160 @@ namespace simplex
             std::cout << "Z line <= Z - " << l_q << " * R[" << p_row_index << "] / " << l_pivot << std::endl;
         }
 #endif // DEBUG_SIMPLEX
-        for(unsigned int l_index = 0;
-            l_index < this->get_nb_all_variables();
-            ++l_index
-           )
+        if(l_q)
         {
-            COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
-            this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) - l_q * (l_u / l_pivot));
+            for(auto l_index: m_pivot_row_pattern)
+            {
+                COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
+                this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) - l_q * (l_u / l_pivot));
+            }
+            this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
         }
-        this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
 
-        // Pivoting other rows
-        for(unsigned int l_row_index = 0;
-            l_row_index < this->get_nb_total_equations();
-            ++l_row_index
-            )
+        // Pivoting B column, pivot row is unchanged as its pivot column
+        // coefficient is null in dense copy
+        simplex_row_kernel<COEF_TYPE>::eliminate(this->get_array().get_B_column(), m_pivot_column.data(), this->get_array().get_B_coef(p_row_index), l_pivot, l_nb_total_equations);
+
+        // Pivoting columns: C[i] <= C[i] - C[pivot row] * P[i] / pivot then
+        // particular case of pivot row
+        for(auto l_index: m_pivot_row_pattern)
         {
-            if(l_row_index != p_row_index)
+            COEF_TYPE * l_updated_column = this->get_array().get_column(l_index);
+            COEF_TYPE l_u = l_updated_column[p_row_index];
+            if(l_index == p_column_index)
+            {
+                // Set exact values to avoid rounding residues in base column
+                std::fill(l_updated_column, l_updated_column + l_nb_total_equations, COEF_TYPE(0));
+            }
+            else
             {
-                COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
+                simplex_row_kernel<COEF_TYPE>::eliminate(l_updated_column, m_pivot_column.data(), l_u, l_pivot, l_nb_total_equations);
+            }
+            l_updated_column[p_row_index] = l_u / l_pivot;
+        }
+        this->get_array().set_B_coef(p_row_index, this->get_array().get_B_coef(p_row_index) / l_pivot);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index,
+                                                               const unsigned int p_column_index,
+                                                               std::true_type
+                                                              )
+    {
+        COEF_TYPE l_pivot = this->get_internal_coef(p_row_index,p_column_index);
+        unsigned int l_nb_all_variables = this->get_nb_all_variables();
+        unsigned int l_nb_total_equations = this->get_nb_total_equations();
+        const COEF_TYPE * l_pivot_row = this->get_array().get_row(p_row_index);
+
+        // Rows with null coefficient in pivot column are not modified
+        this->collect_column_pattern(p_column_index, p_row_index, m_pivot_column_pattern);
+        m_pivot_column.assign(l_nb_total_equations, (COEF_TYPE)0);
+        for(auto l_row_index: m_pivot_column_pattern)
+        {
+            m_pivot_column[l_row_index] = this->get_internal_coef(l_row_index,p_column_index);
+        }
+
+        // Pivoting Z
+        COEF_TYPE l_q = this->get_array().get_Z_coef(p_column_index);
+#ifdef DEBUG_SIMPLEX
+        if(l_pivot != 1 || l_q)
+        {
+            std::cout << "Z line <= Z - " << l_q << " * R[" << p_row_index << "] / " << l_pivot << std::endl;
+        }
+#endif // DEBUG_SIMPLEX
+        if(l_q)
+        {
+            simplex_row_kernel<COEF_TYPE>::eliminate_objective(this->get_array().get_Z_row(), l_pivot_row, l_q, l_pivot, l_nb_all_variables);
+            this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
+        }
+
+        // Pivoting B column, pivot row is unchanged as its pivot column
+        // coefficient is null in dense copy
+        simplex_row_kernel<COEF_TYPE>::eliminate(this->get_array().get_B_column(), m_pivot_column.data(), this->get_array().get_B_coef(p_row_index), l_pivot, l_nb_total_equations);
+
+        // Pivoting other rows
+        this->for_each_row((unsigned int)m_pivot_column_pattern.size(),
+                           [&](unsigned int p_pattern_index)
+                           {
+                               unsigned int l_row_index = m_pivot_column_pattern[p_pattern_index];
+                               COEF_TYPE l_q = m_pivot_column[l_row_index];
 #ifdef DEBUG_SIMPLEX
-                if(l_q)
-                {
-                    std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] - " << l_q << " * " << "R[" << p_row_index << "] / " << l_pivot << std::endl;
-                }
+                               std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] - " << l_q << " * " << "R[" << p_row_index << "] / " << l_pivot << std::endl;
 #endif // DEBUG_SIMPLEX
-                this->get_array().set_B_coef(l_row_index, this->get_array().get_B_coef(l_row_index) - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
-                for(unsigned int l_index = 0;
-                    l_index < this->get_nb_all_variables();
-                    ++l_index
-                   )
-                {
-                    COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
-                    this->set_internal_coef(l_row_index, l_index, this->get_internal_coef(l_row_index,l_index) - (l_q * l_u) / l_pivot);
-                }
+                               simplex_row_kernel<COEF_TYPE>::eliminate(this->get_array().get_row(l_row_index), l_pivot_row, l_q, l_pivot, l_nb_all_variables);
+                               // Set exact value to avoid rounding residues in base column
+                               this->set_internal_coef(l_row_index, p_column_index, (COEF_TYPE)0);
+                           }
+                          );
+
+        // Particular case of pivot row
+#ifdef DEBUG_SIMPLEX
+        std::cout << "R[" << p_row_index << "] <= R[" << p_row_index << "] / " << l_pivot << std::endl;
+#endif // DEBUG_SIMPLEX
+        simplex_row_kernel<COEF_TYPE>::divide(this->get_array().get_row(p_row_index), l_pivot, l_nb_all_variables);
+        this->get_array().set_B_coef(p_row_index, this->get_array().get_B_coef(p_row_index) / l_pivot);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index,
+                                                               const unsigned int p_column_index,
+                                                               std::false_type
+                                                              )
+    {
+        COEF_TYPE l_pivot = this->get_internal_coef(p_row_index,p_column_index);
+
+        // Only non null coefficients of pivot row and pivot column
+        // contribute to pivot
+        this->collect_row_pattern(p_row_index, m_pivot_row_pattern);
+        this->collect_column_pattern(p_column_index, p_row_index, m_pivot_column_pattern);
+
+        // Pivoting Z
+        COEF_TYPE l_q = this->get_array().get_Z_coef(p_column_index);
+#ifdef DEBUG_SIMPLEX
+        if(l_pivot != 1 || l_q)
+        {
+            std::cout << "Z line <= Z - " << l_q << " * R[" << p_row_index << "] / " << l_pivot << std::endl;
+        }
+#endif // DEBUG_SIMPLEX
+        if(l_q)
+        {
+            for(auto l_index: m_pivot_row_pattern)
+            {
+                COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
+                this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) - l_q * (l_u / l_pivot));
             }
+            this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
         }
 
+        // Pivoting other rows
+        this->for_each_row((unsigned int)m_pivot_column_pattern.size(),
+                           [&](unsigned int p_pattern_index)
+                           {
+                               unsigned int l_row_index = m_pivot_column_pattern[p_pattern_index];
+                               COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
+#ifdef DEBUG_SIMPLEX
+                               std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] - " << l_q << " * " << "R[" << p_row_index << "] / " << l_pivot << std::endl;
+#endif // DEBUG_SIMPLEX
+                               this->get_array().set_B_coef(l_row_index, this->get_array().get_B_coef(l_row_index) - (l_q * this->get_array().get_B_coef(p_row_index)) / l_pivot);
+                               for(auto l_index: m_pivot_row_pattern)
+                               {
+                                   COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
+                                   this->set_internal_coef(l_row_index, l_index, this->get_internal_coef(l_row_index,l_index) - (l_q * l_u) / l_pivot);
+                               }
+                               // Set exact value to avoid rounding residues in base column
+                               this->set_internal_coef(l_row_index, p_column_index, (COEF_TYPE)0);
+                           }
+                          );
+
         // Particular case of pivot row
 #ifdef DEBUG_SIMPLEX
         std::cout << "R[" << p_row_index << "] <= R[" << p_row_index << "] / " << l_pivot << std::endl;
 #endif // DEBUG_SIMPLEX
-        for(unsigned int l_index = 0;
-            l_index < this->get_nb_variables();
-            ++l_index
-           )
+        for(auto l_index: m_pivot_row_pattern)
         {
             this->set_internal_coef(p_row_index,l_index,this->get_internal_coef(p_row_index,l_index) / l_pivot);
         }
@@ -151,54 +361,68 @@ namespace simplex
     }
 
     //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
     bool
-    simplex_solver<COEF_TYPE,ARRAY_TYPE>::get_output_equation_index(unsigned int p_input_variable_index,
-                                                                    unsigned int & p_equation_index
-                                                                   )const
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_output_equation_index(unsigned int p_input_variable_index,
+                                                                                   unsigned int & p_equation_index
+                                                                                  )const
     {
         assert(p_input_variable_index < this->get_nb_all_variables());
-        unsigned int l_index = 0;
-        while(this->get_internal_coef(l_index,p_input_variable_index) <= 0 && l_index < this->get_nb_total_equations())
-        {
-            ++l_index;
-        }
-        if(l_index == this->get_nb_total_equations())
-        {
-            return false;
-        }
-        COEF_TYPE l_min = this->get_array().get_B_coef(l_index) / this->get_internal_coef(l_index,p_input_variable_index);
-        p_equation_index = l_index;
-        ++l_index;
-        while(l_index < this->get_nb_total_equations())
+        // Rounding residues should not be selected as pivot
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        bool l_found = false;
+        COEF_TYPE l_min = 0;
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_total_equations();
+            ++l_index
+           )
         {
             COEF_TYPE l_divider = this->get_internal_coef(l_index,p_input_variable_index);
-            if(l_divider > 0)
+            COEF_TYPE l_result;
+            if(l_divider > l_tolerance)
             {
-                COEF_TYPE l_result = this->get_array().get_B_coef(l_index) / l_divider;
-                if(l_result < l_min)
-                {
-                    l_min = l_result;
-                    p_equation_index = l_index;
-                }
+                // Base variable decrease down to 0
+                l_result = this->get_array().get_B_coef(l_index) / l_divider;
             }
-            ++l_index;
+            else if(l_divider < -l_tolerance && this->is_bounded() && this->has_upper_bound(this->get_base_variable(l_index)))
+            {
+                // Base variable increase up to its upper bound
+                COEF_TYPE l_base_coef = this->get_internal_coef(l_index, this->get_base_variable(l_index));
+                l_result = (this->get_upper_bound(this->get_base_variable(l_index)) * l_base_coef - this->get_array().get_B_coef(l_index)) / -l_divider;
+            }
+            else
+            {
+                continue;
+            }
+            if(!l_found || l_result < l_min)
+            {
+                l_min = l_result;
+                p_equation_index = l_index;
+                l_found = true;
+            }
+        }
+        // Input variable reaching its own upper bound first is indicated by
+        // an equation index equal to number of equations
+        if(this->is_bounded() && this->has_upper_bound(p_input_variable_index) && (!l_found || !(l_min < this->get_upper_bound(p_input_variable_index))))
+        {
+            p_equation_index = this->get_nb_total_equations();
+            return true;
         }
-      return true;
+        return l_found;
     }
 
     //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    simplex_solver<COEF_TYPE,ARRAY_TYPE>::simplex_solver(unsigned int p_nb_variables,
-                                                         unsigned int p_nb_inequations_lt,
-                                                         unsigned int p_nb_equations,
-                                                         unsigned int p_nb_inequations_gt
-                                                        ):
-            simplex_solver_base<COEF_TYPE,ARRAY_TYPE>(p_nb_variables,
-                                                      p_nb_inequations_lt,
-                                                      p_nb_equations,
-                                                      p_nb_inequations_gt
-                                                     )
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    simplex_solver<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::simplex_solver(unsigned int p_nb_variables,
+                                                                        unsigned int p_nb_inequations_lt,
+                                                                        unsigned int p_nb_equations,
+                                                                        unsigned int p_nb_inequations_gt
+                                                                       ):
+            simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>(p_nb_variables,
+                                                                     p_nb_inequations_lt,
+                                                                     p_nb_equations,
+                                                                     p_nb_inequations_gt
+                                                                    )
     {
 
     }
@@ -19,25 +19,30 @@
 #define SIMPLEX_SOLVER_BASE_H
 
 #include "simplex_listener.h"
+#include "simplex_pricing.h"
+#include "simplex_array_base.h"
+#include "simplex_thread_pool.h"
+#include "simplex_solve_options.h"
+#include "simplex_range.h"
+#include "simplex_scaling.h"
+#include "simplex_scope_trail.h"
+#include "simplex_equation_type.h"
+#include "simplex_checked_arithmetic.h"
 #include "quicky_exception.h"
 #include "equation_system.h"
 #include <sstream>
 #include <limits>
 #include <vector>
+#include <memory>
 #include <memory.h>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
 
 namespace simplex
 {
 
-    typedef enum class equation_type
-    {
-        UNDEFINED = 0,
-        EQUATION,
-        INEQUATION_LT,
-        INEQUATION_GT
-    } t_equation_type;
-
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
     class simplex_solver_base: public simplex_listener_target_if<COEF_TYPE>
     {
       public:
@@ -79,6 +84,19 @@ namespace simplex
                                const COEF_TYPE & p_value
                               );
 
+        /**
+         * Modify B coefficient of an equation after a search. Current simplex
+         * array is updated consistently with current base so that
+         * find_max_dual can restart from it. Adjustment or base variable
+         * initially defined for equation should only appear in this equation.
+         * Modification is undone by pop when done inside a scope
+         * @param p_index : the value should be less than total number of equations
+         * @param value : new value of coefficient in b
+         */
+        inline void update_B_coef(const unsigned int p_index,
+                                  const COEF_TYPE & p_value
+                                 );
+
         /**
          * Define coefficient for A coefficients in A x = b
          * @param p_equation_index : the value should be less than total number of equations
@@ -125,6 +143,44 @@ namespace simplex
                                   const simplex::equation_type & p_equation_type
                                  );
 
+        /**
+         * Define a range equation p_lower <= a1 * x1 + ... + an * xn <= p_upper
+         * stored as a single row. Equation should be counted as an
+         * INEQUATION_LT and B coefficient is set to p_upper. Lower limit is
+         * an upper bound on its adjustment variable
+         * @param p_equation_index Equation index
+         * @param p_lower lower limit of equation
+         * @param p_upper upper limit of equation
+         */
+        inline
+        void define_range_equation(const unsigned int & p_equation_index,
+                                   const COEF_TYPE & p_lower,
+                                   const COEF_TYPE & p_upper
+                                  );
+
+        /**
+         * Define lower bound of a variable, default lower bound is 0.
+         * Bound is kept outside of simplex array
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value lower bound
+         */
+        inline
+        void set_variable_lower_bound(const unsigned int p_variable_index,
+                                      const COEF_TYPE & p_value
+                                     );
+
+        /**
+         * Define upper bound of a variable, by default there is no upper
+         * bound. Bound is kept outside of simplex array and handled by ratio
+         * test so no equation is needed for it
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value upper bound
+         */
+        inline
+        void set_variable_upper_bound(const unsigned int p_variable_index,
+                                      const COEF_TYPE & p_value
+                                     );
+
         /**
          * Declare that a variable is a base variable
          * @param variable index in simplex array
@@ -141,6 +197,110 @@ namespace simplex
         const unsigned int &
         get_base_variable(const unsigned int & p_index)const;
 
+        /**
+         * Return current basis so that a later search of a close problem
+         * can start from it
+         * @return index of base variable of each equation, maximum value of
+         * unsigned int for equations without base variable or whose base
+         * variable is artificial
+         */
+        inline
+        std::vector<unsigned int>
+        get_basis() const;
+
+        /**
+         * Define base variables from a basis returned by get_basis. Only
+         * the set of base variables matters: equations are pivoted so that
+         * each variable of the basis becomes a base variable. Equations
+         * without base variable and base variables that do not respect
+         * their bounds are completed by the first phase of find_max
+         * @param p_basis index of base variable of each equation, maximum
+         * value of unsigned int if none
+         */
+        virtual
+        void
+        set_basis(const std::vector<unsigned int> & p_basis);
+
+        /**
+         * Add a variable after existing ones, adjustment variables indexes
+         * are shifted by one. Before any search coefficients are simply
+         * stored. Once a search has been done the new column is expressed in
+         * current base using columns of variables initially specific to an
+         * equation, like update_B_coef, so that current base stays valid and
+         * next search restarts from it
+         * @param p_Z_coef value of coefficient in the formula Z = SUM(Cj * x)
+         * @param p_coefs coefficient of new variable in each equation
+         * @return index of new variable
+         */
+        inline
+        unsigned int
+        add_variable(const COEF_TYPE & p_Z_coef,
+                     const std::vector<COEF_TYPE> & p_coefs
+                    );
+
+        /**
+         * Add an equation after existing ones. Its adjustment variable, if
+         * any, becomes its base variable when other equations have one.
+         * Once a search has been done the new equation is expressed with non
+         * base variables so that current base stays valid: find_max_dual
+         * restarts from it when the new equation is an inequation that is
+         * not respected by current solution, find_max completes the base
+         * for a new equation
+         * @param p_coefs coefficient of each variable in new equation
+         * @param p_equation_type type of new equation
+         * @param p_B_coef value of B coefficient of new equation
+         * @return index of new equation
+         */
+        inline
+        unsigned int
+        add_constraint(const std::vector<COEF_TYPE> & p_coefs,
+                       const t_equation_type & p_equation_type,
+                       const COEF_TYPE & p_B_coef
+                      );
+
+        /**
+         * Fix a variable to a value by setting both its bounds to it. No
+         * equation is added: once a search has been done simplex array is
+         * translated so that current base stays valid and find_max_dual
+         * restarts from it. Previous bounds are recorded so that pop undoes
+         * fixing
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value value of variable
+         */
+        virtual
+        void
+        fix_variable(const unsigned int p_variable_index,
+                     const COEF_TYPE & p_value
+                    );
+
+        /**
+         * Open a scope: equations added with add_constraint, bounds changed
+         * by fix_variable and B coefficients modified with update_B_coef
+         * until matching pop are recorded so that pop can undo them. Only inequations can be
+         * added and no variable can be added inside a scope
+         */
+        inline
+        void
+        push();
+
+        /**
+         * Close last scope opened by push. Recorded changes are undone in
+         * reverse order and base of push is restored so that next search
+         * restarts from it. Base variables of added inequations that are
+         * not adjustment variables are first replaced by them
+         */
+        inline
+        void
+        pop();
+
+        /**
+         * Return number of scopes opened by push and not closed by pop
+         * @return number of scopes
+         */
+        inline
+        unsigned int
+        get_nb_scopes() const;
+
         /**
          * Return total number of equations ( <= + >= + = )
          */
@@ -150,11 +310,15 @@ namespace simplex
 
         /**
          Method implementing simplex algorithm to find max optimum solution
-         The problem must be in solved form
+         Base variables do not need to be defined: equations without a
+         feasible base variable receive an artificial variable and a first
+         phase minimizing the sum of artificial variables builds a feasible
+         base before the search of the optimum
          @param reference on variable where result will be stored
          @param reference on a boolean value that will receive true if max
          is infinite
-         @return value indicating if a max was found
+         @return value indicating if a max was found, false with infinite
+         set to false means that problem has no feasible solution
          */
         template <class LISTENER=simplex_listener<COEF_TYPE>>
         bool
@@ -163,6 +327,74 @@ namespace simplex
                  LISTENER * p_listener = NULL
                 );
 
+        /**
+         Method implementing simplex algorithm to find max optimum solution
+         within limits of search options. Limits are checked before each
+         iteration, cutoff only once a feasible base is found
+         @param reference on variable receiving optimum, or objective
+         function value of current feasible base when search is stopped
+         @param p_options search limits
+         @param p_listener optional listener to treat iterations information
+         @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_max(COEF_TYPE & p_max,
+                 const simplex_solve_options<COEF_TYPE> & p_options,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+         Method implementing simplex algorithm to find min optimum solution
+         by searching max of opposite objective function
+         @param reference on variable where result will be stored
+         @param reference on a boolean value that will receive true if min
+         is infinite
+         @return value indicating if a min was found, false with infinite
+         set to false means that problem has no feasible solution
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_min(COEF_TYPE & p_min,
+                 bool & p_infinite,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+         Method implementing simplex algorithm to find min optimum solution
+         within limits of search options. Search stops on cutoff once
+         objective function is lower or equal to cutoff
+         @param reference on variable receiving optimum, or objective
+         function value of current feasible base when search is stopped
+         @param p_options search limits
+         @param p_listener optional listener to treat iterations information,
+         it receives values of opposite objective function
+         @return reason why search ended
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_min(COEF_TYPE & p_min,
+                 const simplex_solve_options<COEF_TYPE> & p_options,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+         Method implementing dual simplex algorithm to find max optimum
+         solution. Current base should be dual feasible, typically the base
+         of a previous optimum after some B coefficients have been modified
+         with update_B_coef, but not necessarily primal feasible
+         @param reference on variable where result will be stored
+         @param reference on a boolean value that will receive true if
+         problem has no feasible solution
+         @return value indicating if a max was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_max_dual(COEF_TYPE & p_max,
+                      bool & p_infeasible,
+                      LISTENER * p_listener = NULL
+                     );
+
         /**
          *  Method checking if variable values passed as parameters respect
          *  simplex problem constraints
@@ -171,6 +403,142 @@ namespace simplex
          */
         inline bool check_variables(const std::vector<COEF_TYPE> & p_values);
 
+        /**
+         * Return pricing policy used to select input variable so that it
+         * can be configured before calling find_max
+         * @return pricing policy
+         */
+        inline
+        PRICING_POLICY &
+        get_pricing_policy();
+
+        /**
+         * Define number of threads sharing rows update during pivot. Threads
+         * are created once and reused by all pivots. Array types that do not
+         * support concurrent update of different rows always pivot on a
+         * single thread
+         * @param p_nb_threads number of threads including calling thread, 0
+         * means number of hardware threads
+         */
+        inline
+        void
+        set_nb_threads(unsigned int p_nb_threads);
+
+        /**
+         * Return number of threads used to update rows during pivot
+         * @return number of threads including calling thread
+         */
+        inline
+        unsigned int
+        get_nb_threads() const;
+
+        /**
+         * Define minimum number of coefficients to update in a pivot to use
+         * several threads. Smaller pivots are done on calling thread
+         * @param p_nb_coefs minimum number of coefficients
+         */
+        inline
+        void
+        set_parallel_threshold(unsigned int p_nb_coefs);
+
+        /**
+         * Enable row and column scaling of simplex array before first
+         * search. Scale factors are computed by geometric mean passes
+         * followed by an equilibration so that largest coefficient of each
+         * row and column is close to 1. They are rounded to powers of 2 so
+         * that scaling introduces no rounding error. Coefficients given
+         * after search and variable values are expressed in original units.
+         * Only available for floating point coefficients
+         * @param p_scaling true to enable scaling
+         */
+        inline
+        void
+        set_scaling(bool p_scaling);
+
+        /**
+         * Define number of consecutive degenerate pivots, pivots that do not
+         * change objective function value, after which search is considered
+         * as stalling. Input and output variables are then selected with
+         * Bland's rule, lowest index first, until a pivot changes objective
+         * function value, so that search cannot cycle
+         * @param p_nb_pivots number of consecutive degenerate pivots, 0
+         * disables stall detection
+         */
+        inline
+        void
+        set_stall_threshold(unsigned int p_nb_pivots);
+
+        /**
+         * Enable perturbation of B coefficients during find_max. Each
+         * equation having a variable specific to it is relaxed by a small
+         * amount so that ties between output equations are unlikely.
+         * Perturbation is removed once optimum is found and dual simplex
+         * iterations restore feasibility if needed. Only available for
+         * floating point coefficients
+         * @param p_perturbation true to enable perturbation
+         */
+        inline
+        void
+        set_perturbation(bool p_perturbation);
+
+        /**
+         * Return number of pivots done by last search
+         * @return number of pivots
+         */
+        inline
+        unsigned int
+        get_nb_pivots() const;
+
+        /**
+         * Return number of pivots of last search that did not change
+         * objective function value
+         * @return number of degenerate pivots
+         */
+        inline
+        unsigned int
+        get_nb_degenerate_pivots() const;
+
+        /**
+         * Return proportion of degenerate pivots in last search
+         * @return ratio between 0 and 1, 0 if no pivot was done
+         */
+        inline
+        double
+        get_degenerate_pivot_ratio() const;
+
+        /**
+         * Return dual value of each equation in final base of last search:
+         * variation of optimum when B coefficient of equation increases by 1
+         * @return dual value of each equation
+         */
+        std::vector<COEF_TYPE>
+        get_dual_values() const;
+
+        /**
+         * Return reduced cost of each variable in final base of last search:
+         * variation of optimum when variable moves by 1 from the bound where
+         * it stays, 0 for base variables
+         * @return reduced cost of each variable
+         */
+        std::vector<COEF_TYPE>
+        get_reduced_costs() const;
+
+        /**
+         * Return range of B coefficient of each equation for which final
+         * base of last search stays feasible, and so optimal
+         * @return allowable decrease and increase of each B coefficient
+         */
+        std::vector<simplex_range<COEF_TYPE>>
+        get_B_coef_ranges() const;
+
+        /**
+         * Return range of Z coefficient of each variable for which final
+         * base of last search stays optimal
+         * @return allowable decrease and increase of each Z coefficient
+         */
+        std::vector<simplex_range<COEF_TYPE>>
+        get_Z_coef_ranges() const;
+
         inline virtual ~simplex_solver_base(void);
 
       protected:
@@ -210,7 +578,7 @@ namespace simplex
          */
         inline
         void
-        set_base_variable(const unsigned int & p_index, const unsigned int & p_value)const;
+        set_base_variable(const unsigned int & p_index, const unsigned int & p_value);
 
         /**
             * Define coefficient for A coefficients in A x = b
@@ -239,6 +607,70 @@ namespace simplex
                           const unsigned int p_variable_index
                          ) const;
 
+        /**
+         * Collect index of variables having a non null coefficient in a row
+         * @param p_row_index row index
+         * @param p_pattern vector receiving variable indexes in increasing order
+         */
+        inline
+        void
+        collect_row_pattern(unsigned int p_row_index,
+                            std::vector<unsigned int> & p_pattern
+                           ) const;
+
+        /**
+         * Return variable whose column was specific to an equation at first
+         * search, used to compute dual values
+         * @param p_row_index index of equation
+         * @param p_coef reference on variable where to store original
+         * coefficient of variable in equation
+         * @param p_Z_coef reference on variable where to store original Z
+         * coefficient of variable
+         * @return variable index, max unsigned int value if there is none
+         */
+        inline
+        unsigned int
+        get_unit_column(unsigned int p_row_index,
+                        COEF_TYPE & p_coef,
+                        COEF_TYPE & p_Z_coef
+                       ) const;
+
+        /**
+         * Collect index of rows having a non null coefficient in a column
+         * @param p_column_index column index
+         * @param p_excluded_row_index index of row that should not be collected
+         * @param p_pattern vector receiving row indexes in increasing order
+         */
+        inline
+        void
+        collect_column_pattern(unsigned int p_column_index,
+                               unsigned int p_excluded_row_index,
+                               std::vector<unsigned int> & p_pattern
+                              ) const;
+
+        /**
+         * Return a value changing each time a coefficient or dimension of
+         * simplex array is modified so that data computed from coefficients
+         * can be kept until they change
+         * @return revision of coefficients
+         */
+        inline
+        unsigned long long
+        get_coefs_revision() const;
+
+        /**
+         * Call function for each index in [0, p_nb_rows[. Calls are shared
+         * between threads when several threads are defined, array type
+         * supports it and number of coefficients to update reach threshold
+         * @param p_nb_rows number of rows to update
+         * @param p_function function called with index of row to update
+         */
+        template <typename FUNCTION>
+        void
+        for_each_row(unsigned int p_nb_rows,
+                     const FUNCTION & p_function
+                    );
+
         /**
            * Method to determine the next input variable for pivot operation
            * when searching max optimum
@@ -249,668 +681,4215 @@ namespace simplex
         bool
         get_max_input_variable_index(unsigned int & p_variable_index) const;
 
-      private:
-
-        /**
-           Method performing pivot to change the base
-           The A coefficient A[row,column] should be !0
-           @param p_row_index Row index
-           @param p_column_index Column index
-        */
-        virtual void pivot(const unsigned int p_row_index, 
-                           const unsigned int p_column_index
-                          ) = 0;
-
         /**
-           Method to determine the equation index corresponding to next output
-           variable for pivot operation
-           @param index of input variable
-           @param reference on variable where to store the output equation index if any
-           @return boolean indicating if an input variable was found
+         * Indicate if some variables have an upper bound
+         * @return true if at least one upper bound is defined
          */
-        virtual
+        inline
         bool
-        get_output_equation_index(unsigned int p_input_variable_index,
-                                  unsigned int & p_equation_index
-                                 )const = 0;
+        is_bounded() const;
 
         /**
-         * Method to set adjustement variable in the right place
-         * @param index of inequation
-         * @param value to set as coefficient
+         * Indicate if some variables have a non null lower bound
+         * @return true if at least one lower bound is not null
          */
         inline
-        void
-        set_adjustement_variable(const unsigned int & p_equation_index,
-                                 const COEF_TYPE & p_value
-                                );
+        bool
+        is_translated() const;
 
         /**
-         * Method to determine the next input variable for pivot operation
-         * when searching min optimum
-         * @param reference on variable where to store the input variable index if any
-         * @return boolean indicating if an input variable was found: TRUE = found
+         * Indicate if a variable has an upper bound
+         * @param p_variable_index : the value should be less than total number of variables
+         * including adjustment variables
+         * @return true if variable has an upper bound
          */
         inline
         bool
-        get_min_input_variable_index(unsigned int & p_variable_index) const;
+        has_upper_bound(unsigned int p_variable_index) const;
 
-        simplex_solver_base(void) = delete;
+        /**
+         * Return distance between lower and upper bound of a variable
+         * @param p_variable_index : the value should be less than total number of variables
+         * including adjustment variables
+         * @return range of variable
+         */
+        inline
+        const COEF_TYPE &
+        get_upper_bound(unsigned int p_variable_index) const;
 
         /**
-         * Variable numbers without adjustment variables
+         * Give a base variable to each equation. Defined base variables
+         * that respect their bounds are kept, equations without base
+         * variable use a variable appearing only in them if it respects
+         * its bounds. Remaining equations receive an artificial variable,
+         * artificial variables left in base by an unfinished first phase
+         * are kept. Objective function is replaced by the opposite of the
+         * weighted sum of artificial variables expressed with non base
+         * variables
+         * @param p_record_unit_columns true if array is still the original
+         * one so that artificial variables can be recorded as unit column of
+         * equations that have none
+         * @return number of artificial variables in base, 0 means that base
+         * is feasible and objective function is unchanged
          */
-        unsigned int m_nb_variables;
+        inline
+        unsigned int
+        start_first_phase(bool p_record_unit_columns);
 
         /**
-         * Number of inequations of type x1 + x2 + ... + xn <= value
+         * Continue first phase from current base for solvers whose array
+         * keeps original coefficients: objective function is saved like in
+         * start_first_phase and replaced by the opposite of the sum of
+         * artificial variables in base
          */
-        unsigned int m_nb_inequations_lt;
+        inline
+        void
+        resume_first_phase();
 
         /**
-         * Number of equations of type x1 + x2 + ... + xn = value
+         * Remove artificial variables that are not in base anymore, except
+         * unit columns, and restore objective function saved by
+         * start_first_phase. Z coefficients of base variables are not
+         * eliminated
          */
-        unsigned int m_nb_equations;
+        inline
+        void
+        end_first_phase();
 
         /**
-         * Number of inequations of type x1 + x2 + ... + xn >= value
+         * Indicate if a variable is an artificial variable added by first
+         * phase
+         * @param p_variable_index : the value should be less than total number of variables
+         * @return true if variable is artificial
          */
-        unsigned int m_nb_inequations_gt;
+        inline
+        bool
+        is_artificial_variable(unsigned int p_variable_index) const;
 
         /**
-         * Variable counting the number of base variables
+         * Indicate if each equation has a base variable
+         * @return true if base is complete
          */
-        unsigned int m_nb_adjustment_variable;
+        inline
+        bool
+        is_base_complete() const;
 
         /**
-         * Variable counting the number of adjustement variable specified
+         * Check that a basis given to set_basis is consistent with problem:
+         * one entry per equation, no artificial variable and no variable
+         * defined twice
+         * @param p_basis index of base variable of each equation
          */
-        unsigned int m_nb_defined_adjustment_variables;
+        inline
+        void
+        check_basis(const std::vector<unsigned int> & p_basis) const;
 
         /**
-         * Total number of variables including adjustment variables
+         * Remove all base variables
          */
-        unsigned int m_nb_all_variables;
+        inline
+        void
+        clear_base_variables();
 
         /**
-         * Total numer of equations after adjuments variables have been added
+         * Indicate if simplex array has already been modified by a search
+         * @return true if a search has been done
          */
-        unsigned int m_nb_total_equations;
+        inline
+        bool
+        is_search_done() const;
 
         /**
-         * Array storing equations
+         * Insert a null column in simplex array, indexes of following
+         * variables are shifted by one
+         * @param p_column_index index of new column
          */
-        ARRAY_TYPE m_array;
+        virtual
+        void
+        insert_column(unsigned int p_column_index);
 
         /**
-         * Equation types
+         * Remove a null column from simplex array, indexes of following
+         * variables are shifted by one
+         * @param p_column_index index of removed column
          */
-        t_equation_type * m_equation_types;
+        virtual
+        void
+        remove_column(unsigned int p_column_index);
 
         /**
-         * Base variables, array to store base variables index
+         * Return objective function value of current base, used to check
+         * search cutoff
+         * @return objective function value
          */
-        unsigned int * m_base_variables;
+        virtual
+        COEF_TYPE
+        get_objective_value() const;
 
         /**
-         * Array storing if variable is a base variable or not
+         * Replace objective function by its opposite. Z row being linear in
+         * objective coefficients the current base stays valid
          */
-        unsigned int * m_base_variables_position;
+        virtual
+        void
+        negate_objective();
 
         /**
-         * Nb base variables defined
+         * Search min optimum as max of opposite objective function. Objective
+         * function is restored once search is done
+         * @param p_min reference on variable receiving optimum
+         * @param p_options search limits
+         * @param p_find_max function searching max with options whose cutoff
+         * is adapted to opposite objective function
+         * @return reason why search ended
+         */
+        template <class FUNCTION>
+        t_solve_status
+        minimize(COEF_TYPE & p_min,
+                 const simplex_solve_options<COEF_TYPE> & p_options,
+                 const FUNCTION & p_find_max
+                );
+
+        /**
+         * Record if last search was a min search so that sensitivity
+         * analysis is expressed for objective function defined by user
+         * @param p_minimized true if last search was a min search
+         */
+        inline
+        void
+        set_minimized(bool p_minimized);
+
+        /**
+         * Compute variation of Z0 when B coefficient of each equation of
+         * internal array increases by 1
+         * @param p_duals vector receiving variation for each equation
+         */
+        virtual
+        void
+        compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const;
+
+        /**
+         * Compute Z coefficient of each variable in current base
+         * @param p_Z_coefs vector receiving Z coefficient of each variable
+         */
+        virtual
+        void
+        compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const;
+
+        /**
+         * Compute value of base variable of each equation
+         * @param p_values vector receiving value of each base variable
+         */
+        virtual
+        void
+        compute_base_values(std::vector<COEF_TYPE> & p_values) const;
+
+        /**
+         * Compute variation of base variables when B coefficient of an
+         * equation of internal array increases by 1
+         * @param p_equation_index index of modified equation
+         * @param p_direction vector receiving variation of base variable of
+         * each equation
+         */
+        virtual
+        void
+        compute_B_coef_direction(unsigned int p_equation_index,
+                                 std::vector<COEF_TYPE> & p_direction
+                                ) const;
+
+        /**
+         * Compute row of an equation where its base variable has coefficient
+         * 1: variation of base variable is the opposite of coefficient times
+         * variation of a non base variable
+         * @param p_row_index index of equation
+         * @param p_row vector receiving coefficient of each variable
+         */
+        virtual
+        void
+        compute_base_row(unsigned int p_row_index,
+                         std::vector<COEF_TYPE> & p_row
+                        ) const;
+
+        /**
+         * Scale simplex array if scaling is enabled. Done once before first
+         * search
+         */
+        inline
+        void
+        scale();
+
+        /**
+         * Convert values of scaled variables in original units
+         * @param p_values values of variables that are modified
+         */
+        inline
+        void
+        unscale_variable_values(std::vector<COEF_TYPE> & p_values) const;
+
+        /**
+         * Fix a variable to a value by adding a pair of inequations, used by
+         * solvers that do not support variable bounds
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value value of variable
+         */
+        inline
+        void
+        add_fixing_constraints(const unsigned int p_variable_index,
+                               const COEF_TYPE & p_value
+                              );
+
+      private:
+
+        typedef simplex_scope_trail<COEF_TYPE> t_scope_trail;
+        typedef typename t_scope_trail::t_trail_kind t_trail_kind;
+        typedef typename t_scope_trail::t_trail_entry t_trail_entry;
+        typedef typename t_scope_trail::t_scope t_scope;
+
+        /**
+         * Record a change if a scope is opened
+         * @param p_kind kind of change
+         * @param p_equation_index equation index
+         * @param p_unit_column previous unit column of equation
+         * @param p_B_coef previous B coefficient of equation
+         */
+        inline
+        void
+        record_change(t_trail_kind p_kind,
+                      unsigned int p_equation_index,
+                      unsigned int p_unit_column,
+                      const COEF_TYPE & p_B_coef
+                     );
+
+        /**
+         * Record bounds of a variable if a scope is opened
+         * @param p_variable_index index of variable
+         */
+        inline
+        void
+        record_bounds(unsigned int p_variable_index);
+
+        /**
+         * Replace bounds of a variable. Once bounds have been prepared
+         * simplex array is translated and the variable is complemented back
+         * if it loses its upper bound so that current base stays valid
+         * @param p_variable_index index of variable
+         * @param p_lower new lower bound in internal units
+         * @param p_upper new upper bound in internal units, meaningful only
+         * if p_has_upper is set
+         * @param p_has_upper indicate if variable has an upper bound
+         */
+        inline
+        void
+        move_variable_bounds(unsigned int p_variable_index,
+                             const COEF_TYPE & p_lower,
+                             const COEF_TYPE & p_upper,
+                             bool p_has_upper
+                            );
+
+        /**
+         * Remove last equation added inside a scope and its adjustment
+         * variable. Once a search has been done adjustment variable is
+         * first made base variable so that other equations do not depend
+         * on removed equation anymore
+         */
+        inline
+        void
+        remove_last_equation();
+
+        /**
+         * Primal simplex iterations until current objective function cannot
+         * be increased anymore
+         * @param p_nb_iteration iteration counter incremented by each iteration
+         * @param p_control limits of search
+         * @param p_check_cutoff true if objective function is the original
+         * one so that cutoff can be checked
+         * @param p_listener optional listener to treat iterations information
+         * @return OPTIMAL when no input variable remains, UNBOUNDED if
+         * objective function is not bounded or limit that stopped search
+         */
+        template <class LISTENER>
+        t_solve_status
+        primal_iterations(unsigned int & p_nb_iteration,
+                          const simplex_solve_control<COEF_TYPE> & p_control,
+                          bool p_check_cutoff,
+                          LISTENER * p_listener
+                         );
+
+        /**
+         * Dual simplex iterations until base is primal feasible
+         * @param p_nb_iteration iteration counter incremented by each iteration
+         * @param p_control limits of search
+         * @param p_listener optional listener to treat iterations information
+         * @return OPTIMAL when base is primal feasible, INFEASIBLE if
+         * problem has no feasible solution or limit that stopped search
+         */
+        template <class LISTENER>
+        t_solve_status
+        dual_iterations(unsigned int & p_nb_iteration,
+                        const simplex_solve_control<COEF_TYPE> & p_control,
+                        LISTENER * p_listener
+                       );
+
+        /**
+         * Indicate if a value is null regarding tolerance
+         * @param p_value value to check
+         * @return true if value is null
+         */
+        inline static
+        bool
+        is_null(const COEF_TYPE & p_value);
+
+        /**
+         * Indicate if pivot on an equation does not move input variable so
+         * that objective function value is unchanged
+         * @param p_equation_index output equation index
+         * @param p_at_upper_bound true if base variable of equation leaves
+         * base at its upper bound
+         * @return true if pivot is degenerate
+         */
+        inline
+        bool
+        is_degenerate_pivot(unsigned int p_equation_index,
+                            bool p_at_upper_bound
+                           ) const;
+
+        /**
+         * Bland's rule for output equation: among equations whose base
+         * variable blocks input variable without any move, select the one
+         * whose base variable has the lowest index
+         * @param p_input_variable_index index of input variable
+         * @param p_equation_index equation selected by ratio test, replaced
+         * if pivot on it is degenerate
+         */
+        inline
+        void
+        get_bland_output_equation_index(unsigned int p_input_variable_index,
+                                        unsigned int & p_equation_index
+                                       ) const;
+
+        /**
+         * Update current simplex array after a modification of B coefficient
+         * of an equation having a variable specific to it
+         * @param p_equation_index equation index
+         * @param p_delta modification of B coefficient in internal units
+         */
+        inline
+        void
+        shift_B_coef(unsigned int p_equation_index,
+                     const COEF_TYPE & p_delta
+                    );
+
+        /**
+         * Relax B coefficients if perturbation is enabled
+         */
+        inline
+        void
+        perturb();
+
+        /**
+         * Compute perturbation of each equation and apply it
+         */
+        inline
+        void
+        perturb(std::true_type);
+
+        /**
+         * Perturbation is not available for exact coefficient types
+         */
+        inline
+        void
+        perturb(std::false_type);
+
+        /**
+         * Restore B coefficients modified by perturb
+         * @return true if B coefficients were perturbed
+         */
+        inline
+        bool
+        remove_perturbation();
+
+        /**
+         * After first phase iterations check that artificial variables are
+         * null, pivot base artificial variables out of base when possible
+         * and come back to original objective function
+         * @return false if problem has no feasible solution
+         */
+        inline
+        bool
+        finish_first_phase();
+
+        /**
+         * Save objective function restored by end_first_phase and clear it
+         */
+        inline
+        void
+        save_objective();
+
+        /**
+         * Negate column of an artificial base variable
+         * @param p_row_index index of equation where variable is in base
+         * @param p_variable_index index of artificial variable
+         */
+        inline
+        void
+        negate_artificial_column(unsigned int p_row_index,
+                                 unsigned int p_variable_index
+                                );
+
+        /**
+         * Express objective function with non base variables by pivoting
+         * equations whose base variable has a non null Z coefficient
+         */
+        inline
+        void
+        eliminate_base_Z_coefs();
+
+        /**
+         * Indicate if a variable is the unit column of an equation
+         * @param p_variable_index index of variable
+         * @return true if variable is the unit column of an equation
+         */
+        inline
+        bool
+        is_unit_column(unsigned int p_variable_index) const;
+
+        /**
+         * Indicate if an artificial variable is still in base, except a null
+         * one of a redundant equation, meaning that last search stopped
+         * before first phase found a feasible base
+         * @return true if first phase should be continued
+         */
+        inline
+        bool
+        is_first_phase_pending() const;
+
+        /**
+         * Indicate if all coefficients of an equation are null except the
+         * ones of artificial variables
+         * @param p_row_index index of equation
+         * @return true if equation is a combination of other ones
+         */
+        inline
+        bool
+        is_redundant_equation(unsigned int p_row_index) const;
+
+        /**
+         * Search for each equation a variable, artificial variables
+         * excluded, having a non null coefficient only in this equation.
+         * Base variable is preferred then adjustment variables
+         * @param p_columns vector receiving variable index for each equation,
+         * maximum value of unsigned int if there is none
+         */
+        inline
+        void
+        find_unit_columns(std::vector<unsigned int> & p_columns) const;
+
+        /**
+         * Indicate if a base variable value defined by its coefficient and
+         * B coefficient of its equation respects variable bounds
+         * @param p_variable_index variable index
+         * @param p_coef coefficient of variable in its equation
+         * @param p_B_coef B coefficient of equation
+         * @return true if bounds are respected
+         */
+        inline
+        bool
+        is_feasible_value(unsigned int p_variable_index,
+                          const COEF_TYPE & p_coef,
+                          const COEF_TYPE & p_B_coef
+                         ) const;
+
+        /**
+         * Translate variables with non null lower bound so that all
+         * variables have 0 as lower bound. Done once before first search
+         */
+        inline
+        void
+        prepare_bounds();
+
+        /**
+         * Replace a non base variable x by its complement u - x where u is
+         * its upper bound. Variable value moves from one bound to the other
+         * @param p_variable_index index of non base variable
+         */
+        inline
+        void
+        complement_variable(unsigned int p_variable_index);
+
+        /**
+         * Store before first search a variable appearing only in each
+         * equation so that B coefficients can be updated later through its
+         * column
+         */
+        inline
+        void
+        record_unit_columns();
+
+        /**
+         * Multiply an equation by -1
+         * @param p_equation_index index of equation
+         */
+        inline
+        void
+        negate_row(unsigned int p_equation_index);
+
+        /**
+         * Compute scale factors and apply them on simplex array, bounds and
+         * objective function
+         */
+        inline
+        void
+        scale(std::true_type);
+
+        /**
+         * Scaling is not available for exact coefficient types
+         */
+        inline
+        void
+        scale(std::false_type);
+
+        /**
+         * Return factor applied to an equation by scaling
+         * @param p_equation_index equation index
+         * @return scale factor, 1 if array is not scaled
+         */
+        inline
+        COEF_TYPE
+        get_row_scale(unsigned int p_equation_index) const;
+
+        /**
+         * Return factor applied to a variable column by scaling. Scaled
+         * variable is original variable divided by this factor
+         * @param p_variable_index variable index
+         * @return scale factor, 1 if array is not scaled
+         */
+        inline
+        COEF_TYPE
+        get_column_scale(unsigned int p_variable_index) const;
+
+        /**
+         * Read only access to simplex array given to pricing policy
+         */
+        class pricing_view
+        {
+          public:
+            inline
+            pricing_view(const simplex_solver_base & p_solver);
+
+            inline
+            unsigned int
+            get_nb_all_variables() const;
+
+            inline
+            unsigned int
+            get_nb_total_equations() const;
+
+            inline
+            const COEF_TYPE &
+            get_Z_coef(unsigned int p_variable_index) const;
+
+            inline
+            const COEF_TYPE &
+            get_coef(unsigned int p_equation_index,
+                     unsigned int p_variable_index
+                    ) const;
+
+            inline
+            unsigned int
+            get_base_variable(unsigned int p_equation_index) const;
+
+            inline
+            bool
+            is_base_variable(unsigned int p_variable_index) const;
+
+          private:
+            const simplex_solver_base & m_solver;
+
+            /**
+             * Z coefficient seen for artificial variables out of base
+             */
+            const COEF_TYPE m_null_Z_coef;
+        };
+
+        /**
+           Method performing pivot to change the base
+           The A coefficient A[row,column] should be !0
+           @param p_row_index Row index
+           @param p_column_index Column index
+        */
+        virtual void pivot(const unsigned int p_row_index, 
+                           const unsigned int p_column_index
+                          ) = 0;
+
+        /**
+           Method to determine the equation index corresponding to next output
+           variable for pivot operation
+           @param index of input variable
+           @param reference on variable where to store the output equation index if any.
+           Number of equations is stored if input variable reaches its upper
+           bound before any base variable reaches one of its bounds
+           @return boolean indicating if an input variable was found
+         */
+        virtual
+        bool
+        get_output_equation_index(unsigned int p_input_variable_index,
+                                  unsigned int & p_equation_index
+                                 )const = 0;
+
+        /**
+         * Method to determine the equation whose base variable leaves the
+         * base during a dual simplex iteration: the one whose base
+         * variable violates the most one of its bounds
+         * @param p_equation_index reference on variable where to store the output equation index if any
+         * @param p_at_upper_bound reference on variable set to true if base
+         * variable is above its upper bound
+         * @return boolean indicating if an output equation was found, false
+         * means that base is primal feasible
+         */
+        virtual
+        bool
+        get_dual_output_equation_index(unsigned int & p_equation_index,
+                                       bool & p_at_upper_bound
+                                      )const;
+
+        /**
+         * Method implementing dual ratio test to determine the input
+         * variable of a dual simplex iteration so that base stays dual
+         * feasible
+         * @param p_equation_index index of output equation
+         * @param p_at_upper_bound true if base variable of output equation
+         * is above its upper bound
+         * @param p_variable_index reference on variable where to store the input variable index if any
+         * @return boolean indicating if an input variable was found, false
+         * means that problem has no feasible solution
+         */
+        virtual
+        bool
+        get_dual_input_variable_index(unsigned int p_equation_index,
+                                      bool p_at_upper_bound,
+                                      unsigned int & p_variable_index
+                                     )const;
+
+        /**
+         * Method to set adjustement variable in the right place
+         * @param index of inequation
+         * @param value to set as coefficient
+         */
+        inline
+        void
+        set_adjustement_variable(const unsigned int & p_equation_index,
+                                 const COEF_TYPE & p_value
+                                );
+
+        simplex_solver_base(void) = delete;
+
+        /**
+         * Variable numbers without adjustment variables
+         */
+        unsigned int m_nb_variables;
+
+        /**
+         * Number of inequations of type x1 + x2 + ... + xn <= value
+         */
+        unsigned int m_nb_inequations_lt;
+
+        /**
+         * Number of equations of type x1 + x2 + ... + xn = value
+         */
+        unsigned int m_nb_equations;
+
+        /**
+         * Number of inequations of type x1 + x2 + ... + xn >= value
+         */
+        unsigned int m_nb_inequations_gt;
+
+        /**
+         * Variable counting the number of base variables
+         */
+        unsigned int m_nb_adjustment_variable;
+
+        /**
+         * Variable counting the number of adjustement variable specified
+         */
+        unsigned int m_nb_defined_adjustment_variables;
+
+        /**
+         * Total number of variables including adjustment variables
+         */
+        unsigned int m_nb_all_variables;
+
+        /**
+         * Total numer of equations after adjuments variables have been added
+         */
+        unsigned int m_nb_total_equations;
+
+        /**
+         * Array storing equations
+         */
+        ARRAY_TYPE m_array;
+
+        /**
+         * Equation types
+         */
+        std::vector<t_equation_type> m_equation_types;
+
+        /**
+         * Base variables, array to store base variables index
+         */
+        std::vector<unsigned int> m_base_variables;
+
+        /**
+         * Array storing if variable is a base variable or not
+         */
+        std::vector<unsigned int> m_base_variables_position;
+
+        /**
+         * Nb base variables defined
          */
         unsigned int m_nb_base_variables_defined;
+
+        /**
+         * Policy selecting input variable
+         */
+        PRICING_POLICY m_pricing_policy;
+
+        /**
+         * Threads sharing rows update during pivot, null when pivot is done
+         * on calling thread only
+         */
+        std::unique_ptr<simplex_thread_pool> m_thread_pool;
+
+        /**
+         * Minimum number of coefficients to update to use thread pool
+         */
+        unsigned int m_parallel_threshold;
+
+        /**
+         * Lower bounds of variables
+         */
+        std::vector<COEF_TYPE> m_lower_bounds;
+
+        /**
+         * Distance between upper and lower bound for each variable including
+         * adjustment variables. Meaningful only if m_has_upper_bounds is set
+         */
+        std::vector<COEF_TYPE> m_upper_bounds;
+
+        /**
+         * Indicate for each variable if it has an upper bound
+         */
+        std::vector<bool> m_has_upper_bounds;
+
+        /**
+         * Indicate for each variable if it is currently replaced by its
+         * complement regarding upper bound
+         */
+        std::vector<bool> m_complemented;
+
+        /**
+         * Indicate if at least one upper bound is defined
+         */
+        bool m_bounded;
+
+        /**
+         * Indicate if at least one lower bound is not null
+         */
+        bool m_translated;
+
+        /**
+         * Indicate if lower bounds translation has been done
+         */
+        bool m_bounds_prepared;
+
+        /**
+         * B coefficients as defined by user
+         */
+        std::vector<COEF_TYPE> m_original_B_coefs;
+
+        /**
+         * Variable appearing only in each equation before first search,
+         * maximum value of unsigned int if there is none
+         */
+        std::vector<unsigned int> m_unit_columns;
+
+        /**
+         * Coefficient of unit column variable in its equation
+         */
+        std::vector<COEF_TYPE> m_unit_coefs;
+
+        /**
+         * Z coefficient of unit column variable before first search, used to
+         * extract dual values from Z coefficient of unit column
+         */
+        std::vector<COEF_TYPE> m_unit_Z_coefs;
+
+        /**
+         * Z coefficients of objective function replaced during first phase
+         */
+        std::vector<COEF_TYPE> m_first_phase_Z_coefs;
+
+        /**
+         * Z0 coefficient of objective function replaced during first phase
+         */
+        COEF_TYPE m_first_phase_Z0;
+
+        /**
+         * Complemented variables when first phase started
+         */
+        std::vector<bool> m_first_phase_complemented;
+
+        /**
+         * Scopes opened by push and changes done inside them
+         */
+        t_scope_trail m_scope_trail;
+
+        /**
+         * Indicate if scaling should be applied before first search
+         */
+        bool m_scaling;
+
+        /**
+         * Indicate if scaling has been applied
+         */
+        bool m_scaled;
+
+        /**
+         * Factor applied to each equation by scaling
+         */
+        std::vector<COEF_TYPE> m_row_scales;
+
+        /**
+         * Factor applied to each variable column by scaling
+         */
+        std::vector<COEF_TYPE> m_column_scales;
+
+        /**
+         * Number of consecutive degenerate pivots considered as a stall
+         */
+        unsigned int m_stall_threshold;
+
+        /**
+         * Number of consecutive degenerate pivots of last primal iterations,
+         * kept when search is stopped by a limit so that a resumed search
+         * still detects stall
+         */
+        unsigned int m_nb_consecutive_degenerate_pivots;
+
+        /**
+         * Indicate if B coefficients should be perturbed during find_max
+         */
+        bool m_perturbation;
+
+        /**
+         * Perturbation applied to each B coefficient, empty if none
+         */
+        std::vector<COEF_TYPE> m_perturbations;
+
+        /**
+         * Number of pivots done by last search
+         */
+        unsigned int m_nb_pivots;
+
+        /**
+         * Number of degenerate pivots done by last search
+         */
+        unsigned int m_nb_degenerate_pivots;
+
+        /**
+         * Indicate if last search was a min search
+         */
+        bool m_minimized;
+
+        /**
+         * Incremented each time a coefficient or dimension of simplex array
+         * is modified
+         */
+        unsigned long long m_coefs_revision;
     };
 
-    //----------------------------------------------------------------------------
-    inline
-    std::ostream &
-    operator<<(std::ostream & p_stream,
-               const t_equation_type & p_equation_type
-              )
-    {
-        switch(p_equation_type)
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::simplex_solver_base(unsigned int p_nb_variables,
+                                                                                            unsigned int p_nb_inequations_lt,
+                                                                                            unsigned int p_nb_equations,
+                                                                                            unsigned int p_nb_inequations_gt
+                                                                                           ):
+            m_nb_variables(p_nb_variables),
+            m_nb_inequations_lt(p_nb_inequations_lt),
+            m_nb_equations(p_nb_equations),
+            m_nb_inequations_gt(p_nb_inequations_gt),
+            m_nb_adjustment_variable(p_nb_inequations_lt + p_nb_inequations_gt),
+            m_nb_defined_adjustment_variables(0),
+            m_nb_all_variables(p_nb_variables + m_nb_adjustment_variable),
+            m_nb_total_equations(p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt),
+            m_array(m_nb_total_equations,m_nb_all_variables),
+            m_equation_types(m_nb_total_equations, t_equation_type::UNDEFINED),
+            m_base_variables(m_nb_total_equations, ::std::numeric_limits<unsigned int>::max()),
+            m_base_variables_position(m_nb_all_variables, ::std::numeric_limits<unsigned int>::max()),
+            m_nb_base_variables_defined(0),
+            m_parallel_threshold(32768),
+            m_lower_bounds(p_nb_variables, (COEF_TYPE)0),
+            m_upper_bounds(m_nb_all_variables, (COEF_TYPE)0),
+            m_has_upper_bounds(m_nb_all_variables, false),
+            m_complemented(m_nb_all_variables, false),
+            m_bounded(false),
+            m_translated(false),
+            m_bounds_prepared(false),
+            m_original_B_coefs(m_nb_total_equations, (COEF_TYPE)0),
+            m_first_phase_Z0(0),
+            m_scaling(false),
+            m_scaled(false),
+            m_stall_threshold(50),
+            m_nb_consecutive_degenerate_pivots(0),
+            m_perturbation(false),
+            m_nb_pivots(0),
+            m_nb_degenerate_pivots(0),
+            m_minimized(false),
+            m_coefs_revision(0)
+    {
+        static_assert(std::is_signed<COEF_TYPE>::value, "Simplex template parameter should be signed");
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_Z_coef(const unsigned int p_index,
+                                                                                        const COEF_TYPE & p_value
+                                                                                       )
+    {
+        assert(p_index < m_nb_variables);
+        m_array.set_Z_coef(p_index, m_scaled ? -p_value * get_column_scale(p_index) : -p_value);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_B_coef(const unsigned int p_index,
+                                                                                        const COEF_TYPE & p_value
+                                                                                       )
+    {
+        assert(p_index < m_nb_total_equations);
+        m_array.set_B_coef(p_index, m_scaled ? p_value * get_row_scale(p_index) : p_value);
+        m_original_B_coefs[p_index] = p_value;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::update_B_coef(const unsigned int p_index,
+                                                                                           const COEF_TYPE & p_value
+                                                                                          )
+    {
+        assert(p_index < m_nb_total_equations);
+        record_change(t_trail_kind::B_COEF, p_index, ::std::numeric_limits<unsigned int>::max(), m_original_B_coefs[p_index]);
+        if(m_unit_columns.empty())
+        {
+            // No search done yet
+            set_B_coef(p_index, p_value);
+            return;
+        }
+        unsigned int l_variable_index = m_unit_columns[p_index];
+        if(::std::numeric_limits<unsigned int>::max() == l_variable_index)
+        {
+            throw quicky_exception::quicky_logic_exception("No variable is specific to equation " + std::to_string(p_index) + ", B coefficient cannot be updated", __LINE__, __FILE__);
+        }
+        COEF_TYPE l_delta = p_value - m_original_B_coefs[p_index];
+        if(m_scaled)
+        {
+            l_delta = l_delta * get_row_scale(p_index);
+        }
+        shift_B_coef(p_index, l_delta);
+        m_original_B_coefs[p_index] = p_value;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_A_coef(const unsigned int p_equation_index,
+                                                                                        const unsigned int p_variable_index,
+                                                                                        const COEF_TYPE & p_value
+                                                                                       )
+    {
+        // Keep assert because we differentiate access to internal coefs
+        assert(p_variable_index < m_nb_variables);
+        m_array.set_A_coef(p_equation_index, p_variable_index, m_scaled ? p_value * get_row_scale(p_equation_index) * get_column_scale(p_variable_index) : p_value);
+        ++m_coefs_revision;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    const COEF_TYPE &
+    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_A_coef(const unsigned int p_equation_index,
+                                                                                   const unsigned int p_variable_index
+                                                                                  )const
+    {
+        // Keep assert because we differentiate access to internal coefs
+        assert(p_variable_index < m_nb_variables);
+        return m_array.get_A_coef(p_equation_index,p_variable_index);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_internal_coef(const unsigned int p_equation_index,
+                                                                                               const unsigned int p_variable_index,
+                                                                                               const COEF_TYPE & p_value
+                                                                                              )
+    {
+        // Keep assert because we differentiate access to internal coefs
+        assert(p_variable_index < m_nb_all_variables);
+        //    assert(p_variable_index >= m_nb_variables);
+        m_array.set_A_coef(p_equation_index, p_variable_index, p_value);
+        ++m_coefs_revision;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    const COEF_TYPE &
+    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_internal_coef(const unsigned int p_equation_index,
+                                                                                          const unsigned int p_variable_index
+                                                                                         )const
+    {
+        // Keep assert because we differentiate access to internal coefs
+        assert(p_variable_index < m_nb_all_variables);
+        //      assert(p_variable_index >= m_nb_variables);
+        return m_array.get_A_coef(p_equation_index, p_variable_index);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    std::ostream & simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::display_array(std::ostream & p_stream)const
+    {
+        p_stream << "Z\t";
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+                )
+        {
+            if(l_index < m_nb_variables)
+            {
+                p_stream << "X" << 1 + l_index;
+            }
+            else
+            {
+                p_stream << "E" << 1 + l_index - m_nb_variables;
+            }
+            p_stream << "\t" ;
+        }
+        p_stream << std::endl;
+        p_stream << "Z\t";
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+                )
+        {
+            p_stream << m_array.get_Z_coef(l_index) << "\t";
+        }
+        p_stream << "|\t" << m_array.get_Z0_coef() << std::endl;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+                )
+        {
+            unsigned int l_var_index = m_base_variables[l_row_index];
+            if(::std::numeric_limits<unsigned int>::max() != l_var_index)
+            {
+                if(l_var_index < m_nb_variables)
+                {
+                    p_stream << "X" << 1 + l_var_index;
+                }
+                else
+                {
+                    p_stream << "E" << 1 + l_var_index - m_nb_variables;
+                }
+            }
+            else
+            {
+                p_stream << " ";
+            }
+            p_stream << "\t";
+            for(unsigned int l_index = 0;
+                l_index < m_nb_all_variables;
+                ++l_index
+                    )
+            {
+                p_stream << get_internal_coef(l_row_index, l_index) << "\t";
+            }
+            p_stream << "|\t" << m_array.get_B_coef(l_row_index) << std::endl;
+        }
+        return p_stream;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_adjustement_variable(const unsigned int & p_equation_index,
+                                                                                                      const COEF_TYPE & p_value
+                                                                                                     )
+    {
+        unsigned int l_column_index = m_nb_variables + m_nb_defined_adjustment_variables;
+        set_internal_coef(p_equation_index, l_column_index, p_value);
+        if(!m_nb_equations)
+        {
+            define_base_variable(l_column_index);
+        }
+        ++m_nb_defined_adjustment_variables;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    bool simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_max_input_variable_index(unsigned int & p_variable_index) const
+    {
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+                )
+        {
+            if(m_array.get_Z_coef(l_index) < 0)
+            {
+                p_variable_index = l_index;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::define_equation_type(const unsigned int & p_equation_index,
+                                                                                        const t_equation_type & p_equation_type
+                                                                                       )
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        m_equation_types[p_equation_index] = p_equation_type;
+        switch(p_equation_type)
+        {
+            case t_equation_type::UNDEFINED:
+                throw quicky_exception::quicky_logic_exception("Try to set undefined equation type for equation" + std::to_string(p_equation_index),__LINE__,__FILE__);
+                break;
+            case t_equation_type::EQUATION:
+                // Nothing to do
+                break;
+            case t_equation_type::INEQUATION_LT:
+                set_adjustement_variable(p_equation_index,(COEF_TYPE)1);
+                break;
+            case t_equation_type::INEQUATION_GT:
+                set_adjustement_variable(p_equation_index,(COEF_TYPE)-1);
+                break;
+            default:
+                throw quicky_exception::quicky_logic_exception("Unknown equation_type value : "+ std::to_string((unsigned int)p_equation_type),__LINE__,__FILE__);
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::define_range_equation(const unsigned int & p_equation_index,
+                                                                                         const COEF_TYPE & p_lower,
+                                                                                         const COEF_TYPE & p_upper
+                                                                                        )
+    {
+        if(p_upper < p_lower)
+        {
+            throw quicky_exception::quicky_logic_exception("Empty range for equation " + std::to_string(p_equation_index), __LINE__, __FILE__);
+        }
+        unsigned int l_adjustment_variable_index = m_nb_variables + m_nb_defined_adjustment_variables;
+        define_equation_type(p_equation_index, t_equation_type::INEQUATION_LT);
+        set_B_coef(p_equation_index, p_upper);
+        m_upper_bounds[l_adjustment_variable_index] = p_upper - p_lower;
+        m_has_upper_bounds[l_adjustment_variable_index] = true;
+        m_bounded = true;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::set_variable_lower_bound(const unsigned int p_variable_index,
+                                                                                            const COEF_TYPE & p_value
+                                                                                           )
+    {
+        assert(p_variable_index < m_nb_variables);
+        if(m_bounds_prepared)
+        {
+            throw quicky_exception::quicky_logic_exception("Lower bounds cannot be changed once search has been done", __LINE__, __FILE__);
+        }
+        if(m_has_upper_bounds[p_variable_index])
+        {
+            COEF_TYPE l_upper = m_upper_bounds[p_variable_index] + m_lower_bounds[p_variable_index];
+            if(l_upper < p_value)
+            {
+                throw quicky_exception::quicky_logic_exception("Lower bound greater than upper bound for variable " + std::to_string(p_variable_index), __LINE__, __FILE__);
+            }
+            m_upper_bounds[p_variable_index] = l_upper - p_value;
+        }
+        m_lower_bounds[p_variable_index] = p_value;
+        m_translated |= COEF_TYPE(0) != p_value;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::set_variable_upper_bound(const unsigned int p_variable_index,
+                                                                                            const COEF_TYPE & p_value
+                                                                                           )
+    {
+        assert(p_variable_index < m_nb_variables);
+        if(m_bounds_prepared)
+        {
+            throw quicky_exception::quicky_logic_exception("Upper bounds cannot be changed once search has been done", __LINE__, __FILE__);
+        }
+        if(p_value < m_lower_bounds[p_variable_index])
+        {
+            throw quicky_exception::quicky_logic_exception("Upper bound lower than lower bound for variable " + std::to_string(p_variable_index), __LINE__, __FILE__);
+        }
+        m_upper_bounds[p_variable_index] = p_value - m_lower_bounds[p_variable_index];
+        m_has_upper_bounds[p_variable_index] = true;
+        m_bounded = true;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::define_base_variable(const unsigned int & p_variable_index)
+    {
+        assert(p_variable_index < m_nb_all_variables);
+        assert(m_nb_base_variables_defined < m_nb_total_equations);
+        m_base_variables[m_nb_base_variables_defined] = p_variable_index;
+        m_base_variables_position[p_variable_index] = m_nb_base_variables_defined;
+        ++m_nb_base_variables_defined;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    const unsigned int & simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_base_variable(const unsigned int & p_index)const
+    {
+        assert(p_index < m_nb_total_equations);
+        return m_base_variables[p_index];
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    std::vector<unsigned int>
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_basis() const
+    {
+        std::vector<unsigned int> l_basis(m_base_variables);
+        for(auto & l_variable_index: l_basis)
+        {
+            if(::std::numeric_limits<unsigned int>::max() != l_variable_index && is_artificial_variable(l_variable_index))
+            {
+                l_variable_index = ::std::numeric_limits<unsigned int>::max();
+            }
+        }
+        return l_basis;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::set_basis(const std::vector<unsigned int> & p_basis)
+    {
+        check_basis(p_basis);
+        // Done before first pivot as they rely on original coefficients
+        scale();
+        record_unit_columns();
+        prepare_bounds();
+
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        std::vector<bool> l_in_basis(m_nb_all_variables, false);
+        for(auto l_variable_index: p_basis)
+        {
+            if(l_none != l_variable_index)
+            {
+                l_in_basis[l_variable_index] = true;
+            }
+        }
+        // Equations whose base variable is not part of new basis can receive
+        // a new base variable
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            if(l_none != l_variable_index && !l_in_basis[l_variable_index])
+            {
+                m_base_variables_position[l_variable_index] = l_none;
+                m_base_variables[l_row_index] = l_none;
+            }
+        }
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        for(auto l_variable_index: p_basis)
+        {
+            if(l_none == l_variable_index || is_base_variable(l_variable_index))
+            {
+                continue;
+            }
+            // Largest coefficient among free equations is used as pivot
+            unsigned int l_pivot_row_index = l_none;
+            COEF_TYPE l_max(0);
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
+            {
+                if(l_none != m_base_variables[l_row_index])
+                {
+                    continue;
+                }
+                COEF_TYPE l_coef = get_internal_coef(l_row_index, l_variable_index);
+                if(l_coef < 0)
+                {
+                    l_coef = -l_coef;
+                }
+                if(l_tolerance < l_coef && (l_none == l_pivot_row_index || l_max < l_coef))
+                {
+                    l_max = l_coef;
+                    l_pivot_row_index = l_row_index;
+                }
+            }
+            if(l_none == l_pivot_row_index)
+            {
+                throw quicky_exception::quicky_runtime_exception("Basis is singular, variable " + std::to_string(l_variable_index) + " cannot become a base variable", __LINE__, __FILE__);
+            }
+            if(get_internal_coef(l_pivot_row_index, l_variable_index) < 0)
+            {
+                negate_row(l_pivot_row_index);
+            }
+            pivot(l_pivot_row_index, l_variable_index);
+            m_base_variables_position[l_variable_index] = l_pivot_row_index;
+            m_base_variables[l_pivot_row_index] = l_variable_index;
+        }
+        m_nb_base_variables_defined = m_nb_total_equations;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::add_variable(const COEF_TYPE & p_Z_coef,
+                                                                           const std::vector<COEF_TYPE> & p_coefs
+                                                                          )
+    {
+        if(p_coefs.size() != m_nb_total_equations)
+        {
+            throw quicky_exception::quicky_logic_exception("Number of coefficients " + std::to_string(p_coefs.size()) + " differs from number of equations " + std::to_string(m_nb_total_equations), __LINE__, __FILE__);
+        }
+        if(!m_scope_trail.empty())
+        {
+            throw quicky_exception::quicky_logic_exception("Variables cannot be added inside a scope", __LINE__, __FILE__);
+        }
+        unsigned int l_variable_index = m_nb_variables;
+        if(!is_search_done())
+        {
+            insert_column(l_variable_index);
+            ++m_nb_variables;
+            m_lower_bounds.push_back(COEF_TYPE(0));
+            if(m_scaled)
+            {
+                m_column_scales.push_back(COEF_TYPE(1));
+            }
+            set_Z_coef(l_variable_index, p_Z_coef);
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
+            {
+                if(COEF_TYPE(0) != p_coefs[l_row_index])
+                {
+                    set_A_coef(l_row_index, l_variable_index, p_coefs[l_row_index]);
+                }
+            }
+            return l_variable_index;
+        }
+
+        // Column of unit variable is B^-1 e * initial coef so
+        // B^-1 a = SUM(a_i * column_i / initial coef_i). Z coefficient is
+        // obtained in the same way starting from -c. A complemented variable
+        // has its column negated
+        std::vector<COEF_TYPE> l_column(m_nb_total_equations, COEF_TYPE(0));
+        COEF_TYPE l_Z_coef = -p_Z_coef;
+        for(unsigned int l_equation_index = 0;
+            l_equation_index < m_nb_total_equations;
+            ++l_equation_index
+           )
+        {
+            COEF_TYPE l_coef = p_coefs[l_equation_index];
+            if(COEF_TYPE(0) == l_coef)
+            {
+                continue;
+            }
+            if(m_scaled)
+            {
+                l_coef = l_coef * get_row_scale(l_equation_index);
+            }
+            unsigned int l_unit_index = m_unit_columns[l_equation_index];
+            if(::std::numeric_limits<unsigned int>::max() == l_unit_index)
+            {
+                throw quicky_exception::quicky_logic_exception("No variable is specific to equation " + std::to_string(l_equation_index) + ", new variable cannot be expressed in current base", __LINE__, __FILE__);
+            }
+            if(m_complemented[l_unit_index])
+            {
+                l_coef = -l_coef;
+            }
+            const COEF_TYPE & l_initial_coef = m_unit_coefs[l_equation_index];
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
+            {
+                COEF_TYPE l_unit_coef = get_internal_coef(l_row_index, l_unit_index);
+                if(COEF_TYPE(0) != l_unit_coef)
+                {
+                    l_column[l_row_index] = l_column[l_row_index] + (l_unit_coef * l_coef) / l_initial_coef;
+                }
+            }
+            COEF_TYPE l_unit_Z_coef = m_array.get_Z_coef(l_unit_index);
+            if(COEF_TYPE(0) != l_unit_Z_coef)
+            {
+                l_Z_coef = l_Z_coef + (l_unit_Z_coef * l_coef) / l_initial_coef;
+            }
+        }
+        insert_column(l_variable_index);
+        ++m_nb_variables;
+        m_lower_bounds.push_back(COEF_TYPE(0));
+        if(m_scaled)
+        {
+            m_column_scales.push_back(COEF_TYPE(1));
+        }
+        m_array.set_Z_coef(l_variable_index, l_Z_coef);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(COEF_TYPE(0) != l_column[l_row_index])
+            {
+                set_internal_coef(l_row_index, l_variable_index, l_column[l_row_index]);
+            }
+        }
+        return l_variable_index;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::add_constraint(const std::vector<COEF_TYPE> & p_coefs,
+                                                                             const t_equation_type & p_equation_type,
+                                                                             const COEF_TYPE & p_B_coef
+                                                                            )
+    {
+        if(p_coefs.size() != m_nb_variables)
+        {
+            throw quicky_exception::quicky_logic_exception("Number of coefficients " + std::to_string(p_coefs.size()) + " differs from number of variables " + std::to_string(m_nb_variables), __LINE__, __FILE__);
+        }
+        if(!m_scope_trail.empty() && t_equation_type::EQUATION == p_equation_type)
+        {
+            throw quicky_exception::quicky_logic_exception("Only inequations can be added inside a scope", __LINE__, __FILE__);
+        }
+        switch(p_equation_type)
+        {
+            case t_equation_type::UNDEFINED:
+                throw quicky_exception::quicky_logic_exception("Try to add an equation of undefined type", __LINE__, __FILE__);
+                break;
+            case t_equation_type::EQUATION:
+                ++m_nb_equations;
+                break;
+            case t_equation_type::INEQUATION_LT:
+                ++m_nb_inequations_lt;
+                break;
+            case t_equation_type::INEQUATION_GT:
+                ++m_nb_inequations_gt;
+                break;
+            default:
+                throw quicky_exception::quicky_logic_exception("Unknown equation_type value : "+ std::to_string((unsigned int)p_equation_type),__LINE__,__FILE__);
+        }
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        unsigned int l_equation_index = m_nb_total_equations;
+        m_array.add_equations(1);
+        ++m_coefs_revision;
+        ++m_nb_total_equations;
+        m_equation_types.push_back(p_equation_type);
+        m_base_variables.push_back(l_none);
+        m_original_B_coefs.push_back(p_B_coef);
+        if(m_scaled)
+        {
+            m_row_scales.push_back(COEF_TYPE(1));
+        }
+        record_change(t_trail_kind::EQUATION, l_equation_index, l_none, COEF_TYPE(0));
+
+        COEF_TYPE l_B_coef = p_B_coef;
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            COEF_TYPE l_coef = p_coefs[l_variable_index];
+            if(COEF_TYPE(0) == l_coef)
+            {
+                continue;
+            }
+            if(m_scaled)
+            {
+                l_coef = l_coef * get_column_scale(l_variable_index);
+            }
+            if(m_bounds_prepared)
+            {
+                // Apply translation and complement already done on variables
+                l_B_coef = l_B_coef - l_coef * m_lower_bounds[l_variable_index];
+                if(m_complemented[l_variable_index])
+                {
+                    l_B_coef = l_B_coef - l_coef * m_upper_bounds[l_variable_index];
+                    l_coef = -l_coef;
+                }
+            }
+            set_internal_coef(l_equation_index, l_variable_index, l_coef);
+        }
+        m_array.set_B_coef(l_equation_index, l_B_coef);
+
+        // New adjustment variable is stored after the ones already defined
+        unsigned int l_adjustment_index = l_none;
+        if(t_equation_type::EQUATION != p_equation_type)
+        {
+            l_adjustment_index = m_nb_variables + m_nb_defined_adjustment_variables;
+            insert_column(l_adjustment_index);
+            ++m_nb_adjustment_variable;
+            ++m_nb_defined_adjustment_variables;
+            set_internal_coef(l_equation_index, l_adjustment_index, t_equation_type::INEQUATION_LT == p_equation_type ? COEF_TYPE(1) : COEF_TYPE(-1));
+        }
+
+        if(!is_search_done())
+        {
+            if(l_none != l_adjustment_index && m_nb_base_variables_defined == l_equation_index)
+            {
+                define_base_variable(l_adjustment_index);
+            }
+            return l_equation_index;
+        }
+
+        // A variable involved in new equation is not specific to one
+        // equation anymore
+        for(unsigned int l_row_index = 0;
+            l_row_index < l_equation_index;
+            ++l_row_index
+           )
+        {
+            unsigned int l_unit_index = m_unit_columns[l_row_index];
+            if(l_none != l_unit_index && COEF_TYPE(0) != get_internal_coef(l_equation_index, l_unit_index))
+            {
+                record_change(t_trail_kind::UNIT_COLUMN, l_row_index, l_unit_index, COEF_TYPE(0));
+                m_unit_columns[l_row_index] = l_none;
+            }
+        }
+        m_unit_columns.push_back(l_adjustment_index);
+        m_unit_coefs.push_back(l_none != l_adjustment_index ? get_internal_coef(l_equation_index, l_adjustment_index) : COEF_TYPE(0));
+        m_unit_Z_coefs.push_back(COEF_TYPE(0));
+
+        // Express new equation with non base variables: pivoting an
+        // equation on its own base variable only eliminates this variable
+        // from other equations
+        for(unsigned int l_row_index = 0;
+            l_row_index < l_equation_index;
+            ++l_row_index
+           )
+        {
+            unsigned int l_base_index = m_base_variables[l_row_index];
+            if(l_none != l_base_index && COEF_TYPE(0) != get_internal_coef(l_equation_index, l_base_index))
+            {
+                pivot(l_row_index, l_base_index);
+            }
+        }
+        if(l_none != l_adjustment_index)
+        {
+            m_base_variables[l_equation_index] = l_adjustment_index;
+            m_base_variables_position[l_adjustment_index] = l_equation_index;
+            // Pivots expect positive base variable coefficients
+            if(t_equation_type::INEQUATION_GT == p_equation_type)
+            {
+                negate_row(l_equation_index);
+            }
+        }
+        m_nb_base_variables_defined = m_nb_total_equations;
+        return l_equation_index;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::fix_variable(const unsigned int p_variable_index,
+                                                                           const COEF_TYPE & p_value
+                                                                          )
+    {
+        assert(p_variable_index < m_nb_variables);
+        record_bounds(p_variable_index);
+        COEF_TYPE l_value = p_value / get_column_scale(p_variable_index);
+        move_variable_bounds(p_variable_index, l_value, l_value, true);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::add_fixing_constraints(const unsigned int p_variable_index,
+                                                                                     const COEF_TYPE & p_value
+                                                                                    )
+    {
+        assert(p_variable_index < m_nb_variables);
+        std::vector<COEF_TYPE> l_coefs(m_nb_variables, COEF_TYPE(0));
+        l_coefs[p_variable_index] = COEF_TYPE(1);
+        add_constraint(l_coefs, t_equation_type::INEQUATION_LT, p_value);
+        add_constraint(l_coefs, t_equation_type::INEQUATION_GT, p_value);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::push()
+    {
+        t_scope l_scope;
+        l_scope.m_search_done = is_search_done();
+        l_scope.m_base_variables = m_base_variables;
+        l_scope.m_nb_base_variables_defined = m_nb_base_variables_defined;
+        l_scope.m_complemented = m_complemented;
+        m_scope_trail.push(l_scope);
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pop()
+    {
+        if(m_scope_trail.empty())
+        {
+            throw quicky_exception::quicky_logic_exception("No scope to pop", __LINE__, __FILE__);
+        }
+        // Changes are undone from the last one. Undoing B coefficient
+        // updates records new changes after scope ones, they are dropped
+        t_scope l_scope = m_scope_trail.pop([&](const t_trail_entry & p_entry)
+                                            {
+                                                switch(p_entry.m_kind)
+                                                {
+                                                    case t_trail_kind::B_COEF:
+                                                        update_B_coef(p_entry.m_equation_index, p_entry.m_B_coef);
+                                                        break;
+                                                    case t_trail_kind::UNIT_COLUMN:
+                                                        m_unit_columns[p_entry.m_equation_index] = p_entry.m_unit_column;
+                                                        break;
+                                                    case t_trail_kind::EQUATION:
+                                                        assert(m_nb_total_equations == p_entry.m_equation_index + 1);
+                                                        remove_last_equation();
+                                                        break;
+                                                    case t_trail_kind::BOUNDS:
+                                                    {
+                                                        COEF_TYPE l_scale = get_column_scale(p_entry.m_equation_index);
+                                                        move_variable_bounds(p_entry.m_equation_index,
+                                                                             p_entry.m_B_coef / l_scale,
+                                                                             p_entry.m_upper_bound / l_scale,
+                                                                             p_entry.m_has_upper_bound
+                                                                            );
+                                                        break;
+                                                    }
+                                                }
+                                            }
+                                           );
+
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        if(!is_search_done())
+        {
+            // Simplex array is unchanged so base can simply be restored
+            m_base_variables = l_scope.m_base_variables;
+            m_base_variables_position.assign(m_nb_all_variables, l_none);
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
+            {
+                if(l_none != m_base_variables[l_row_index])
+                {
+                    m_base_variables_position[m_base_variables[l_row_index]] = l_row_index;
+                }
+            }
+            m_nb_base_variables_defined = l_scope.m_nb_base_variables_defined;
+        }
+        else if(l_scope.m_search_done)
+        {
+            // Base of scope is obtained by pivoting from current one
+            std::vector<unsigned int> l_basis(l_scope.m_base_variables);
+            for(auto & l_variable_index: l_basis)
+            {
+                if(l_none != l_variable_index && is_artificial_variable(l_variable_index))
+                {
+                    l_variable_index = l_none;
+                }
+            }
+            set_basis(l_basis);
+            // Non base variables come back to the bound they had
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < l_scope.m_complemented.size();
+                ++l_variable_index
+               )
+            {
+                if(m_complemented[l_variable_index] != l_scope.m_complemented[l_variable_index] && !is_base_variable(l_variable_index))
+                {
+                    complement_variable(l_variable_index);
+                }
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_nb_scopes() const
+    {
+        return m_scope_trail.get_nb_scopes();
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::set_base_variable(const unsigned int & p_index,
+                                                                                const unsigned int & p_value
+                                                                               )
+    {
+        assert(p_index < m_nb_total_equations);
+        m_base_variables[p_index] = p_value;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    const unsigned int simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_total_nb_equation(void)const
+    {
+        return m_nb_total_equations;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::~simplex_solver_base(void)
+    {
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_nb_total_equations() const
+    {
+        return m_nb_total_equations;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_nb_all_variables() const
+    {
+        return m_nb_all_variables;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    const ARRAY_TYPE &
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_array() const
+    {
+        return m_array;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    ARRAY_TYPE &
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_array()
+    {
+        return m_array;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_nb_variables() const
+    {
+        return m_nb_variables;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_nb_base_variables_defined() const
+    {
+        return m_nb_base_variables_defined;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_base_variables_position(unsigned int p_index) const
+    {
+        assert(p_index < m_nb_all_variables);
+        return m_base_variables_position[p_index];
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::set_base_variables_position(unsigned int p_index,
+                                                                                          unsigned int p_value
+                                                                                         )
+    {
+        assert(p_index < m_nb_all_variables);
+        m_base_variables_position[p_index] = p_value;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    bool
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::find_max(COEF_TYPE & p_max,
+                                                                       bool & p_infinite,
+                                                                       LISTENER * p_listener
+                                                                      )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::find_max(COEF_TYPE & p_max,
+                                                                       const simplex_solve_options<COEF_TYPE> & p_options,
+                                                                       LISTENER * p_listener
+                                                                      )
+    {
+        simplex_solve_control<COEF_TYPE> l_control(p_options);
+        m_minimized = false;
+        for(unsigned int l_index = 0;
+            l_index < m_nb_total_equations;
+            ++l_index
+                )
+        {
+            unsigned int l_var_index = m_base_variables[l_index];
+            if(l_var_index != ::std::numeric_limits<unsigned int>::max() && m_array.get_Z_coef(l_var_index))
+            {
+                throw quicky_exception::quicky_runtime_exception("Z coef of base variable in column " + std::to_string(l_var_index) + " should be 0 or this is not a base variable", __LINE__, __FILE__);
+            }
+        }
+        bool l_first_search = !is_search_done();
+        scale();
+        record_unit_columns();
+        prepare_bounds();
+        m_nb_pivots = 0;
+        m_nb_degenerate_pivots = 0;
+        perturb();
+        unsigned int l_nb_iteration = 0;
+        bool l_first_phase = start_first_phase(l_first_search);
+        // Pivots expect positive base variable coefficients
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(get_internal_coef(l_row_index, m_base_variables[l_row_index]) < 0)
+            {
+                negate_row(l_row_index);
+            }
+        }
+        t_solve_status l_status;
+        if(l_first_phase)
+        {
+            eliminate_base_Z_coefs();
+            l_status = primal_iterations(l_nb_iteration, l_control, false, p_listener);
+            if(t_solve_status::UNBOUNDED == l_status)
+            {
+                throw quicky_exception::quicky_logic_exception("First phase objective function cannot be infinite", __LINE__, __FILE__);
+            }
+            if(t_solve_status::OPTIMAL != l_status)
+            {
+                // Original objective function is restored, artificial
+                // variables remaining in base keep base unfeasible and
+                // first phase continues from them at next search
+                end_first_phase();
+                eliminate_base_Z_coefs();
+                remove_perturbation();
+                return l_status;
+            }
+            if(!finish_first_phase())
+            {
+                remove_perturbation();
+                return t_solve_status::INFEASIBLE;
+            }
+        }
+        l_status = primal_iterations(l_nb_iteration, l_control, true, p_listener);
+        if(t_solve_status::UNBOUNDED == l_status)
+        {
+            remove_perturbation();
+            return l_status;
+        }
+        // Base stays dual feasible when perturbation is removed
+        if(remove_perturbation() && t_solve_status::OPTIMAL == l_status)
+        {
+            l_status = dual_iterations(l_nb_iteration, l_control, p_listener);
+            if(t_solve_status::INFEASIBLE == l_status)
+            {
+                return l_status;
+            }
+        }
+        p_max = get_objective_value();
+        return l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    bool
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::find_min(COEF_TYPE & p_min,
+                                                                       bool & p_infinite,
+                                                                       LISTENER * p_listener
+                                                                      )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_min(p_min, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::find_min(COEF_TYPE & p_min,
+                                                                       const simplex_solve_options<COEF_TYPE> & p_options,
+                                                                       LISTENER * p_listener
+                                                                      )
+    {
+        return minimize(p_min,
+                        p_options,
+                        [&](COEF_TYPE & p_max, const simplex_solve_options<COEF_TYPE> & p_max_options)
+                        {
+                            return find_max(p_max, p_max_options, p_listener);
+                        }
+                       );
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class FUNCTION>
+    t_solve_status
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::minimize(COEF_TYPE & p_min,
+                                                                       const simplex_solve_options<COEF_TYPE> & p_options,
+                                                                       const FUNCTION & p_find_max
+                                                                      )
+    {
+        simplex_solve_options<COEF_TYPE> l_options(p_options);
+        l_options.m_cutoff = -p_options.m_cutoff;
+        COEF_TYPE l_max = -p_min;
+        negate_objective();
+        t_solve_status l_status = p_find_max(l_max, l_options);
+        negate_objective();
+        m_minimized = true;
+        p_min = -l_max;
+        return l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::negate_objective()
+    {
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            m_array.set_Z_coef(l_index, -m_array.get_Z_coef(l_index));
+        }
+        m_array.set_Z0_coef(-m_array.get_Z0_coef());
+        for(auto & l_Z_coef: m_unit_Z_coefs)
+        {
+            l_Z_coef = -l_Z_coef;
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::primal_iterations(unsigned int & p_nb_iteration,
+                                                                                const simplex_solve_control<COEF_TYPE> & p_control,
+                                                                                bool p_check_cutoff,
+                                                                                LISTENER * p_listener
+                                                                               )
+    {
+        unsigned int l_input_variable_index = 0;
+        pricing_view l_view(*this);
+        m_pricing_policy.reset(m_nb_total_equations, m_nb_all_variables);
+        // First negative Z coefficient is Bland's rule for input variable
+        simplex_pricing_first<COEF_TYPE> l_bland_pricing;
+        bool l_stalling = m_stall_threshold && m_nb_consecutive_degenerate_pivots >= m_stall_threshold;
+        t_solve_status l_status = t_solve_status::OPTIMAL;
+        while(l_stalling ? l_bland_pricing.select_input_variable(l_view, l_input_variable_index) : m_pricing_policy.select_input_variable(l_view, l_input_variable_index))
+        {
+            if(p_control.must_stop(p_nb_iteration, l_status))
+            {
+                return l_status;
+            }
+            if(p_check_cutoff && p_control.is_cutoff_reached(get_objective_value()))
+            {
+                return t_solve_status::CUTOFF;
+            }
+            if(p_listener)
+            {
+                p_listener->start_iteration(p_nb_iteration);
+                p_listener->new_input_var_event(l_input_variable_index);
+            }
+            assert(::std::numeric_limits<unsigned int>::max() == m_base_variables_position[l_input_variable_index]);
+            assert(m_array.get_Z_coef(l_input_variable_index));
+            unsigned int l_output_equation_index = 0;
+            if(!get_output_equation_index(l_input_variable_index, l_output_equation_index))
+            {
+                m_nb_consecutive_degenerate_pivots = 0;
+                return t_solve_status::UNBOUNDED;
+            }
+            bool l_degenerate = false;
+            if(m_nb_total_equations == l_output_equation_index)
+            {
+                // Input variable reaches its upper bound before any base
+                // variable reaches one of its bounds: no pivot is needed
+                l_degenerate = is_null(m_upper_bounds[l_input_variable_index]);
+                complement_variable(l_input_variable_index);
+                if(p_listener)
+                {
+                    p_listener->new_Z0(m_array.get_Z0_coef());
+                }
+            }
+            else
+            {
+                if(l_stalling)
+                {
+                    get_bland_output_equation_index(l_input_variable_index, l_output_equation_index);
+                }
+                unsigned int l_output_variable_index = m_base_variables[l_output_equation_index];
+                // Base variable increasing when input variable increase
+                // leaves the base at its upper bound
+                bool l_output_at_upper_bound = get_internal_coef(l_output_equation_index, l_input_variable_index) < 0;
+                l_degenerate = is_degenerate_pivot(l_output_equation_index, l_output_at_upper_bound);
+                if(p_listener)
+                {
+                    p_listener->new_output_var_event(l_output_variable_index);
+                }
+                assert(l_output_equation_index == m_base_variables_position[l_output_variable_index]);
+                assert(!m_array.get_Z_coef(l_output_variable_index));
+                m_pricing_policy.notify_pivot(l_view, l_output_equation_index, l_input_variable_index);
+                pivot(l_output_equation_index,l_input_variable_index);
+                assert(m_array.get_Z_coef(l_output_variable_index));
+                assert(!m_array.get_Z_coef(l_input_variable_index));
+                m_base_variables_position[l_output_variable_index] = std::numeric_limits<unsigned int>::max();
+                m_base_variables_position[l_input_variable_index] = l_output_equation_index;
+                m_base_variables[l_output_equation_index] = l_input_variable_index;
+                if(l_output_at_upper_bound)
+                {
+                    complement_variable(l_output_variable_index);
+                }
+
+                if(p_listener)
+                {
+                    p_listener->new_Z0(m_array.get_Z0_coef());
+                }
+            }
+            ++m_nb_pivots;
+            if(l_degenerate)
+            {
+                ++m_nb_degenerate_pivots;
+                ++m_nb_consecutive_degenerate_pivots;
+                l_stalling |= m_stall_threshold && m_nb_consecutive_degenerate_pivots >= m_stall_threshold;
+            }
+            else
+            {
+                m_nb_consecutive_degenerate_pivots = 0;
+                l_stalling = false;
+            }
+            ++p_nb_iteration;
+        }
+        m_nb_consecutive_degenerate_pivots = 0;
+        return l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    bool
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::find_max_dual(COEF_TYPE & p_max,
+                                                                            bool & p_infeasible,
+                                                                            LISTENER * p_listener
+                                                                           )
+    {
+        if(!is_base_complete())
+        {
+            throw quicky_exception::quicky_runtime_exception("Not enough base variables defined", __LINE__, __FILE__);
+        }
+        simplex_solve_options<COEF_TYPE> l_options;
+        if(!is_first_phase_pending())
+        {
+            for(unsigned int l_index = 0;
+                l_index < m_nb_variables + m_nb_adjustment_variable;
+                ++l_index
+               )
+            {
+                if(!is_base_variable(l_index) && m_array.get_Z_coef(l_index) < -simplex_tolerance<COEF_TYPE>::get())
+                {
+                    throw quicky_exception::quicky_runtime_exception("Base is not dual feasible: Z coef of variable " + std::to_string(l_index) + " is negative", __LINE__, __FILE__);
+                }
+            }
+            scale();
+            prepare_bounds();
+            record_unit_columns();
+            m_minimized = false;
+            m_nb_pivots = 0;
+            m_nb_degenerate_pivots = 0;
+            p_infeasible = false;
+            unsigned int l_nb_iteration = 0;
+            simplex_solve_control<COEF_TYPE> l_control(l_options);
+            if(t_solve_status::INFEASIBLE == dual_iterations(l_nb_iteration, l_control, p_listener))
+            {
+                p_infeasible = true;
+                return false;
+            }
+            // Dual pivots can move artificial variables left null in base
+            // by an unfinished first phase
+            if(!is_first_phase_pending())
+            {
+                p_max = m_array.get_Z0_coef();
+                return true;
+            }
+        }
+        // Base is not a base of the problem, first phase of primal
+        // algorithm has to be continued
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infeasible = t_solve_status::INFEASIBLE == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //----------------------------------------------------------------------------
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::dual_iterations(unsigned int & p_nb_iteration,
+                                                                              const simplex_solve_control<COEF_TYPE> & p_control,
+                                                                              LISTENER * p_listener
+                                                                             )
+    {
+        unsigned int l_output_equation_index = 0;
+        bool l_at_upper_bound = false;
+        t_solve_status l_status = t_solve_status::OPTIMAL;
+        while(get_dual_output_equation_index(l_output_equation_index, l_at_upper_bound))
+        {
+            if(p_control.must_stop(p_nb_iteration, l_status))
+            {
+                return l_status;
+            }
+            unsigned int l_input_variable_index = 0;
+            if(!get_dual_input_variable_index(l_output_equation_index, l_at_upper_bound, l_input_variable_index))
+            {
+                return t_solve_status::INFEASIBLE;
+            }
+            unsigned int l_output_variable_index = m_base_variables[l_output_equation_index];
+            if(p_listener)
+            {
+                p_listener->start_iteration(p_nb_iteration);
+                p_listener->new_input_var_event(l_input_variable_index);
+                p_listener->new_output_var_event(l_output_variable_index);
+            }
+            // Objective function does not change if input variable has a
+            // null reduced cost
+            ++m_nb_pivots;
+            if(is_null(m_array.get_Z_coef(l_input_variable_index)))
+            {
+                ++m_nb_degenerate_pivots;
+            }
+            // Pivot is negative when base variable is below 0, negating
+            // equation keep solvers in their usual positive pivot case
+            if(!l_at_upper_bound)
+            {
+                negate_row(l_output_equation_index);
+            }
+            pivot(l_output_equation_index, l_input_variable_index);
+            m_base_variables_position[l_output_variable_index] = std::numeric_limits<unsigned int>::max();
+            m_base_variables_position[l_input_variable_index] = l_output_equation_index;
+            m_base_variables[l_output_equation_index] = l_input_variable_index;
+            if(l_at_upper_bound)
+            {
+                complement_variable(l_output_variable_index);
+            }
+            if(p_listener)
+            {
+                p_listener->new_Z0(m_array.get_Z0_coef());
+            }
+            ++p_nb_iteration;
+        }
+        return l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_dual_output_equation_index(unsigned int & p_equation_index,
+                                                                                              bool & p_at_upper_bound
+                                                                                             )const
+    {
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        bool l_found = false;
+        COEF_TYPE l_max_violation = 0;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            COEF_TYPE l_value = m_array.get_B_coef(l_row_index) / get_internal_coef(l_row_index, l_variable_index);
+            COEF_TYPE l_violation;
+            bool l_at_upper_bound = false;
+            if(l_value < -l_tolerance)
+            {
+                l_violation = -l_value;
+            }
+            else if(m_bounded && m_has_upper_bounds[l_variable_index] && m_upper_bounds[l_variable_index] + l_tolerance < l_value)
+            {
+                l_violation = l_value - m_upper_bounds[l_variable_index];
+                l_at_upper_bound = true;
+            }
+            else
+            {
+                continue;
+            }
+            if(!l_found || l_max_violation < l_violation)
+            {
+                l_max_violation = l_violation;
+                p_equation_index = l_row_index;
+                p_at_upper_bound = l_at_upper_bound;
+                l_found = true;
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_dual_input_variable_index(unsigned int p_equation_index,
+                                                                                             bool p_at_upper_bound,
+                                                                                             unsigned int & p_variable_index
+                                                                                            )const
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        const COEF_TYPE & l_base_coef = get_internal_coef(p_equation_index, m_base_variables[p_equation_index]);
+        bool l_found = false;
+        COEF_TYPE l_min = 0;
+        // Artificial variables out of base never come back
+        for(unsigned int l_index = 0;
+            l_index < m_nb_variables + m_nb_adjustment_variable;
+            ++l_index
+           )
+        {
+            if(is_base_variable(l_index))
+            {
+                continue;
+            }
+            // Variation of base variable when input variable increase is
+            // opposite of its coefficient
+            COEF_TYPE l_coef = get_internal_coef(p_equation_index, l_index) / l_base_coef;
+            if(p_at_upper_bound ? l_coef > l_tolerance : l_coef < -l_tolerance)
+            {
+                COEF_TYPE l_ratio = m_array.get_Z_coef(l_index) / (p_at_upper_bound ? l_coef : -l_coef);
+                if(!l_found || l_ratio < l_min)
+                {
+                    l_min = l_ratio;
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE,
+              typename ARRAY_TYPE,
+              typename PRICING_POLICY
+             >
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_base_variable(const unsigned int & p_index) const
+    {
+        return std::numeric_limits<unsigned int>::max() != m_base_variables_position[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE,
+              typename ARRAY_TYPE,
+              typename PRICING_POLICY
+             >
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::check_variables(const std::vector<COEF_TYPE> & p_values)
+    {
+        assert(p_values.size() <= m_nb_variables);
+        for(unsigned int l_equation_index = 0;
+            l_equation_index < m_nb_equations;
+            ++l_equation_index
+           )
+        {
+            COEF_TYPE l_sum(0);
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < p_values.size();
+                ++l_variable_index
+               )
+            {
+                l_sum += m_array.get_A_coef(l_equation_index, l_variable_index) * p_values[l_variable_index];
+            }
+            COEF_TYPE l_b_coef = m_array.get_B_coef(l_equation_index);
+            switch(m_equation_types[l_equation_index])
+            {
+                case t_equation_type::UNDEFINED:
+                    throw quicky_exception::quicky_logic_exception("Undefined equation when checking simplex variables", __LINE__, __FILE__);
+                    break;
+                case t_equation_type::EQUATION:
+                    if(l_sum != l_b_coef)
+                    {
+                        return false;
+                    }
+                    break;
+                case t_equation_type::INEQUATION_LT:
+                    if(l_sum > l_b_coef)
+                    {
+                        return false;
+                    }
+                    break;
+                case t_equation_type::INEQUATION_GT:
+                    if(l_sum < l_b_coef)
+                    {
+                        return false;
+                    }
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<COEF_TYPE>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_variable_values() const
+    {
+        std::vector<COEF_TYPE> l_result(m_nb_variables, (COEF_TYPE)0);
+        my_square_matrix<COEF_TYPE> l_matrix(m_nb_total_equations);
+        my_matrix<COEF_TYPE> l_coefs(m_nb_total_equations, 1);
+        // Create Equation system
+        for(unsigned int l_equation_index = 0; l_equation_index < m_nb_total_equations; ++l_equation_index)
+        {
+            for(unsigned int l_variable_index = 0; l_variable_index < m_nb_total_equations; ++l_variable_index)
+            {
+                l_matrix.set_data(l_equation_index, l_variable_index, m_array.get_A_coef(l_equation_index, get_base_variable(l_variable_index)));
+            }
+            l_coefs.set_data(l_equation_index, 0, m_array.get_B_coef(l_equation_index));
+        }
+        my_equation_system<COEF_TYPE> l_equation_system(l_matrix, l_coefs);
+
+        my_matrix<COEF_TYPE> l_result_matrix = l_equation_system.solve();
+        assert(l_result_matrix.get_height() == m_nb_total_equations);
+
+        // Fill result
+        for(unsigned int l_index = 0; l_index < m_nb_variables; ++l_index)
+        {
+            unsigned int l_base_variable_index = get_base_variables_position(l_index);
+            if(l_base_variable_index != ::std::numeric_limits<unsigned int>::max())
+            {
+                l_result[l_index] = l_result_matrix.get_data(l_base_variable_index,0);
+            }
+            // Come back from complemented and translated variables
+            if(m_complemented[l_index])
+            {
+                l_result[l_index] = m_upper_bounds[l_index] - l_result[l_index];
+            }
+            l_result[l_index] += m_lower_bounds[l_index];
+        }
+        unscale_variable_values(l_result);
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::collect_row_pattern(unsigned int p_row_index,
+                                                                                   std::vector<unsigned int> & p_pattern
+                                                                                  ) const
+    {
+        assert(p_row_index < m_nb_total_equations);
+        p_pattern.clear();
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            if(COEF_TYPE(0) != get_internal_coef(p_row_index, l_index))
+            {
+                p_pattern.push_back(l_index);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::collect_column_pattern(unsigned int p_column_index,
+                                                                                      unsigned int p_excluded_row_index,
+                                                                                      std::vector<unsigned int> & p_pattern
+                                                                                     ) const
+    {
+        assert(p_column_index < m_nb_all_variables);
+        p_pattern.clear();
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(l_row_index != p_excluded_row_index && COEF_TYPE(0) != get_internal_coef(l_row_index, p_column_index))
+            {
+                p_pattern.push_back(l_row_index);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned long long
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_coefs_revision() const
+    {
+        return m_coefs_revision;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <typename FUNCTION>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::for_each_row(unsigned int p_nb_rows,
+                                                                            const FUNCTION & p_function
+                                                                           )
+    {
+        if(simplex_array_traits<ARRAY_TYPE>::m_concurrent_row_update &&
+           m_thread_pool &&
+           p_nb_rows > 1 &&
+           (unsigned long long)p_nb_rows * m_nb_all_variables >= m_parallel_threshold
+          )
+        {
+            m_thread_pool->parallel_for(p_nb_rows,
+                                        [&](unsigned int p_begin, unsigned int p_end)
+                                        {
+                                            for(unsigned int l_index = p_begin; l_index < p_end; ++l_index)
+                                            {
+                                                p_function(l_index);
+                                            }
+                                        }
+                                       );
+            return;
+        }
+        for(unsigned int l_index = 0;
+            l_index < p_nb_rows;
+            ++l_index
+           )
+        {
+            p_function(l_index);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_nb_threads(unsigned int p_nb_threads)
+    {
+        if(!p_nb_threads)
+        {
+            p_nb_threads = std::thread::hardware_concurrency();
+        }
+        if(p_nb_threads > 1)
+        {
+            m_thread_pool.reset(new simplex_thread_pool(p_nb_threads));
+        }
+        else
+        {
+            m_thread_pool.reset();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_nb_threads() const
+    {
+        return m_thread_pool ? m_thread_pool->get_nb_threads() : 1;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_parallel_threshold(unsigned int p_nb_coefs)
+    {
+        m_parallel_threshold = p_nb_coefs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::record_unit_columns()
+    {
+        if(!m_unit_columns.empty())
+        {
+            return;
+        }
+        find_unit_columns(m_unit_columns);
+        m_unit_coefs.resize(m_nb_total_equations);
+        m_unit_Z_coefs.assign(m_nb_total_equations, COEF_TYPE(0));
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_unit_columns[l_row_index];
+            if(::std::numeric_limits<unsigned int>::max() != l_variable_index)
+            {
+                m_unit_coefs[l_row_index] = get_internal_coef(l_row_index, l_variable_index);
+                m_unit_Z_coefs[l_row_index] = m_array.get_Z_coef(l_variable_index);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_unit_columns(std::vector<unsigned int> & p_columns) const
+    {
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        unsigned int l_nb_real_variables = m_nb_variables + m_nb_adjustment_variable;
+
+        // Row of single non null coefficient of each column, none if column
+        // is null or has several non null coefficients
+        std::vector<unsigned int> l_rows(l_nb_real_variables, l_none);
+        std::vector<bool> l_several(l_nb_real_variables, false);
+        std::vector<unsigned int> l_pattern;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            collect_row_pattern(l_row_index, l_pattern);
+            for(auto l_variable_index: l_pattern)
+            {
+                if(l_variable_index >= l_nb_real_variables)
+                {
+                    break;
+                }
+                l_several[l_variable_index] = l_rows[l_variable_index] != l_none;
+                l_rows[l_variable_index] = l_row_index;
+            }
+        }
+
+        p_columns.assign(m_nb_total_equations, l_none);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            if(l_variable_index < l_nb_real_variables && !l_several[l_variable_index])
+            {
+                p_columns[l_row_index] = l_variable_index;
+            }
+        }
+        // Adjustment variables are checked before variables
+        for(unsigned int l_rank = 0;
+            l_rank < l_nb_real_variables;
+            ++l_rank
+           )
+        {
+            unsigned int l_variable_index = (l_rank + m_nb_variables) % l_nb_real_variables;
+            unsigned int l_row_index = l_rows[l_variable_index];
+            if(l_none != l_row_index && !l_several[l_variable_index] && l_none == p_columns[l_row_index])
+            {
+                p_columns[l_row_index] = l_variable_index;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_feasible_value(unsigned int p_variable_index,
+                                                                                 const COEF_TYPE & p_coef,
+                                                                                 const COEF_TYPE & p_B_coef
+                                                                                ) const
+    {
+        assert(COEF_TYPE(0) != p_coef);
+        // Value is B / coef, comparisons are done without division to stay
+        // exact with integer coefficients
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        COEF_TYPE l_lower = -l_tolerance * p_coef;
+        if(p_coef > 0 ? p_B_coef < l_lower : l_lower < p_B_coef)
+        {
+            return false;
+        }
+        if(m_bounded && m_has_upper_bounds[p_variable_index])
+        {
+            COEF_TYPE l_upper = (m_upper_bounds[p_variable_index] + l_tolerance) * p_coef;
+            if(p_coef > 0 ? l_upper < p_B_coef : p_B_coef < l_upper)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::start_first_phase(bool p_record_unit_columns)
+    {
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        std::vector<unsigned int> l_unit_columns;
+        if(!is_base_complete())
+        {
+            find_unit_columns(l_unit_columns);
+        }
+
+        // Equations needing an artificial variable. Artificial variables
+        // remaining in base after an unfinished first phase are kept so that
+        // first phase continues from current base
+        std::vector<unsigned int> l_rows;
+        std::vector<unsigned int> l_artificials;
+        unsigned int l_nb_new_artificial = 0;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            const COEF_TYPE & l_B_coef = m_array.get_B_coef(l_row_index);
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            if(l_none != l_variable_index)
+            {
+                if(is_artificial_variable(l_variable_index))
+                {
+                    // Null artificial variable of a redundant equation
+                    if(is_null(l_B_coef) && is_redundant_equation(l_row_index))
+                    {
+                        continue;
+                    }
+                    l_rows.push_back(l_row_index);
+                    l_artificials.push_back(l_variable_index);
+                    continue;
+                }
+                if(is_feasible_value(l_variable_index, get_internal_coef(l_row_index, l_variable_index), l_B_coef))
+                {
+                    continue;
+                }
+                m_base_variables_position[l_variable_index] = l_none;
+                m_base_variables[l_row_index] = l_none;
+            }
+            else
+            {
+                l_variable_index = l_unit_columns[l_row_index];
+                if(l_none != l_variable_index
+                   && !m_complemented[l_variable_index]
+                   && COEF_TYPE(0) == m_array.get_Z_coef(l_variable_index)
+                   && is_feasible_value(l_variable_index, get_internal_coef(l_row_index, l_variable_index), l_B_coef)
+                  )
+                {
+                    m_base_variables[l_row_index] = l_variable_index;
+                    m_base_variables_position[l_variable_index] = l_row_index;
+                    continue;
+                }
+            }
+            l_rows.push_back(l_row_index);
+            l_artificials.push_back(l_none);
+            ++l_nb_new_artificial;
+        }
+        m_nb_base_variables_defined = m_nb_total_equations;
+        if(l_rows.empty())
+        {
+            return 0;
+        }
+
+        // Add one column per new artificial variable
+        unsigned int l_first_index = m_nb_all_variables;
+        if(l_nb_new_artificial)
+        {
+            m_array.add_variables(l_nb_new_artificial);
+            ++m_coefs_revision;
+            m_nb_all_variables += l_nb_new_artificial;
+            m_base_variables_position.resize(m_nb_all_variables, l_none);
+            m_upper_bounds.resize(m_nb_all_variables, (COEF_TYPE)0);
+            m_has_upper_bounds.resize(m_nb_all_variables, false);
+            m_complemented.resize(m_nb_all_variables, false);
+        }
+
+        save_objective();
+
+        // Artificial variable coefficient has the sign of B coefficient so
+        // that its value is positive. Max of -SUM(a) with
+        // a = (B - SUM(Aj * Xj)) / coef gives Z coefficients
+        // -SUM(Aj * sign(coef)) and Z0 -SUM(B * sign(coef)) when coef is 1
+        // or -1. Other coefficients come from pivots of an unfinished first
+        // phase: Z coefficient of artificial variable is set to 1 and
+        // eliminated by pivot once base coefficients are positive so that
+        // first phase goes on with the same objective function
+        COEF_TYPE l_Z0(0);
+        std::vector<unsigned int> l_pattern;
+        for(unsigned int l_rank = 0;
+            l_rank < l_rows.size();
+            ++l_rank
+           )
+        {
+            unsigned int l_row_index = l_rows[l_rank];
+            unsigned int l_variable_index = l_artificials[l_rank];
+            bool l_negative = m_array.get_B_coef(l_row_index) < 0;
+            if(l_none == l_variable_index)
+            {
+                l_variable_index = l_first_index++;
+                set_internal_coef(l_row_index, l_variable_index, l_negative ? COEF_TYPE(-1) : COEF_TYPE(1));
+                m_base_variables[l_row_index] = l_variable_index;
+                m_base_variables_position[l_variable_index] = l_row_index;
+                // Column of artificial variable is the only one specific to
+                // an equation without adjustment variable
+                if(p_record_unit_columns && l_none == m_unit_columns[l_row_index])
+                {
+                    m_unit_columns[l_row_index] = l_variable_index;
+                    m_unit_coefs[l_row_index] = get_internal_coef(l_row_index, l_variable_index);
+                    m_unit_Z_coefs[l_row_index] = COEF_TYPE(0);
+                }
+            }
+            else if(l_negative != (get_internal_coef(l_row_index, l_variable_index) < 0))
+            {
+                // Base artificial variable only appears in its equation so
+                // its column can be negated to keep its value positive
+                negate_artificial_column(l_row_index, l_variable_index);
+            }
+            const COEF_TYPE & l_artificial_coef = get_internal_coef(l_row_index, l_variable_index);
+            if(COEF_TYPE(1) != l_artificial_coef && COEF_TYPE(-1) != l_artificial_coef)
+            {
+                m_array.set_Z_coef(l_variable_index, COEF_TYPE(1));
+                continue;
+            }
+            collect_row_pattern(l_row_index, l_pattern);
+            for(auto l_index: l_pattern)
+            {
+                if(l_index == l_variable_index)
+                {
+                    continue;
+                }
+                const COEF_TYPE & l_coef = get_internal_coef(l_row_index, l_index);
+                m_array.set_Z_coef(l_index, l_negative ? m_array.get_Z_coef(l_index) + l_coef : m_array.get_Z_coef(l_index) - l_coef);
+            }
+            l_Z0 = l_negative ? l_Z0 + m_array.get_B_coef(l_row_index) : l_Z0 - m_array.get_B_coef(l_row_index);
+        }
+        m_array.set_Z0_coef(l_Z0);
+        return (unsigned int)l_rows.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::save_objective()
+    {
+        m_first_phase_Z_coefs.resize(m_nb_all_variables);
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            m_first_phase_Z_coefs[l_index] = m_array.get_Z_coef(l_index);
+            m_array.set_Z_coef(l_index, COEF_TYPE(0));
+        }
+        m_first_phase_Z0 = m_array.get_Z0_coef();
+        m_array.set_Z0_coef(COEF_TYPE(0));
+        m_first_phase_complemented = m_complemented;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::resume_first_phase()
+    {
+        save_objective();
+        // Z coefs are stored as -c
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            if(is_artificial_variable(l_variable_index))
+            {
+                m_array.set_Z_coef(l_variable_index, COEF_TYPE(1));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::negate_artificial_column(unsigned int p_row_index,
+                                                                                        unsigned int p_variable_index
+                                                                                       )
+    {
+        assert(is_artificial_variable(p_variable_index));
+        assert(p_row_index == m_base_variables_position[p_variable_index]);
+        set_internal_coef(p_row_index, p_variable_index, -get_internal_coef(p_row_index, p_variable_index));
+        // Unit column keeps its relation with original coefficient
+        for(unsigned int l_equation_index = 0;
+            l_equation_index < m_unit_columns.size();
+            ++l_equation_index
+           )
+        {
+            if(p_variable_index == m_unit_columns[l_equation_index])
+            {
+                m_unit_coefs[l_equation_index] = -m_unit_coefs[l_equation_index];
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::end_first_phase()
+    {
+        for(unsigned int l_index = m_nb_variables + m_nb_adjustment_variable;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            if(is_base_variable(l_index) || is_unit_column(l_index))
+            {
+                // Artificial variable stays in base, at 0 for a redundant
+                // equation, or its column is needed to express equation
+                // without adjustment variable
+                continue;
+            }
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
+            {
+                if(COEF_TYPE(0) != get_internal_coef(l_row_index, l_index))
+                {
+                    set_internal_coef(l_row_index, l_index, COEF_TYPE(0));
+                }
+            }
+        }
+        m_array.set_Z0_coef(m_first_phase_Z0);
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            COEF_TYPE l_Z_coef = l_index < m_first_phase_Z_coefs.size() ? m_first_phase_Z_coefs[l_index] : COEF_TYPE(0);
+            // Apply complements done during first phase
+            if(l_index < m_first_phase_complemented.size() && m_complemented[l_index] != m_first_phase_complemented[l_index])
+            {
+                m_array.set_Z0_coef(m_array.get_Z0_coef() - l_Z_coef * m_upper_bounds[l_index]);
+                l_Z_coef = -l_Z_coef;
+            }
+            m_array.set_Z_coef(l_index, l_Z_coef);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::finish_first_phase()
+    {
+        // Z0 is the opposite of the weighted sum of artificial variables
+        if(m_array.get_Z0_coef() < -simplex_tolerance<COEF_TYPE>::get())
+        {
+            end_first_phase();
+            eliminate_base_Z_coefs();
+            return false;
+        }
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        std::vector<unsigned int> l_pattern;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_artificial_index = m_base_variables[l_row_index];
+            if(!is_artificial_variable(l_artificial_index))
+            {
+                continue;
+            }
+            // Artificial variable is null so any variable with a non null
+            // coefficient can replace it without changing values
+            collect_row_pattern(l_row_index, l_pattern);
+            for(auto l_variable_index: l_pattern)
+            {
+                if(is_artificial_variable(l_variable_index))
+                {
+                    break;
+                }
+                COEF_TYPE l_coef = get_internal_coef(l_row_index, l_variable_index);
+                if(!is_base_variable(l_variable_index) && (l_coef < -l_tolerance || l_tolerance < l_coef))
+                {
+                    if(l_coef < 0)
+                    {
+                        negate_row(l_row_index);
+                    }
+                    pivot(l_row_index, l_variable_index);
+                    m_base_variables_position[l_artificial_index] = std::numeric_limits<unsigned int>::max();
+                    m_base_variables_position[l_variable_index] = l_row_index;
+                    m_base_variables[l_row_index] = l_variable_index;
+                    break;
+                }
+            }
+        }
+        end_first_phase();
+        eliminate_base_Z_coefs();
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::eliminate_base_Z_coefs()
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(COEF_TYPE(0) != m_array.get_Z_coef(m_base_variables[l_row_index]))
+            {
+                pivot(l_row_index, m_base_variables[l_row_index]);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_unit_column(unsigned int p_variable_index) const
+    {
+        for(auto l_variable_index: m_unit_columns)
+        {
+            if(p_variable_index == l_variable_index)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_unit_column(unsigned int p_row_index,
+                                                                               COEF_TYPE & p_coef,
+                                                                               COEF_TYPE & p_Z_coef
+                                                                              ) const
+    {
+        assert(p_row_index < m_unit_columns.size());
+        p_coef = m_unit_coefs[p_row_index];
+        p_Z_coef = m_unit_Z_coefs[p_row_index];
+        return m_unit_columns[p_row_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_first_phase_pending() const
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            if(::std::numeric_limits<unsigned int>::max() != l_variable_index
+               && is_artificial_variable(l_variable_index)
+               && !(is_null(m_array.get_B_coef(l_row_index)) && is_redundant_equation(l_row_index))
+              )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_redundant_equation(unsigned int p_row_index) const
+    {
+        for(unsigned int l_index = 0;
+            l_index < m_nb_variables + m_nb_adjustment_variable;
+            ++l_index
+           )
+        {
+            if(!is_null(get_internal_coef(p_row_index, l_index)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_artificial_variable(unsigned int p_variable_index) const
+    {
+        assert(p_variable_index < m_nb_all_variables);
+        return m_nb_variables + m_nb_adjustment_variable <= p_variable_index;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_base_complete() const
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(::std::numeric_limits<unsigned int>::max() == m_base_variables[l_row_index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::check_basis(const std::vector<unsigned int> & p_basis) const
+    {
+        if(p_basis.size() != m_nb_total_equations)
+        {
+            throw quicky_exception::quicky_logic_exception("Basis size " + std::to_string(p_basis.size()) + " differs from number of equations " + std::to_string(m_nb_total_equations), __LINE__, __FILE__);
+        }
+        std::vector<bool> l_in_basis(m_nb_variables + m_nb_adjustment_variable, false);
+        for(auto l_variable_index: p_basis)
+        {
+            if(::std::numeric_limits<unsigned int>::max() == l_variable_index)
+            {
+                continue;
+            }
+            if(l_variable_index >= m_nb_variables + m_nb_adjustment_variable)
+            {
+                throw quicky_exception::quicky_logic_exception("Basis variable index " + std::to_string(l_variable_index) + " is out of range", __LINE__, __FILE__);
+            }
+            if(l_in_basis[l_variable_index])
+            {
+                throw quicky_exception::quicky_logic_exception("Variable " + std::to_string(l_variable_index) + " appears twice in basis", __LINE__, __FILE__);
+            }
+            l_in_basis[l_variable_index] = true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::clear_base_variables()
+    {
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            m_base_variables[l_row_index] = ::std::numeric_limits<unsigned int>::max();
+        }
+        m_base_variables_position.assign(m_nb_all_variables, ::std::numeric_limits<unsigned int>::max());
+        m_nb_base_variables_defined = m_nb_total_equations;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_search_done() const
+    {
+        return !m_unit_columns.empty();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::insert_column(unsigned int p_column_index)
+    {
+        assert(p_column_index <= m_nb_all_variables);
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        m_array.insert_variables(p_column_index, 1);
+        ++m_coefs_revision;
+        ++m_nb_all_variables;
+        m_base_variables_position.insert(m_base_variables_position.begin() + p_column_index, l_none);
+        for(auto & l_variable_index: m_base_variables)
+        {
+            if(l_none != l_variable_index && l_variable_index >= p_column_index)
+            {
+                ++l_variable_index;
+            }
+        }
+        for(auto & l_variable_index: m_unit_columns)
+        {
+            if(l_none != l_variable_index && l_variable_index >= p_column_index)
+            {
+                ++l_variable_index;
+            }
+        }
+        m_upper_bounds.insert(m_upper_bounds.begin() + p_column_index, COEF_TYPE(0));
+        m_has_upper_bounds.insert(m_has_upper_bounds.begin() + p_column_index, false);
+        m_complemented.insert(m_complemented.begin() + p_column_index, false);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::remove_column(unsigned int p_column_index)
+    {
+        assert(p_column_index < m_nb_all_variables);
+        assert(!is_base_variable(p_column_index));
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        m_array.remove_variables(p_column_index, 1);
+        ++m_coefs_revision;
+        --m_nb_all_variables;
+        m_base_variables_position.erase(m_base_variables_position.begin() + p_column_index);
+        for(auto & l_variable_index: m_base_variables)
+        {
+            if(l_none != l_variable_index && l_variable_index > p_column_index)
+            {
+                --l_variable_index;
+            }
+        }
+        for(auto & l_variable_index: m_unit_columns)
+        {
+            assert(l_variable_index != p_column_index);
+            if(l_none != l_variable_index && l_variable_index > p_column_index)
+            {
+                --l_variable_index;
+            }
+        }
+        m_upper_bounds.erase(m_upper_bounds.begin() + p_column_index);
+        m_has_upper_bounds.erase(m_has_upper_bounds.begin() + p_column_index);
+        m_complemented.erase(m_complemented.begin() + p_column_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_objective_value() const
+    {
+        return m_array.get_Z0_coef();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::record_change(t_trail_kind p_kind,
+                                                                             unsigned int p_equation_index,
+                                                                             unsigned int p_unit_column,
+                                                                             const COEF_TYPE & p_B_coef
+                                                                            )
+    {
+        m_scope_trail.record(p_kind, p_equation_index, p_unit_column, p_B_coef);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::record_bounds(unsigned int p_variable_index)
+    {
+        if(m_scope_trail.empty())
+        {
+            return;
+        }
+        // Bounds are recorded in original units as scaling can be done
+        // before scope is closed
+        COEF_TYPE l_scale = get_column_scale(p_variable_index);
+        const COEF_TYPE & l_lower = m_lower_bounds[p_variable_index];
+        m_scope_trail.record(t_trail_kind::BOUNDS,
+                             p_variable_index,
+                             ::std::numeric_limits<unsigned int>::max(),
+                             l_lower * l_scale,
+                             (l_lower + m_upper_bounds[p_variable_index]) * l_scale,
+                             m_has_upper_bounds[p_variable_index]
+                            );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::move_variable_bounds(unsigned int p_variable_index,
+                                                                                    const COEF_TYPE & p_lower,
+                                                                                    const COEF_TYPE & p_upper,
+                                                                                    bool p_has_upper
+                                                                                   )
+    {
+        assert(p_variable_index < m_nb_variables);
+        if(p_has_upper && p_upper < p_lower)
+        {
+            throw quicky_exception::quicky_logic_exception("Lower bound greater than upper bound for variable " + std::to_string(p_variable_index), __LINE__, __FILE__);
+        }
+        if(m_bounds_prepared)
+        {
+            if(m_complemented[p_variable_index] && !p_has_upper)
+            {
+                // a * (u - x') = a * u - a * x' like complement_variable. A
+                // base variable keeps a positive coefficient in its row
+                const COEF_TYPE & l_upper = m_upper_bounds[p_variable_index];
+                for(unsigned int l_row_index = 0;
+                    l_row_index < m_nb_total_equations;
+                    ++l_row_index
+                   )
+                {
+                    COEF_TYPE l_coef = get_internal_coef(l_row_index, p_variable_index);
+                    if(COEF_TYPE(0) != l_coef)
+                    {
+                        m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) - l_coef * l_upper);
+                        set_internal_coef(l_row_index, p_variable_index, -l_coef);
+                    }
+                }
+                COEF_TYPE l_z_coef = m_array.get_Z_coef(p_variable_index);
+                m_array.set_Z0_coef(m_array.get_Z0_coef() - l_z_coef * l_upper);
+                m_array.set_Z_coef(p_variable_index, -l_z_coef);
+                m_complemented[p_variable_index] = false;
+                if(is_base_variable(p_variable_index))
+                {
+                    negate_row(m_base_variables_position[p_variable_index]);
+                }
+            }
+            // Simplex variable is x - l or u - x when complemented, old one
+            // is new one plus a constant delta : a * x' = a * x'' + a * delta
+            COEF_TYPE l_delta = m_complemented[p_variable_index]
+                                ? (m_lower_bounds[p_variable_index] + m_upper_bounds[p_variable_index]) - p_upper
+                                : p_lower - m_lower_bounds[p_variable_index];
+            if(COEF_TYPE(0) != l_delta)
+            {
+                for(unsigned int l_row_index = 0;
+                    l_row_index < m_nb_total_equations;
+                    ++l_row_index
+                   )
+                {
+                    const COEF_TYPE & l_coef = get_internal_coef(l_row_index, p_variable_index);
+                    if(COEF_TYPE(0) != l_coef)
+                    {
+                        m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) - l_coef * l_delta);
+                    }
+                }
+                m_array.set_Z0_coef(m_array.get_Z0_coef() - m_array.get_Z_coef(p_variable_index) * l_delta);
+            }
+        }
+        else
+        {
+            m_translated |= COEF_TYPE(0) != p_lower;
+        }
+        m_lower_bounds[p_variable_index] = p_lower;
+        m_upper_bounds[p_variable_index] = p_has_upper ? p_upper - p_lower : COEF_TYPE(0);
+        m_has_upper_bounds[p_variable_index] = p_has_upper;
+        m_bounded |= p_has_upper;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::remove_last_equation()
+    {
+        const unsigned int l_none = ::std::numeric_limits<unsigned int>::max();
+        unsigned int l_equation_index = m_nb_total_equations - 1;
+        t_equation_type l_equation_type = m_equation_types[l_equation_index];
+        assert(t_equation_type::INEQUATION_LT == l_equation_type || t_equation_type::INEQUATION_GT == l_equation_type);
+        // Adjustment variables of equations added after construction are
+        // stored in the order of equations
+        unsigned int l_adjustment_index = m_nb_variables + m_nb_defined_adjustment_variables - 1;
+
+        if(is_search_done())
+        {
+            // Adjustment variable only appears in original equation so once
+            // it is a base variable other equations do not depend on it
+            if(!is_base_variable(l_adjustment_index))
+            {
+                unsigned int l_pivot_row_index = l_none;
+                COEF_TYPE l_max(0);
+                for(unsigned int l_row_index = 0;
+                    l_row_index < m_nb_total_equations;
+                    ++l_row_index
+                   )
+                {
+                    COEF_TYPE l_coef = get_internal_coef(l_row_index, l_adjustment_index);
+                    if(l_coef < 0)
+                    {
+                        l_coef = -l_coef;
+                    }
+                    if(l_max < l_coef)
+                    {
+                        l_max = l_coef;
+                        l_pivot_row_index = l_row_index;
+                    }
+                }
+                assert(l_none != l_pivot_row_index);
+                if(get_internal_coef(l_pivot_row_index, l_adjustment_index) < 0)
+                {
+                    negate_row(l_pivot_row_index);
+                }
+                pivot(l_pivot_row_index, l_adjustment_index);
+                m_base_variables_position[m_base_variables[l_pivot_row_index]] = l_none;
+                m_base_variables_position[l_adjustment_index] = l_pivot_row_index;
+                m_base_variables[l_pivot_row_index] = l_adjustment_index;
+            }
+            // Row defining adjustment variable is dropped, last row takes
+            // its place
+            unsigned int l_row_index = m_base_variables_position[l_adjustment_index];
+            m_base_variables_position[l_adjustment_index] = l_none;
+            m_base_variables[l_row_index] = l_none;
+            if(l_row_index != l_equation_index)
+            {
+                for(unsigned int l_index = 0;
+                    l_index < m_nb_all_variables;
+                    ++l_index
+                   )
+                {
+                    COEF_TYPE l_coef = get_internal_coef(l_equation_index, l_index);
+                    if(COEF_TYPE(0) != l_coef || COEF_TYPE(0) != get_internal_coef(l_row_index, l_index))
+                    {
+                        set_internal_coef(l_row_index, l_index, l_coef);
+                    }
+                }
+                m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_equation_index));
+                unsigned int l_variable_index = m_base_variables[l_equation_index];
+                m_base_variables[l_row_index] = l_variable_index;
+                if(l_none != l_variable_index)
+                {
+                    m_base_variables_position[l_variable_index] = l_row_index;
+                }
+                m_base_variables[l_equation_index] = l_none;
+            }
+            m_unit_columns.pop_back();
+            m_unit_coefs.pop_back();
+            m_unit_Z_coefs.pop_back();
+        }
+        else if(l_none != m_base_variables[l_equation_index])
+        {
+            m_base_variables_position[m_base_variables[l_equation_index]] = l_none;
+            m_base_variables[l_equation_index] = l_none;
+        }
+
+        // Adjustment variable column is now null
+        remove_column(l_adjustment_index);
+        --m_nb_adjustment_variable;
+        --m_nb_defined_adjustment_variables;
+        if(t_equation_type::INEQUATION_LT == l_equation_type)
+        {
+            --m_nb_inequations_lt;
+        }
+        else
+        {
+            --m_nb_inequations_gt;
+        }
+        m_array.remove_equations(1);
+        ++m_coefs_revision;
+        --m_nb_total_equations;
+        m_equation_types.pop_back();
+        m_base_variables.pop_back();
+        m_original_B_coefs.pop_back();
+        if(m_scaled)
+        {
+            m_row_scales.pop_back();
+        }
+        if(m_nb_base_variables_defined > m_nb_total_equations)
+        {
+            m_nb_base_variables_defined = m_nb_total_equations;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::negate_row(unsigned int p_equation_index)
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            COEF_TYPE l_coef = get_internal_coef(p_equation_index, l_index);
+            if(COEF_TYPE(0) != l_coef)
+            {
+                set_internal_coef(p_equation_index, l_index, -l_coef);
+            }
+        }
+        m_array.set_B_coef(p_equation_index, -m_array.get_B_coef(p_equation_index));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_scaling(bool p_scaling)
+    {
+        if(m_scaled)
+        {
+            throw quicky_exception::quicky_logic_exception("Scaling cannot be changed once search has been done", __LINE__, __FILE__);
+        }
+        if(p_scaling && !std::is_floating_point<COEF_TYPE>::value)
+        {
+            throw quicky_exception::quicky_logic_exception("Scaling is only available for floating point coefficients", __LINE__, __FILE__);
+        }
+        m_scaling = p_scaling;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::scale()
+    {
+        if(!m_scaling || m_scaled)
+        {
+            return;
+        }
+        scale(std::integral_constant<bool, std::is_floating_point<COEF_TYPE>::value>());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::scale(std::false_type)
+    {
+        assert(false);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::scale(std::true_type)
+    {
+        assert(!m_bounds_prepared);
+        assert(m_unit_columns.empty());
+        // Non null coefficients of original variables. Adjustment variables
+        // keep their coefficient: they are implicitly scaled by the factor
+        // of their equation
+        std::vector<unsigned int> l_rows;
+        std::vector<unsigned int> l_columns;
+        std::vector<COEF_TYPE> l_values;
+        std::vector<unsigned int> l_pattern;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            collect_row_pattern(l_row_index, l_pattern);
+            for(auto l_column_index: l_pattern)
+            {
+                if(l_column_index < m_nb_variables)
+                {
+                    l_rows.push_back(l_row_index);
+                    l_columns.push_back(l_column_index);
+                    l_values.push_back(std::abs(get_internal_coef(l_row_index, l_column_index)));
+                }
+            }
+        }
+        simplex_scaling<COEF_TYPE>::compute(m_nb_total_equations,
+                                            m_nb_variables,
+                                            l_rows,
+                                            l_columns,
+                                            l_values,
+                                            m_row_scales,
+                                            m_column_scales
+                                           );
+
+        // Apply factors: A' = R A C, b' = R b, c' = c C and x' = x / C
+        for(size_t l_index = 0; l_index < l_values.size(); ++l_index)
         {
-            case t_equation_type::UNDEFINED:
-                p_stream << "\"undef\"";
-                break;
-            case t_equation_type::EQUATION:
-                p_stream << "\"=\"";
-                break;
-            case t_equation_type::INEQUATION_LT:
-                p_stream << "\"<=\"";
-                break;
-            case t_equation_type::INEQUATION_GT:
-                p_stream << "\">=\"";
-                break;
-            default:
-                throw quicky_exception::quicky_logic_exception("Unknown equation_type value : "+ std::to_string((unsigned int)p_equation_type),__LINE__,__FILE__);
+            unsigned int l_row_index = l_rows[l_index];
+            unsigned int l_column_index = l_columns[l_index];
+            set_internal_coef(l_row_index, l_column_index, get_internal_coef(l_row_index, l_column_index) * m_row_scales[l_row_index] * m_column_scales[l_column_index]);
         }
-        return p_stream;
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) * m_row_scales[l_row_index]);
+            // Bound of range adjustment variable follows its equation
+            collect_row_pattern(l_row_index, l_pattern);
+            for(auto l_column_index: l_pattern)
+            {
+                if(l_column_index >= m_nb_variables && m_has_upper_bounds[l_column_index])
+                {
+                    m_upper_bounds[l_column_index] = m_upper_bounds[l_column_index] * m_row_scales[l_row_index];
+                }
+            }
+        }
+        for(unsigned int l_column_index = 0;
+            l_column_index < m_nb_variables;
+            ++l_column_index
+           )
+        {
+            const COEF_TYPE & l_scale = m_column_scales[l_column_index];
+            m_array.set_Z_coef(l_column_index, m_array.get_Z_coef(l_column_index) * l_scale);
+            m_lower_bounds[l_column_index] = m_lower_bounds[l_column_index] / l_scale;
+            m_upper_bounds[l_column_index] = m_upper_bounds[l_column_index] / l_scale;
+        }
+        m_scaled = true;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::simplex_solver_base(unsigned int p_nb_variables,
-                                                                             unsigned int p_nb_inequations_lt,
-                                                                             unsigned int p_nb_equations,
-                                                                             unsigned int p_nb_inequations_gt
-                                                                            ):
-            m_nb_variables(p_nb_variables),
-            m_nb_inequations_lt(p_nb_inequations_lt),
-            m_nb_equations(p_nb_equations),
-            m_nb_inequations_gt(p_nb_inequations_gt),
-            m_nb_adjustment_variable(p_nb_inequations_lt + p_nb_inequations_gt),
-            m_nb_defined_adjustment_variables(0),
-            m_nb_all_variables(p_nb_variables + m_nb_adjustment_variable),
-            m_nb_total_equations(p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt),
-            m_array(m_nb_total_equations,m_nb_all_variables),
-            m_equation_types(new simplex::equation_type[m_nb_total_equations]),
-            m_base_variables(new unsigned int[m_nb_total_equations]),
-            m_base_variables_position(new unsigned int[m_nb_all_variables]),
-            m_nb_base_variables_defined(0)
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_row_scale(unsigned int p_equation_index) const
     {
-        static_assert(std::is_signed<COEF_TYPE>::value, "Simplex template parameter should be signed");
-        for(unsigned int l_index = 0;
-            l_index < m_nb_total_equations;
-            ++l_index
-                )
+        assert(!m_scaled || p_equation_index < m_row_scales.size());
+        return m_scaled ? m_row_scales[p_equation_index] : COEF_TYPE(1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_column_scale(unsigned int p_variable_index) const
+    {
+        assert(!m_scaled || p_variable_index < m_column_scales.size());
+        return m_scaled ? m_column_scales[p_variable_index] : COEF_TYPE(1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::unscale_variable_values(std::vector<COEF_TYPE> & p_values) const
+    {
+        if(!m_scaled)
+        {
+            return;
+        }
+        assert(p_values.size() <= m_column_scales.size());
+        for(size_t l_index = 0; l_index < p_values.size(); ++l_index)
         {
-            m_base_variables[l_index] = ::std::numeric_limits<unsigned int>::max();
+            p_values[l_index] = p_values[l_index] * m_column_scales[l_index];
         }
-        memset(m_base_variables_position, 0xFF, m_nb_all_variables * sizeof(unsigned int));
-        memset(m_equation_types, 0, m_nb_total_equations * sizeof(simplex::equation_type));
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_Z_coef(const unsigned int p_index,
-                                                                         const COEF_TYPE & p_value
-                                                                        )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_stall_threshold(unsigned int p_nb_pivots)
     {
-        assert(p_index < m_nb_variables);
-        m_array.set_Z_coef(p_index,-p_value);
+        m_stall_threshold = p_nb_pivots;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_B_coef(const unsigned int p_index,
-                                                                         const COEF_TYPE & p_value
-                                                                        )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_perturbation(bool p_perturbation)
     {
-        m_array.set_B_coef(p_index, p_value);
+        if(p_perturbation && !std::is_floating_point<COEF_TYPE>::value)
+        {
+            throw quicky_exception::quicky_logic_exception("Perturbation is only available for floating point coefficients", __LINE__, __FILE__);
+        }
+        m_perturbation = p_perturbation;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_A_coef(const unsigned int p_equation_index,
-                                                                         const unsigned int p_variable_index,
-                                                                         const COEF_TYPE & p_value
-                                                                        )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_nb_pivots() const
     {
-        // Keep assert because we differentiate access to internal coefs
-        assert(p_variable_index < m_nb_variables);
-        m_array.set_A_coef(p_equation_index,p_variable_index,p_value);
+        return m_nb_pivots;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    const COEF_TYPE &
-    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::get_A_coef(const unsigned int p_equation_index,
-                                                                    const unsigned int p_variable_index
-                                                                   )const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_nb_degenerate_pivots() const
     {
-        // Keep assert because we differentiate access to internal coefs
-        assert(p_variable_index < m_nb_variables);
-        return m_array.get_A_coef(p_equation_index,p_variable_index);
+        return m_nb_degenerate_pivots;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_internal_coef(const unsigned int p_equation_index,
-                                                                                const unsigned int p_variable_index,
-                                                                                const COEF_TYPE & p_value
-                                                                               )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    double
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_degenerate_pivot_ratio() const
     {
-        // Keep assert because we differentiate access to internal coefs
-        assert(p_variable_index < m_nb_all_variables);
-        //    assert(p_variable_index >= m_nb_variables);
-        m_array.set_A_coef(p_equation_index, p_variable_index, p_value);
+        return m_nb_pivots ? (double)m_nb_degenerate_pivots / m_nb_pivots : 0.0;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    const COEF_TYPE &
-    simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::get_internal_coef(const unsigned int p_equation_index,
-                                                                           const unsigned int p_variable_index
-                                                                          )const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<COEF_TYPE>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_dual_values() const
     {
-        // Keep assert because we differentiate access to internal coefs
-        assert(p_variable_index < m_nb_all_variables);
-        //      assert(p_variable_index >= m_nb_variables);
-        return m_array.get_A_coef(p_equation_index, p_variable_index);
+        std::vector<COEF_TYPE> l_duals;
+        compute_internal_duals(l_duals);
+        // Internal B coefficients are multiplied by row scale
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            l_duals[l_row_index] = l_duals[l_row_index] * get_row_scale(l_row_index);
+        }
+        return l_duals;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    std::ostream & simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::display_array(std::ostream & p_stream)const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<COEF_TYPE>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_reduced_costs() const
     {
-        p_stream << "Z\t";
+        std::vector<COEF_TYPE> l_Z_coefs;
+        compute_internal_Z_coefs(l_Z_coefs);
+        std::vector<COEF_TYPE> l_result(m_nb_variables, COEF_TYPE(0));
         for(unsigned int l_index = 0;
-            l_index < m_nb_all_variables;
+            l_index < m_nb_variables;
             ++l_index
-                )
+           )
         {
-            if(l_index < m_nb_variables)
-            {
-                p_stream << "X" << 1 + l_index;
-            }
-            else
+            if(is_base_variable(l_index))
             {
-                p_stream << "E" << 1 + l_index - m_nb_variables;
+                continue;
             }
-            p_stream << "\t" ;
-        }
-        p_stream << std::endl;
-        p_stream << "Z\t";
-        for(unsigned int l_index = 0;
-            l_index < m_nb_all_variables;
-            ++l_index
-                )
-        {
-            p_stream << m_array.get_Z_coef(l_index) << "\t";
+            // Z coefs are stored as -c and a complemented variable varies in
+            // opposite direction
+            COEF_TYPE l_reduced_cost = -l_Z_coefs[l_index] / get_column_scale(l_index);
+            l_result[l_index] = m_complemented[l_index] ? -l_reduced_cost : l_reduced_cost;
         }
-        p_stream << "|\t" << m_array.get_Z0_coef() << std::endl;
-        for(unsigned int l_row_index = 0;
-            l_row_index < m_nb_total_equations;
-            ++l_row_index
-                )
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<simplex_range<COEF_TYPE>>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_B_coef_ranges() const
+    {
+        std::vector<COEF_TYPE> l_values;
+        compute_base_values(l_values);
+        std::vector<simplex_range<COEF_TYPE>> l_ranges(m_nb_total_equations);
+        std::vector<COEF_TYPE> l_direction;
+        for(unsigned int l_equation_index = 0;
+            l_equation_index < m_nb_total_equations;
+            ++l_equation_index
+           )
         {
-            unsigned int l_var_index = m_base_variables[l_row_index];
-            if(::std::numeric_limits<unsigned int>::max() != l_var_index)
+            compute_B_coef_direction(l_equation_index, l_direction);
+            simplex_range<COEF_TYPE> & l_range = l_ranges[l_equation_index];
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
             {
-                if(l_var_index < m_nb_variables)
+                COEF_TYPE l_coef = l_direction[l_row_index] * get_row_scale(l_equation_index);
+                unsigned int l_variable_index = m_base_variables[l_row_index];
+                if(is_artificial_variable(l_variable_index))
                 {
-                    p_stream << "X" << 1 + l_var_index;
+                    // Artificial variable of redundant equation should stay
+                    // null
+                    l_range.restrict(COEF_TYPE(0), l_coef);
+                    l_range.restrict(COEF_TYPE(0), -l_coef);
+                    continue;
                 }
-                else
+                l_range.restrict(l_values[l_row_index], l_coef);
+                if(m_bounded && m_has_upper_bounds[l_variable_index])
                 {
-                    p_stream << "E" << 1 + l_var_index - m_nb_variables;
+                    l_range.restrict(m_upper_bounds[l_variable_index] - l_values[l_row_index], -l_coef);
                 }
             }
-            else
+        }
+        return l_ranges;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<simplex_range<COEF_TYPE>>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_Z_coef_ranges() const
+    {
+        std::vector<COEF_TYPE> l_Z_coefs;
+        compute_internal_Z_coefs(l_Z_coefs);
+        // Optimality conditions are expressed on maximized objective function
+        // that is the opposite of user one after a min search
+        const COEF_TYPE l_sign = m_minimized ? COEF_TYPE(-1) : COEF_TYPE(1);
+        for(auto & l_Z_coef: l_Z_coefs)
+        {
+            l_Z_coef = l_sign * l_Z_coef;
+        }
+        std::vector<simplex_range<COEF_TYPE>> l_ranges(m_nb_variables);
+        std::vector<COEF_TYPE> l_row;
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            // Variation of internal Z coefficient when Z coefficient of user
+            // objective function increases by 1
+            COEF_TYPE l_factor = l_sign * get_column_scale(l_variable_index);
+            if(m_complemented[l_variable_index])
             {
-                p_stream << " ";
+                l_factor = -l_factor;
             }
-            p_stream << "\t";
+            simplex_range<COEF_TYPE> & l_range = l_ranges[l_variable_index];
+            if(!is_base_variable(l_variable_index))
+            {
+                l_range.restrict(l_Z_coefs[l_variable_index], -l_factor);
+                continue;
+            }
+            // Z row is updated with row of base variable to keep its Z
+            // coefficient null
+            compute_base_row(get_base_variables_position(l_variable_index), l_row);
             for(unsigned int l_index = 0;
-                l_index < m_nb_all_variables;
+                l_index < m_nb_variables + m_nb_adjustment_variable;
                 ++l_index
-                    )
+               )
             {
-                p_stream << get_internal_coef(l_row_index, l_index) << "\t";
+                if(!is_base_variable(l_index))
+                {
+                    l_range.restrict(l_Z_coefs[l_index], l_row[l_index] * l_factor);
+                }
             }
-            p_stream << "|\t" << m_array.get_B_coef(l_row_index) << std::endl;
         }
-        return p_stream;
+        return l_ranges;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_adjustement_variable(const unsigned int & p_equation_index,
-                                                                                       const COEF_TYPE & p_value
-                                                                                      )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_minimized(bool p_minimized)
     {
-        unsigned int l_column_index = m_nb_variables + m_nb_defined_adjustment_variables;
-        set_internal_coef(p_equation_index, l_column_index, p_value);
-        if(!m_nb_equations)
-        {
-            define_base_variable(l_column_index);
-        }
-        ++m_nb_defined_adjustment_variables;
+        m_minimized = p_minimized;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    bool simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::get_max_input_variable_index(unsigned int & p_variable_index) const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const
     {
-        for(unsigned int l_index = 0;
-            l_index < m_nb_all_variables;
-            ++l_index
-                )
+        if(!is_search_done())
         {
-            if(m_array.get_Z_coef(l_index) < 0)
+            throw quicky_exception::quicky_logic_exception("Dual values are only available after a search", __LINE__, __FILE__);
+        }
+        // Z coefficient of unit column is its original Z coefficient plus
+        // dual value times its original coefficient. A complemented variable
+        // has its column and Z coefficient negated
+        p_duals.resize(m_nb_total_equations);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            unsigned int l_variable_index = m_unit_columns[l_row_index];
+            if(::std::numeric_limits<unsigned int>::max() == l_variable_index)
             {
-                p_variable_index = l_index;
-                return true;
+                throw quicky_exception::quicky_logic_exception("No variable is specific to equation " + std::to_string(l_row_index) + ", dual value cannot be computed", __LINE__, __FILE__);
+            }
+            COEF_TYPE l_Z_coef = m_array.get_Z_coef(l_variable_index);
+            if(m_complemented[l_variable_index])
+            {
+                l_Z_coef = -l_Z_coef;
             }
+            p_duals[l_row_index] = (l_Z_coef - m_unit_Z_coefs[l_row_index]) / m_unit_coefs[l_row_index];
         }
-        return false;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    bool simplex::simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::get_min_input_variable_index(unsigned int & p_variable_index) const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const
     {
+        if(!is_search_done())
+        {
+            throw quicky_exception::quicky_logic_exception("Reduced costs are only available after a search", __LINE__, __FILE__);
+        }
+        p_Z_coefs.resize(m_nb_all_variables);
         for(unsigned int l_index = 0;
             l_index < m_nb_all_variables;
             ++l_index
-                )
+           )
         {
-            if(m_array.get_Z_coef(l_index) > 0)
-            {
-                p_variable_index = l_index;
-                return true;
-            }
+            p_Z_coefs[l_index] = m_array.get_Z_coef(l_index);
         }
-        return false;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::define_equation_type(const unsigned int & p_equation_index,
-                                                                         const t_equation_type & p_equation_type
-                                                                        )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_base_values(std::vector<COEF_TYPE> & p_values) const
+    {
+        if(!is_search_done() || !is_base_complete())
+        {
+            throw quicky_exception::quicky_logic_exception("Ranges are only available for a complete base after a search", __LINE__, __FILE__);
+        }
+        p_values.resize(m_nb_total_equations);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            p_values[l_row_index] = m_array.get_B_coef(l_row_index) / get_internal_coef(l_row_index, m_base_variables[l_row_index]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_B_coef_direction(unsigned int p_equation_index,
+                                                                                        std::vector<COEF_TYPE> & p_direction
+                                                                                       ) const
     {
         assert(p_equation_index < m_nb_total_equations);
-        m_equation_types[p_equation_index] = p_equation_type;
-        switch(p_equation_type)
+        unsigned int l_variable_index = m_unit_columns[p_equation_index];
+        if(::std::numeric_limits<unsigned int>::max() == l_variable_index)
         {
-            case t_equation_type::UNDEFINED:
-                throw quicky_exception::quicky_logic_exception("Try to set undefined equation type for equation" + std::to_string(p_equation_index),__LINE__,__FILE__);
-                break;
-            case t_equation_type::EQUATION:
-                // Nothing to do
-                break;
-            case t_equation_type::INEQUATION_LT:
-                set_adjustement_variable(p_equation_index,(COEF_TYPE)1);
-                break;
-            case t_equation_type::INEQUATION_GT:
-                set_adjustement_variable(p_equation_index,(COEF_TYPE)-1);
-                break;
-            default:
-                throw quicky_exception::quicky_logic_exception("Unknown equation_type value : "+ std::to_string((unsigned int)p_equation_type),__LINE__,__FILE__);
+            throw quicky_exception::quicky_logic_exception("No variable is specific to equation " + std::to_string(p_equation_index) + ", B coefficient range cannot be computed", __LINE__, __FILE__);
+        }
+        // Same relation as in shift_B_coef
+        COEF_TYPE l_initial_coef = m_complemented[l_variable_index] ? -m_unit_coefs[p_equation_index] : m_unit_coefs[p_equation_index];
+        p_direction.resize(m_nb_total_equations);
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            p_direction[l_row_index] = get_internal_coef(l_row_index, l_variable_index) / (l_initial_coef * get_internal_coef(l_row_index, m_base_variables[l_row_index]));
         }
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::define_base_variable(const unsigned int & p_variable_index)
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_base_row(unsigned int p_row_index,
+                                                                                std::vector<COEF_TYPE> & p_row
+                                                                               ) const
     {
-        assert(p_variable_index < m_nb_all_variables);
-        assert(m_nb_base_variables_defined < m_nb_total_equations);
-        m_base_variables[m_nb_base_variables_defined] = p_variable_index;
-        m_base_variables_position[p_variable_index] = m_nb_base_variables_defined;
-        ++m_nb_base_variables_defined;
+        assert(p_row_index < m_nb_total_equations);
+        const COEF_TYPE & l_base_coef = get_internal_coef(p_row_index, m_base_variables[p_row_index]);
+        p_row.resize(m_nb_all_variables);
+        for(unsigned int l_index = 0;
+            l_index < m_nb_all_variables;
+            ++l_index
+           )
+        {
+            p_row[l_index] = get_internal_coef(p_row_index, l_index) / l_base_coef;
+        }
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    const unsigned int & simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_base_variable(const unsigned int & p_index)const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_null(const COEF_TYPE & p_value)
     {
-        assert(p_index < m_nb_total_equations);
-        return m_base_variables[p_index];
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        return !(p_value > l_tolerance) && !(p_value < -l_tolerance);
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::set_base_variable(const unsigned int & p_index,
-                                                                 const unsigned int & p_value
-                                                                ) const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_degenerate_pivot(unsigned int p_equation_index,
+                                                                                   bool p_at_upper_bound
+                                                                                  ) const
     {
-        assert(p_index < m_nb_total_equations);
-        m_base_variables[p_index] = p_value;
+        assert(p_equation_index < m_nb_total_equations);
+        if(!p_at_upper_bound)
+        {
+            // Base variable is already null
+            return is_null(m_array.get_B_coef(p_equation_index));
+        }
+        // Base variable is already at its upper bound
+        unsigned int l_variable_index = m_base_variables[p_equation_index];
+        return is_null(m_upper_bounds[l_variable_index] * get_internal_coef(p_equation_index, l_variable_index) - m_array.get_B_coef(p_equation_index));
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    const unsigned int simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_total_nb_equation(void)const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_bland_output_equation_index(unsigned int p_input_variable_index,
+                                                                                               unsigned int & p_equation_index
+                                                                                              ) const
     {
-        return m_nb_total_equations;
+        if(!is_degenerate_pivot(p_equation_index, get_internal_coef(p_equation_index, p_input_variable_index) < 0))
+        {
+            // Minimum ratio is not null so degenerate equations are not
+            // candidates
+            return;
+        }
+        const COEF_TYPE l_tolerance = simplex_tolerance<COEF_TYPE>::get();
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            COEF_TYPE l_coef = get_internal_coef(l_row_index, p_input_variable_index);
+            unsigned int l_variable_index = m_base_variables[l_row_index];
+            bool l_candidate = (l_coef > l_tolerance && is_degenerate_pivot(l_row_index, false)) ||
+                               (l_coef < -l_tolerance && m_bounded && m_has_upper_bounds[l_variable_index] && is_degenerate_pivot(l_row_index, true));
+            if(l_candidate && l_variable_index < m_base_variables[p_equation_index])
+            {
+                p_equation_index = l_row_index;
+            }
+        }
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::~simplex_solver_base(void)
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::shift_B_coef(unsigned int p_equation_index,
+                                                                            const COEF_TYPE & p_delta
+                                                                           )
     {
-        delete[] m_base_variables_position;
-        delete[] m_base_variables;
-        delete[] m_equation_types;
-        m_equation_types = nullptr;
+        unsigned int l_variable_index = m_unit_columns[p_equation_index];
+        assert(::std::numeric_limits<unsigned int>::max() != l_variable_index);
+        // Column of unit variable is B^-1 e * initial coef so
+        // B^-1 (b + delta e) = B^-1 b + delta * column / initial coef. A
+        // complemented variable has its column negated
+        COEF_TYPE l_delta = m_complemented[l_variable_index] ? -p_delta : p_delta;
+        const COEF_TYPE & l_initial_coef = m_unit_coefs[p_equation_index];
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            COEF_TYPE l_coef = get_internal_coef(l_row_index, l_variable_index);
+            if(COEF_TYPE(0) != l_coef)
+            {
+                m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) + (l_coef * l_delta) / l_initial_coef);
+            }
+        }
+        COEF_TYPE l_z_coef = m_array.get_Z_coef(l_variable_index);
+        if(COEF_TYPE(0) != l_z_coef)
+        {
+            m_array.set_Z0_coef(m_array.get_Z0_coef() + (l_z_coef * l_delta) / l_initial_coef);
+        }
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    unsigned int
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_nb_total_equations() const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::perturb()
     {
-        return m_nb_total_equations;
+        m_perturbations.clear();
+        if(!m_perturbation)
+        {
+            return;
+        }
+        perturb(std::integral_constant<bool, std::is_floating_point<COEF_TYPE>::value>());
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    unsigned int
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_nb_all_variables() const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::perturb(std::false_type)
     {
-        return m_nb_all_variables;
+        assert(false);
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    const ARRAY_TYPE &
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_array() const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::perturb(std::true_type)
     {
-        return m_array;
+        // Large enough to be distinguished from rounding residues, small
+        // enough to be removed by a few dual iterations
+        const COEF_TYPE l_epsilon = COEF_TYPE(1000) * simplex_tolerance<COEF_TYPE>::get();
+        m_perturbations.assign(m_nb_total_equations, COEF_TYPE(0));
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            if(::std::numeric_limits<unsigned int>::max() == m_unit_columns[l_row_index])
+            {
+                continue;
+            }
+            // Deterministic factor in [1, 2) so that equations receive
+            // different perturbations
+            COEF_TYPE l_factor = COEF_TYPE(1) + COEF_TYPE((l_row_index * 7919u) % 1000u) / COEF_TYPE(1000);
+            COEF_TYPE l_delta = l_epsilon * l_factor * (COEF_TYPE(1) + std::abs(m_original_B_coefs[l_row_index] * get_row_scale(l_row_index)));
+            // Variable specific to equation moves away from 0
+            if(m_unit_coefs[l_row_index] < 0)
+            {
+                l_delta = -l_delta;
+            }
+            m_perturbations[l_row_index] = l_delta;
+            shift_B_coef(l_row_index, l_delta);
+        }
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    ARRAY_TYPE &
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_array()
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::remove_perturbation()
     {
-        return m_array;
+        if(m_perturbations.empty())
+        {
+            return false;
+        }
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_perturbations.size();
+            ++l_row_index
+           )
+        {
+            if(COEF_TYPE(0) != m_perturbations[l_row_index])
+            {
+                shift_B_coef(l_row_index, -m_perturbations[l_row_index]);
+            }
+        }
+        m_perturbations.clear();
+        return true;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    unsigned int
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_nb_variables() const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_bounded() const
     {
-        return m_nb_variables;
+        return m_bounded;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    unsigned int
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_nb_base_variables_defined() const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::is_translated() const
     {
-        return m_nb_base_variables_defined;
+        return m_translated;
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    unsigned int
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::get_base_variables_position(unsigned int p_index) const
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::has_upper_bound(unsigned int p_variable_index) const
     {
-        assert(p_index < m_nb_all_variables);
-        return m_base_variables_position[p_index];
+        assert(p_variable_index < m_nb_all_variables);
+        return m_has_upper_bounds[p_variable_index];
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    void
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::set_base_variables_position(unsigned int p_index,
-                                                                           unsigned int p_value
-                                                                          )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    const COEF_TYPE &
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_upper_bound(unsigned int p_variable_index) const
     {
-        assert(p_index < m_nb_all_variables);
-        m_base_variables_position[p_index] = p_value;
+        assert(p_variable_index < m_nb_all_variables);
+        assert(m_has_upper_bounds[p_variable_index]);
+        return m_upper_bounds[p_variable_index];
     }
 
-    //----------------------------------------------------------------------------
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    template <class LISTENER>
-    bool
-    simplex_solver_base<COEF_TYPE,ARRAY_TYPE>::find_max(COEF_TYPE & p_max,
-                                                        bool & p_infinite,
-                                                        LISTENER * p_listener
-                                                       )
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::prepare_bounds()
     {
-        if(m_nb_base_variables_defined != m_nb_total_equations)
+        if(m_bounds_prepared)
         {
-            throw quicky_exception::quicky_runtime_exception("Not enough base variables defined : " + std::to_string(m_nb_base_variables_defined) + " < " + std::to_string(m_nb_total_equations) , __LINE__, __FILE__);
+            return;
         }
+        m_bounds_prepared = true;
+        // x = l + x' with x' >= 0
         for(unsigned int l_index = 0;
-            l_index < m_nb_total_equations;
+            l_index < m_nb_variables;
             ++l_index
-                )
-        {
-            unsigned int l_var_index = m_base_variables[l_index];
-            assert(l_var_index != ::std::numeric_limits<unsigned int>::max());
-            if(m_array.get_Z_coef(l_var_index))
-            {
-                throw quicky_exception::quicky_runtime_exception("Z coef of base variable in column " + std::to_string(l_var_index) + " should be 0 or this is not a base variable", __LINE__, __FILE__);
-            }
-        }
-        p_infinite = false;
-        bool l_input_found = true;
-        unsigned int l_input_variable_index = 0;
-        unsigned int l_nb_iteration = 0;
-        while(true == (l_input_found = get_max_input_variable_index(l_input_variable_index)))
+           )
         {
-            if(p_listener)
+            const COEF_TYPE & l_lower = m_lower_bounds[l_index];
+            if(COEF_TYPE(0) == l_lower)
             {
-                p_listener->start_iteration(l_nb_iteration);
-                p_listener->new_input_var_event(l_input_variable_index);
+                continue;
             }
-            assert(::std::numeric_limits<unsigned int>::max() == m_base_variables_position[l_input_variable_index]);
-            assert(m_array.get_Z_coef(l_input_variable_index));
-            unsigned int l_output_equation_index = 0;
-            if(get_output_equation_index(l_input_variable_index, l_output_equation_index))
+            for(unsigned int l_row_index = 0;
+                l_row_index < m_nb_total_equations;
+                ++l_row_index
+               )
             {
-                unsigned int l_output_variable_index = m_base_variables[l_output_equation_index];
-                if(p_listener)
-                {
-                    p_listener->new_output_var_event(l_output_variable_index);
-                }
-                assert(l_output_equation_index == m_base_variables_position[l_output_variable_index]);
-                assert(!m_array.get_Z_coef(l_output_variable_index));
-                pivot(l_output_equation_index,l_input_variable_index);
-                assert(m_array.get_Z_coef(l_output_variable_index));
-                assert(!m_array.get_Z_coef(l_input_variable_index));
-                m_base_variables_position[l_output_variable_index] = std::numeric_limits<unsigned int>::max();
-                m_base_variables_position[l_input_variable_index] = l_output_equation_index;
-                m_base_variables[l_output_equation_index] = l_input_variable_index;
-
-                if(p_listener)
+                const COEF_TYPE & l_coef = get_internal_coef(l_row_index, l_index);
+                if(COEF_TYPE(0) != l_coef)
                 {
-                    p_listener->new_Z0(m_array.get_Z0_coef());
+                    m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) - l_coef * l_lower);
                 }
             }
-            else
+            m_array.set_Z0_coef(m_array.get_Z0_coef() - m_array.get_Z_coef(l_index) * l_lower);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::complement_variable(unsigned int p_variable_index)
+    {
+        assert(!is_base_variable(p_variable_index));
+        assert(m_has_upper_bounds[p_variable_index]);
+        const COEF_TYPE & l_upper = m_upper_bounds[p_variable_index];
+        // a * x = a * (u - x') = a * u - a * x'
+        for(unsigned int l_row_index = 0;
+            l_row_index < m_nb_total_equations;
+            ++l_row_index
+           )
+        {
+            COEF_TYPE l_coef = get_internal_coef(l_row_index, p_variable_index);
+            if(COEF_TYPE(0) != l_coef)
             {
-                p_infinite = true;
-                return false;
+                m_array.set_B_coef(l_row_index, m_array.get_B_coef(l_row_index) - l_coef * l_upper);
+                set_internal_coef(l_row_index, p_variable_index, -l_coef);
             }
-            ++l_nb_iteration;
         }
-        p_max = m_array.get_Z0_coef();
-        return true;
+        COEF_TYPE l_z_coef = m_array.get_Z_coef(p_variable_index);
+        m_array.set_Z0_coef(m_array.get_Z0_coef() - l_z_coef * l_upper);
+        m_array.set_Z_coef(p_variable_index, -l_z_coef);
+        m_complemented[p_variable_index] = !m_complemented[p_variable_index];
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE,
-              typename ARRAY_TYPE
-             >
-    bool
-    simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::is_base_variable(const unsigned int & p_index) const
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    PRICING_POLICY &
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_pricing_policy()
     {
-        return std::numeric_limits<unsigned int>::max() != m_base_variables_position[p_index];
+        return m_pricing_policy;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE,
-              typename ARRAY_TYPE
-             >
-    bool
-    simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::check_variables(const std::vector<COEF_TYPE> & p_values)
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::pricing_view(const simplex_solver_base & p_solver):
+            m_solver(p_solver),
+            m_null_Z_coef(0)
     {
-        assert(p_values.size() <= m_nb_variables);
-        for(unsigned int l_equation_index = 0;
-            l_equation_index < m_nb_equations;
-            ++l_equation_index
-           )
-        {
-            COEF_TYPE l_sum(0);
-            for(unsigned int l_variable_index = 0;
-                l_variable_index < p_values.size();
-                ++l_variable_index
-               )
-            {
-                l_sum += m_array.get_A_coef(l_equation_index, l_variable_index) * p_values[l_variable_index];
-            }
-            COEF_TYPE l_b_coef = m_array.get_B_coef(l_equation_index);
-            switch(m_equation_types[l_equation_index])
-            {
-                case t_equation_type::UNDEFINED:
-                    throw quicky_exception::quicky_logic_exception("Undefined equation when checking simplex variables", __LINE__, __FILE__);
-                    break;
-                case t_equation_type::EQUATION:
-                    if(l_sum != l_b_coef)
-                    {
-                        return false;
-                    }
-                    break;
-                case t_equation_type::INEQUATION_LT:
-                    if(l_sum > l_b_coef)
-                    {
-                        return false;
-                    }
-                    break;
-                case t_equation_type::INEQUATION_GT:
-                    if(l_sum < l_b_coef)
-                    {
-                        return false;
-                    }
-            }
-        }
-        return true;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
-    std::vector<COEF_TYPE>
-    simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::get_variable_values() const
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::get_nb_all_variables() const
     {
-        std::vector<COEF_TYPE> l_result(m_nb_variables, (COEF_TYPE)0);
-        my_square_matrix<COEF_TYPE> l_matrix(m_nb_total_equations);
-        my_matrix<COEF_TYPE> l_coefs(m_nb_total_equations, 1);
-        // Create Equation system
-        for(unsigned int l_equation_index = 0; l_equation_index < m_nb_total_equations; ++l_equation_index)
-        {
-            for(unsigned int l_variable_index = 0; l_variable_index < m_nb_total_equations; ++l_variable_index)
-            {
-                l_matrix.set_data(l_equation_index, l_variable_index, m_array.get_A_coef(l_equation_index, get_base_variable(l_variable_index)));
-            }
-            l_coefs.set_data(l_equation_index, 0, m_array.get_B_coef(l_equation_index));
-        }
-        my_equation_system<COEF_TYPE> l_equation_system(l_matrix, l_coefs);
+        return m_solver.m_nb_all_variables;
+    }
 
-        my_matrix<COEF_TYPE> l_result_matrix = l_equation_system.solve();
-        assert(l_result_matrix.get_height() == m_nb_total_equations);
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::get_nb_total_equations() const
+    {
+        return m_solver.m_nb_total_equations;
+    }
 
-        // Fill result
-        for(unsigned int l_index = 0; l_index < m_nb_variables; ++l_index)
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    const COEF_TYPE &
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::get_Z_coef(unsigned int p_variable_index) const
+    {
+        // Artificial variables out of base never come back so they are
+        // never seen as improving objective function
+        if(m_solver.is_artificial_variable(p_variable_index) && !m_solver.is_base_variable(p_variable_index))
         {
-            unsigned int l_base_variable_index = get_base_variables_position(l_index);
-            if(l_base_variable_index != ::std::numeric_limits<unsigned int>::max())
-            {
-                l_result[l_index] = l_result_matrix.get_data(l_base_variable_index,0);
-            }
+            return m_null_Z_coef;
         }
-        return l_result;
+        return m_solver.m_array.get_Z_coef(p_variable_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    const COEF_TYPE &
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::get_coef(unsigned int p_equation_index,
+                                                                                      unsigned int p_variable_index
+                                                                                     ) const
+    {
+        return m_solver.get_internal_coef(p_equation_index, p_variable_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::get_base_variable(unsigned int p_equation_index) const
+    {
+        return m_solver.get_base_variable(p_equation_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::pricing_view::is_base_variable(unsigned int p_variable_index) const
+    {
+        return m_solver.is_base_variable(p_variable_index);
     }
 }
 #endif //SIMPLEX_SOLVER_BASE_H
@@ -22,12 +22,16 @@
 #include "simplex_map.h"
 #include "simplex_solver.h"
 #include "simplex_listener_if.h"
+#include "simplex_solve_options.h"
 #include "glpk.h"
 #include <string>
+#include <climits>
+#include <algorithm>
 #include <map>
 #include <cstring>
 #include <cassert>
 #include <vector>
+#include <limits>
 
 namespace simplex
 {
@@ -100,6 +104,56 @@ namespace simplex
                 ,simplex_listener_if<double> *p_listener = NULL
                 );
 
+        /**
+         * Method implementing simplex algorithm to find max optimum solution
+         * within limits of search options. Iteration and time limits are
+         * transmitted to GLPK, cancellation and cutoff make GLPK to be called
+         * iteration by iteration
+         * @param p_max reference on variable receiving optimum, or objective
+         * function value of current base when search is stopped
+         * @param p_options search limits
+         * @param p_listener optional listener to treat iterations information
+         * @return reason why search ended
+         */
+        inline
+        t_solve_status
+        find_max(double & p_max
+                ,const simplex_solve_options<double> & p_options
+                ,simplex_listener_if<double> *p_listener = NULL
+                );
+
+        /**
+         * Method implementing simplex algorithm to find min optimum solution
+         * @param p_min reference on variable where result will be stored
+         * @param p_infinite reference on a boolean value that will receive true if min
+         * is infinite
+         * @param p_listener optional listener to treat iterations information
+         * @return value indicating if a min was found
+         */
+        inline
+        bool
+        find_min(double & p_min
+                ,bool & p_infinite
+                ,simplex_listener_if<double> *p_listener = NULL
+                );
+
+        /**
+         * Method implementing simplex algorithm to find min optimum solution
+         * within limits of search options
+         * @param p_min reference on variable receiving optimum, or objective
+         * function value of current base when search is stopped
+         * @param p_options search limits, search stops on cutoff once
+         * objective function is lower or equal to cutoff
+         * @param p_listener optional listener to treat iterations information
+         * @return reason why search ended
+         */
+        inline
+        t_solve_status
+        find_min(double & p_min
+                ,const simplex_solve_options<double> & p_options
+                ,simplex_listener_if<double> *p_listener = NULL
+                );
+
         /**
          * Return values of variable at current iteration
          * @return
@@ -107,6 +161,22 @@ namespace simplex
         inline
         std::vector<double> get_variable_values() const override;
 
+        /**
+         * Return dual value of each equation computed by GLPK for last
+         * search. Not available when MIP solver is used
+         * @return dual value of each equation
+         */
+        inline
+        std::vector<double> get_dual_values() const;
+
+        /**
+         * Return reduced cost of each variable computed by GLPK for last
+         * search. Not available when MIP solver is used
+         * @return reduced cost of each variable
+         */
+        inline
+        std::vector<double> get_reduced_costs() const;
+
         /**
          * Supposed to display array content
          * @param p_stream
@@ -150,6 +220,22 @@ namespace simplex
          bool is_mip_used();
 
       private:
+        /**
+         * Call GLPK to find optimum solution within limits of search options
+         * @param p_optimum reference on variable receiving optimum
+         * @param p_options search limits
+         * @param p_listener optional listener to treat iterations information
+         * @param p_direction GLP_MAX or GLP_MIN
+         * @return reason why search ended
+         */
+        inline
+        t_solve_status
+        solve(double & p_optimum
+             ,const simplex_solve_options<double> & p_options
+             ,simplex_listener_if<double> *p_listener
+             ,int p_direction
+             );
+
         /**
          * Method to intercept terminal output from GLPK
          * @param p_info additional info provided when registering hook ( this)
@@ -168,6 +254,26 @@ namespace simplex
         inline
         void treat_message(const std::string & p_msg);
 
+        /**
+         * Callback called by GLPK MIP solver to check cancellation, cutoff
+         * and iteration limit. In MIP mode an iteration is the search of a
+         * subproblem of branch and bound tree
+         * @param p_tree branch and bound tree
+         * @param p_info additional info provided when registering callback ( this)
+         */
+        static inline
+        void mip_callback(glp_tree * p_tree
+                         ,void * p_info
+                         );
+
+        /**
+         * Convert remaining time of search in GLPK time limit
+         * @param p_control search control
+         * @return time limit in milliseconds
+         */
+        static inline
+        int get_time_limit(const simplex_solve_control<double> & p_control);
+
         static inline
         int convert(const simplex::equation_type & p_equation_type);
 
@@ -192,7 +298,25 @@ namespace simplex
         simplex_listener_if<double> * m_listener;
 
         /**
-         * Store iteration number
+         * Limits of current search
+         * Member value to be accessible from mip_callback method
+         */
+        const simplex_solve_control<double> * m_control;
+
+        /**
+         * Reason why search was stopped by limits checks, OPTIMAL if not
+         * stopped
+         */
+        t_solve_status m_stop_status;
+
+        /**
+         * 1 when searching max, -1 when searching min so that cutoff is
+         * always checked as a lower bound
+         */
+        double m_objective_sign;
+
+        /**
+         * Store iteration number, number of subproblems searched in MIP mode
          */
         uint64_t m_iteration;
 
@@ -229,6 +353,9 @@ namespace simplex
             , m_nb_variables(p_nb_variables)
             , m_prepared(false)
             , m_listener(nullptr)
+            , m_control(nullptr)
+            , m_stop_status(t_solve_status::OPTIMAL)
+            , m_objective_sign(1)
             , m_iteration(0)
 #ifdef SIMPLEX_SELF_TEST
             , m_my_solver(p_nb_variables, p_nb_inequations_lt, p_nb_equations, p_nb_inequations_gt)
@@ -324,6 +451,59 @@ namespace simplex
                                  ,simplex_listener_if<double> *p_listener
                                  )
     {
+        simplex_solve_options<double> l_options;
+        t_solve_status l_status = find_max(p_max, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    t_solve_status
+    simplex_solver_glpk::find_max(double & p_max
+                                 ,const simplex_solve_options<double> & p_options
+                                 ,simplex_listener_if<double> *p_listener
+                                 )
+    {
+        return solve(p_max, p_options, p_listener, GLP_MAX);
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    simplex_solver_glpk::find_min(double & p_min
+                                 ,bool & p_infinite
+                                 ,simplex_listener_if<double> *p_listener
+                                 )
+    {
+        simplex_solve_options<double> l_options;
+        t_solve_status l_status = find_min(p_min, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    t_solve_status
+    simplex_solver_glpk::find_min(double & p_min
+                                 ,const simplex_solve_options<double> & p_options
+                                 ,simplex_listener_if<double> *p_listener
+                                 )
+    {
+        return solve(p_min, p_options, p_listener, GLP_MIN);
+    }
+
+    //-------------------------------------------------------------------------
+    t_solve_status
+    simplex_solver_glpk::solve(double & p_optimum
+                              ,const simplex_solve_options<double> & p_options
+                              ,simplex_listener_if<double> *p_listener
+                              ,int p_direction
+                              )
+    {
+        m_objective_sign = GLP_MAX == p_direction ? 1.0 : -1.0;
+        simplex_solve_options<double> l_options(p_options);
+        l_options.m_cutoff = m_objective_sign * p_options.m_cutoff;
+        simplex_solve_control<double> l_control(l_options);
+        m_control = &l_control;
+        m_stop_status = t_solve_status::OPTIMAL;
         m_listener = p_listener;
         m_iteration = 0;
         if(!m_prepared)
@@ -384,7 +564,7 @@ namespace simplex
             delete[] l_variable_index_list;
             delete[] l_coef_list;
         }
-        glp_set_obj_dir(m_problem, GLP_MAX);
+        glp_set_obj_dir(m_problem, p_direction);
 
         glp_iocp l_mip_solver_parameter;
         glp_smcp l_solver_parameters;
@@ -420,8 +600,45 @@ namespace simplex
             }
         }
 
+        if(m_use_mip)
+        {
+            if(p_options.m_cancel || p_options.m_use_cutoff || std::numeric_limits<unsigned int>::max() != p_options.m_iteration_limit)
+            {
+                l_mip_solver_parameter.cb_func = simplex_solver_glpk::mip_callback;
+                l_mip_solver_parameter.cb_info = this;
+            }
+        }
+        else if(p_options.m_cancel || p_options.m_use_cutoff)
+        {
+            // Cancellation and cutoff are checked between iterations
+            l_solver_parameters.it_lim = 1;
+        }
+        else if(1 != l_solver_parameters.it_lim)
+        {
+            l_solver_parameters.it_lim = (int)std::min(p_options.m_iteration_limit, (unsigned int)INT_MAX);
+        }
+        bool l_step_mode = !m_use_mip && 1 == l_solver_parameters.it_lim;
+
+        unsigned int l_nb_iteration = 0;
         do
         {
+            if(!m_use_mip)
+            {
+                if(l_control.must_stop(l_nb_iteration, m_stop_status))
+                {
+                    break;
+                }
+                if(GLP_FEAS == glp_get_status(m_problem) && l_control.is_cutoff_reached(m_objective_sign * glp_get_obj_val(m_problem)))
+                {
+                    m_stop_status = t_solve_status::CUTOFF;
+                    break;
+                }
+                l_solver_parameters.tm_lim = get_time_limit(l_control);
+            }
+            else
+            {
+                l_mip_solver_parameter.tm_lim = get_time_limit(l_control);
+            }
             int l_return = m_use_mip ? glp_intopt(m_problem, &l_mip_solver_parameter) : glp_simplex(m_problem, &l_solver_parameters);
             std::cout << "Solver return \"" << return_to_string(l_return) << "\"" << std::endl;
             if(m_listener)
@@ -431,23 +648,52 @@ namespace simplex
 #ifdef DEBUG_SIMPLEX_SOLVER_GLPK
             std::cout << "STATUS= " << status_to_string(m_use_mip ? glp_mip_status(m_problem) : glp_get_status(m_problem)) << std::endl;
 #endif // DEBUG_SIMPLEX_SOLVER_GLPK
+            if(GLP_ETMLIM == l_return)
+            {
+                m_stop_status = t_solve_status::TIME_LIMIT;
+                break;
+            }
+            if(GLP_ESTOP == l_return)
+            {
+                // Status was set by mip_callback
+                break;
+            }
+            if(!l_step_mode && GLP_EITLIM == l_return)
+            {
+                m_stop_status = t_solve_status::ITERATION_LIMIT;
+                break;
+            }
+            ++l_nb_iteration;
         }
         while(GLP_FEAS == glp_get_status(m_problem) || GLP_INFEAS == glp_get_status(m_problem));
+        t_solve_status l_status = m_stop_status;
+        if(t_solve_status::OPTIMAL == l_status)
+        {
+            if(GLP_UNBND == glp_get_status(m_problem))
+            {
+                l_status = t_solve_status::UNBOUNDED;
+            }
+            else if(GLP_NOFEAS == glp_get_status(m_problem) || (m_use_mip && GLP_NOFEAS == glp_mip_status(m_problem)))
+            {
+                l_status = t_solve_status::INFEASIBLE;
+            }
+        }
         if(m_use_mip)
         {
-            p_max = glp_mip_obj_val(m_problem);
+            p_optimum = glp_mip_obj_val(m_problem);
             if (p_listener)
             {
-                p_listener->new_Z0(p_max);
+                p_listener->new_Z0(p_optimum);
             }
         }
         else
         {
-            p_max = glp_get_obj_val(m_problem);
+            p_optimum = glp_get_obj_val(m_problem);
         }
         m_listener = NULL;
+        m_control = NULL;
         glp_term_hook(NULL, NULL);
-        return true;
+        return l_status;
     }
 
     //-------------------------------------------------------------------------
@@ -544,6 +790,45 @@ namespace simplex
         return 1;
     }
 
+    //-------------------------------------------------------------------------
+    void
+    simplex_solver_glpk::mip_callback(glp_tree * p_tree
+                                     ,void * p_info
+                                     )
+    {
+        simplex_solver_glpk & l_solver = *static_cast<simplex_solver_glpk*>(p_info);
+        assert(l_solver.m_control);
+        const simplex_solve_options<double> & l_options = l_solver.m_control->get_options();
+        if(l_options.m_cancel && l_options.m_cancel->load(std::memory_order_relaxed))
+        {
+            l_solver.m_stop_status = t_solve_status::CANCELLED;
+            glp_ios_terminate(p_tree);
+        }
+        else if(GLP_IBINGO == glp_ios_reason(p_tree) && l_solver.m_control->is_cutoff_reached(l_solver.m_objective_sign * glp_mip_obj_val(glp_ios_get_prob(p_tree))))
+        {
+            l_solver.m_stop_status = t_solve_status::CUTOFF;
+            glp_ios_terminate(p_tree);
+        }
+        else if(GLP_IPREPRO == glp_ios_reason(p_tree))
+        {
+            // Each subproblem is preprocessed once before being searched
+            if(l_solver.m_iteration >= l_options.m_iteration_limit)
+            {
+                l_solver.m_stop_status = t_solve_status::ITERATION_LIMIT;
+                glp_ios_terminate(p_tree);
+            }
+            ++l_solver.m_iteration;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    int
+    simplex_solver_glpk::get_time_limit(const simplex_solve_control<double> & p_control)
+    {
+        std::chrono::milliseconds l_remaining = std::chrono::duration_cast<std::chrono::milliseconds>(p_control.get_remaining_time());
+        return (int)std::min(l_remaining.count(), (std::chrono::milliseconds::rep)INT_MAX);
+    }
+
     //-------------------------------------------------------------------------
     void
     simplex_solver_glpk::treat_message(const std::string & p_msg)
@@ -621,6 +906,46 @@ namespace simplex
         return l_result;
     }
 
+    //-------------------------------------------------------------------------
+    std::vector<double>
+    simplex_solver_glpk::get_dual_values() const
+    {
+        assert(m_problem);
+        if(m_use_mip)
+        {
+            throw quicky_exception::quicky_logic_exception("Dual values are not available with MIP solver", __LINE__, __FILE__);
+        }
+        std::vector<double> l_result;
+        for(unsigned int l_index = 0;
+            l_index < m_nb_equations;
+            ++l_index
+           )
+        {
+            l_result.push_back(glp_get_row_dual(m_problem, 1 + l_index));
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    std::vector<double>
+    simplex_solver_glpk::get_reduced_costs() const
+    {
+        assert(m_problem);
+        if(m_use_mip)
+        {
+            throw quicky_exception::quicky_logic_exception("Reduced costs are not available with MIP solver", __LINE__, __FILE__);
+        }
+        std::vector<double> l_result;
+        for(unsigned int l_index = 0;
+            l_index < m_nb_variables;
+            ++l_index
+           )
+        {
+            l_result.push_back(glp_get_col_dual(m_problem, 1 + l_index));
+        }
+        return l_result;
+    }
+
     //-------------------------------------------------------------------------
     std::ostream &
     simplex_solver_glpk::display_array(std::ostream & p_stream) const
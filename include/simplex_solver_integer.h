@@ -23,8 +23,8 @@
 
 namespace simplex
 {
-    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>>
-    class simplex_solver_integer: public simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>, typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
+    class simplex_solver_integer: public simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>
     {
 
       public:
@@ -40,6 +40,8 @@ namespace simplex
         /**
          * Method performing pivot to change the base
          * The A coefficient A[row,column] should be !0
+         * Products are checked and simplex_overflow_exception is thrown when
+         * they do not fit in coefficient type, array is then inconsistent
          * @param p_row_index Row index
          * @param p_column_index Column index
          * */
@@ -50,11 +52,11 @@ namespace simplex
     };
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     void
-    simplex_solver_integer<COEF_TYPE,ARRAY_TYPE>::pivot(const unsigned int p_row_index,
-                                                        const unsigned int p_column_index
-                                                       )
+    simplex_solver_integer<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index,
+                                                                       const unsigned int p_column_index
+                                                                      )
     {
         assert(p_row_index < this->get_nb_total_equations());
         assert(p_column_index < this->get_nb_all_variables());
@@ -69,124 +71,77 @@ namespace simplex
             std::cout << "Z line <= (Z * " << l_pivot << ") - (R[" << p_row_index << "] * " << l_q << ")" << std::endl;
         }
 #endif // DEBUG_SIMPLEX
-        COEF_TYPE l_pgcd = 0;
-        COEF_TYPE l_new_coef = 0;
         for(unsigned int l_index = 0;
             l_index < this->get_nb_all_variables();
             ++l_index
                 )
         {
             COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
-            l_new_coef = this->get_array().get_Z_coef(l_index) * l_pivot - l_q * l_u;
-            this->accumulate_PGCD(l_pgcd, l_new_coef);
-            this->get_array().set_Z_coef(l_index, l_new_coef);
+            this->get_array().set_Z_coef(l_index, checked_mul_sub(this->get_array().get_Z_coef(l_index), l_pivot, l_q, l_u));
         }
         assert(!this->get_array().get_Z_coef(p_column_index));
-        l_new_coef = this->get_array().get_Z0_coef() * l_pivot - l_q * this->get_array().get_B_coef(p_row_index);
-        this->accumulate_PGCD(l_pgcd, l_new_coef);
-        this->get_array().set_Z0_coef(l_new_coef);
+        this->get_array().set_Z0_coef(checked_mul_sub(this->get_array().get_Z0_coef(), l_pivot, l_q, this->get_array().get_B_coef(p_row_index)));
 
         // Divide Z row by PGCD if necessary
+        COEF_TYPE l_pgcd = this->get_Z_row_PGCD();
         if(l_pgcd > 1)
         {
-#ifdef DEBUG_SIMPLEX
-            std::cout << "Z line <= Z / " << l_pgcd << std::endl;
-#endif //DEBUG_SIMPLEX
-            for (unsigned int l_index = 0;
-                 l_index < this->get_nb_all_variables();
-                 ++l_index
-                    )
-            {
-                this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) / l_pgcd);
-            }
-            this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() / l_pgcd);
+            this->divide_Z_row(l_pgcd);
         }
         // Pivoting other rows
-        for(unsigned int l_row_index = 0;
-            l_row_index < this->get_nb_total_equations();
-            ++l_row_index
-                )
-        {
-            if(l_row_index != p_row_index)
-            {
-                COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
+        this->for_each_row(this->get_nb_total_equations(),
+                           [&](unsigned int l_row_index)
+                           {
+                               if(l_row_index == p_row_index)
+                               {
+                                   return;
+                               }
+                               COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
 #ifdef DEBUG_SIMPLEX
-                if(l_pivot != 1 || l_q)
-                {
-                    std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] * " << l_pivot << ") - (R["
-                              << p_row_index << "] * " << l_q << ")" << std::endl;
-                }
+                               if(l_pivot != 1 || l_q)
+                               {
+                                   std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] * " << l_pivot << ") - (R["
+                                             << p_row_index << "] * " << l_q << ")" << std::endl;
+                               }
 #endif //DEBUG_SIMPLEX
-                l_pgcd = 0;
-                l_new_coef = this->get_array().get_B_coef(l_row_index) * l_pivot - l_q * this->get_array().get_B_coef(p_row_index);
-                this->accumulate_PGCD(l_pgcd, l_new_coef);
-                this->get_array().set_B_coef(l_row_index, l_new_coef);
-                for (unsigned int l_index = 0;
-                     l_index < this->get_nb_all_variables();
-                     ++l_index
-                    )
-                {
-                    COEF_TYPE l_u = this->get_internal_coef(p_row_index, l_index);
-                    l_new_coef = this->get_internal_coef(l_row_index,l_index) * l_pivot - l_q * l_u;
-                    this->accumulate_PGCD(l_pgcd, l_new_coef);
-                    this->set_internal_coef(l_row_index, l_index, l_new_coef);
-                }
-
-                    if (l_pgcd > 1)
-                    {
-#ifdef DEBUG_SIMPLEX
-                        std::cout << "R[" << l_row_index << "] <= R[" << l_row_index << "] / " << l_pgcd << std::endl;
-#endif //DEBUG_SIMPLEX
-                        for (unsigned int l_index = 0;
-                             l_index < this->get_nb_all_variables();
-                             ++l_index
-                            )
-                        {
-                            this->set_internal_coef(l_row_index, l_index, this->get_internal_coef(l_row_index, l_index) / l_pgcd);
-                        }
-                        this->get_array().set_B_coef(l_row_index, this->get_array().get_B_coef(l_row_index) / l_pgcd);
-                    }
-            }
-        }
+                               this->get_array().set_B_coef(l_row_index, checked_mul_sub(this->get_array().get_B_coef(l_row_index), l_pivot, l_q, this->get_array().get_B_coef(p_row_index)));
+                               for (unsigned int l_index = 0;
+                                    l_index < this->get_nb_all_variables();
+                                    ++l_index
+                                   )
+                               {
+                                   COEF_TYPE l_u = this->get_internal_coef(p_row_index, l_index);
+                                   this->set_internal_coef(l_row_index, l_index, checked_mul_sub(this->get_internal_coef(l_row_index,l_index), l_pivot, l_q, l_u));
+                               }
+
+                               COEF_TYPE l_pgcd = this->get_row_PGCD(l_row_index);
+                               if (l_pgcd > 1)
+                               {
+                                   this->divide_row(l_row_index, l_pgcd);
+                               }
+                           }
+                          );
 
         // Particular case of pivot row
-        l_pgcd = 0;
-        for(unsigned int l_index = 0;
-            l_index < this->get_nb_variables();
-            ++l_index
-           )
-        {
-            this->accumulate_PGCD(l_pgcd,this->get_internal_coef(p_row_index, l_index));
-        }
-        this->accumulate_PGCD(l_pgcd,this->get_array().get_B_coef(p_row_index));
+        l_pgcd = this->get_row_PGCD(p_row_index);
         if(l_pgcd > 1)
         {
-#ifdef DEBUG_SIMPLEX
-            std::cout << "R[" << p_row_index << "] <= R[" << p_row_index << "] / " << l_pgcd << std::endl;
-#endif //DEBUG_SIMPLEX
-            for(unsigned int l_index = 0;
-                l_index < this->get_nb_variables();
-                ++l_index
-               )
-            {
-                this->set_internal_coef(p_row_index,l_index,this->get_internal_coef(p_row_index,l_index) / l_pgcd);
-            }
-            this->get_array().set_B_coef(p_row_index, this->get_array().get_B_coef(p_row_index) / l_pgcd);
+            this->divide_row(p_row_index, l_pgcd);
         }
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
-    simplex_solver_integer<COEF_TYPE,ARRAY_TYPE>::simplex_solver_integer(unsigned int p_nb_variables,
-                                                                         unsigned int p_nb_inequations_lt,
-                                                                         unsigned int p_nb_equations,
-                                                                         unsigned int p_nb_inequations_gt
-                                                                        ):
-    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE>(p_nb_variables,
-                                                     p_nb_inequations_lt,
-                                                     p_nb_equations,
-                                                     p_nb_inequations_gt
-                                                     )
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    simplex_solver_integer<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::simplex_solver_integer(unsigned int p_nb_variables,
+                                                                                        unsigned int p_nb_inequations_lt,
+                                                                                        unsigned int p_nb_equations,
+                                                                                        unsigned int p_nb_inequations_gt
+                                                                                       ):
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>(p_nb_variables,
+                                                                    p_nb_inequations_lt,
+                                                                    p_nb_equations,
+                                                                    p_nb_inequations_gt
+                                                                    )
     {
         static_assert(std::is_integral<COEF_TYPE>::value, "Simplex solver acccept only integer types");
         static_assert(std::is_signed<COEF_TYPE>::value, "Simplex solver acccept only signed types");
@@ -0,0 +1,344 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_SOLVER_INTEGER_BAREISS_H
+#define SIMPLEX_SOLVER_INTEGER_BAREISS_H
+
+#include "simplex_array.h"
+#include "simplex_solver_integer_base.h"
+#include <vector>
+#include <limits>
+
+namespace simplex
+{
+    /**
+     * Integer simplex solver using Bareiss fraction free pivots:
+     * R[i] <= (pivot * R[i] - R[i][column] * R[row]) / previous pivot
+     * The division by previous pivot is exact as long as rows keep the
+     * common denominator introduced by previous pivots so no PGCD reduction
+     * is needed and coefficients stay bounded by basis determinants.
+     * Rows scaled outside of pivots ( objective restored after first phase,
+     * constraints added after a solve ) are detected when division is not
+     * exact and are then reduced by their PGCD like in PPCM solver
+     */
+    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>, typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
+    class simplex_solver_integer_bareiss: public simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>
+    {
+      public:
+        simplex_solver_integer_bareiss() = delete;
+
+        simplex_solver_integer_bareiss(unsigned int p_nb_variables
+                                      ,unsigned int p_nb_inequations_lt
+                                      ,unsigned int p_nb_equations
+                                      ,unsigned int p_nb_inequations_gt
+                                      );
+
+        /**
+         * Absolute value of previous pivot used as divider by next pivot
+         * @return current common denominator of rows
+         */
+        inline
+        COEF_TYPE
+        get_divider() const;
+
+      private:
+        /**
+         * Method performing pivot to change the base
+         * The A coefficient A[row,column] should be !0
+         * @param p_row_index Row index
+         * @param p_column_index Column index
+         * */
+        inline void pivot(const unsigned int p_row_index,
+                          const unsigned int p_column_index
+                         ) override ;
+
+        /**
+         * Replace a row by (p_pivot * row - p_q * pivot row) / divider
+         * Index get_nb_all_variables() designates B coefficient ( Z0 for
+         * objective row )
+         * If division is not exact the row is kept multiplied and divided
+         * by PGCD of its coefficients
+         * @param p_row_index index of pivot row
+         * @param p_pivot absolute value of pivot
+         * @param p_q multiplier of pivot row
+         * @param p_get accessor returning coefficient of updated row
+         * @param p_set accessor setting coefficient of updated row
+         */
+        template <typename GETTER, typename SETTER>
+        void
+        eliminate(unsigned int p_row_index
+                 ,const COEF_TYPE & p_pivot
+                 ,const COEF_TYPE & p_q
+                 ,const GETTER & p_get
+                 ,const SETTER & p_set
+                 );
+
+        /**
+         * Coefficient of pivot row
+         * @param p_row_index index of pivot row
+         * @param p_index index of variable, get_nb_all_variables() for B
+         * @return coefficient of pivot row
+         */
+        inline
+        COEF_TYPE
+        get_pivot_row_coef(unsigned int p_row_index
+                          ,unsigned int p_index
+                          ) const;
+
+        /**
+         * Absolute value of previous pivot, all rows updated by pivots
+         * share this denominator
+         */
+        COEF_TYPE m_divider;
+
+        /**
+         * Index of variables with non null coefficient in pivot row
+         */
+        std::vector<unsigned int> m_pivot_row_pattern;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    simplex_solver_integer_bareiss<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::simplex_solver_integer_bareiss(unsigned int p_nb_variables
+                                                                                                       ,unsigned int p_nb_inequations_lt
+                                                                                                       ,unsigned int p_nb_equations
+                                                                                                       ,unsigned int p_nb_inequations_gt
+                                                                                                       )
+    :simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>(p_nb_variables
+                                                                     ,p_nb_inequations_lt
+                                                                     ,p_nb_equations
+                                                                     ,p_nb_inequations_gt
+                                                                     )
+    ,m_divider(1)
+    {
+        static_assert(std::is_integral<COEF_TYPE>::value, "Simplex solver acccept only integer types");
+        static_assert(std::is_signed<COEF_TYPE>::value, "Simplex solver acccept only signed types");
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_bareiss<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_divider() const
+    {
+        return m_divider;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_bareiss<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_pivot_row_coef(unsigned int p_row_index
+                                                                                           ,unsigned int p_index
+                                                                                           ) const
+    {
+        return p_index < this->get_nb_all_variables() ? this->get_internal_coef(p_row_index, p_index) : this->get_array().get_B_coef(p_row_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <typename GETTER, typename SETTER>
+    void
+    simplex_solver_integer_bareiss<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::eliminate(unsigned int p_row_index
+                                                                                  ,const COEF_TYPE & p_pivot
+                                                                                  ,const COEF_TYPE & p_q
+                                                                                  ,const GETTER & p_get
+                                                                                  ,const SETTER & p_set
+                                                                                  )
+    {
+        unsigned int l_nb_coefs = this->get_nb_all_variables() + 1;
+        bool l_exact = true;
+        COEF_TYPE l_pgcd = 0;
+        // Pivot row pattern is sorted so it can be merged with dense scan.
+        // B coefficient is not part of pattern and handled at last index
+        unsigned int l_pattern_index = 0;
+        for(unsigned int l_index = 0;
+            l_index < l_nb_coefs;
+            ++l_index
+           )
+        {
+            COEF_TYPE l_coef = p_get(l_index);
+            COEF_TYPE l_u = 0;
+            if(l_index == l_nb_coefs - 1)
+            {
+                l_u = get_pivot_row_coef(p_row_index, l_index);
+            }
+            else if(l_pattern_index < m_pivot_row_pattern.size() && m_pivot_row_pattern[l_pattern_index] == l_index)
+            {
+                l_u = this->get_internal_coef(p_row_index, l_index);
+                ++l_pattern_index;
+            }
+            if(!l_coef && (!l_u || !p_q))
+            {
+                continue;
+            }
+            COEF_TYPE l_new_coef = checked_mul_sub(l_coef, p_pivot, l_u, p_q);
+            if(l_exact)
+            {
+                COEF_TYPE l_quotient = l_new_coef / m_divider;
+                if(l_quotient * m_divider == l_new_coef)
+                {
+                    p_set(l_index, l_quotient);
+                    continue;
+                }
+                // Row does not share common denominator: restore coefficients
+                // already divided and fall back on PGCD reduction
+                l_exact = false;
+                for(unsigned int l_previous_index = 0;
+                    l_previous_index < l_index;
+                    ++l_previous_index
+                   )
+                {
+                    COEF_TYPE l_previous_coef = p_get(l_previous_index);
+                    if(l_previous_coef)
+                    {
+                        l_previous_coef = checked_mul(l_previous_coef, m_divider);
+                        p_set(l_previous_index, l_previous_coef);
+                        this->accumulate_PGCD(l_pgcd, l_previous_coef);
+                    }
+                }
+            }
+            p_set(l_index, l_new_coef);
+            if(l_new_coef)
+            {
+                this->accumulate_PGCD(l_pgcd, l_new_coef);
+            }
+        }
+
+        if(!l_exact && l_pgcd > 1)
+        {
+            for(unsigned int l_index = 0;
+                l_index < l_nb_coefs;
+                ++l_index
+               )
+            {
+                COEF_TYPE l_coef = p_get(l_index);
+                if(l_coef)
+                {
+                    p_set(l_index, l_coef / l_pgcd);
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_bareiss<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index
+                                                                              ,const unsigned int p_column_index
+                                                                              )
+    {
+        assert(p_row_index < this->get_nb_total_equations());
+        assert(p_column_index < this->get_nb_all_variables());
+        COEF_TYPE l_pivot = this->get_internal_coef(p_row_index,p_column_index);
+        assert(l_pivot);
+
+        // Rows are multiplied by absolute value of pivot so that Z row scale
+        // and base coefficients stay positive. Sign of pivot is reported on
+        // pivot row multiplier
+        bool l_negative = l_pivot < 0;
+        COEF_TYPE l_abs_pivot = l_negative ? -l_pivot : l_pivot;
+
+        this->collect_row_pattern(p_row_index, m_pivot_row_pattern);
+
+        // Pivoting Z
+        COEF_TYPE l_q = this->get_array().get_Z_coef(p_column_index);
+#ifdef DEBUG_SIMPLEX
+        std::cout << "Z line <= ((Z * " << l_abs_pivot << ") - (R[" << p_row_index << "] * " << (l_negative ? -l_q : l_q) << ")) / " << m_divider << std::endl;
+#endif //DEBUG_SIMPLEX
+        if(l_q || l_abs_pivot != m_divider)
+        {
+            eliminate(p_row_index
+                     ,l_abs_pivot
+                     ,l_negative ? -l_q : l_q
+                     ,[&](unsigned int p_index) -> COEF_TYPE
+                      {
+                          return p_index < this->get_nb_all_variables() ? this->get_array().get_Z_coef(p_index) : this->get_array().get_Z0_coef();
+                      }
+                     ,[&](unsigned int p_index, const COEF_TYPE & p_value)
+                      {
+                          if(p_index < this->get_nb_all_variables())
+                          {
+                              this->get_array().set_Z_coef(p_index, p_value);
+                          }
+                          else
+                          {
+                              this->get_array().set_Z0_coef(p_value);
+                          }
+                      }
+                     );
+        }
+        assert(!this->get_array().get_Z_coef(p_column_index));
+
+        // Pivoting other rows. Rows with null coefficient in pivot column are
+        // only rescaled to common denominator, untouched if it does not change
+        this->for_each_row(this->get_nb_total_equations(),
+                           [&](unsigned int p_row)
+                           {
+                               if(p_row == p_row_index)
+                               {
+                                   return;
+                               }
+                               COEF_TYPE l_row_q = this->get_internal_coef(p_row, p_column_index);
+                               if(!l_row_q && l_abs_pivot == m_divider)
+                               {
+                                   return;
+                               }
+#ifdef DEBUG_SIMPLEX
+                               std::cout << "R[" << p_row << "] <= ((R[" << p_row << "] * " << l_abs_pivot << ") - (R["
+                                         << p_row_index << "] * " << (l_negative ? -l_row_q : l_row_q) << ")) / " << m_divider << std::endl;
+#endif //DEBUG_SIMPLEX
+                               eliminate(p_row_index
+                                        ,l_abs_pivot
+                                        ,l_negative ? -l_row_q : l_row_q
+                                        ,[&](unsigned int p_index) -> COEF_TYPE
+                                         {
+                                             return p_index < this->get_nb_all_variables() ? this->get_internal_coef(p_row, p_index) : this->get_array().get_B_coef(p_row);
+                                         }
+                                        ,[&](unsigned int p_index, const COEF_TYPE & p_value)
+                                         {
+                                             if(p_index < this->get_nb_all_variables())
+                                             {
+                                                 this->set_internal_coef(p_row, p_index, p_value);
+                                             }
+                                             else
+                                             {
+                                                 this->get_array().set_B_coef(p_row, p_value);
+                                             }
+                                         }
+                                        );
+                               assert(!this->get_internal_coef(p_row, p_column_index));
+                           }
+                          );
+
+        // Pivot row keeps its coefficients which are now expressed with
+        // pivot as denominator
+        if(l_negative)
+        {
+#ifdef DEBUG_SIMPLEX
+            std::cout << "R[" << p_row_index << "] <= -R[" << p_row_index << "]" << std::endl;
+#endif //DEBUG_SIMPLEX
+            for(auto l_index: m_pivot_row_pattern)
+            {
+                this->set_internal_coef(p_row_index, l_index, -this->get_internal_coef(p_row_index, l_index));
+            }
+            this->get_array().set_B_coef(p_row_index, -this->get_array().get_B_coef(p_row_index));
+        }
+        m_divider = l_abs_pivot;
+    }
+}
+
+#endif //SIMPLEX_SOLVER_INTEGER_BAREISS_H
+// EOF
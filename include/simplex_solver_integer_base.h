@@ -19,12 +19,13 @@
 #define SIMPLEX_SOLVER_INTEGER_BASE_H
 
 #include "simplex_solver_base.h"
+#include "simplex_gcd_kernel.h"
 #include "fract.h"
 
 namespace simplex
 {
-    template <typename COEF_TYPE,typename ARRAY_TYPE>
-    class simplex_solver_integer_base: public simplex_solver_base<COEF_TYPE, ARRAY_TYPE>
+    template <typename COEF_TYPE,typename ARRAY_TYPE,typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
+    class simplex_solver_integer_base: public simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>
     {
 
       public:
@@ -36,12 +37,42 @@ namespace simplex
                                     unsigned int p_nb_inequations_gt
                                    );
 
-        ~simplex_solver_integer_base();
-
         void set_Z_coef(const unsigned int p_index,
                         const COEF_TYPE & p_value
                        );
 
+        /**
+         * Add a variable after existing ones. Z row is scaled by pivots so
+         * that Z coefficient of a new variable cannot be expressed in current
+         * base: variables can only be added before search
+         * @param p_Z_coef value of coefficient in the formula Z = SUM(Cj * x)
+         * @param p_coefs coefficient of new variable in each equation
+         * @return index of new variable
+         */
+        unsigned int
+        add_variable(const COEF_TYPE & p_Z_coef,
+                     const std::vector<COEF_TYPE> & p_coefs
+                    );
+
+        /**
+         * Base columns are null outside of their row so values are directly
+         * computed as B / base coefficient. Solving base equation system
+         * would overflow as it multiplies base coefficients
+         * @return variable values of current base
+         */
+        std::vector<COEF_TYPE> get_variable_values() const override;
+
+        /**
+         * Variable bounds are not supported by integer solvers so variable
+         * is fixed by a pair of inequations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param p_value value of variable
+         */
+        void
+        fix_variable(const unsigned int p_variable_index,
+                     const COEF_TYPE & p_value
+                    ) override;
+
         /**
                  Method implementing simplex algorithm to find max optimum solution
                  The problem must be in solved form
@@ -57,6 +88,63 @@ namespace simplex
                  LISTENER * p_listener = NULL
                 );
 
+        /**
+                 Method implementing simplex algorithm to find max optimum solution
+                 within limits of search options
+                 @param reference on variable where result will be stored
+                 @param p_options search limits
+                 @return reason why search ended
+                 */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_max(COEF_TYPE & p_max,
+                 const simplex_solve_options<COEF_TYPE> & p_options,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+                 Method implementing simplex algorithm to find min optimum solution
+                 @param reference on variable where result will be stored
+                 @param reference on a boolean value that will receive true if min
+                 is infinite
+                 @return value indicating if a min was found
+                 */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_min(COEF_TYPE & p_min,
+                 bool & p_infinite,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+                 Method implementing simplex algorithm to find min optimum solution
+                 within limits of search options
+                 @param reference on variable where result will be stored
+                 @param p_options search limits
+                 @return reason why search ended
+                 */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        t_solve_status
+        find_min(COEF_TYPE & p_min,
+                 const simplex_solve_options<COEF_TYPE> & p_options,
+                 LISTENER * p_listener = NULL
+                );
+
+        /**
+                 Method implementing dual simplex algorithm to find max optimum
+                 solution from a dual feasible base
+                 @param reference on variable where result will be stored
+                 @param reference on a boolean value that will receive true if
+                 problem has no feasible solution
+                 @return value indicating if a max was found
+                 */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_max_dual(COEF_TYPE & p_max,
+                      bool & p_infeasible,
+                      LISTENER * p_listener = NULL
+                     );
+
       protected:
         /**
                   * Method to determine the PGCD of a number list by successive calls
@@ -68,6 +156,45 @@ namespace simplex
                         const COEF_TYPE & p_value
                        );
 
+        /**
+         * Compute PGCD of coefficients of a row including its B coefficient
+         * Contiguous rows are processed by PGCD kernel
+         * @param p_row_index index of row
+         * @return positive PGCD, 0 if all coefficients are null
+         */
+        inline
+        COEF_TYPE
+        get_row_PGCD(unsigned int p_row_index);
+
+        /**
+         * Divide coefficients of a row including its B coefficient
+         * @param p_row_index index of row
+         * @param p_pgcd PGCD of row coefficients
+         */
+        inline
+        void
+        divide_row(unsigned int p_row_index,
+                   const COEF_TYPE & p_pgcd
+                  );
+
+        /**
+         * Compute PGCD of coefficients of objective function row including
+         * Z0 coefficient
+         * @return positive PGCD, 0 if all coefficients are null
+         */
+        inline
+        COEF_TYPE
+        get_Z_row_PGCD();
+
+        /**
+         * Divide coefficients of objective function row including Z0
+         * coefficient
+         * @param p_pgcd PGCD of row coefficients
+         */
+        inline
+        void
+        divide_Z_row(const COEF_TYPE & p_pgcd);
+
         /**
            * Method to determine the equation index corresponding to next output
            * variable for pivot operation.
@@ -82,62 +209,480 @@ namespace simplex
                                   unsigned int & p_equation_index
                                  )const override ;
 
+        /**
+           * Method to determine the equation whose base variable leaves the
+           * base during a dual simplex iteration.
+           * Search is done using fract type to do exact comparison
+           * @param p_equation_index reference on variable where to store the output equation index if any
+           * @param p_at_upper_bound reference on variable set to true if base
+           * variable is above its upper bound, always false as bounds are not
+           * supported
+           * @return boolean indicating if an output equation was found
+           */
+        inline
+        bool
+        get_dual_output_equation_index(unsigned int & p_equation_index,
+                                       bool & p_at_upper_bound
+                                      )const override;
+
+        /**
+           * Method implementing dual ratio test.
+           * Search is done using fract type to do exact comparison
+           * @param p_equation_index index of output equation
+           * @param p_at_upper_bound always false as bounds are not supported
+           * @param p_variable_index reference on variable where to store the input variable index if any
+           * @return boolean indicating if an input variable was found
+           */
+        inline
+        bool
+        get_dual_input_variable_index(unsigned int p_equation_index,
+                                      bool p_at_upper_bound,
+                                      unsigned int & p_variable_index
+                                     )const override;
+
+        /**
+         * Insert a null column in simplex array, indexes of following
+         * variables are shifted by one
+         * @param p_column_index index of new column
+         */
+        void
+        insert_column(unsigned int p_column_index) override;
+
+        /**
+         * Remove a null column from simplex array, indexes of following
+         * variables are shifted by one
+         * @param p_column_index index of removed column
+         */
+        void
+        remove_column(unsigned int p_column_index) override;
+
+        /**
+         * Dual values are computed from original Z coefficients as Z row is
+         * scaled by pivots. Throw quicky_runtime_exception if a dual value
+         * is fractional so not representable with coefficient type, and
+         * simplex_overflow_exception if its computation overflows
+         * @param p_duals vector receiving dual values
+         */
+        void
+        compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const override;
+
+        /**
+         * Z coefficients are computed from original Z coefficients as Z row
+         * is scaled by pivots. Throw quicky_runtime_exception if a Z
+         * coefficient is fractional so not representable with coefficient
+         * type, and simplex_overflow_exception if its computation overflows
+         * @param p_Z_coefs vector receiving Z coefficients
+         */
+        void
+        compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const override;
+
+        /**
+         * Base variable values are not integer so that sensitivity analysis
+         * is not available with integer coefficients
+         * @param p_values unused
+         */
+        void
+        compute_base_values(std::vector<COEF_TYPE> & p_values) const override;
+
+        /**
+         * Objective function value is computed from original Z coefficients
+         * as Z row is scaled by pivots
+         * @return objective function value
+         */
+        COEF_TYPE
+        get_objective_value() const override;
+
+        /**
+         * Original Z coefficients are negated with Z row
+         */
+        void
+        negate_objective() override;
+
       private:
-        COEF_TYPE * m_original_Z_coefs;
+        /**
+         * Compute objective value from original Z coefficients as Z row is
+         * scaled by pivots
+         * @return objective value of current base
+         */
+        inline
+        COEF_TYPE
+        compute_max()const;
+
+        /**
+         * Compute Z coefficient of a variable in tableau whose rows are
+         * divided by their base coefficient from original Z coefficients
+         * @param p_variable_index index of variable
+         * @param p_numerator reference on variable where to store numerator
+         * of Z coefficient
+         * @param p_denominator reference on variable where to store positive
+         * denominator of Z coefficient
+         */
+        inline
+        void
+        compute_Z_coef(unsigned int p_variable_index,
+                       COEF_TYPE & p_numerator,
+                       COEF_TYPE & p_denominator
+                      ) const;
+
+        /**
+         * Original Z coefficient of a variable, artificial variables added
+         * by first phase have a null one
+         * @param p_variable_index index of variable
+         * @return original Z coefficient
+         */
+        inline
+        COEF_TYPE
+        get_original_Z_coef(unsigned int p_variable_index) const;
+
+        /**
+         * Exact division of values computed for sensitivity analysis
+         * @param p_numerator numerator
+         * @param p_denominator non null denominator
+         * @param p_name name of computed value used in exception message
+         * @return quotient, quicky_runtime_exception is thrown if it is
+         * not an integer
+         */
+        inline static
+        COEF_TYPE
+        exact_divide(const COEF_TYPE & p_numerator,
+                     const COEF_TYPE & p_denominator,
+                     const std::string & p_name
+                    );
+
+        /**
+         * Row PGCD implementations depending on rows storage
+         */
+        inline
+        COEF_TYPE
+        get_row_PGCD(unsigned int p_row_index,
+                     std::true_type
+                    );
+
+        inline
+        COEF_TYPE
+        get_row_PGCD(unsigned int p_row_index,
+                     std::false_type
+                    );
+
+        inline
+        void
+        divide_row(unsigned int p_row_index,
+                   const COEF_TYPE & p_pgcd,
+                   std::true_type
+                  );
+
+        inline
+        void
+        divide_row(unsigned int p_row_index,
+                   const COEF_TYPE & p_pgcd,
+                   std::false_type
+                  );
+
+        inline
+        COEF_TYPE
+        get_Z_row_PGCD(std::true_type);
+
+        inline
+        COEF_TYPE
+        get_Z_row_PGCD(std::false_type);
+
+        inline
+        void
+        divide_Z_row(const COEF_TYPE & p_pgcd,
+                     std::true_type
+                    );
+
+        inline
+        void
+        divide_Z_row(const COEF_TYPE & p_pgcd,
+                     std::false_type
+                    );
+
+        typedef std::integral_constant<bool, simplex_array_traits<ARRAY_TYPE>::m_contiguous_rows> t_contiguous_rows;
+
+        std::vector<COEF_TYPE> m_original_Z_coefs;
     };
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
-    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE>::simplex_solver_integer_base(unsigned int p_nb_variables,
-                                                                                             unsigned int p_nb_inequations_lt,
-                                                                                             unsigned int p_nb_equations,
-                                                                                             unsigned int p_nb_inequations_gt
-                                                                                            ):
-            simplex_solver_base<COEF_TYPE,ARRAY_TYPE>(p_nb_variables,
-                                                      p_nb_inequations_lt,
-                                                      p_nb_equations,
-                                                      p_nb_inequations_gt
-                                                     )
-    {
-        m_original_Z_coefs = new COEF_TYPE[this->get_nb_all_variables()];
-        memset(m_original_Z_coefs, 0, this->get_nb_all_variables() * sizeof(COEF_TYPE));
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::simplex_solver_integer_base(unsigned int p_nb_variables,
+                                                                                                            unsigned int p_nb_inequations_lt,
+                                                                                                            unsigned int p_nb_equations,
+                                                                                                            unsigned int p_nb_inequations_gt
+                                                                                                           ):
+            simplex_solver_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>(p_nb_variables,
+                                                                     p_nb_inequations_lt,
+                                                                     p_nb_equations,
+                                                                     p_nb_inequations_gt
+                                                                    ),
+            m_original_Z_coefs(this->get_nb_all_variables(), COEF_TYPE(0))
+    {
         static_assert(std::is_integral<COEF_TYPE>::value, "Simplex solver acccept only integer types");
         static_assert(std::is_signed<COEF_TYPE>::value, "Simplex solver acccept only signed types");
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
-    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE>::~simplex_solver_integer_base()
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_Z_coef(const unsigned int p_index,
+                                                                                           const COEF_TYPE & p_value
+                                                                                          )
     {
-        delete[] m_original_Z_coefs;
+        simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::set_Z_coef(p_index,
+                                                                              p_value
+                                                                             );
+        m_original_Z_coefs[p_index] = -p_value;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    unsigned int
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::add_variable(const COEF_TYPE & p_Z_coef,
+                                                                                             const std::vector<COEF_TYPE> & p_coefs
+                                                                                            )
+    {
+        if(this->is_search_done())
+        {
+            throw quicky_exception::quicky_logic_exception("Variables cannot be added to integer simplex solvers once search has been done", __LINE__, __FILE__);
+        }
+        unsigned int l_variable_index = simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::add_variable(p_Z_coef, p_coefs);
+        m_original_Z_coefs[l_variable_index] = -p_Z_coef;
+        return l_variable_index;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     void
-    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE>::set_Z_coef(const unsigned int p_index,
-                                                                            const COEF_TYPE & p_value
-                                                                           )
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::insert_column(unsigned int p_column_index)
     {
-        simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::set_Z_coef(p_index,
-                                                               p_value
-                                                              );
-        m_original_Z_coefs[p_index] = -p_value;
+        simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::insert_column(p_column_index);
+        m_original_Z_coefs.insert(m_original_Z_coefs.begin() + p_column_index, COEF_TYPE(0));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::remove_column(unsigned int p_column_index)
+    {
+        simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::remove_column(p_column_index);
+        m_original_Z_coefs.erase(m_original_Z_coefs.begin() + p_column_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::fix_variable(const unsigned int p_variable_index,
+                                                                                             const COEF_TYPE & p_value
+                                                                                            )
+    {
+        this->add_fixing_constraints(p_variable_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    std::vector<COEF_TYPE>
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_variable_values() const
+    {
+        std::vector<COEF_TYPE> l_result(this->get_nb_variables(), (COEF_TYPE)0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_variables();
+            ++l_index
+           )
+        {
+            unsigned int l_row_index = this->get_base_variables_position(l_index);
+            if(std::numeric_limits<unsigned int>::max() != l_row_index)
+            {
+                l_result[l_index] = this->get_array().get_B_coef(l_row_index) / this->get_array().get_A_coef(l_row_index, l_index);
+            }
+        }
+        this->unscale_variable_values(l_result);
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_internal_duals(std::vector<COEF_TYPE> & p_duals) const
+    {
+        if(!this->is_search_done())
+        {
+            throw quicky_exception::quicky_logic_exception("Dual values are only available after a search", __LINE__, __FILE__);
+        }
+        // Z coefficient of unit column is its original Z coefficient plus
+        // dual value times its original coefficient
+        p_duals.resize(this->get_nb_total_equations());
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            COEF_TYPE l_unit_coef;
+            COEF_TYPE l_unit_Z_coef;
+            unsigned int l_variable_index = this->get_unit_column(l_row_index, l_unit_coef, l_unit_Z_coef);
+            if(::std::numeric_limits<unsigned int>::max() == l_variable_index)
+            {
+                throw quicky_exception::quicky_logic_exception("No variable is specific to equation " + std::to_string(l_row_index) + ", dual value cannot be computed", __LINE__, __FILE__);
+            }
+            COEF_TYPE l_numerator;
+            COEF_TYPE l_denominator;
+            compute_Z_coef(l_variable_index, l_numerator, l_denominator);
+            p_duals[l_row_index] = exact_divide(checked_mul_sub(l_numerator, COEF_TYPE(1), l_unit_Z_coef, l_denominator),
+                                                checked_mul(l_denominator, l_unit_coef),
+                                                "Dual value of equation " + std::to_string(l_row_index)
+                                               );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_internal_Z_coefs(std::vector<COEF_TYPE> & p_Z_coefs) const
+    {
+        if(!this->is_search_done())
+        {
+            throw quicky_exception::quicky_logic_exception("Reduced costs are only available after a search", __LINE__, __FILE__);
+        }
+        p_Z_coefs.resize(this->get_nb_all_variables());
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables();
+            ++l_index
+           )
+        {
+            COEF_TYPE l_numerator;
+            COEF_TYPE l_denominator;
+            compute_Z_coef(l_index, l_numerator, l_denominator);
+            p_Z_coefs[l_index] = exact_divide(l_numerator, l_denominator, "Z coefficient of variable " + std::to_string(l_index));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_base_values(std::vector<COEF_TYPE> & p_values) const
+    {
+        (void)p_values;
+        throw quicky_exception::quicky_logic_exception("Ranges are not available with integer simplex solvers", __LINE__, __FILE__);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <class LISTENER>
+    bool
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max(COEF_TYPE & p_max,
+                                                                                         bool & p_infinite,
+                                                                                         LISTENER *p_listener
+                                                                                        )
+    {
+        if(this->is_bounded() || this->is_translated())
+        {
+            throw quicky_exception::quicky_logic_exception("Variable bounds are not supported by integer simplex solvers", __LINE__, __FILE__);
+        }
+        bool l_result = simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max(p_max,
+                                                                                            p_infinite,
+                                                                                            p_listener
+                                                                                           );
+        p_max = compute_max();
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max(COEF_TYPE & p_max,
+                                                                                         const simplex_solve_options<COEF_TYPE> & p_options,
+                                                                                         LISTENER *p_listener
+                                                                                        )
+    {
+        if(this->is_bounded() || this->is_translated())
+        {
+            throw quicky_exception::quicky_logic_exception("Variable bounds are not supported by integer simplex solvers", __LINE__, __FILE__);
+        }
+        return simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max(p_max,
+                                                                                   p_options,
+                                                                                   p_listener
+                                                                                  );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <class LISTENER>
+    bool
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_min(COEF_TYPE & p_min,
+                                                                                         bool & p_infinite,
+                                                                                         LISTENER *p_listener
+                                                                                        )
+    {
+        simplex_solve_options<COEF_TYPE> l_options;
+        t_solve_status l_status = find_min(p_min, l_options, p_listener);
+        p_infinite = t_solve_status::UNBOUNDED == l_status;
+        return t_solve_status::OPTIMAL == l_status;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    template <class LISTENER>
+    t_solve_status
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_min(COEF_TYPE & p_min,
+                                                                                         const simplex_solve_options<COEF_TYPE> & p_options,
+                                                                                         LISTENER *p_listener
+                                                                                        )
+    {
+        return this->minimize(p_min,
+                              p_options,
+                              [&](COEF_TYPE & p_max, const simplex_solve_options<COEF_TYPE> & p_max_options)
+                              {
+                                  return find_max(p_max, p_max_options, p_listener);
+                              }
+                             );
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     template <class LISTENER>
     bool
-    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE>::find_max(COEF_TYPE & p_max,
-                                                                          bool & p_infinite,
-                                                                          LISTENER *p_listener
-                                                                         )
-    {
-        bool l_result = simplex_solver_base<COEF_TYPE, ARRAY_TYPE>::find_max(p_max,
-                                                                             p_infinite,
-                                                                             p_listener
-                                                                            );
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max_dual(COEF_TYPE & p_max,
+                                                                                              bool & p_infeasible,
+                                                                                              LISTENER *p_listener
+                                                                                             )
+    {
+        if(this->is_bounded() || this->is_translated())
+        {
+            throw quicky_exception::quicky_logic_exception("Variable bounds are not supported by integer simplex solvers", __LINE__, __FILE__);
+        }
+        bool l_result = simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::find_max_dual(p_max,
+                                                                                                 p_infeasible,
+                                                                                                 p_listener
+                                                                                                );
+        p_max = compute_max();
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::negate_objective()
+    {
+        simplex_solver_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::negate_objective();
+        for(auto & l_Z_coef: m_original_Z_coefs)
+        {
+            l_Z_coef = -l_Z_coef;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_objective_value() const
+    {
+        return compute_max();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_max()const
+    {
         COEF_TYPE l_computed_max = 0;
         for(unsigned int l_index = 0;
             l_index < this->get_nb_variables();
@@ -154,7 +699,7 @@ namespace simplex
                 COEF_TYPE l_B_coef = this->get_array().get_B_coef(l_row_index);
                 COEF_TYPE l_var_value = l_B_coef / l_coef;
                 COEF_TYPE l_z_coef = m_original_Z_coefs[l_index];
-                l_computed_max -= l_z_coef * l_var_value;
+                l_computed_max = checked_sub(l_computed_max, checked_mul(l_z_coef, l_var_value));
 #ifdef DEBUG_SIMPLEX
                 std::cout << "Corresponding row index : " << l_row_index << std::endl;
                 std::cout << "Corresponding coef : " << l_coef << std::endl;
@@ -164,39 +709,251 @@ namespace simplex
 #endif //DEBUG_SIMPLEX
             }
         }
-        p_max = l_computed_max;
-        return l_result;
+        return l_computed_max;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     void
-    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE>::accumulate_PGCD(COEF_TYPE & p_pgcd,
-                                                                       const COEF_TYPE & p_value
-                                                                      )
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::compute_Z_coef(unsigned int p_variable_index,
+                                                                                               COEF_TYPE & p_numerator,
+                                                                                               COEF_TYPE & p_denominator
+                                                                                              ) const
+    {
+        // Z coefficient is z - SUM(zb * a / ab) where zb is original Z
+        // coefficient of base variable of row, ab its coefficient and a
+        // coefficient of variable in this row
+        p_numerator = get_original_Z_coef(p_variable_index);
+        p_denominator = COEF_TYPE(1);
+        for(unsigned int l_row_index = 0;
+            l_row_index < this->get_nb_total_equations();
+            ++l_row_index
+           )
+        {
+            const COEF_TYPE & l_coef = this->get_internal_coef(l_row_index, p_variable_index);
+            unsigned int l_base_variable_index = this->get_base_variable(l_row_index);
+            COEF_TYPE l_base_Z_coef = get_original_Z_coef(l_base_variable_index);
+            if(COEF_TYPE(0) == l_coef || COEF_TYPE(0) == l_base_Z_coef)
+            {
+                continue;
+            }
+            // Base coefficients are kept positive
+            const COEF_TYPE & l_base_coef = this->get_internal_coef(l_row_index, l_base_variable_index);
+            assert(0 < l_base_coef);
+            p_numerator = checked_mul_sub(p_numerator, l_base_coef, checked_mul(l_base_Z_coef, l_coef), p_denominator);
+            p_denominator = checked_mul(p_denominator, l_base_coef);
+            COEF_TYPE l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(p_numerator, p_denominator);
+            p_numerator = p_numerator / l_pgcd;
+            p_denominator = p_denominator / l_pgcd;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::get_original_Z_coef(unsigned int p_variable_index) const
+    {
+        return p_variable_index < m_original_Z_coefs.size() ? m_original_Z_coefs[p_variable_index] : COEF_TYPE(0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex::simplex_solver_integer_base<COEF_TYPE, ARRAY_TYPE,PRICING_POLICY>::exact_divide(const COEF_TYPE & p_numerator,
+                                                                                             const COEF_TYPE & p_denominator,
+                                                                                             const std::string & p_name
+                                                                                            )
     {
-        if(p_pgcd)
+        assert(COEF_TYPE(0) != p_denominator);
+        if(COEF_TYPE(0) != p_numerator % p_denominator)
         {
-            p_pgcd = quicky_utils::fract<COEF_TYPE>::PGCD(p_value,
-                                                          p_pgcd
-                                                         );
+            // Not an overflow: a wider integer type would not help
+            throw quicky_exception::quicky_runtime_exception(p_name + " is fractional and not representable with integer coefficient type", __LINE__, __FILE__);
         }
-        else
+        return p_numerator / p_denominator;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::accumulate_PGCD(COEF_TYPE & p_pgcd,
+                                                                                      const COEF_TYPE & p_value
+                                                                                     )
+    {
+        p_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(p_pgcd, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_row_PGCD(unsigned int p_row_index)
+    {
+        return get_row_PGCD(p_row_index, t_contiguous_rows());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_row_PGCD(unsigned int p_row_index,
+                                                                                   std::true_type
+                                                                                  )
+    {
+        return simplex_gcd_kernel<COEF_TYPE>::row_gcd(this->get_array().get_row(p_row_index),
+                                                      this->get_nb_all_variables(),
+                                                      this->get_array().get_B_coef(p_row_index)
+                                                     );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_row_PGCD(unsigned int p_row_index,
+                                                                                   std::false_type
+                                                                                  )
+    {
+        COEF_TYPE l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(this->get_array().get_B_coef(p_row_index), 0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables() && 1 != l_pgcd;
+            ++l_index
+           )
         {
-            p_pgcd = p_value;
+            l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(l_pgcd, this->get_internal_coef(p_row_index, l_index));
         }
+        return l_pgcd;
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_row(unsigned int p_row_index,
+                                                                                 const COEF_TYPE & p_pgcd
+                                                                                )
+    {
+#ifdef DEBUG_SIMPLEX
+        std::cout << "R[" << p_row_index << "] <= R[" << p_row_index << "] / " << p_pgcd << std::endl;
+#endif //DEBUG_SIMPLEX
+        divide_row(p_row_index, p_pgcd, t_contiguous_rows());
+        this->get_array().set_B_coef(p_row_index, this->get_array().get_B_coef(p_row_index) / p_pgcd);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_row(unsigned int p_row_index,
+                                                                                 const COEF_TYPE & p_pgcd,
+                                                                                 std::true_type
+                                                                                )
+    {
+        simplex_gcd_kernel<COEF_TYPE>::divide(this->get_array().get_row(p_row_index), p_pgcd, this->get_nb_all_variables());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_row(unsigned int p_row_index,
+                                                                                 const COEF_TYPE & p_pgcd,
+                                                                                 std::false_type
+                                                                                )
+    {
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables();
+            ++l_index
+           )
+        {
+            // Null coefficients are not written to keep sparse storages sparse
+            if(this->get_internal_coef(p_row_index, l_index))
+            {
+                this->set_internal_coef(p_row_index, l_index, this->get_internal_coef(p_row_index, l_index) / p_pgcd);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_Z_row_PGCD()
+    {
+        return get_Z_row_PGCD(t_contiguous_rows());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_Z_row_PGCD(std::true_type)
+    {
+        return simplex_gcd_kernel<COEF_TYPE>::row_gcd(this->get_array().get_Z_row(),
+                                                      this->get_nb_all_variables(),
+                                                      this->get_array().get_Z0_coef()
+                                                     );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    COEF_TYPE
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_Z_row_PGCD(std::false_type)
+    {
+        COEF_TYPE l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(this->get_array().get_Z0_coef(), 0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables() && 1 != l_pgcd;
+            ++l_index
+           )
+        {
+            l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(l_pgcd, this->get_array().get_Z_coef(l_index));
+        }
+        return l_pgcd;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_Z_row(const COEF_TYPE & p_pgcd)
+    {
+#ifdef DEBUG_SIMPLEX
+        std::cout << "Z line <= Z / " << p_pgcd << std::endl;
+#endif //DEBUG_SIMPLEX
+        divide_Z_row(p_pgcd, t_contiguous_rows());
+        this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() / p_pgcd);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_Z_row(const COEF_TYPE & p_pgcd,
+                                                                                   std::true_type
+                                                                                  )
+    {
+        simplex_gcd_kernel<COEF_TYPE>::divide(this->get_array().get_Z_row(), p_pgcd, this->get_nb_all_variables());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::divide_Z_row(const COEF_TYPE & p_pgcd,
+                                                                                   std::false_type
+                                                                                  )
+    {
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables();
+            ++l_index
+           )
+        {
+            if(this->get_array().get_Z_coef(l_index))
+            {
+                this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) / p_pgcd);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     bool
-    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE>::get_output_equation_index(unsigned int p_input_variable_index,
-                                                                                 unsigned int & p_equation_index
-                                                                                )const
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_output_equation_index(unsigned int p_input_variable_index,
+                                                                                                unsigned int & p_equation_index
+                                                                                               )const
     {
         assert(p_input_variable_index < this->get_nb_all_variables());
         unsigned int l_index = 0;
-        while(this->get_internal_coef(l_index,p_input_variable_index) <= 0 && l_index < this->get_nb_total_equations())
+        while(l_index < this->get_nb_total_equations() && this->get_internal_coef(l_index,p_input_variable_index) <= 0)
         {
             ++l_index;
         }
@@ -224,6 +981,71 @@ namespace simplex
         return true;
     }
 
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_dual_output_equation_index(unsigned int & p_equation_index,
+                                                                                                     bool & p_at_upper_bound
+                                                                                                    )const
+    {
+        // Base coefficients are kept positive so base variable is negative
+        // when B coefficient is negative
+        p_at_upper_bound = false;
+        bool l_found = false;
+        quicky_utils::fract<COEF_TYPE> l_min(0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_total_equations();
+            ++l_index
+           )
+        {
+            COEF_TYPE l_B_coef = this->get_array().get_B_coef(l_index);
+            if(l_B_coef < 0)
+            {
+                quicky_utils::fract<COEF_TYPE> l_value(l_B_coef, this->get_internal_coef(l_index, this->get_base_variable(l_index)));
+                if(!l_found || l_value < l_min)
+                {
+                    l_min = l_value;
+                    p_equation_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    bool
+    simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::get_dual_input_variable_index(unsigned int p_equation_index,
+                                                                                                    bool p_at_upper_bound,
+                                                                                                    unsigned int & p_variable_index
+                                                                                                   )const
+    {
+        assert(p_equation_index < this->get_nb_total_equations());
+        assert(!p_at_upper_bound);
+        (void)p_at_upper_bound;
+        bool l_found = false;
+        quicky_utils::fract<COEF_TYPE> l_min(0);
+        for(unsigned int l_index = 0;
+            l_index < this->get_nb_all_variables();
+            ++l_index
+           )
+        {
+            COEF_TYPE l_coef = this->get_internal_coef(p_equation_index, l_index);
+            if(l_coef < 0 && !this->is_base_variable(l_index))
+            {
+                quicky_utils::fract<COEF_TYPE> l_ratio(this->get_array().get_Z_coef(l_index), -l_coef);
+                if(!l_found || l_ratio < l_min)
+                {
+                    l_min = l_ratio;
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
+
 }
 
 #endif //SIMPLEX_SOLVER_INTEGER_BASE_H
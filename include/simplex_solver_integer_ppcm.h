@@ -20,11 +20,12 @@
 
 #include "simplex_array.h"
 #include "simplex_solver_integer_base.h"
+#include <vector>
 
 namespace simplex
 {
-    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>>
-    class simplex_solver_integer_ppcm: public simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE=simplex_array<COEF_TYPE>, typename PRICING_POLICY=simplex_pricing_first<COEF_TYPE>>
+    class simplex_solver_integer_ppcm: public simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>
     {
       public:
         simplex_solver_integer_ppcm() = delete;
@@ -46,165 +47,184 @@ namespace simplex
                           const unsigned int p_column_index
                          ) override ;
 
+        /**
+         * Compute multipliers PPCM / |q| and PPCM / pivot so that
+         * R * p_mult_z - pivot row * p_mult_array has a null coefficient in
+         * pivot column. They are obtained from PGCD without computing PPCM
+         * which could overflow
+         * @param p_q coefficient of row in pivot column
+         * @param p_pivot pivot coefficient
+         * @param p_mult_z reference on variable where to store positive row
+         * multiplier
+         * @param p_mult_array reference on variable where to store pivot row
+         * multiplier
+         */
+        inline static
+        void
+        compute_multipliers(const COEF_TYPE & p_q,
+                            const COEF_TYPE & p_pivot,
+                            COEF_TYPE & p_mult_z,
+                            COEF_TYPE & p_mult_array
+                           );
+
+        /**
+         * Index of variables with non null coefficient in pivot row
+         */
+        std::vector<unsigned int> m_pivot_row_pattern;
+
+        /**
+         * Index of rows with non null coefficient in pivot column, pivot row
+         * excluded
+         */
+        std::vector<unsigned int> m_pivot_column_pattern;
     };
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
-    simplex_solver_integer_ppcm<COEF_TYPE,ARRAY_TYPE>::simplex_solver_integer_ppcm(unsigned int p_nb_variables,
-                                                                                   unsigned int p_nb_inequations_lt,
-                                                                                   unsigned int p_nb_equations,
-                                                                                   unsigned int p_nb_inequations_gt
-                                                                                  ):
-            simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE>(p_nb_variables,
-                                                              p_nb_inequations_lt,
-                                                              p_nb_equations,
-                                                              p_nb_inequations_gt
-                                                             )
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    simplex_solver_integer_ppcm<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::simplex_solver_integer_ppcm(unsigned int p_nb_variables,
+                                                                                                  unsigned int p_nb_inequations_lt,
+                                                                                                  unsigned int p_nb_equations,
+                                                                                                  unsigned int p_nb_inequations_gt
+                                                                                                 ):
+            simplex_solver_integer_base<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>(p_nb_variables,
+                                                                             p_nb_inequations_lt,
+                                                                             p_nb_equations,
+                                                                             p_nb_inequations_gt
+                                                                            )
     {
         static_assert(std::is_integral<COEF_TYPE>::value, "Simplex solver acccept only integer types");
         static_assert(std::is_signed<COEF_TYPE>::value, "Simplex solver acccept only signed types");
     }
 
     //-------------------------------------------------------------------------
-    template <typename COEF_TYPE, typename ARRAY_TYPE>
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
     void
-    simplex_solver_integer_ppcm<COEF_TYPE,ARRAY_TYPE>::pivot(const unsigned int p_row_index,
-                                                        const unsigned int p_column_index
-                                                       )
+    simplex_solver_integer_ppcm<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::pivot(const unsigned int p_row_index,
+                                                                       const unsigned int p_column_index
+                                                                      )
     {
         assert(p_row_index < this->get_nb_total_equations());
         assert(p_column_index < this->get_nb_all_variables());
         COEF_TYPE l_pivot = this->get_internal_coef(p_row_index,p_column_index);
         assert(l_pivot);
 
+        // Only non null coefficients of pivot row and rows with non null
+        // coefficient in pivot column are involved in pivot
+        this->collect_row_pattern(p_row_index, m_pivot_row_pattern);
+        this->collect_column_pattern(p_column_index, p_row_index, m_pivot_column_pattern);
+
         // Pivoting Z
         COEF_TYPE l_q = this->get_array().get_Z_coef(p_column_index);
 
-        // Determine PPCM and pivoting to be able to set pivoting Z to 0
-        COEF_TYPE l_ppcm = quicky_utils::fract<COEF_TYPE>::PPCM(l_q,l_pivot);
-        COEF_TYPE l_mult_z = -l_ppcm / l_q;
-        COEF_TYPE l_mult_array = -l_ppcm / l_pivot;
+        // Determine PPCM and pivoting to be able to set pivoting Z to 0.
+        // Z coefficient is positive or null during dual simplex iterations
+        COEF_TYPE l_mult_z = 1;
+        COEF_TYPE l_mult_array = 0;
+        if(l_q)
+        {
+            compute_multipliers(l_q, l_pivot, l_mult_z, l_mult_array);
+        }
 
 #ifdef DEBUG_SIMPLEX
         std::cout << "Z line <= (Z * " << l_mult_z << ") - (R[" << p_row_index << "] * " << l_mult_array << ")" << std::endl;
 #endif //DEBUG_SIMPLEX
-        COEF_TYPE l_pgcd = 0;
-        COEF_TYPE l_new_coef = 0;
+        // Coefficients outside of pivot row pattern are only modified when
+        // multiplied
+        unsigned int l_pattern_index = 0;
         for(unsigned int l_index = 0;
             l_index < this->get_nb_all_variables();
             ++l_index
                 )
         {
-            COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
-            l_new_coef = this->get_array().get_Z_coef(l_index) * l_mult_z - l_u * l_mult_array;
-            this->accumulate_PGCD(l_pgcd, l_new_coef);
-            this->get_array().set_Z_coef(l_index, l_new_coef);
+            COEF_TYPE l_coef = this->get_array().get_Z_coef(l_index);
+            if(l_pattern_index < m_pivot_row_pattern.size() && m_pivot_row_pattern[l_pattern_index] == l_index)
+            {
+                COEF_TYPE l_u = this->get_internal_coef(p_row_index,l_index);
+                this->get_array().set_Z_coef(l_index, checked_mul_sub(l_coef, l_mult_z, l_u, l_mult_array));
+                ++l_pattern_index;
+            }
+            else if(l_coef && 1 != l_mult_z)
+            {
+                this->get_array().set_Z_coef(l_index, checked_mul(l_coef, l_mult_z));
+            }
         }
         assert(!this->get_array().get_Z_coef(p_column_index));
-        l_new_coef = this->get_array().get_Z0_coef() * l_mult_z - this->get_array().get_B_coef(p_row_index) * l_mult_array;
-        this->accumulate_PGCD(l_pgcd, l_new_coef);
-        this->get_array().set_Z0_coef(l_new_coef);
+        this->get_array().set_Z0_coef(checked_mul_sub(this->get_array().get_Z0_coef(), l_mult_z, this->get_array().get_B_coef(p_row_index), l_mult_array));
 
         // Divide Z row by PGCD if necessary
+        COEF_TYPE l_pgcd = this->get_Z_row_PGCD();
         if(l_pgcd > 1)
         {
-#ifdef DEBUG_SIMPLEX
-            std::cout << "Z line <= Z / " << l_pgcd << std::endl;
-#endif //DEBUG_SIMPLEX
-            for (unsigned int l_index = 0;
-                 l_index < this->get_nb_all_variables();
-                 ++l_index
-                    )
-            {
-                this->get_array().set_Z_coef(l_index, this->get_array().get_Z_coef(l_index) / l_pgcd);
-            }
-            this->get_array().set_Z0_coef(this->get_array().get_Z0_coef() / l_pgcd);
+            this->divide_Z_row(l_pgcd);
         }
-        // Pivoting other rows
-        for(unsigned int l_row_index = 0;
-            l_row_index < this->get_nb_total_equations();
-            ++l_row_index
-                )
-        {
-            if(l_row_index != p_row_index)
-            {
-                COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
-                if(l_q)
-                {
-                    // Determine PPCM and pivoting to be able to set pivoting Z to 0
-                    l_ppcm = quicky_utils::fract<COEF_TYPE>::PPCM(l_q,
-                                                                  l_pivot
-                                                                 );
-                    if(l_q > 0)
-                    {
-                        l_mult_z = l_ppcm / l_q;
-                        l_mult_array = l_ppcm / l_pivot;
-                    } else
-                    {
-                        l_mult_z = -l_ppcm / l_q;
-                        l_mult_array = -l_ppcm / l_pivot;
-                    }
+        // Pivoting other rows, rows with null coefficient in pivot column
+        // are not modified
+        this->for_each_row((unsigned int)m_pivot_column_pattern.size(),
+                           [&](unsigned int p_pattern_index)
+                           {
+                               unsigned int l_row_index = m_pivot_column_pattern[p_pattern_index];
+                               COEF_TYPE l_q = this->get_internal_coef(l_row_index,p_column_index);
+                               assert(l_q);
+                               // Determine PPCM and pivoting to be able to set pivoting Z to 0
+                               COEF_TYPE l_mult_z;
+                               COEF_TYPE l_mult_array;
+                               compute_multipliers(l_q, l_pivot, l_mult_z, l_mult_array);
 
 #ifdef DEBUG_SIMPLEX
-                    std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] * " << l_mult_z << ") - (R["
-                              << p_row_index << "] * " << l_mult_array << ")" << std::endl;
+                               std::cout << "R[" << l_row_index << "] <= (R[" << l_row_index << "] * " << l_mult_z << ") - (R["
+                                         << p_row_index << "] * " << l_mult_array << ")" << std::endl;
 #endif //DEBUG_SIMPLEX
-                    l_pgcd = 0;
-                    l_new_coef = this->get_array().get_B_coef(l_row_index) * l_mult_z - this->get_array().get_B_coef(p_row_index) * l_mult_array;
-                    this->accumulate_PGCD(l_pgcd, l_new_coef);
-                    this->get_array().set_B_coef(l_row_index, l_new_coef);
-                    for (unsigned int l_index = 0;
-                         l_index < this->get_nb_all_variables();
-                         ++l_index
-                        )
-                    {
-                        COEF_TYPE l_u = this->get_internal_coef(p_row_index, l_index);
-                        l_new_coef = this->get_internal_coef(l_row_index, l_index) * l_mult_z - l_u * l_mult_array;
-                        this->accumulate_PGCD(l_pgcd, l_new_coef);
-                        this->set_internal_coef(l_row_index, l_index, l_new_coef);
-                    }
-
-                    if (l_pgcd > 1)
-                    {
-#ifdef DEBUG_SIMPLEX
-                        std::cout << "R[" << l_row_index << "] <= R[" << l_row_index << "] / " << l_pgcd << std::endl;
-#endif //DEBUG_SIMPLEX
-                        for (unsigned int l_index = 0;
-                             l_index < this->get_nb_all_variables();
-                             ++l_index
-                            )
-                        {
-                            this->set_internal_coef(l_row_index, l_index, this->get_internal_coef(l_row_index, l_index) / l_pgcd);
-                        }
-                        this->get_array().set_B_coef(l_row_index, this->get_array().get_B_coef(l_row_index) / l_pgcd);
-                    }
-                }
-            }
-        }
+                               this->get_array().set_B_coef(l_row_index, checked_mul_sub(this->get_array().get_B_coef(l_row_index), l_mult_z, this->get_array().get_B_coef(p_row_index), l_mult_array));
+                               unsigned int l_pattern_index = 0;
+                               for (unsigned int l_index = 0;
+                                    l_index < this->get_nb_all_variables();
+                                    ++l_index
+                                   )
+                               {
+                                   COEF_TYPE l_coef = this->get_internal_coef(l_row_index, l_index);
+                                   if(l_pattern_index < m_pivot_row_pattern.size() && m_pivot_row_pattern[l_pattern_index] == l_index)
+                                   {
+                                       COEF_TYPE l_u = this->get_internal_coef(p_row_index, l_index);
+                                       this->set_internal_coef(l_row_index, l_index, checked_mul_sub(l_coef, l_mult_z, l_u, l_mult_array));
+                                       ++l_pattern_index;
+                                   }
+                                   else if(l_coef && 1 != l_mult_z)
+                                   {
+                                       this->set_internal_coef(l_row_index, l_index, checked_mul(l_coef, l_mult_z));
+                                   }
+                               }
+
+                               COEF_TYPE l_pgcd = this->get_row_PGCD(l_row_index);
+                               if (l_pgcd > 1)
+                               {
+                                   this->divide_row(l_row_index, l_pgcd);
+                               }
+                           }
+                          );
 
         // Particular case of pivot row
-        l_pgcd = 0;
-        for(unsigned int l_index = 0;
-            l_index < this->get_nb_variables();
-            ++l_index
-           )
-        {
-            this->accumulate_PGCD(l_pgcd,this->get_internal_coef(p_row_index, l_index));
-        }
-        this->accumulate_PGCD(l_pgcd,this->get_array().get_B_coef(p_row_index));
+        l_pgcd = this->get_row_PGCD(p_row_index);
         if(l_pgcd > 1)
         {
-            std::cout << "R[" << p_row_index << "] <= R[" << p_row_index << "] / " << l_pgcd << std::endl;
-            for(unsigned int l_index = 0;
-                l_index < this->get_nb_variables();
-                ++l_index
-               )
-            {
-                this->set_internal_coef(p_row_index,l_index,this->get_internal_coef(p_row_index,l_index) / l_pgcd);
-            }
-            this->get_array().set_B_coef(p_row_index, this->get_array().get_B_coef(p_row_index) / l_pgcd);
+            this->divide_row(p_row_index, l_pgcd);
         }
     }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, typename ARRAY_TYPE, typename PRICING_POLICY>
+    void
+    simplex_solver_integer_ppcm<COEF_TYPE,ARRAY_TYPE,PRICING_POLICY>::compute_multipliers(const COEF_TYPE & p_q,
+                                                                                     const COEF_TYPE & p_pivot,
+                                                                                     COEF_TYPE & p_mult_z,
+                                                                                     COEF_TYPE & p_mult_array
+                                                                                    )
+    {
+        // PPCM = |q * pivot| / PGCD so PPCM / |q| = |pivot| / PGCD and
+        // PPCM / pivot signed like q gives q * sign(pivot) / PGCD
+        COEF_TYPE l_pgcd = simplex_gcd_kernel<COEF_TYPE>::gcd(p_q, p_pivot);
+        p_mult_z = (p_pivot < 0 ? -p_pivot : p_pivot) / l_pgcd;
+        p_mult_array = p_pivot < 0 ? -(p_q / l_pgcd) : p_q / l_pgcd;
+    }
 }
 
 
@@ -0,0 +1,846 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_SOLVER_INTEGER_PROMOTING_H
+#define SIMPLEX_SOLVER_INTEGER_PROMOTING_H
+
+// Arbitrary precision types are declared before solvers using them
+#include "ext_int.h"
+#include "fract.h"
+#include "simplex_solver_integer.h"
+#include "simplex_solver.h"
+#include "simplex_checked_arithmetic.h"
+#include "simplex_listener_if.h"
+#include "simplex_listener_target_if.h"
+#include "quicky_exception.h"
+#include <memory>
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+namespace simplex
+{
+    /**
+     * Integer simplex solver whose tableau coefficients are promoted to a
+     * wider integer type when a pivot overflows: 32 bits, 64 bits, 128 bits
+     * when compiler provides them, then arbitrary precision fractions so
+     * that result never depends on a guessed width. Model is kept with user
+     * coefficient type and replayed in wider solver which restarts from
+     * the basis reached before the failed pivot, so that pivot is done
+     * again with wider coefficients. Like integer solvers, last tier gives
+     * variable values truncated to integers.
+     * SOLVER has to detect overflows by throwing simplex_overflow_exception
+     * @tparam COEF_TYPE Type of model coefficients, int32_t or int64_t
+     * @tparam SOLVER integer solver template used for each width
+     */
+    template <typename COEF_TYPE=int32_t, template <typename...> class SOLVER=simplex_solver_integer>
+    class simplex_solver_integer_promoting: public simplex_listener_target_if<COEF_TYPE>
+    {
+      public:
+        typedef COEF_TYPE t_coef_type;
+
+        simplex_solver_integer_promoting() = delete;
+
+        inline
+        simplex_solver_integer_promoting(unsigned int p_nb_variables
+                                        ,unsigned int p_nb_inequations_lt
+                                        ,unsigned int p_nb_equations
+                                        ,unsigned int p_nb_inequations_gt
+                                        );
+
+        /**
+         * Define coefficient for objective function
+         * @param p_index : the value should be less than number of variables
+         * @param value : value of coefficient in the formula Z = SUM(Cj * x)
+         */
+        inline
+        void
+        set_Z_coef(const unsigned int p_index
+                  ,const COEF_TYPE & p_value
+                  );
+
+        /**
+         * Define coefficient for B coefficients in A x = b
+         * @param p_index : the value should be less than total number of equations
+         * @param value : value of coefficient in b
+         */
+        inline
+        void
+        set_B_coef(const unsigned int p_index
+                  ,const COEF_TYPE & p_value
+                  );
+
+        /**
+         * Define coefficient for A coefficients in A x = b
+         * @param p_equation_index : the value should be less than total number of equations
+         * @param p_variable_index : the value should be less than number of variables
+         * @param value : value of coefficient in A
+         */
+        inline
+        void
+        set_A_coef(const unsigned int p_equation_index
+                  ,const unsigned int p_variable_index
+                  ,const COEF_TYPE & p_value
+                  );
+
+        /**
+         * Define type of equation
+         * @param p_equation_index index of equation
+         * @param p_type type of equation
+         */
+        inline
+        void
+        define_equation_type(const unsigned int & p_equation_index
+                            ,const t_equation_type & p_type
+                            );
+
+        /**
+         * Define a base variable, see simplex_solver_base
+         * @param p_variable_index index of variable
+         */
+        inline
+        void
+        define_base_variable(const unsigned int & p_variable_index);
+
+        /**
+         * Search max optimum, promoting coefficients when a pivot overflows
+         * @param p_max reference on variable where result will be stored
+         * @param p_infinite receive true if max is infinite
+         * @param p_listener optional listener, it keeps receiving events
+         * after promotion
+         * @return value indicating if a max was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_max(COEF_TYPE & p_max
+                ,bool & p_infinite
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Search min optimum, promoting coefficients when a pivot overflows
+         * @param p_min reference on variable where result will be stored
+         * @param p_infinite receive true if min is infinite
+         * @param p_listener optional listener
+         * @return value indicating if a min was found
+         */
+        template <class LISTENER=simplex_listener<COEF_TYPE>>
+        bool
+        find_min(COEF_TYPE & p_min
+                ,bool & p_infinite
+                ,LISTENER * p_listener = NULL
+                );
+
+        /**
+         * Check if values respect equations
+         * @param p_values values of variables
+         * @return true if equations are respected
+         */
+        inline
+        bool
+        check_variables(const std::vector<COEF_TYPE> & p_values);
+
+        std::vector<COEF_TYPE> get_variable_values() const override;
+
+        std::ostream & display_array(std::ostream & p_stream) const override;
+
+        /**
+         * Number of bits of integers currently used by tableau
+         * @return 32, 64, 128 or 0 for arbitrary precision
+         */
+        inline
+        unsigned int
+        get_coef_width() const;
+
+      private:
+
+        /**
+         * Interface hiding integer type of solver used for current width
+         */
+        class tier_if
+        {
+          public:
+            virtual unsigned int get_width() const = 0;
+            virtual void set_Z_coef(unsigned int p_index, const COEF_TYPE & p_value) = 0;
+            virtual void set_B_coef(unsigned int p_index, const COEF_TYPE & p_value) = 0;
+            virtual void set_A_coef(unsigned int p_equation_index, unsigned int p_variable_index, const COEF_TYPE & p_value) = 0;
+            virtual void define_equation_type(unsigned int p_equation_index, t_equation_type p_type) = 0;
+            virtual void define_base_variable(unsigned int p_variable_index) = 0;
+            virtual bool find_max(COEF_TYPE & p_max, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) = 0;
+            virtual bool find_min(COEF_TYPE & p_min, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) = 0;
+            virtual bool check_variables(const std::vector<COEF_TYPE> & p_values) = 0;
+            virtual std::vector<COEF_TYPE> get_variable_values() const = 0;
+            virtual std::ostream & display_array(std::ostream & p_stream) const = 0;
+            virtual std::vector<unsigned int> get_basis() const = 0;
+            virtual void set_basis(const std::vector<unsigned int> & p_basis) = 0;
+            virtual ~tier_if(){}
+        };
+
+        /**
+         * Solver working with a given integer type
+         * @tparam INTEGER_TYPE type of tableau coefficients
+         */
+        template <typename INTEGER_TYPE>
+        class tier: public tier_if
+        {
+          public:
+            tier(unsigned int p_nb_variables
+                ,unsigned int p_nb_inequations_lt
+                ,unsigned int p_nb_equations
+                ,unsigned int p_nb_inequations_gt
+                )
+            :m_solver(p_nb_variables, p_nb_inequations_lt, p_nb_equations, p_nb_inequations_gt)
+            {
+            }
+
+            unsigned int get_width() const override
+            {
+                return 8 * sizeof(INTEGER_TYPE);
+            }
+
+            void set_Z_coef(unsigned int p_index, const COEF_TYPE & p_value) override
+            {
+                m_solver.set_Z_coef(p_index, INTEGER_TYPE(p_value));
+            }
+
+            void set_B_coef(unsigned int p_index, const COEF_TYPE & p_value) override
+            {
+                m_solver.set_B_coef(p_index, INTEGER_TYPE(p_value));
+            }
+
+            void set_A_coef(unsigned int p_equation_index, unsigned int p_variable_index, const COEF_TYPE & p_value) override
+            {
+                m_solver.set_A_coef(p_equation_index, p_variable_index, INTEGER_TYPE(p_value));
+            }
+
+            void define_equation_type(unsigned int p_equation_index, t_equation_type p_type) override
+            {
+                m_solver.define_equation_type(p_equation_index, p_type);
+            }
+
+            void define_base_variable(unsigned int p_variable_index) override
+            {
+                m_solver.define_base_variable(p_variable_index);
+            }
+
+            bool find_max(COEF_TYPE & p_max, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) override
+            {
+                INTEGER_TYPE l_max = 0;
+                bool l_result = m_solver.find_max(l_max, p_infinite, p_listener);
+                p_max = l_result ? narrow(l_max) : COEF_TYPE(0);
+                return l_result;
+            }
+
+            bool find_min(COEF_TYPE & p_min, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) override
+            {
+                INTEGER_TYPE l_min = 0;
+                bool l_result = m_solver.find_min(l_min, p_infinite, p_listener);
+                p_min = l_result ? narrow(l_min) : COEF_TYPE(0);
+                return l_result;
+            }
+
+            bool check_variables(const std::vector<COEF_TYPE> & p_values) override
+            {
+                return m_solver.check_variables(std::vector<INTEGER_TYPE>(p_values.begin(), p_values.end()));
+            }
+
+            std::vector<COEF_TYPE> get_variable_values() const override
+            {
+                std::vector<INTEGER_TYPE> l_values = m_solver.get_variable_values();
+                std::vector<COEF_TYPE> l_result(l_values.size());
+                for(unsigned int l_index = 0; l_index < l_values.size(); ++l_index)
+                {
+                    l_result[l_index] = narrow(l_values[l_index]);
+                }
+                return l_result;
+            }
+
+            std::ostream & display_array(std::ostream & p_stream) const override
+            {
+                return m_solver.display_array(p_stream);
+            }
+
+            std::vector<unsigned int> get_basis() const override
+            {
+                return m_solver.get_basis();
+            }
+
+            void set_basis(const std::vector<unsigned int> & p_basis) override
+            {
+                m_solver.set_basis(p_basis);
+            }
+
+          private:
+            /**
+             * Convert a result to model coefficient type. Failure is not an
+             * overflow of tableau so no promotion would fix it
+             * @param p_value result with tableau integer type
+             * @return result with model coefficient type
+             */
+            static
+            COEF_TYPE
+            narrow(const INTEGER_TYPE & p_value)
+            {
+                if(p_value < INTEGER_TYPE(std::numeric_limits<COEF_TYPE>::min()) || INTEGER_TYPE(std::numeric_limits<COEF_TYPE>::max()) < p_value)
+                {
+                    throw quicky_exception::quicky_runtime_exception("Result does not fit in model coefficient type", __LINE__, __FILE__);
+                }
+                return COEF_TYPE(p_value);
+            }
+
+            SOLVER<INTEGER_TYPE> m_solver;
+        };
+
+        /**
+         * Arbitrary precision type of last tier, built from 32 bits integers
+         */
+        typedef quicky_utils::fract<quicky_utils::ext_int<int32_t>> t_exact_type;
+
+        /**
+         * Solver working with arbitrary precision fractions, used when
+         * widest integer type overflows
+         */
+        class exact_tier: public tier_if
+        {
+          public:
+            exact_tier(unsigned int p_nb_variables
+                      ,unsigned int p_nb_inequations_lt
+                      ,unsigned int p_nb_equations
+                      ,unsigned int p_nb_inequations_gt
+                      )
+            :m_solver(p_nb_variables, p_nb_inequations_lt, p_nb_equations, p_nb_inequations_gt)
+            ,m_Z_coefs(p_nb_variables, COEF_TYPE(0))
+            {
+            }
+
+            unsigned int get_width() const override
+            {
+                return 0;
+            }
+
+            void set_Z_coef(unsigned int p_index, const COEF_TYPE & p_value) override
+            {
+                m_Z_coefs[p_index] = p_value;
+                m_solver.set_Z_coef(p_index, to_exact(p_value));
+            }
+
+            void set_B_coef(unsigned int p_index, const COEF_TYPE & p_value) override
+            {
+                m_solver.set_B_coef(p_index, to_exact(p_value));
+            }
+
+            void set_A_coef(unsigned int p_equation_index, unsigned int p_variable_index, const COEF_TYPE & p_value) override
+            {
+                m_solver.set_A_coef(p_equation_index, p_variable_index, to_exact(p_value));
+            }
+
+            void define_equation_type(unsigned int p_equation_index, t_equation_type p_type) override
+            {
+                m_solver.define_equation_type(p_equation_index, p_type);
+            }
+
+            void define_base_variable(unsigned int p_variable_index) override
+            {
+                m_solver.define_base_variable(p_variable_index);
+            }
+
+            bool find_max(COEF_TYPE & p_max, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) override
+            {
+                t_exact_type l_max(0);
+                listener l_listener(p_listener);
+                bool l_result = m_solver.find_max(l_max, p_infinite, p_listener ? &l_listener : nullptr);
+                p_max = l_result ? compute_objective() : COEF_TYPE(0);
+                return l_result;
+            }
+
+            bool find_min(COEF_TYPE & p_min, bool & p_infinite, simplex_listener_if<COEF_TYPE> * p_listener) override
+            {
+                t_exact_type l_min(0);
+                listener l_listener(p_listener);
+                bool l_result = m_solver.find_min(l_min, p_infinite, p_listener ? &l_listener : nullptr);
+                p_min = l_result ? compute_objective() : COEF_TYPE(0);
+                return l_result;
+            }
+
+            bool check_variables(const std::vector<COEF_TYPE> & p_values) override
+            {
+                std::vector<t_exact_type> l_values;
+                for(auto l_value: p_values)
+                {
+                    l_values.push_back(to_exact(l_value));
+                }
+                return m_solver.check_variables(l_values);
+            }
+
+            std::vector<COEF_TYPE> get_variable_values() const override
+            {
+                std::vector<t_exact_type> l_values = m_solver.get_variable_values();
+                std::vector<COEF_TYPE> l_result(l_values.size());
+                for(unsigned int l_index = 0; l_index < l_values.size(); ++l_index)
+                {
+                    l_result[l_index] = truncate(l_values[l_index]);
+                }
+                return l_result;
+            }
+
+            std::ostream & display_array(std::ostream & p_stream) const override
+            {
+                return m_solver.display_array(p_stream);
+            }
+
+            std::vector<unsigned int> get_basis() const override
+            {
+                return m_solver.get_basis();
+            }
+
+            void set_basis(const std::vector<unsigned int> & p_basis) override
+            {
+                m_solver.set_basis(p_basis);
+            }
+
+          private:
+            /**
+             * Forward events to listener of model coefficient type, Z0
+             * values that do not fit in it are not reported
+             */
+            class listener: public simplex_listener_if<t_exact_type>
+            {
+              public:
+                explicit listener(simplex_listener_if<COEF_TYPE> * p_listener)
+                :m_listener(p_listener)
+                {
+                }
+
+                void start_iteration(const unsigned int & p_nb_iteration) override
+                {
+                    m_listener->start_iteration(p_nb_iteration);
+                }
+
+                void new_input_var_event(const unsigned int & p_input_variable_index) override
+                {
+                    m_listener->new_input_var_event(p_input_variable_index);
+                }
+
+                void new_output_var_event(const unsigned int & p_output_variable_index) override
+                {
+                    m_listener->new_output_var_event(p_output_variable_index);
+                }
+
+                void new_Z0(t_exact_type p_z0) override
+                {
+                    if(!(p_z0 < to_exact(std::numeric_limits<COEF_TYPE>::min())) && !(to_exact(std::numeric_limits<COEF_TYPE>::max()) < p_z0))
+                    {
+                        m_listener->new_Z0(truncate(p_z0));
+                    }
+                }
+
+              private:
+                simplex_listener_if<COEF_TYPE> * m_listener;
+            };
+
+            /**
+             * Convert a model coefficient, exact type is only built from 32
+             * bits integers so wider values are built by 16 bits chunks
+             * @param p_value value with model coefficient type
+             * @return exact value
+             */
+            static
+            t_exact_type
+            to_exact(const COEF_TYPE & p_value)
+            {
+                if(COEF_TYPE(std::numeric_limits<int32_t>::min()) <= p_value && p_value <= COEF_TYPE(std::numeric_limits<int32_t>::max()))
+                {
+                    return t_exact_type(int32_t(p_value));
+                }
+                return to_exact(p_value / 65536) * t_exact_type(65536) + t_exact_type(int32_t(p_value % 65536));
+            }
+
+            /**
+             * Convert a result to model coefficient type, rounding toward
+             * zero like integer solvers. Integer part is found by dichotomy
+             * so that only comparisons of exact type are needed
+             * @param p_value exact result
+             * @return integer part with model coefficient type
+             */
+            static
+            COEF_TYPE
+            truncate(const t_exact_type & p_value)
+            {
+                if(p_value < to_exact(std::numeric_limits<COEF_TYPE>::min()) || to_exact(std::numeric_limits<COEF_TYPE>::max()) < p_value)
+                {
+                    throw quicky_exception::quicky_runtime_exception("Result does not fit in model coefficient type", __LINE__, __FILE__);
+                }
+                if(p_value == to_exact(std::numeric_limits<COEF_TYPE>::min()))
+                {
+                    return std::numeric_limits<COEF_TYPE>::min();
+                }
+                bool l_negative = p_value < t_exact_type(0);
+                t_exact_type l_value = l_negative ? t_exact_type(0) - p_value : p_value;
+                // Invariant: to_exact(l_low) <= l_value < to_exact(l_high + 1)
+                COEF_TYPE l_low = 0;
+                COEF_TYPE l_high = std::numeric_limits<COEF_TYPE>::max();
+                while(l_low < l_high)
+                {
+                    COEF_TYPE l_middle = l_low + (l_high - l_low) / 2 + 1;
+                    if(l_value < to_exact(l_middle))
+                    {
+                        l_high = l_middle - 1;
+                    }
+                    else
+                    {
+                        l_low = l_middle;
+                    }
+                }
+                return l_negative ? -l_low : l_low;
+            }
+
+            /**
+             * Objective value computed from truncated variable values like
+             * integer solvers do
+             * @return objective value
+             */
+            COEF_TYPE
+            compute_objective() const
+            {
+                std::vector<t_exact_type> l_values = m_solver.get_variable_values();
+                t_exact_type l_objective(0);
+                for(unsigned int l_index = 0; l_index < l_values.size(); ++l_index)
+                {
+                    l_objective = l_objective + to_exact(m_Z_coefs[l_index]) * to_exact(truncate(l_values[l_index]));
+                }
+                return truncate(l_objective);
+            }
+
+            simplex_solver<t_exact_type> m_solver;
+
+            /**
+             * Objective function coefficients with model coefficient type
+             */
+            std::vector<COEF_TYPE> m_Z_coefs;
+        };
+
+        /**
+         * Create a solver with given width and fill it with model
+         * @param p_width number of bits of integers, 0 for arbitrary
+         * precision
+         * @return solver or nullptr if width is not supported
+         */
+        inline
+        std::unique_ptr<tier_if>
+        create_tier(unsigned int p_width) const;
+
+        /**
+         * Width following a given one in promotion sequence
+         * @param p_width number of bits of integers
+         * @return next number of bits of integers, 0 for arbitrary precision
+         */
+        inline static
+        unsigned int
+        get_next_width(unsigned int p_width);
+
+        /**
+         * Replace current solver by a wider one restarting from basis of
+         * current solver
+         */
+        inline
+        void
+        promote();
+
+        unsigned int m_nb_variables;
+        unsigned int m_nb_inequations_lt;
+        unsigned int m_nb_equations;
+        unsigned int m_nb_inequations_gt;
+        unsigned int m_nb_total_equations;
+
+        /**
+         * Model as defined by user
+         */
+        std::vector<COEF_TYPE> m_Z_coefs;
+        std::vector<COEF_TYPE> m_B_coefs;
+        std::vector<COEF_TYPE> m_A_coefs;
+        std::vector<t_equation_type> m_equation_types;
+        std::vector<unsigned int> m_base_variables;
+
+        std::unique_ptr<tier_if> m_tier;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::simplex_solver_integer_promoting(unsigned int p_nb_variables
+                                                                                        ,unsigned int p_nb_inequations_lt
+                                                                                        ,unsigned int p_nb_equations
+                                                                                        ,unsigned int p_nb_inequations_gt
+                                                                                        )
+    :m_nb_variables(p_nb_variables)
+    ,m_nb_inequations_lt(p_nb_inequations_lt)
+    ,m_nb_equations(p_nb_equations)
+    ,m_nb_inequations_gt(p_nb_inequations_gt)
+    ,m_nb_total_equations(p_nb_inequations_lt + p_nb_equations + p_nb_inequations_gt)
+    ,m_Z_coefs(p_nb_variables, COEF_TYPE(0))
+    ,m_B_coefs(m_nb_total_equations, COEF_TYPE(0))
+    ,m_A_coefs(m_nb_total_equations * p_nb_variables, COEF_TYPE(0))
+    ,m_equation_types(m_nb_total_equations, t_equation_type::UNDEFINED)
+    ,m_tier(create_tier(8 * sizeof(COEF_TYPE)))
+    {
+        static_assert(std::is_same<COEF_TYPE, int32_t>::value || std::is_same<COEF_TYPE, int64_t>::value, "Promoting simplex solver accept only 32 or 64 bits integers");
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::set_Z_coef(const unsigned int p_index
+                                                                  ,const COEF_TYPE & p_value
+                                                                  )
+    {
+        assert(p_index < m_nb_variables);
+        m_Z_coefs[p_index] = p_value;
+        m_tier->set_Z_coef(p_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::set_B_coef(const unsigned int p_index
+                                                                  ,const COEF_TYPE & p_value
+                                                                  )
+    {
+        assert(p_index < m_nb_total_equations);
+        m_B_coefs[p_index] = p_value;
+        m_tier->set_B_coef(p_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::set_A_coef(const unsigned int p_equation_index
+                                                                  ,const unsigned int p_variable_index
+                                                                  ,const COEF_TYPE & p_value
+                                                                  )
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        assert(p_variable_index < m_nb_variables);
+        m_A_coefs[p_equation_index * m_nb_variables + p_variable_index] = p_value;
+        m_tier->set_A_coef(p_equation_index, p_variable_index, p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::define_equation_type(const unsigned int & p_equation_index
+                                                                            ,const t_equation_type & p_type
+                                                                            )
+    {
+        assert(p_equation_index < m_nb_total_equations);
+        m_equation_types[p_equation_index] = p_type;
+        m_tier->define_equation_type(p_equation_index, p_type);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::define_base_variable(const unsigned int & p_variable_index)
+    {
+        m_base_variables.push_back(p_variable_index);
+        m_tier->define_base_variable(p_variable_index);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    template <class LISTENER>
+    bool
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::find_max(COEF_TYPE & p_max
+                                                                ,bool & p_infinite
+                                                                ,LISTENER * p_listener
+                                                                )
+    {
+        for(;;)
+        {
+            try
+            {
+                return m_tier->find_max(p_max, p_infinite, p_listener);
+            }
+            catch(const simplex_overflow_exception &)
+            {
+                promote();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    template <class LISTENER>
+    bool
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::find_min(COEF_TYPE & p_min
+                                                                ,bool & p_infinite
+                                                                ,LISTENER * p_listener
+                                                                )
+    {
+        for(;;)
+        {
+            try
+            {
+                return m_tier->find_min(p_min, p_infinite, p_listener);
+            }
+            catch(const simplex_overflow_exception &)
+            {
+                promote();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    bool
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::check_variables(const std::vector<COEF_TYPE> & p_values)
+    {
+        return m_tier->check_variables(p_values);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    std::vector<COEF_TYPE>
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::get_variable_values() const
+    {
+        return m_tier->get_variable_values();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    std::ostream &
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::display_array(std::ostream & p_stream) const
+    {
+        return m_tier->display_array(p_stream);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    unsigned int
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::get_coef_width() const
+    {
+        return m_tier->get_width();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    std::unique_ptr<typename simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::tier_if>
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::create_tier(unsigned int p_width) const
+    {
+        std::unique_ptr<tier_if> l_tier;
+        switch(p_width)
+        {
+            case 32:
+                l_tier.reset(new tier<int32_t>(m_nb_variables, m_nb_inequations_lt, m_nb_equations, m_nb_inequations_gt));
+                break;
+            case 64:
+                l_tier.reset(new tier<int64_t>(m_nb_variables, m_nb_inequations_lt, m_nb_equations, m_nb_inequations_gt));
+                break;
+#ifdef SIMPLEX_INT128
+            case 128:
+                l_tier.reset(new tier<simplex_int128>(m_nb_variables, m_nb_inequations_lt, m_nb_equations, m_nb_inequations_gt));
+                break;
+#endif // SIMPLEX_INT128
+            case 0:
+                l_tier.reset(new exact_tier(m_nb_variables, m_nb_inequations_lt, m_nb_equations, m_nb_inequations_gt));
+                break;
+            default:
+                return l_tier;
+        }
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < m_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(m_Z_coefs[l_variable_index])
+            {
+                l_tier->set_Z_coef(l_variable_index, m_Z_coefs[l_variable_index]);
+            }
+        }
+        for(unsigned int l_equation_index = 0;
+            l_equation_index < m_nb_total_equations;
+            ++l_equation_index
+           )
+        {
+            for(unsigned int l_variable_index = 0;
+                l_variable_index < m_nb_variables;
+                ++l_variable_index
+               )
+            {
+                const COEF_TYPE & l_coef = m_A_coefs[l_equation_index * m_nb_variables + l_variable_index];
+                if(l_coef)
+                {
+                    l_tier->set_A_coef(l_equation_index, l_variable_index, l_coef);
+                }
+            }
+            l_tier->set_B_coef(l_equation_index, m_B_coefs[l_equation_index]);
+            if(t_equation_type::UNDEFINED != m_equation_types[l_equation_index])
+            {
+                l_tier->define_equation_type(l_equation_index, m_equation_types[l_equation_index]);
+            }
+        }
+        for(auto l_variable_index: m_base_variables)
+        {
+            l_tier->define_base_variable(l_variable_index);
+        }
+        return l_tier;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    unsigned int
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::get_next_width(unsigned int p_width)
+    {
+#ifdef SIMPLEX_INT128
+        return p_width < 128 ? 2 * p_width : 0;
+#else // SIMPLEX_INT128
+        return p_width < 64 ? 2 * p_width : 0;
+#endif // SIMPLEX_INT128
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename COEF_TYPE, template <typename...> class SOLVER>
+    void
+    simplex_solver_integer_promoting<COEF_TYPE,SOLVER>::promote()
+    {
+        // Base variables are only updated once pivot succeeded so basis is
+        // the one before the failed pivot
+        std::vector<unsigned int> l_basis = m_tier->get_basis();
+        unsigned int l_width = m_tier->get_width();
+        for(;;)
+        {
+            if(!l_width)
+            {
+                throw simplex_overflow_exception("Tableau coefficients overflow arbitrary precision type", __LINE__, __FILE__);
+            }
+            l_width = get_next_width(l_width);
+            std::unique_ptr<tier_if> l_tier = create_tier(l_width);
+            assert(l_tier);
+            try
+            {
+                l_tier->set_basis(l_basis);
+                m_tier = std::move(l_tier);
+                return;
+            }
+            catch(const simplex_overflow_exception &)
+            {
+                // Pivots done to reach basis overflow too: try wider
+            }
+        }
+    }
+}
+
+#endif //SIMPLEX_SOLVER_INTEGER_PROMOTING_H
+// EOF
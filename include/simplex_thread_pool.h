@@ -0,0 +1,255 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_THREAD_POOL_H
+#define SIMPLEX_THREAD_POOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <vector>
+#include <cassert>
+
+namespace simplex
+{
+    /**
+     * Pool of threads created once and reused to share a range of items
+     * between threads. Calling thread takes its part of the work so a pool
+     * of N threads only creates N - 1 workers
+     */
+    class simplex_thread_pool
+    {
+      public:
+        /**
+         * Create pool
+         * @param p_nb_threads total number of threads including calling thread
+         */
+        inline explicit
+        simplex_thread_pool(unsigned int p_nb_threads);
+
+        simplex_thread_pool(const simplex_thread_pool &) = delete;
+
+        simplex_thread_pool & operator=(const simplex_thread_pool &) = delete;
+
+        inline
+        ~simplex_thread_pool();
+
+        /**
+         * Return total number of threads including calling thread
+         * @return number of threads
+         */
+        inline
+        unsigned int get_nb_threads() const;
+
+        /**
+         * Split items in contiguous ranges, one per thread, and call task
+         * for each range. Return when all ranges have been processed. If a
+         * task throw an exception it is rethrown in calling thread
+         * @param p_nb_items number of items
+         * @param p_task task called with first item index and end item index
+         */
+        inline
+        void parallel_for(unsigned int p_nb_items
+                         ,const std::function<void(unsigned int, unsigned int)> & p_task
+                         );
+
+      private:
+        /**
+         * Main loop of workers
+         * @param p_thread_index index of thread, 0 being calling thread
+         */
+        inline
+        void work(unsigned int p_thread_index);
+
+        /**
+         * Call task on range of a thread
+         * @param p_thread_index index of thread, 0 being calling thread
+         */
+        inline
+        void run_range(unsigned int p_thread_index);
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_start_condition;
+        std::condition_variable m_end_condition;
+
+        /**
+         * Task of current parallel_for
+         */
+        const std::function<void(unsigned int, unsigned int)> * m_task;
+
+        /**
+         * Number of items of current parallel_for
+         */
+        unsigned int m_nb_items;
+
+        /**
+         * Incremented at each parallel_for to wake up workers
+         */
+        unsigned long m_generation;
+
+        /**
+         * Number of workers still processing their range
+         */
+        unsigned int m_nb_running;
+
+        /**
+         * First exception thrown by a task
+         */
+        std::exception_ptr m_exception;
+
+        bool m_stop;
+    };
+
+    //-------------------------------------------------------------------------
+    simplex_thread_pool::simplex_thread_pool(unsigned int p_nb_threads)
+    :m_task(nullptr)
+    ,m_nb_items(0)
+    ,m_generation(0)
+    ,m_nb_running(0)
+    ,m_stop(false)
+    {
+        assert(p_nb_threads);
+        for(unsigned int l_index = 1; l_index < p_nb_threads; ++l_index)
+        {
+            m_workers.emplace_back(&simplex_thread_pool::work, this, l_index);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    simplex_thread_pool::~simplex_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_stop = true;
+        }
+        m_start_condition.notify_all();
+        for(auto & l_worker: m_workers)
+        {
+            l_worker.join();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    unsigned int
+    simplex_thread_pool::get_nb_threads() const
+    {
+        return (unsigned int)m_workers.size() + 1;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_thread_pool::parallel_for(unsigned int p_nb_items
+                                     ,const std::function<void(unsigned int, unsigned int)> & p_task
+                                     )
+    {
+        if(m_workers.empty())
+        {
+            p_task(0, p_nb_items);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_task = &p_task;
+            m_nb_items = p_nb_items;
+            m_nb_running = (unsigned int)m_workers.size();
+            m_exception = nullptr;
+            ++m_generation;
+        }
+        m_start_condition.notify_all();
+
+        try
+        {
+            run_range(0);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            if(!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+        }
+
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_end_condition.wait(l_lock, [this]{return !m_nb_running;});
+        m_task = nullptr;
+        if(m_exception)
+        {
+            std::exception_ptr l_exception = m_exception;
+            m_exception = nullptr;
+            std::rethrow_exception(l_exception);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_thread_pool::work(unsigned int p_thread_index)
+    {
+        unsigned long l_generation = 0;
+        for(;;)
+        {
+            {
+                std::unique_lock<std::mutex> l_lock(m_mutex);
+                m_start_condition.wait(l_lock, [&]{return m_stop || m_generation != l_generation;});
+                if(m_stop)
+                {
+                    return;
+                }
+                l_generation = m_generation;
+            }
+            try
+            {
+                run_range(p_thread_index);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> l_lock(m_mutex);
+                if(!m_exception)
+                {
+                    m_exception = std::current_exception();
+                }
+            }
+            bool l_last;
+            {
+                std::lock_guard<std::mutex> l_lock(m_mutex);
+                l_last = !--m_nb_running;
+            }
+            if(l_last)
+            {
+                m_end_condition.notify_one();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    simplex_thread_pool::run_range(unsigned int p_thread_index)
+    {
+        unsigned int l_nb_threads = get_nb_threads();
+        unsigned int l_begin = (unsigned int)(((unsigned long long)m_nb_items * p_thread_index) / l_nb_threads);
+        unsigned int l_end = (unsigned int)(((unsigned long long)m_nb_items * (p_thread_index + 1)) / l_nb_threads);
+        if(l_begin < l_end)
+        {
+            (*m_task)(l_begin, l_end);
+        }
+    }
+}
+#endif //SIMPLEX_THREAD_POOL_H
+// EOF
@@ -0,0 +1,74 @@
+/*    This file is part of simplex
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef SIMPLEX_TOLERANCE_H
+#define SIMPLEX_TOLERANCE_H
+
+namespace simplex
+{
+    /**
+     * Tolerance used to decide if a recomputed coefficient is null.
+     * Exact types like integers or fractions have no tolerance, floating
+     * point types use a small value to absorb rounding errors
+     * @tparam COEF_TYPE Type of coefficients
+     */
+    template <typename COEF_TYPE>
+    class simplex_tolerance
+    {
+      public:
+        inline static
+        COEF_TYPE get()
+        {
+            return COEF_TYPE(0);
+        }
+    };
+
+    template <>
+    class simplex_tolerance<float>
+    {
+      public:
+        inline static
+        float get()
+        {
+            return 1e-5f;
+        }
+    };
+
+    template <>
+    class simplex_tolerance<double>
+    {
+      public:
+        inline static
+        double get()
+        {
+            return 1e-9;
+        }
+    };
+
+    template <>
+    class simplex_tolerance<long double>
+    {
+      public:
+        inline static
+        long double get()
+        {
+            return 1e-12L;
+        }
+    };
+}
+#endif //SIMPLEX_TOLERANCE_H
+// EOF
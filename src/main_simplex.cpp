@@ -28,13 +28,53 @@
 #include "fract.h"
 #include "simplex_listener.h"
 #include "simplex_map.h"
+#include "simplex_csr_array.h"
+#include "simplex_column_array.h"
+#include "simplex_implicit_slack_array.h"
 #include "simplex_solver.h"
 #include "simplex_solver_integer.h"
 #include "simplex_solver_integer_ppcm.h"
+#include "simplex_solver_integer_bareiss.h"
+#include "simplex_solver_integer_promoting.h"
 #include "simplex_identity_solver.h"
+#include "simplex_revised_solver.h"
+#include "simplex_pricing.h"
+#include "simplex_counting_listener.h"
+#include "simplex_basis_file.h"
+#include "simplex_presolve.h"
+#include "simplex_row_kernel.h"
+#include "simplex_gcd_kernel.h"
 #include "equation_system.h"
 #include "simplex_solver_glpk.h"
 #include <vector>
+#include <random>
+#include <chrono>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+/**
+ * Solver sharing pivots between threads whatever the tableau size so that
+ * parallel pivot is exercised by small test cases
+ * @tparam SIMPLEX_TYPE solver type
+ */
+template <typename SIMPLEX_TYPE>
+class multi_threaded_solver: public SIMPLEX_TYPE
+{
+  public:
+    multi_threaded_solver(unsigned int p_nb_variables,
+                          unsigned int p_nb_inequations_lt,
+                          unsigned int p_nb_equations,
+                          unsigned int p_nb_inequations_gt
+                         ):
+        SIMPLEX_TYPE(p_nb_variables, p_nb_inequations_lt, p_nb_equations, p_nb_inequations_gt)
+    {
+        this->set_nb_threads(4);
+        this->set_parallel_threshold(0);
+    }
+};
 
 template <typename SIMPLEX_TYPE>
 bool test_case1();
@@ -42,12 +82,115 @@ bool test_case1();
 template <typename SIMPLEX_TYPE>
 bool test_case2();
 
+template <typename SIMPLEX_TYPE>
+bool test_bounds();
+
+template <typename SIMPLEX_TYPE>
+bool test_dual();
+
+template <typename SIMPLEX_TYPE>
+bool test_phase_1();
+
+template <typename SIMPLEX_TYPE>
+bool test_infeasible_restart();
+
+template <typename SIMPLEX_TYPE>
+bool test_first_phase_resume();
+
+template <typename SIMPLEX_TYPE>
+bool test_basis();
+
+template <typename SIMPLEX_TYPE>
+bool test_incremental(bool p_add_variable_after_search);
+
+template <typename SIMPLEX_TYPE>
+bool test_scope(bool p_fixing_bounds);
+
+template <typename SIMPLEX_TYPE>
+bool test_presolve();
+
+bool test_presolve_case3();
+
+template <typename SIMPLEX_TYPE>
+bool test_scaling(bool p_bounds);
+
+template <typename SIMPLEX_TYPE>
+bool test_degeneracy(bool p_perturbation);
+
+template <typename SIMPLEX_TYPE>
+bool test_solve_options();
+
+template <typename SIMPLEX_TYPE>
+bool test_find_min();
+
+template <typename SIMPLEX_TYPE>
+bool test_find_min_gt();
+
+template <typename SIMPLEX_TYPE>
+bool test_dual_values();
+
+template <typename IDENTITY_TYPE>
+bool test_identity_mixed();
+
+template <typename IDENTITY_TYPE>
+bool test_identity_random_mixed();
+
+template <typename SIMPLEX_TYPE>
+bool test_sensitivity_ranges(bool p_scaling);
+
+template <typename SIMPLEX_TYPE>
+bool test_sensitivity_bounds();
+
 template <typename SIMPLEX_TYPE>
 bool
 test_case3(const std::string & p_suffix);
 
 bool test_simplex_identity_solver();
 
+bool test_array_allocators();
+
+template <typename ROW_SIMPLEX_TYPE, typename COLUMN_SIMPLEX_TYPE>
+bool test_array_layout();
+
+bool test_implicit_slack_array();
+
+bool test_integer_bareiss();
+
+bool test_integer_promoting();
+
+void bench_pricing();
+
+bool test_steepest_edge_pricing();
+
+bool check_close(double p_value,
+                 double p_expected,
+                 const std::string & p_name
+                );
+
+void bench_array();
+
+void bench_layout();
+
+template <typename COEF_TYPE>
+bool test_row_kernel();
+
+void bench_row_kernel();
+
+template <typename COEF_TYPE>
+bool test_gcd_kernel();
+
+bool test_basis_factorization();
+
+void bench_gcd_kernel();
+
+void bench_threads();
+
+void bench_phase_1();
+
+void bench_scaling();
+
+void bench_integer();
+
 bool test_simplex_solver_glpk();
 
 using namespace quicky_utils;
@@ -59,6 +202,20 @@ int main(int argc,char ** argv)
     bool l_ok = true;
     try
     {
+        if(argc > 1 && std::string("bench") == argv[1])
+        {
+            bench_pricing();
+            bench_array();
+            bench_layout();
+            bench_row_kernel();
+            bench_gcd_kernel();
+            bench_threads();
+            bench_phase_1();
+            bench_scaling();
+            bench_integer();
+            return 0;
+        }
+
         l_ok &= test_simplex_solver_glpk();
 
         l_ok &= test_my_matrix();
@@ -67,14 +224,49 @@ int main(int argc,char ** argv)
 
         l_ok &= test_simplex_identity_solver();
 
+        std::cout << "============ TEST ARRAY ALLOCATORS ==============" << std::endl;
+        l_ok &= test_array_allocators();
+
+        std::cout << "============ TEST ARRAY LAYOUT ==============" << std::endl;
+        l_ok &= test_array_layout<simplex::simplex_solver<double>,simplex::simplex_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST ARRAY LAYOUT " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==============" << std::endl;
+        l_ok &= test_array_layout<simplex::simplex_solver<quicky_utils::fract<ext_int<int32_t>>>,simplex::simplex_solver<quicky_utils::fract<ext_int<int32_t>>,simplex::simplex_column_array<quicky_utils::fract<ext_int<int32_t>>>>>();
+        std::cout << "============ TEST ARRAY LAYOUT implicit slack ==============" << std::endl;
+        l_ok &= test_array_layout<simplex::simplex_solver<double>,simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>>();
+
+        std::cout << "============ TEST IMPLICIT SLACK ARRAY ==============" << std::endl;
+        l_ok &= test_implicit_slack_array();
+
+        std::cout << "============ TEST INTEGER BAREISS ==============" << std::endl;
+        l_ok &= test_integer_bareiss();
+
+        std::cout << "============ TEST INTEGER PROMOTING ==============" << std::endl;
+        l_ok &= test_integer_promoting();
+
         std::cout << "============ TEST CASE 1 GLPK ==============" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver_glpk>();
+        std::cout << "============ ROW KERNEL double ==============" << std::endl;
+        l_ok &= test_row_kernel<double>();
+        std::cout << "============ ROW KERNEL float ==============" << std::endl;
+        l_ok &= test_row_kernel<float>();
+        std::cout << "============ GCD KERNEL int32_t ==============" << std::endl;
+        l_ok &= test_gcd_kernel<int32_t>();
+        std::cout << "============ GCD KERNEL int64_t ==============" << std::endl;
+        l_ok &= test_gcd_kernel<int64_t>();
+        std::cout << "============ BASIS FACTORIZATION ==============" << std::endl;
+        l_ok &= test_basis_factorization();
         std::cout << "============ TEST CASE 1 ==============" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST CASE 1 float ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<float>>();
         std::cout << "============ TEST CASE 1 ==============" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver_integer<int32_t>>();
         std::cout << "============ TEST CASE 1 ==============" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST CASE 1 bareiss ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST CASE 1 promoting ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver_integer_promoting<int32_t>>();
         std::cout << "============ TEST CASE 1 ==============" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
         std::cout << "============ TEST CASE 1 bis==============" << std::endl;
@@ -83,24 +275,274 @@ int main(int argc,char ** argv)
         l_ok &= test_case1<simplex::simplex_solver<quicky_utils::fract<quicky_utils::safe_uint32_t>,simplex::simplex_map<quicky_utils::fract<quicky_utils::safe_uint32_t>>>>();
         std::cout << "============ TEST CASE 1 " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==========" << std::endl;
         l_ok &= test_case1<simplex::simplex_solver<quicky_utils::fract<ext_int<int32_t>>>>();
+        std::cout << "============ TEST CASE 1 REVISED ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST CASE 1 CSR ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<double,simplex::simplex_csr_array<double>>>();
+        std::cout << "============ TEST CASE 1 COLUMN ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST CASE 1 COLUMN " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==========" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<quicky_utils::fract<ext_int<int32_t>>,simplex::simplex_column_array<quicky_utils::fract<ext_int<int32_t>>>>>();
+        std::cout << "============ TEST CASE 1 IMPLICIT SLACK ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>>();
+        std::cout << "============ TEST CASE 1 huge pages ==============" << std::endl;
+        l_ok &= test_case1<simplex::simplex_solver<double,simplex::simplex_array<double,simplex::simplex_huge_page_allocator<double>>>>();
         std::cout << "============ TEST CASE 2 ==============" << std::endl;
         l_ok &= test_case2<simplex::simplex_solver<double>>();
         std::cout << "============ TEST CASE 2 bis ==============" << std::endl;
         l_ok &= test_case2<simplex::simplex_solver_integer<int32_t>>();
         std::cout << "============ TEST CASE 2 ter ==============" << std::endl;
         l_ok &= test_case2<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST CASE 2 bareiss ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST CASE 2 promoting ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver_integer_promoting<int32_t>>();
         std::cout << "============ TEST CASE 2 " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==============" << std::endl;
         l_ok &= test_case2<simplex::simplex_solver<quicky_utils::fract<quicky_utils::ext_int<int32_t>>>>();
         std::cout << "============ TEST CASE 2 GLPK ==============" << std::endl;
         l_ok &= test_case2<simplex::simplex_solver_glpk>();
+        std::cout << "============ TEST CASE 2 REVISED ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST CASE 2 CSR ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver_integer<int32_t,simplex::simplex_csr_array<int32_t>>>();
+        std::cout << "============ TEST CASE 2 COLUMN ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST CASE 2 IMPLICIT SLACK ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver_integer<int32_t,simplex::simplex_implicit_slack_array<int32_t>>>();
+        std::cout << "============ TEST CASE 2 DANTZIG ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_dantzig<double>>>();
+        std::cout << "============ TEST CASE 2 PARTIAL ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver_integer<int32_t,simplex::simplex_array<int32_t>,simplex::simplex_pricing_partial<int32_t>>>();
+        std::cout << "============ TEST CASE 2 DEVEX ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_devex<double>>>();
+        std::cout << "============ TEST CASE 2 STEEPEST EDGE ==============" << std::endl;
+        l_ok &= test_case2<simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_steepest_edge<double>>>();
+        std::cout << "============ STEEPEST EDGE PRICING ==============" << std::endl;
+        l_ok &= test_steepest_edge_pricing();
+        std::cout << "============ TEST BOUNDS ==============" << std::endl;
+        l_ok &= test_bounds<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST BOUNDS map ==============" << std::endl;
+        l_ok &= test_bounds<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST DUAL ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST DUAL map ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST DUAL integer ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST DUAL ppcm ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST DUAL bareiss ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST DUAL REVISED ==============" << std::endl;
+        l_ok &= test_dual<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST PHASE 1 ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST PHASE 1 map ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST PHASE 1 integer ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST PHASE 1 ppcm ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST PHASE 1 bareiss ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST PHASE 1 promoting ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_solver_integer_promoting<int32_t>>();
+        std::cout << "============ TEST PHASE 1 REVISED ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST PHASE 1 IDENTITY ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST PHASE 1 IDENTITY COLUMN ==============" << std::endl;
+        l_ok &= test_phase_1<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST INFEASIBLE RESTART ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST INFEASIBLE RESTART map ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST INFEASIBLE RESTART integer ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST INFEASIBLE RESTART ppcm ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST INFEASIBLE RESTART bareiss ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST INFEASIBLE RESTART REVISED ==============" << std::endl;
+        l_ok &= test_infeasible_restart<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST FIRST PHASE RESUME ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST FIRST PHASE RESUME map ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST FIRST PHASE RESUME integer ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST FIRST PHASE RESUME ppcm ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST FIRST PHASE RESUME bareiss ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST FIRST PHASE RESUME REVISED ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST FIRST PHASE RESUME IDENTITY ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST FIRST PHASE RESUME IDENTITY COLUMN ==============" << std::endl;
+        l_ok &= test_first_phase_resume<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST BASIS ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST BASIS map ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_solver<double,simplex::simplex_map<double>>>();
+        std::cout << "============ TEST BASIS integer ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST BASIS ppcm ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST BASIS bareiss ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST BASIS REVISED ==============" << std::endl;
+        l_ok &= test_basis<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST INCREMENTAL ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver<double>>(true);
+        std::cout << "============ TEST INCREMENTAL map ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver<double,simplex::simplex_map<double>>>(true);
+        std::cout << "============ TEST INCREMENTAL column ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver<double,simplex::simplex_column_array<double>>>(true);
+        std::cout << "============ TEST INCREMENTAL implicit slack ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>>(true);
+        std::cout << "============ TEST INCREMENTAL integer ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver_integer<int32_t>>(false);
+        std::cout << "============ TEST INCREMENTAL ppcm ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver_integer_ppcm<int32_t>>(false);
+        std::cout << "============ TEST INCREMENTAL bareiss ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_solver_integer_bareiss<int32_t>>(false);
+        std::cout << "============ TEST INCREMENTAL REVISED ==============" << std::endl;
+        l_ok &= test_incremental<simplex::simplex_revised_solver<double>>(true);
+        std::cout << "============ TEST SCOPE ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver<double>>(true);
+        std::cout << "============ TEST SCOPE map ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver<double,simplex::simplex_map<double>>>(true);
+        std::cout << "============ TEST SCOPE csr ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver<double,simplex::simplex_csr_array<double>>>(true);
+        std::cout << "============ TEST SCOPE column ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver<double,simplex::simplex_column_array<double>>>(true);
+        std::cout << "============ TEST SCOPE implicit slack ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>>(true);
+        std::cout << "============ TEST SCOPE integer ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver_integer<int32_t>>(false);
+        std::cout << "============ TEST SCOPE ppcm ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver_integer_ppcm<int32_t>>(false);
+        std::cout << "============ TEST SCOPE bareiss ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_solver_integer_bareiss<int32_t>>(false);
+        std::cout << "============ TEST SCOPE REVISED ==============" << std::endl;
+        l_ok &= test_scope<simplex::simplex_revised_solver<double>>(false);
+        std::cout << "============ TEST PRESOLVE ==============" << std::endl;
+        l_ok &= test_presolve<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST PRESOLVE integer ==============" << std::endl;
+        l_ok &= test_presolve<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST PRESOLVE REVISED ==============" << std::endl;
+        l_ok &= test_presolve<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST PRESOLVE CASE 3 ==============" << std::endl;
+        l_ok &= test_presolve_case3();
+        std::cout << "============ TEST SCALING ==============" << std::endl;
+        l_ok &= test_scaling<simplex::simplex_solver<double>>(true);
+        std::cout << "============ TEST SCALING map ==============" << std::endl;
+        l_ok &= test_scaling<simplex::simplex_solver<double,simplex::simplex_map<double>>>(true);
+        std::cout << "============ TEST SCALING REVISED ==============" << std::endl;
+        l_ok &= test_scaling<simplex::simplex_revised_solver<double>>(false);
+        std::cout << "============ TEST DEGENERACY ==============" << std::endl;
+        l_ok &= test_degeneracy<simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_dantzig<double>>>(false);
+        std::cout << "============ TEST DEGENERACY perturbation ==============" << std::endl;
+        l_ok &= test_degeneracy<simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_dantzig<double>>>(true);
+        std::cout << "============ TEST DEGENERACY integer ==============" << std::endl;
+        l_ok &= test_degeneracy<simplex::simplex_solver_integer<int32_t,simplex::simplex_array<int32_t>,simplex::simplex_pricing_dantzig<int32_t>>>(false);
+        std::cout << "============ TEST SOLVE OPTIONS ==============" << std::endl;
+        l_ok &= test_solve_options<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST SOLVE OPTIONS integer ==============" << std::endl;
+        l_ok &= test_solve_options<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST SOLVE OPTIONS REVISED ==============" << std::endl;
+        l_ok &= test_solve_options<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST SOLVE OPTIONS IDENTITY ==============" << std::endl;
+        l_ok &= test_solve_options<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST FIND MIN ==============" << std::endl;
+        l_ok &= test_find_min<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST FIND MIN integer ==============" << std::endl;
+        l_ok &= test_find_min<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST FIND MIN REVISED ==============" << std::endl;
+        l_ok &= test_find_min<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST FIND MIN IDENTITY ==============" << std::endl;
+        l_ok &= test_find_min<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST FIND MIN IDENTITY COLUMN ==============" << std::endl;
+        l_ok &= test_find_min<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST FIND MIN GT ==============" << std::endl;
+        l_ok &= test_find_min_gt<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST FIND MIN GT integer ==============" << std::endl;
+        l_ok &= test_find_min_gt<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST FIND MIN GT REVISED ==============" << std::endl;
+        l_ok &= test_find_min_gt<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST FIND MIN GT IDENTITY ==============" << std::endl;
+        l_ok &= test_find_min_gt<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST DUAL VALUES ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_solver<double>>();
+        std::cout << "============ TEST DUAL VALUES " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_solver<quicky_utils::fract<quicky_utils::ext_int<int32_t>>>>();
+        std::cout << "============ TEST DUAL VALUES integer ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_solver_integer<int32_t>>();
+        std::cout << "============ TEST DUAL VALUES ppcm ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_solver_integer_ppcm<int32_t>>();
+        std::cout << "============ TEST DUAL VALUES bareiss ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_solver_integer_bareiss<int32_t>>();
+        std::cout << "============ TEST DUAL VALUES REVISED ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_revised_solver<double>>();
+        std::cout << "============ TEST DUAL VALUES IDENTITY ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST DUAL VALUES IDENTITY COLUMN ==============" << std::endl;
+        l_ok &= test_dual_values<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST IDENTITY MIXED ==============" << std::endl;
+        l_ok &= test_identity_mixed<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST IDENTITY MIXED COLUMN ==============" << std::endl;
+        l_ok &= test_identity_mixed<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST IDENTITY RANDOM MIXED ==============" << std::endl;
+        l_ok &= test_identity_random_mixed<simplex::simplex_identity_solver<double>>();
+        std::cout << "============ TEST IDENTITY RANDOM MIXED COLUMN ==============" << std::endl;
+        l_ok &= test_identity_random_mixed<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>();
+        std::cout << "============ TEST SENSITIVITY RANGES ==============" << std::endl;
+        l_ok &= test_sensitivity_ranges<simplex::simplex_solver<double>>(false);
+        std::cout << "============ TEST SENSITIVITY RANGES scaled ==============" << std::endl;
+        l_ok &= test_sensitivity_ranges<simplex::simplex_solver<double>>(true);
+        std::cout << "============ TEST SENSITIVITY RANGES map ==============" << std::endl;
+        l_ok &= test_sensitivity_ranges<simplex::simplex_solver<double,simplex::simplex_map<double>>>(false);
+        std::cout << "============ TEST SENSITIVITY RANGES REVISED ==============" << std::endl;
+        l_ok &= test_sensitivity_ranges<simplex::simplex_revised_solver<double>>(false);
+        std::cout << "============ TEST SENSITIVITY BOUNDS ==============" << std::endl;
+        l_ok &= test_sensitivity_bounds<simplex::simplex_solver<double>>();
         std::cout << "============ TEST CASE 3 ==============" << std::endl;
         l_ok &= test_case3<simplex::simplex_solver<double>>("double");
         std::cout << "============ TEST CASE 3 bis ==============" << std::endl;
         l_ok &= test_case3<simplex::simplex_solver_integer<int32_t>>("integer");
         std::cout << "============ TEST CASE 3 ter ==============" << std::endl;
         l_ok &= test_case3<simplex::simplex_solver_integer_ppcm<int32_t>>("integer_ppcm");
+        std::cout << "============ TEST CASE 3 bareiss ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_bareiss<int32_t>>("integer_bareiss");
+        std::cout << "============ TEST CASE 3 promoting ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_promoting<int32_t>>("integer_promoting");
         std::cout << "============ TEST CASE 3 " << type_string<quicky_utils::fract<ext_int<int32_t>>>::name() << " ==============" << std::endl;
         l_ok &= test_case3<simplex::simplex_solver<quicky_utils::fract<quicky_utils::ext_int<int32_t>>>>("toto");
+        std::cout << "============ TEST CASE 3 REVISED ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_revised_solver<double>>("revised");
+        std::cout << "============ TEST CASE 3 CSR ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver<double,simplex::simplex_csr_array<double>>>("csr");
+        std::cout << "============ TEST CASE 3 COLUMN ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver<double,simplex::simplex_column_array<double>>>("column");
+        std::cout << "============ TEST CASE 3 IMPLICIT SLACK ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>>("implicit_slack");
+        std::cout << "============ TEST CASE 3 IMPLICIT SLACK ppcm ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_ppcm<int32_t,simplex::simplex_implicit_slack_array<int32_t>>>("implicit_slack_ppcm");
+        std::cout << "============ TEST CASE 3 IMPLICIT SLACK bareiss ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_bareiss<int32_t,simplex::simplex_implicit_slack_array<int32_t>>>("implicit_slack_bareiss");
+        std::cout << "============ TEST CASE 3 CSR ppcm ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_ppcm<int32_t,simplex::simplex_csr_array<int32_t>>>("csr_ppcm");
+        std::cout << "============ TEST CASE 3 CSR bareiss ==============" << std::endl;
+        l_ok &= test_case3<simplex::simplex_solver_integer_bareiss<int32_t,simplex::simplex_csr_array<int32_t>>>("csr_bareiss");
+        std::cout << "============ TEST CASE 3 THREADS ==============" << std::endl;
+        l_ok &= test_case3<multi_threaded_solver<simplex::simplex_solver<double>>>("threads");
+        std::cout << "============ TEST CASE 3 THREADS integer ==============" << std::endl;
+        l_ok &= test_case3<multi_threaded_solver<simplex::simplex_solver_integer<int32_t>>>("threads_integer");
+        std::cout << "============ TEST CASE 3 THREADS ppcm ==============" << std::endl;
+        l_ok &= test_case3<multi_threaded_solver<simplex::simplex_solver_integer_ppcm<int32_t>>>("threads_ppcm");
+        std::cout << "============ TEST CASE 3 THREADS bareiss ==============" << std::endl;
+        l_ok &= test_case3<multi_threaded_solver<simplex::simplex_solver_integer_bareiss<int32_t>>>("threads_bareiss");
         simplex_solver_glpk::use_mip(true);
         std::cout << "============ TEST CASE 3 GLPK ==============" << std::endl;
         l_ok &= test_case3<simplex::simplex_solver_glpk>("glpk");
@@ -433,467 +875,478 @@ typedef enum class yes_no
    //,YES
 } t_yes_no;
 
+/**
+ * Fill simplex with test case 3 model: 18 variables and 46 inequations
+ * @param p_simplex simplex to fill
+ */
 template <typename SIMPLEX_TYPE>
-bool
-test_case3(const std::string & p_suffix)
+void
+fill_test_case3(SIMPLEX_TYPE & p_simplex)
 {
-    bool l_ok = true;
-    // 3 position equations
-    // 3 pieces equations
-
-    // 18 variables : 3 pieces at 3 positions with 2 orientations : 3*3*2
-    // 54 equations : 48 : (3pieces * 2orientations) * (2pieces * 2orientations) * 2 segments
-    SIMPLEX_TYPE l_simplex(18, // Number of variables : x1 and x2
-                           //54, // Number of inequations with the form A x <= b
-                           46, // Number of inequations with the form A x <= b
-                           0, // Number of equations with the form A x = b
-                           0  // Number of inequations with the form A x >= b
-                          );
     for(unsigned int l_index = 0;
         l_index < 18;
         ++l_index
             )
     {
-        l_simplex.set_Z_coef(l_index,(typename SIMPLEX_TYPE::t_coef_type)1);
+        p_simplex.set_Z_coef(l_index,(typename SIMPLEX_TYPE::t_coef_type)1);
     }
 
     // Position equations
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P1_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P2_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P3_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P1b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P2b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos0,
                          (unsigned int)t_variable::P3b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::Pos0,
+    p_simplex.set_B_coef((unsigned int)t_equation::Pos0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::Pos0,
+    p_simplex.define_equation_type((unsigned int)t_equation::Pos0,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
 
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P1_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P2_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P3_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P1b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P2b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos1,
                          (unsigned int)t_variable::P3b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::Pos1,
+    p_simplex.set_B_coef((unsigned int)t_equation::Pos1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::Pos1,
+    p_simplex.define_equation_type((unsigned int)t_equation::Pos1,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P1_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P2_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P3_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P1b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P2b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_A_coef((unsigned int)t_equation::Pos2,
                          (unsigned int)t_variable::P3b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::Pos2,
+    p_simplex.set_B_coef((unsigned int)t_equation::Pos2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::Pos2,
+    p_simplex.define_equation_type((unsigned int)t_equation::Pos2,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
     // Pieces equation
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P1,
+    p_simplex.set_A_coef((unsigned int)t_equation::P1,
                          (unsigned int)t_variable::P1b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::P1,
+    p_simplex.set_B_coef((unsigned int)t_equation::P1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::P1,
+    p_simplex.define_equation_type((unsigned int)t_equation::P1,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P2,
+    p_simplex.set_A_coef((unsigned int)t_equation::P2,
                          (unsigned int)t_variable::P2b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::P2,
+    p_simplex.set_B_coef((unsigned int)t_equation::P2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::P2,
+    p_simplex.define_equation_type((unsigned int)t_equation::P2,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3b_0,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3b_1,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.set_A_coef((unsigned int)t_equation::P3,
+    p_simplex.set_A_coef((unsigned int)t_equation::P3,
                          (unsigned int)t_variable::P3b_2,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
 
-    l_simplex.set_B_coef((unsigned int)t_equation::P3,
+    p_simplex.set_B_coef((unsigned int)t_equation::P3,
                          (typename SIMPLEX_TYPE::t_coef_type)1
                         );
-    l_simplex.define_equation_type((unsigned int)t_equation::P3,
+    p_simplex.define_equation_type((unsigned int)t_equation::P3,
                                    simplex::t_equation_type::INEQUATION_LT
                                   );
 
     // Combination equations
 
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2b_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3b_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2b_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3b_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P2_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P2_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1b_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3b_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1b_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3b_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P3_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P3_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1b_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2b_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1b_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2b_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2b_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3b_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2b_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3b_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P2_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P2_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1b_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3b_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1b_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3b_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P3_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P3_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1b_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2b_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
-
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1b_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    l_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
-    l_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
-
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2b_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
-    //l_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
-    //l_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2b_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3b_1,(unsigned int)t_variable::P1_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2b_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3b_1,(unsigned int)t_variable::P1b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P1b_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P1b_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P1b_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P2_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P2_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1b_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3b_1,(unsigned int)t_variable::P2_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3_1,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P3_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P3_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1b_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3b_1,(unsigned int)t_variable::P2b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_0_P3b_1,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_0_P3b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_0_P3b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P3_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P3_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1b_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2b_1,(unsigned int)t_variable::P3_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1_1,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P1_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P1_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2_1,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P2_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P2_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1b_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P1b_1,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P1b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P1b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2b_1,(unsigned int)t_variable::P3b_0,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3b_0_P2b_1,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P3b_0_P2b_1,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P3b_0_P2b_1,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2b_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3b_2,(unsigned int)t_variable::P1_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2b_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3b_2,(unsigned int)t_variable::P1b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P1b_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P1b_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P1b_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P2_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P2_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1b_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3b_2,(unsigned int)t_variable::P2_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3_2,(unsigned int)t_variable::P3_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P3_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P3_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1b_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3b_2,(unsigned int)t_variable::P2b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P2b_1_P3b_2,(unsigned int)t_variable::P3b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P2b_1_P3b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P2b_1_P3b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P3_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P3_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1b_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2b_2,(unsigned int)t_variable::P3_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1_2,(unsigned int)t_variable::P1_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P1_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P1_2,simplex::t_equation_type::INEQUATION_LT);
+
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2_2,(unsigned int)t_variable::P2_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P2_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P2_2,simplex::t_equation_type::INEQUATION_LT);
 
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1b_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P1b_2,(unsigned int)t_variable::P1b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    p_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P1b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::NO);
+    p_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P1b_2,simplex::t_equation_type::INEQUATION_LT);
+
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2b_2,(unsigned int)t_variable::P3b_1,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_A_coef((unsigned int)t_equation::P3b_1_P2b_2,(unsigned int)t_variable::P2b_2,(typename SIMPLEX_TYPE::t_coef_type)1);
+    //p_simplex.set_B_coef((unsigned int)t_equation::P3b_1_P2b_2,(typename SIMPLEX_TYPE::t_coef_type)(unsigned int)t_yes_no::YES);
+    //p_simplex.define_equation_type((unsigned int)t_equation::P3b_1_P2b_2,simplex::t_equation_type::INEQUATION_LT);
+}
+
+//-----------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool
+test_case3(const std::string & p_suffix)
+{
+    bool l_ok = true;
+    // 3 position equations
+    // 3 pieces equations
+
+    // 18 variables : 3 pieces at 3 positions with 2 orientations : 3*3*2
+    // 54 equations : 48 : (3pieces * 2orientations) * (2pieces * 2orientations) * 2 segments
+    SIMPLEX_TYPE l_simplex(18, // Number of variables : x1 and x2
+                           //54, // Number of inequations with the form A x <= b
+                           46, // Number of inequations with the form A x <= b
+                           0, // Number of equations with the form A x = b
+                           0  // Number of inequations with the form A x >= b
+                          );
+    fill_test_case3(l_simplex);
 
     //  l_simplex.set_B_coef(0,200);
     //  l_simplex.set_B_coef(1,60);
@@ -959,84 +1412,2892 @@ test_case3(const std::string & p_suffix)
 }
 
 //------------------------------------------------------------------------------
-bool test_simplex_identity_solver()
+/**
+ * Fill simplex with a generated model: coefficients between 1 and 9 with
+ * 30% density, only inequations with the form A x <= b so adjustment variables are base
+ * variables. Generation is deterministic for a given seed
+ * @param p_simplex simplex to fill
+ * @param p_nb_variables number of variables
+ * @param p_nb_equations number of inequations
+ * @param p_seed seed of random generator
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_random_model(SIMPLEX_TYPE & p_simplex,
+                  unsigned int p_nb_variables,
+                  unsigned int p_nb_equations,
+                  unsigned int p_seed
+                 )
 {
-    bool l_ok = true;
-    // Example
-    // Max Z -1 * X1 - 4 * X2 - 3 * X3           = 0
-    //        2 * X1 + 2 * X2 + 1 * X3 + E1      = 4
-    //            X1 + 2 * X2 + 2 * X3 +    + E2 = 6
-    simplex::simplex_identity_solver<double> l_identity_solver(3,2);
-    l_identity_solver.set_Z_coef(0, 1);
-    l_identity_solver.set_Z_coef(1, 4);
-    l_identity_solver.set_Z_coef(2, 3);
-    l_identity_solver.set_B_coef(0, 4);
-    l_identity_solver.set_B_coef(1, 6);
-    l_identity_solver.set_A_coef(0, 0, 2);
-    l_identity_solver.set_A_coef(0, 1, 2);
-    l_identity_solver.set_A_coef(0, 2, 1);
-    l_identity_solver.set_A_coef(1, 0, 1);
-    l_identity_solver.set_A_coef(1, 1, 2);
-    l_identity_solver.set_A_coef(1, 2, 2);
-    l_identity_solver.display_array(std::cout);
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef_type;
+    std::mt19937 l_generator(p_seed);
+    std::uniform_int_distribution<int> l_Z_distribution(1, 10);
+    std::uniform_int_distribution<int> l_A_distribution(1, 9);
+    std::uniform_int_distribution<int> l_B_distribution(100, 1000);
+    std::bernoulli_distribution l_density_distribution(0.3);
+    for(unsigned int l_variable_index = 0;
+        l_variable_index < p_nb_variables;
+        ++l_variable_index
+       )
+    {
+        p_simplex.set_Z_coef(l_variable_index, (t_coef_type)l_Z_distribution(l_generator));
+    }
+    for(unsigned int l_equation_index = 0;
+        l_equation_index < p_nb_equations;
+        ++l_equation_index
+       )
+    {
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < p_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(l_density_distribution(l_generator))
+            {
+                p_simplex.set_A_coef(l_equation_index, l_variable_index, (t_coef_type)l_A_distribution(l_generator));
+            }
+        }
+        p_simplex.set_B_coef(l_equation_index, (t_coef_type)l_B_distribution(l_generator));
+        p_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+}
 
-    double l_max = 0;
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+void
+bench_simplex(const std::string & p_policy_name,
+              const std::string & p_model_name,
+              SIMPLEX_TYPE & p_simplex
+             )
+{
+    auto l_max = (typename SIMPLEX_TYPE::t_coef_type)0;
     bool l_infinite = false;
-    simplex::simplex_listener<double> l_listener(l_identity_solver);
-    if(l_identity_solver.find_max(l_max,l_infinite,&l_listener))
+    simplex::simplex_counting_listener<typename SIMPLEX_TYPE::t_coef_type> l_listener;
+    auto l_start = std::chrono::steady_clock::now();
+    bool l_found = p_simplex.find_max(l_max, l_infinite, &l_listener);
+    auto l_end = std::chrono::steady_clock::now();
+    std::cout << p_policy_name << "\t" << p_model_name << "\t" << l_listener.get_nb_pivots() << "\t";
+    std::cout << std::chrono::duration_cast<std::chrono::microseconds>(l_end - l_start).count() << "\t";
+    if(l_found)
     {
-        std::cout << "Max = " << l_max << std::endl ;
+        std::cout << l_max << std::endl;
     }
-    else if(l_infinite)
+    else
     {
-        std::cout << "Inifinite Max" << std::endl;
+        std::cout << (l_infinite ? "Infinite" : "None") << std::endl;
     }
-    else
+}
+
+//------------------------------------------------------------------------------
+template <typename PRICING_POLICY>
+void
+bench_pricing_policy(const std::string & p_name)
+{
+    typedef simplex::simplex_solver<double, simplex::simplex_array<double>, PRICING_POLICY> t_simplex;
     {
-        std::cout << "No Max found !?" << std::endl;
+        t_simplex l_simplex(18, 46, 0, 0);
+        fill_test_case3(l_simplex);
+        bench_simplex(p_name, "test_case3", l_simplex);
+    }
+    const unsigned int l_sizes[][2] = {{30, 20}, {60, 40}, {120, 80}, {240, 160}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        t_simplex l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+        bench_simplex(p_name, "random_" + std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations), l_simplex);
     }
-    l_ok &= quicky_test::check_expected(l_max, 10.0, "Result of test_simplex_identity_solver");
-    std::vector<double> l_variable_values = l_identity_solver.get_variable_values();
-    assert(3 == l_variable_values.size());
-    l_ok &= quicky_test::check_expected(l_variable_values[0], 0.0, "Variable[0]");
-    l_ok &= quicky_test::check_expected(l_variable_values[1], 1.0, "Variable[1]");
-    l_ok &= quicky_test::check_expected(l_variable_values[2], 2.0, "Variable[2]");
-    return l_ok;
 }
 
 //------------------------------------------------------------------------------
-bool test_simplex_solver_glpk()
+/**
+ * Steepest edge pricing recomputing norms from array at each selection,
+ * used as reference for weights updated by recurrence
+ */
+template <typename COEF_TYPE>
+class exact_steepest_edge_pricing
 {
-    bool l_ok = true;
-    simplex::simplex_solver_glpk l_glpk(3, 3, 0 , 0);
-    l_glpk.set_Z_coef(0, 10.0);
-    l_glpk.set_Z_coef(1, 6.0);
-    l_glpk.set_Z_coef(2, 4.0);
-    l_glpk.set_B_coef(0, 100.0);
-    l_glpk.set_B_coef(1, 600.0);
-    l_glpk.set_B_coef(2, 300.0);
-    l_glpk.define_equation_type(0, simplex::equation_type::INEQUATION_LT);
-    l_glpk.define_equation_type(1, simplex::equation_type::INEQUATION_LT);
-    l_glpk.define_equation_type(2, simplex::equation_type::INEQUATION_LT);
-    l_glpk.set_A_coef(0, 0, 1.0);
-    l_glpk.set_A_coef(0, 1, 1.0);
-    l_glpk.set_A_coef(0, 2, 1.0);
-    l_glpk.set_A_coef(1, 0, 10.0);
-    l_glpk.set_A_coef(1, 1, 4.0);
-    l_glpk.set_A_coef(1, 2, 5.0);
-    l_glpk.set_A_coef(2, 0, 2.0);
-    l_glpk.set_A_coef(2, 1, 2.0);
-    l_glpk.set_A_coef(2, 2, 6.0);
+  public:
+    void reset(unsigned int
+              ,unsigned int
+              )
+    {
+    }
 
-    simplex_listener<double> l_listener(l_glpk);
+    template <typename VIEW>
+    bool select_input_variable(const VIEW & p_view
+                              ,unsigned int & p_variable_index
+                              )
+    {
+        bool l_found = false;
+        double l_best = 0.0;
+        for(unsigned int l_index = 0;
+            l_index < p_view.get_nb_all_variables();
+            ++l_index
+           )
+        {
+            const COEF_TYPE & l_coef = p_view.get_Z_coef(l_index);
+            if(l_coef < -simplex::simplex_tolerance<COEF_TYPE>::get() && !p_view.is_base_variable(l_index))
+            {
+                double l_norm = 1.0;
+                for(unsigned int l_row_index = 0;
+                    l_row_index < p_view.get_nb_total_equations();
+                    ++l_row_index
+                   )
+                {
+                    double l_column_coef = static_cast<double>(p_view.get_coef(l_row_index, l_index));
+                    l_norm += l_column_coef * l_column_coef;
+                }
+                double l_score = static_cast<double>(l_coef) * static_cast<double>(l_coef) / l_norm;
+                if(!l_found || l_score > l_best)
+                {
+                    l_best = l_score;
+                    p_variable_index = l_index;
+                    l_found = true;
+                }
+            }
+        }
+        return l_found;
+    }
 
-    double l_max;
-    bool l_infinite;
-    l_glpk.find_max(l_max, l_infinite, &l_listener);
+    template <typename VIEW>
+    void notify_pivot(const VIEW &
+                     ,unsigned int
+                     ,unsigned int
+                     )
+    {
+    }
+};
 
-    // Compare string representation to avoid double representation issue
-    std::string l_result = std::to_string(l_max);
-    l_ok = quicky_test::check_expected(l_result, std::string("733.333333"), "test simplex_solver_glpk");
+//------------------------------------------------------------------------------
+bool test_steepest_edge_pricing()
+{
+    bool l_ok = true;
+    for(unsigned int l_seed = 1; l_seed < 5; ++l_seed)
+    {
+        simplex::simplex_solver<double,simplex::simplex_array<double>,simplex::simplex_pricing_steepest_edge<double>> l_simplex(30, 20, 0, 0);
+        simplex::simplex_solver<double,simplex::simplex_array<double>,exact_steepest_edge_pricing<double>> l_exact_simplex(30, 20, 0, 0);
+        fill_random_model(l_simplex, 30, 20, l_seed);
+        fill_random_model(l_exact_simplex, 30, 20, l_seed);
+        simplex::simplex_counting_listener<double> l_listener;
+        simplex::simplex_counting_listener<double> l_exact_listener;
+        double l_max = 0;
+        double l_exact_max = 0;
+        bool l_infinite = false;
+        std::string l_name = "Steepest edge seed " + std::to_string(l_seed);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite, &l_listener), true, l_name + " max found");
+        l_ok &= quicky_test::check_expected(l_exact_simplex.find_max(l_exact_max, l_infinite, &l_exact_listener), true, l_name + " exact max found");
+        l_ok &= check_close(l_max, l_exact_max, l_name + " max");
+        // Updated norms are exact so the same pivots are selected
+        l_ok &= quicky_test::check_expected(l_listener.get_nb_pivots(), l_exact_listener.get_nb_pivots(), l_name + " pivots");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+void bench_pricing()
+{
+    std::cout << "Policy\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    bench_pricing_policy<simplex::simplex_pricing_first<double>>("first");
+    bench_pricing_policy<simplex::simplex_pricing_dantzig<double>>("dantzig");
+    bench_pricing_policy<simplex::simplex_pricing_partial<double>>("partial");
+    bench_pricing_policy<simplex::simplex_pricing_devex<double>>("devex");
+    bench_pricing_policy<simplex::simplex_pricing_steepest_edge<double>>("steepest_edge");
+}
+
+//------------------------------------------------------------------------------
+template <typename ARRAY_TYPE>
+void
+bench_array_type(const std::string & p_name)
+{
+    typedef simplex::simplex_solver<double, ARRAY_TYPE> t_simplex;
+    {
+        t_simplex l_simplex(18, 46, 0, 0);
+        fill_test_case3(l_simplex);
+        bench_simplex(p_name, "test_case3", l_simplex);
+    }
+    const unsigned int l_sizes[][2] = {{60, 40}, {120, 80}, {240, 160}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        t_simplex l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+        bench_simplex(p_name, "random_" + std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations), l_simplex);
+    }
+}
+
+//------------------------------------------------------------------------------
+void bench_array()
+{
+    std::cout << "Array\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    bench_array_type<simplex::simplex_array<double>>("array");
+    bench_array_type<simplex::simplex_map<double>>("map");
+    bench_array_type<simplex::simplex_csr_array<double>>("csr");
+    bench_array_type<simplex::simplex_column_array<double>>("column");
+    bench_array_type<simplex::simplex_implicit_slack_array<double>>("implicit slack");
+}
+
+//------------------------------------------------------------------------------
+template <typename ARRAY_TYPE>
+void
+bench_layout_type(const std::string & p_name)
+{
+    typedef simplex::simplex_solver<double, ARRAY_TYPE> t_simplex;
+    // Aspect ratios from tall to wide tableaus
+    const unsigned int l_sizes[][2] = {{40, 640}, {80, 320}, {160, 160}, {320, 80}, {640, 40}, {1280, 20}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        t_simplex l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+        bench_simplex(p_name, "random_" + std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations), l_simplex);
+    }
+}
+
+//------------------------------------------------------------------------------
+void bench_layout()
+{
+    std::cout << "Layout\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    bench_layout_type<simplex::simplex_array<double>>("row");
+    bench_layout_type<simplex::simplex_column_array<double>>("column");
+    bench_layout_type<simplex::simplex_implicit_slack_array<double>>("implicit slack");
+}
+
+//------------------------------------------------------------------------------
+template <typename COEF_TYPE>
+bool test_row_kernel()
+{
+    bool l_ok = true;
+    // Odd size to exercise remaining coefficients of vectorized kernels
+    const unsigned int l_size = 37;
+    std::mt19937 l_generator(7);
+    std::uniform_real_distribution<COEF_TYPE> l_distribution(-100, 100);
+    std::vector<COEF_TYPE> l_pivot_row(l_size);
+    std::vector<COEF_TYPE> l_row(l_size);
+    for(unsigned int l_index = 0; l_index < l_size; ++l_index)
+    {
+        l_pivot_row[l_index] = l_distribution(l_generator);
+        l_row[l_index] = l_distribution(l_generator);
+    }
+    COEF_TYPE l_q = l_distribution(l_generator);
+    COEF_TYPE l_pivot = l_distribution(l_generator);
+
+    // Reference computed by generic scalar kernel
+    std::vector<COEF_TYPE> l_eliminate_ref(l_row);
+    std::vector<COEF_TYPE> l_objective_ref(l_row);
+    std::vector<COEF_TYPE> l_divide_ref(l_row);
+    simplex::simplex_row_kernel<COEF_TYPE>::set_level(simplex::simplex_simd_level::SCALAR);
+    simplex::simplex_row_kernel<COEF_TYPE>::eliminate(l_eliminate_ref.data(), l_pivot_row.data(), l_q, l_pivot, l_size);
+    simplex::simplex_row_kernel<COEF_TYPE>::eliminate_objective(l_objective_ref.data(), l_pivot_row.data(), l_q, l_pivot, l_size);
+    simplex::simplex_row_kernel<COEF_TYPE>::divide(l_divide_ref.data(), l_pivot, l_size);
+
+    const simplex::simplex_simd_level l_levels[] = {simplex::simplex_simd_level::SSE2, simplex::simplex_simd_level::AVX2, simplex::simplex_simd_level::AVX512};
+    for(auto l_level: l_levels)
+    {
+        if(l_level > simplex::simplex_simd_supported_level())
+        {
+            continue;
+        }
+        simplex::simplex_row_kernel<COEF_TYPE>::set_level(l_level);
+        std::string l_name(simplex::simplex_simd_level_name(l_level));
+        std::vector<COEF_TYPE> l_eliminate(l_row);
+        std::vector<COEF_TYPE> l_objective(l_row);
+        std::vector<COEF_TYPE> l_divide(l_row);
+        simplex::simplex_row_kernel<COEF_TYPE>::eliminate(l_eliminate.data(), l_pivot_row.data(), l_q, l_pivot, l_size);
+        simplex::simplex_row_kernel<COEF_TYPE>::eliminate_objective(l_objective.data(), l_pivot_row.data(), l_q, l_pivot, l_size);
+        simplex::simplex_row_kernel<COEF_TYPE>::divide(l_divide.data(), l_pivot, l_size);
+        l_ok &= quicky_test::check_expected(l_eliminate == l_eliminate_ref, true, l_name + " eliminate");
+        l_ok &= quicky_test::check_expected(l_objective == l_objective_ref, true, l_name + " eliminate objective");
+        l_ok &= quicky_test::check_expected(l_divide == l_divide_ref, true, l_name + " divide");
+    }
+    simplex::simplex_row_kernel<COEF_TYPE>::set_level(simplex::simplex_simd_supported_level());
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Generate rows whose coefficients are multiple of a factor, factor is a
+ * power of two, an odd number, both or 1
+ */
+template <typename COEF_TYPE>
+std::vector<std::vector<COEF_TYPE>> generate_gcd_rows(unsigned int p_nb_rows
+                                                     ,unsigned int p_size
+                                                     ,unsigned int p_seed
+                                                     )
+{
+    std::mt19937 l_generator(p_seed);
+    std::uniform_int_distribution<int32_t> l_distribution(-1000, 1000);
+    const COEF_TYPE l_factors[] = {1, 2, 3, 8, 12, 35, 64, 1024};
+    std::vector<std::vector<COEF_TYPE>> l_rows(p_nb_rows, std::vector<COEF_TYPE>(p_size));
+    for(unsigned int l_row_index = 0; l_row_index < p_nb_rows; ++l_row_index)
+    {
+        COEF_TYPE l_factor = l_factors[l_row_index % (sizeof(l_factors) / sizeof(COEF_TYPE))];
+        for(auto & l_coef: l_rows[l_row_index])
+        {
+            // Keep some null coefficients as in tableau rows
+            int32_t l_value = l_distribution(l_generator);
+            l_coef = l_value % 3 ? COEF_TYPE(l_value) * l_factor : COEF_TYPE(0);
+        }
+    }
+    return l_rows;
+}
+
+//------------------------------------------------------------------------------
+template <typename COEF_TYPE>
+bool test_gcd_kernel()
+{
+    bool l_ok = true;
+    typedef simplex::simplex_gcd_kernel<COEF_TYPE> t_kernel;
+    l_ok &= quicky_test::check_expected(t_kernel::gcd(12, -18), COEF_TYPE(6), "PGCD(12,-18)");
+    l_ok &= quicky_test::check_expected(t_kernel::gcd(-7, 0), COEF_TYPE(7), "PGCD(-7,0)");
+    l_ok &= quicky_test::check_expected(t_kernel::gcd(0, 0), COEF_TYPE(0), "PGCD(0,0)");
+    l_ok &= quicky_test::check_expected(t_kernel::gcd(std::numeric_limits<COEF_TYPE>::min(), 6), COEF_TYPE(2), "PGCD(min,6)");
+    std::vector<COEF_TYPE> l_null_row(9, COEF_TYPE(0));
+    l_ok &= quicky_test::check_expected(t_kernel::row_gcd(l_null_row.data(), 9), COEF_TYPE(0), "Null row");
+    l_ok &= quicky_test::check_expected(t_kernel::row_gcd(l_null_row.data(), 9, COEF_TYPE(-10)), COEF_TYPE(10), "Null row with B");
+
+    // Odd size to exercise remaining coefficients of vectorized kernels
+    std::vector<std::vector<COEF_TYPE>> l_rows = generate_gcd_rows<COEF_TYPE>(16, 37, 11);
+    const simplex::simplex_simd_level l_levels[] = {simplex::simplex_simd_level::SCALAR, simplex::simplex_simd_level::SSE2, simplex::simplex_simd_level::AVX2, simplex::simplex_simd_level::AVX512};
+    for(auto l_level: l_levels)
+    {
+        if(l_level > simplex::simplex_simd_supported_level())
+        {
+            continue;
+        }
+        t_kernel::set_level(l_level);
+        std::string l_name(simplex::simplex_simd_level_name(l_level));
+        for(unsigned int l_row_index = 0; l_row_index < l_rows.size(); ++l_row_index)
+        {
+            const std::vector<COEF_TYPE> & l_row = l_rows[l_row_index];
+            COEF_TYPE l_extra = COEF_TYPE(48);
+            // Reference computed coefficient by coefficient
+            COEF_TYPE l_expected = l_extra;
+            for(auto l_coef: l_row)
+            {
+                l_expected = std::abs(quicky_utils::fract<COEF_TYPE>::PGCD(l_coef, l_expected));
+            }
+            l_ok &= quicky_test::check_expected(t_kernel::row_gcd(l_row.data(), (unsigned int)l_row.size(), l_extra), l_expected, l_name + " row PGCD[" + std::to_string(l_row_index) + "]");
+            std::vector<COEF_TYPE> l_divided(l_row);
+            t_kernel::divide(l_divided.data(), l_expected, (unsigned int)l_divided.size());
+            l_ok &= quicky_test::check_expected(t_kernel::row_gcd(l_divided.data(), (unsigned int)l_divided.size(), l_extra / l_expected), COEF_TYPE(1), l_name + " divided row PGCD[" + std::to_string(l_row_index) + "]");
+        }
+    }
+    t_kernel::set_level(simplex::simplex_simd_supported_level());
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_basis_factorization()
+{
+    bool l_ok = true;
+    //     | 0 2 0 |
+    // B = | 1 0 3 | needs row permutations and has fill-in in U
+    //     | 4 0 1 |
+    simplex::simplex_basis_factorization<double> l_factorization(3);
+    l_factorization.reset();
+    l_factorization.set_coef(0, 1, 2.0);
+    l_factorization.set_coef(1, 0, 1.0);
+    l_factorization.set_coef(1, 2, 3.0);
+    l_factorization.set_coef(2, 2, 1.0);
+    l_factorization.set_coef(2, 0, 4.0);
+    l_factorization.factorize();
+
+    // B x = a with x = (1, 2, 3)
+    std::vector<double> l_vector = {4.0, 10.0, 7.0};
+    l_factorization.ftran(l_vector);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_ok &= check_close(l_vector[l_index], l_index + 1.0, "ftran x[" + std::to_string(l_index) + "]");
+    }
+
+    // y B = c with y = (1, 1, 1)
+    l_vector = {5.0, 2.0, 4.0};
+    l_factorization.btran(l_vector);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_ok &= check_close(l_vector[l_index], 1.0, "btran y[" + std::to_string(l_index) + "]");
+    }
+
+    // Column 1 replaced by (1, 1, 1) through an eta matrix
+    std::vector<double> l_column = {1.0, 1.0, 1.0};
+    l_factorization.ftran(l_column);
+    l_factorization.update(1, l_column);
+    l_vector = {2.0, 12.0, 9.0};
+    l_factorization.ftran(l_vector);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_ok &= check_close(l_vector[l_index], l_index + 1.0, "updated ftran x[" + std::to_string(l_index) + "]");
+    }
+    l_vector = {5.0, 3.0, 4.0};
+    l_factorization.btran(l_vector);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_ok &= check_close(l_vector[l_index], 1.0, "updated btran y[" + std::to_string(l_index) + "]");
+    }
+
+    // Null column
+    l_factorization.reset();
+    l_factorization.set_coef(0, 0, 1.0);
+    l_factorization.set_coef(1, 0, 1.0);
+    l_factorization.set_coef(2, 2, 1.0);
+    bool l_thrown = false;
+    try
+    {
+        l_factorization.factorize();
+    }
+    catch(quicky_exception::quicky_runtime_exception & e)
+    {
+        l_thrown = true;
+    }
+    l_ok &= quicky_test::check_expected(l_thrown, true, "Singular basis");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+void bench_gcd_kernel()
+{
+    std::cout << "Kernel	Rows	Time(us)	PGCD sum" << std::endl;
+    std::vector<std::vector<int64_t>> l_rows = generate_gcd_rows<int64_t>(4096, 256, 5);
+    {
+        int64_t l_sum = 0;
+        auto l_start = std::chrono::steady_clock::now();
+        for(const auto & l_row: l_rows)
+        {
+            int64_t l_pgcd = 0;
+            for(auto l_coef: l_row)
+            {
+                l_pgcd = l_pgcd ? quicky_utils::fract<int64_t>::PGCD(l_coef, l_pgcd) : l_coef;
+            }
+            l_sum += l_pgcd;
+        }
+        auto l_end = std::chrono::steady_clock::now();
+        std::cout << "per coefficient	" << l_rows.size() << "	" << std::chrono::duration_cast<std::chrono::microseconds>(l_end - l_start).count() << "	" << l_sum << std::endl;
+    }
+    const simplex::simplex_simd_level l_levels[] = {simplex::simplex_simd_level::SCALAR, simplex::simplex_simd_level::SSE2, simplex::simplex_simd_level::AVX2, simplex::simplex_simd_level::AVX512};
+    for(auto l_level: l_levels)
+    {
+        if(l_level > simplex::simplex_simd_supported_level())
+        {
+            continue;
+        }
+        simplex::simplex_gcd_kernel<int64_t>::set_level(l_level);
+        int64_t l_sum = 0;
+        auto l_start = std::chrono::steady_clock::now();
+        for(const auto & l_row: l_rows)
+        {
+            l_sum += simplex::simplex_gcd_kernel<int64_t>::row_gcd(l_row.data(), (unsigned int)l_row.size());
+        }
+        auto l_end = std::chrono::steady_clock::now();
+        std::cout << simplex::simplex_simd_level_name(l_level) << "	" << l_rows.size() << "	" << std::chrono::duration_cast<std::chrono::microseconds>(l_end - l_start).count() << "	" << l_sum << std::endl;
+    }
+    simplex::simplex_gcd_kernel<int64_t>::set_level(simplex::simplex_simd_supported_level());
+}
+
+//------------------------------------------------------------------------------
+void bench_row_kernel()
+{
+    std::cout << "Kernel\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    const simplex::simplex_simd_level l_levels[] = {simplex::simplex_simd_level::SCALAR, simplex::simplex_simd_level::SSE2, simplex::simplex_simd_level::AVX2, simplex::simplex_simd_level::AVX512};
+    for(auto l_level: l_levels)
+    {
+        if(l_level > simplex::simplex_simd_supported_level())
+        {
+            continue;
+        }
+        simplex::simplex_row_kernel<double>::set_level(l_level);
+        simplex::simplex_solver<double> l_simplex(240, 160, 0, 0);
+        fill_random_model(l_simplex, 240, 160, 3);
+        bench_simplex(simplex::simplex_simd_level_name(l_level), "random_240x160", l_simplex);
+    }
+    simplex::simplex_row_kernel<double>::set_level(simplex::simplex_simd_supported_level());
+}
+
+//------------------------------------------------------------------------------
+void bench_threads()
+{
+    std::cout << "Threads\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    const unsigned int l_nb_threads[] = {1, 2, 4, 8};
+    for(auto l_nb: l_nb_threads)
+    {
+        simplex::simplex_solver<double> l_simplex(480, 320, 0, 0);
+        l_simplex.set_nb_threads(l_nb);
+        fill_random_model(l_simplex, 480, 320, 5);
+        bench_simplex(std::to_string(l_nb), "random_480x320", l_simplex);
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_bounds()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    {
+        // Knapsack relaxation without any row for bounds
+        // Max Z = 10 * X1 + 13 * X2 + 7 * X3 + 8 * X4 + X5
+        //         4 * X1 + 4 * X2 + 4 * X3 + 5 * X4 + 2 * X5 <= 12
+        //         0 <= X1, X2, X3, X4 <= 1
+        //         1 <= X5 <= 3
+        SIMPLEX_TYPE l_simplex(5, 1, 0, 0);
+        const int l_values[] = {10, 13, 7, 8, 1};
+        const int l_weights[] = {4, 4, 4, 5, 2};
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_simplex.set_Z_coef(l_index, (t_coef)l_values[l_index]);
+            l_simplex.set_A_coef(0, l_index, (t_coef)l_weights[l_index]);
+            l_simplex.set_variable_upper_bound(l_index, (t_coef)1);
+        }
+        l_simplex.set_variable_upper_bound(4, (t_coef)3);
+        l_simplex.set_variable_lower_bound(4, (t_coef)1);
+        l_simplex.set_B_coef(0, (t_coef)12);
+        l_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+
+        t_coef l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Knapsack max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)27.5, "Knapsack max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        const t_coef l_expected[] = {1, 1, 0.5, 0, 1};
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_variable_values[l_index], l_expected[l_index], "Knapsack X" + std::to_string(l_index + 1));
+        }
+
+        // Capacity increase puts X3 above its upper bound
+        bool l_infeasible = false;
+        l_simplex.update_B_coef(0, (t_coef)19);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Knapsack 19 max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)39, "Knapsack 19 max");
+        l_variable_values = l_simplex.get_variable_values();
+        const t_coef l_expected_19[] = {1, 1, 1, 1, 1};
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_variable_values[l_index], l_expected_19[l_index], "Knapsack 19 X" + std::to_string(l_index + 1));
+        }
+
+        // Capacity decrease puts base variables below 0
+        l_simplex.update_B_coef(0, (t_coef)9);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Knapsack 9 max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)21.5, "Knapsack 9 max");
+        l_variable_values = l_simplex.get_variable_values();
+        const t_coef l_expected_9[] = {0.75, 1, 0, 0, 1};
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_variable_values[l_index], l_expected_9[l_index], "Knapsack 9 X" + std::to_string(l_index + 1));
+        }
+    }
+    {
+        // Range equation stored in a single row
+        // Max Z = X1
+        //         -2 <= -X1 + X2 <= 1
+        //         X1 <= 10, X2 <= 1
+        SIMPLEX_TYPE l_simplex(2, 1, 0, 0);
+        l_simplex.set_Z_coef(0, (t_coef)1);
+        l_simplex.set_A_coef(0, 0, (t_coef)-1);
+        l_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_simplex.define_range_equation(0, (t_coef)-2, (t_coef)1);
+        l_simplex.set_variable_upper_bound(0, (t_coef)10);
+        l_simplex.set_variable_upper_bound(1, (t_coef)1);
+
+        t_coef l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Range max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)3, "Range max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)3, "Range X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)1, "Range X2");
+    }
+    return l_ok;
+}
+
+//-----------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_dual()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Max Z = 3 * X1 + 2 * X2
+    //         X1 + X2 <= 8
+    //         X1 + 2 * X2 <= 12
+    //         X1 <= 6
+    SIMPLEX_TYPE l_simplex(2, 3, 0, 0);
+    l_simplex.set_Z_coef(0, (t_coef)3);
+    l_simplex.set_Z_coef(1, (t_coef)2);
+    const int l_coefs[3][2] = {{1, 1}, {1, 2}, {1, 0}};
+    const int l_B_coefs[3] = {8, 12, 6};
+    for(unsigned int l_row_index = 0; l_row_index < 3; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 2; ++l_index)
+        {
+            if(l_coefs[l_row_index][l_index])
+            {
+                l_simplex.set_A_coef(l_row_index, l_index, (t_coef)l_coefs[l_row_index][l_index]);
+            }
+        }
+        l_simplex.set_B_coef(l_row_index, (t_coef)l_B_coefs[l_row_index]);
+        l_simplex.define_equation_type(l_row_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Primal max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Primal max");
+
+    // Restart from previous optimum once X1 + 2 * X2 <= 8
+    bool l_infeasible = false;
+    simplex::simplex_counting_listener<t_coef> l_listener;
+    l_simplex.update_B_coef(1, (t_coef)8);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible, &l_listener), true, "Dual max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)20, "Dual max");
+    std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)6, "Dual X1");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)1, "Dual X2");
+    l_ok &= quicky_test::check_expected(l_listener.get_nb_pivots(), 1u, "Dual pivots");
+
+    // X1 + X2 <= 2
+    l_simplex.update_B_coef(0, (t_coef)2);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Dual max 2 found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)6, "Dual max 2");
+    l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)2, "Dual 2 X1");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)0, "Dual 2 X2");
+
+    // X1 + X2 <= -1 has no solution
+    l_simplex.update_B_coef(0, (t_coef)-1);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), false, "Dual infeasible");
+    l_ok &= quicky_test::check_expected(l_infeasible, true, "Dual infeasible flag");
+    return l_ok;
+}
+
+//-----------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_phase_1()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    {
+        // No base variable defined
+        // Max Z = 4 * X1 + 3 * X2 + X3
+        //         X1 + X2 + X3 = 10
+        //         X1 + 2 * X2 <= 14
+        //         X2 + X3 >= 3
+        SIMPLEX_TYPE l_simplex(3, 1, 1, 1);
+        l_simplex.set_Z_coef(0, (t_coef)4);
+        l_simplex.set_Z_coef(1, (t_coef)3);
+        l_simplex.set_Z_coef(2, (t_coef)1);
+        l_simplex.set_A_coef(0, 0, (t_coef)1);
+        l_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_simplex.set_A_coef(0, 2, (t_coef)1);
+        l_simplex.set_B_coef(0, (t_coef)10);
+        l_simplex.define_equation_type(0, simplex::t_equation_type::EQUATION);
+        l_simplex.set_A_coef(1, 0, (t_coef)1);
+        l_simplex.set_A_coef(1, 1, (t_coef)2);
+        l_simplex.set_B_coef(1, (t_coef)14);
+        l_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_LT);
+        l_simplex.set_A_coef(2, 1, (t_coef)1);
+        l_simplex.set_A_coef(2, 2, (t_coef)1);
+        l_simplex.set_B_coef(2, (t_coef)3);
+        l_simplex.define_equation_type(2, simplex::t_equation_type::INEQUATION_GT);
+
+        t_coef l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Mixed max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)37, "Mixed max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)7, "Mixed X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)3, "Mixed X2");
+        l_ok &= quicky_test::check_expected(l_variable_values[2], (t_coef)0, "Mixed X3");
+    }
+    {
+        // No feasible solution
+        // Max Z = X1 + X2
+        //         X1 + X2 = 10
+        //         X1 + X2 <= 5
+        SIMPLEX_TYPE l_simplex(2, 1, 1, 0);
+        l_simplex.set_Z_coef(0, (t_coef)1);
+        l_simplex.set_Z_coef(1, (t_coef)1);
+        l_simplex.set_A_coef(0, 0, (t_coef)1);
+        l_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_simplex.set_B_coef(0, (t_coef)10);
+        l_simplex.define_equation_type(0, simplex::t_equation_type::EQUATION);
+        l_simplex.set_A_coef(1, 0, (t_coef)1);
+        l_simplex.set_A_coef(1, 1, (t_coef)1);
+        l_simplex.set_B_coef(1, (t_coef)5);
+        l_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_LT);
+
+        t_coef l_max = 0;
+        bool l_infinite = true;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), false, "Infeasible max found");
+        l_ok &= quicky_test::check_expected(l_infinite, false, "Infeasible infinite");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with model mixing equation types without base variables
+ * Max Z = 4 * X1 + 3 * X2 + p_Z3 * X3
+ *         X1 + X2 + X3 = 10
+ *         X1 + 2 * X2 <= 14
+ *         X2 + X3 >= 3
+ * @param p_simplex simplex to fill
+ * @param p_Z3 Z coefficient of X3
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_basis_model(SIMPLEX_TYPE & p_simplex,
+                 int p_Z3
+                )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    p_simplex.set_Z_coef(0, (t_coef)4);
+    p_simplex.set_Z_coef(1, (t_coef)3);
+    p_simplex.set_Z_coef(2, (t_coef)p_Z3);
+    p_simplex.set_A_coef(0, 0, (t_coef)1);
+    p_simplex.set_A_coef(0, 1, (t_coef)1);
+    p_simplex.set_A_coef(0, 2, (t_coef)1);
+    p_simplex.set_B_coef(0, (t_coef)10);
+    p_simplex.define_equation_type(0, simplex::t_equation_type::EQUATION);
+    p_simplex.set_A_coef(1, 0, (t_coef)1);
+    p_simplex.set_A_coef(1, 1, (t_coef)2);
+    p_simplex.set_B_coef(1, (t_coef)14);
+    p_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_LT);
+    p_simplex.set_A_coef(2, 1, (t_coef)1);
+    p_simplex.set_A_coef(2, 2, (t_coef)1);
+    p_simplex.set_B_coef(2, (t_coef)3);
+    p_simplex.define_equation_type(2, simplex::t_equation_type::INEQUATION_GT);
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_basis()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    SIMPLEX_TYPE l_simplex(3, 1, 1, 1);
+    fill_basis_model(l_simplex, 1);
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Cold max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)37, "Cold max");
+
+    // Basis survives serialisation
+    std::vector<unsigned int> l_basis = l_simplex.get_basis();
+    std::stringstream l_stream;
+    simplex::simplex_basis_file::write(l_stream, l_basis);
+    std::vector<unsigned int> l_read_basis = simplex::simplex_basis_file::read(l_stream);
+    l_ok &= quicky_test::check_expected(l_read_basis == l_basis, true, "Basis file");
+
+    // Truncated file announcing a huge number of equations
+    {
+        std::string l_header = l_stream.str().substr(0, 5);
+        std::stringstream l_truncated_stream(l_header + std::string("\xff\xff\xff\xff\x0f", 5) + std::string("\x01", 1));
+        bool l_thrown = false;
+        try
+        {
+            simplex::simplex_basis_file::read(l_truncated_stream);
+        }
+        catch(const quicky_exception::quicky_runtime_exception &)
+        {
+            l_thrown = true;
+        }
+        l_ok &= quicky_test::check_expected(l_thrown, true, "Truncated basis file");
+    }
+
+    // Same problem restarted from optimal basis needs no pivot
+    {
+        SIMPLEX_TYPE l_warm_simplex(3, 1, 1, 1);
+        fill_basis_model(l_warm_simplex, 1);
+        l_warm_simplex.set_basis(l_read_basis);
+        simplex::simplex_counting_listener<t_coef> l_listener;
+        l_ok &= quicky_test::check_expected(l_warm_simplex.find_max(l_max, l_infinite, &l_listener), true, "Warm max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)37, "Warm max");
+        l_ok &= quicky_test::check_expected(l_listener.get_nb_pivots(), 0u, "Warm pivots");
+    }
+
+    // Close problem whose optimum moves to X3
+    // Max Z = 4 * X1 + 3 * X2 + 5 * X3
+    {
+        SIMPLEX_TYPE l_warm_simplex(3, 1, 1, 1);
+        fill_basis_model(l_warm_simplex, 5);
+        l_warm_simplex.set_basis(l_read_basis);
+        l_ok &= quicky_test::check_expected(l_warm_simplex.find_max(l_max, l_infinite), true, "Close max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)50, "Close max");
+        std::vector<t_coef> l_variable_values = l_warm_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)0, "Close X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)0, "Close X2");
+        l_ok &= quicky_test::check_expected(l_variable_values[2], (t_coef)10, "Close X3");
+    }
+
+    // Basis with twice the same variable is rejected
+    {
+        SIMPLEX_TYPE l_warm_simplex(3, 1, 1, 1);
+        fill_basis_model(l_warm_simplex, 1);
+        bool l_thrown = false;
+        try
+        {
+            l_warm_simplex.set_basis(std::vector<unsigned int>({0, 0, 1}));
+        }
+        catch(quicky_exception::quicky_logic_exception & e)
+        {
+            l_thrown = true;
+        }
+        l_ok &= quicky_test::check_expected(l_thrown, true, "Duplicated basis variable");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Check equations and variables added to an existing solver
+ * @param p_add_variable_after_search indicate if solver accepts new variables
+ * once a search has been done
+ */
+template <typename SIMPLEX_TYPE>
+bool test_incremental(bool p_add_variable_after_search)
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    bool l_infeasible = false;
+    {
+        // Max Z = 3 * X1 + 2 * X2
+        //         X1 + X2 <= 8
+        // then X1 + 2 * X2 <= 12 and X1 <= 6 are added before search
+        SIMPLEX_TYPE l_simplex(2, 1, 0, 0);
+        l_simplex.set_Z_coef(0, (t_coef)3);
+        l_simplex.set_Z_coef(1, (t_coef)2);
+        l_simplex.set_A_coef(0, 0, (t_coef)1);
+        l_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_simplex.set_B_coef(0, (t_coef)8);
+        l_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+        l_ok &= quicky_test::check_expected(l_simplex.add_constraint({(t_coef)1, (t_coef)2}, simplex::t_equation_type::INEQUATION_LT, (t_coef)12), 1u, "Added equation index");
+        l_ok &= quicky_test::check_expected(l_simplex.add_constraint({(t_coef)1, (t_coef)0}, simplex::t_equation_type::INEQUATION_LT, (t_coef)6), 2u, "Added equation index 2");
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Grown max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Grown max");
+
+        // Cut X2 <= 1 added at optimum
+        simplex::simplex_counting_listener<t_coef> l_listener;
+        l_simplex.add_constraint({(t_coef)0, (t_coef)1}, simplex::t_equation_type::INEQUATION_LT, (t_coef)1);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible, &l_listener), true, "Cut max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)20, "Cut max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)6, "Cut X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)1, "Cut X2");
+        l_ok &= quicky_test::check_expected(l_listener.get_nb_pivots() <= 2u, true, "Cut pivots");
+
+        // Column of X3 in X1 + X2 + X3 <= 8 and X1 + 2 * X2 + X3 <= 12
+        // Max Z = 3 * X1 + 2 * X2 + 4 * X3
+        bool l_thrown = false;
+        try
+        {
+            l_ok &= quicky_test::check_expected(l_simplex.add_variable((t_coef)4, {(t_coef)1, (t_coef)1, (t_coef)0, (t_coef)0}), 2u, "Added variable index");
+        }
+        catch(quicky_exception::quicky_logic_exception & e)
+        {
+            l_thrown = true;
+        }
+        l_ok &= quicky_test::check_expected(l_thrown, !p_add_variable_after_search, "Variable added after search");
+        if(p_add_variable_after_search)
+        {
+            l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Column max found");
+            l_ok &= quicky_test::check_expected(l_max, (t_coef)32, "Column max");
+            l_variable_values = l_simplex.get_variable_values();
+            l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)0, "Column X1");
+            l_ok &= quicky_test::check_expected(l_variable_values[2], (t_coef)8, "Column X3");
+        }
+    }
+    {
+        // Variable added before search
+        // Max Z = 3 * X1 + 2 * X2 + 4 * X3
+        //         X1 + X2 + X3 <= 8
+        //         X1 + 2 * X2 + X3 >= 2
+        SIMPLEX_TYPE l_simplex(2, 1, 0, 1);
+        l_simplex.set_Z_coef(0, (t_coef)3);
+        l_simplex.set_Z_coef(1, (t_coef)2);
+        l_simplex.set_A_coef(0, 0, (t_coef)1);
+        l_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_simplex.set_B_coef(0, (t_coef)8);
+        l_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+        l_simplex.set_A_coef(1, 0, (t_coef)1);
+        l_simplex.set_A_coef(1, 1, (t_coef)2);
+        l_simplex.set_B_coef(1, (t_coef)2);
+        l_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_GT);
+        l_ok &= quicky_test::check_expected(l_simplex.add_variable((t_coef)4, {(t_coef)1, (t_coef)1}), 2u, "Variable index");
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Added variable max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)32, "Added variable max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values.size(), (size_t)3, "Added variable values");
+        l_ok &= quicky_test::check_expected(l_variable_values[2], (t_coef)8, "Added variable X3");
+    }
+    if(p_add_variable_after_search)
+    {
+        // Variable added after search to a model with an equation
+        // Max Z = 4 * X1 + 3 * X2 + X3 + 6 * X4
+        //         X1 + X2 + X3 + X4 = 10
+        //         X1 + 2 * X2 + X4 <= 14
+        //         X2 + X3 >= 3
+        SIMPLEX_TYPE l_simplex(3, 1, 1, 1);
+        fill_basis_model(l_simplex, 1);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Equation max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)37, "Equation max");
+        l_ok &= quicky_test::check_expected(l_simplex.add_variable((t_coef)6, {(t_coef)1, (t_coef)1, (t_coef)0}), 3u, "Equation variable index");
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Equation column max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)51, "Equation column max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)3, "Equation column X2");
+        l_ok &= quicky_test::check_expected(l_variable_values[3], (t_coef)7, "Equation column X4");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_scope(bool p_fixing_bounds)
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Max Z = 3 * X1 + 2 * X2
+    //         X1 + X2 <= 8
+    //         X1 + 2 * X2 <= 12
+    //         X1 <= 6
+    SIMPLEX_TYPE l_simplex(2, 3, 0, 0);
+    l_simplex.set_Z_coef(0, (t_coef)3);
+    l_simplex.set_Z_coef(1, (t_coef)2);
+    const int l_coefs[3][2] = {{1, 1}, {1, 2}, {1, 0}};
+    const int l_B_coefs[3] = {8, 12, 6};
+    for(unsigned int l_row_index = 0; l_row_index < 3; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 2; ++l_index)
+        {
+            if(l_coefs[l_row_index][l_index])
+            {
+                l_simplex.set_A_coef(l_row_index, l_index, (t_coef)l_coefs[l_row_index][l_index]);
+            }
+        }
+        l_simplex.set_B_coef(l_row_index, (t_coef)l_B_coefs[l_row_index]);
+        l_simplex.define_equation_type(l_row_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    bool l_infeasible = false;
+
+    // Scope opened before search
+    l_simplex.push();
+    l_simplex.add_constraint({(t_coef)0, (t_coef)1}, simplex::t_equation_type::INEQUATION_LT, (t_coef)1);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Cut max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)20, "Cut max");
+    l_simplex.pop();
+    l_ok &= quicky_test::check_expected(l_simplex.get_total_nb_equation(), 3u, "Cut removed");
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Root max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Root max");
+
+    // X1 = 2
+    l_simplex.push();
+    l_simplex.fix_variable(0, (t_coef)2);
+    // Solvers supporting bounds fix variable without adding equations
+    l_ok &= quicky_test::check_expected(l_simplex.get_total_nb_equation(), p_fixing_bounds ? 3u : 5u, "Fixing equations");
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Fixed max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)16, "Fixed max");
+    std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)2, "Fixed X1");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)5, "Fixed X2");
+
+    // X1 + 2 * X2 <= 8 in nested scope
+    l_simplex.push();
+    l_ok &= quicky_test::check_expected(l_simplex.get_nb_scopes(), 2u, "Nested scopes");
+    l_simplex.update_B_coef(1, (t_coef)8);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Nested max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)12, "Nested max");
+
+    // Previous optima are restored without search
+    simplex::simplex_counting_listener<t_coef> l_listener;
+    l_simplex.pop();
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible, &l_listener), true, "Fixed max found again");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)16, "Fixed max again");
+    l_simplex.pop();
+    l_ok &= quicky_test::check_expected(l_simplex.get_nb_scopes(), 0u, "No scope");
+    l_ok &= quicky_test::check_expected(l_simplex.get_total_nb_equation(), 3u, "Fixing removed");
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite, &l_listener), true, "Root max found again");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Root max again");
+    l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)6, "Root X1");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)2, "Root X2");
+    l_ok &= quicky_test::check_expected(l_listener.get_nb_pivots(), 0u, "Restored pivots");
+
+    // Infeasible nodes: X1 + X2 >= 9 then X1 = 2
+    l_simplex.push();
+    l_simplex.add_constraint({(t_coef)1, (t_coef)1}, simplex::t_equation_type::INEQUATION_GT, (t_coef)9);
+    l_simplex.push();
+    l_simplex.fix_variable(0, (t_coef)2);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), false, "Infeasible fixed max found");
+    l_ok &= quicky_test::check_expected(l_infeasible, true, "Infeasible fixed");
+    l_simplex.pop();
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), false, "Infeasible cut max found");
+    l_simplex.pop();
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Root max after infeasible nodes found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Root max after infeasible nodes");
+    l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)6, "Root X1 after infeasible nodes");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)2, "Root X2 after infeasible nodes");
+
+    bool l_thrown = false;
+    try
+    {
+        l_simplex.pop();
+    }
+    catch(quicky_exception::quicky_logic_exception & e)
+    {
+        l_thrown = true;
+    }
+    l_ok &= quicky_test::check_expected(l_thrown, true, "Pop without scope");
+
+    if(p_fixing_bounds)
+    {
+        // Max Z = 3 * X1 + 2 * X2
+        //         X1 + X2 <= 8
+        //         X1 <= 6 : bound
+        SIMPLEX_TYPE l_bounded_simplex(2, 1, 0, 0);
+        l_bounded_simplex.set_Z_coef(0, (t_coef)3);
+        l_bounded_simplex.set_Z_coef(1, (t_coef)2);
+        l_bounded_simplex.set_A_coef(0, 0, (t_coef)1);
+        l_bounded_simplex.set_A_coef(0, 1, (t_coef)1);
+        l_bounded_simplex.set_B_coef(0, (t_coef)8);
+        l_bounded_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+        l_bounded_simplex.set_variable_upper_bound(0, (t_coef)6);
+        l_ok &= quicky_test::check_expected(l_bounded_simplex.find_max(l_max, l_infinite), true, "Bounded root max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Bounded root max");
+
+        // X2 = 1 leaves X1 at its upper bound then X1 = 3
+        l_bounded_simplex.push();
+        l_bounded_simplex.fix_variable(1, (t_coef)1);
+        l_ok &= quicky_test::check_expected(l_bounded_simplex.find_max_dual(l_max, l_infeasible), true, "Bounded fixed max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)20, "Bounded fixed max");
+        l_bounded_simplex.push();
+        l_bounded_simplex.fix_variable(0, (t_coef)3);
+        l_ok &= quicky_test::check_expected(l_bounded_simplex.find_max_dual(l_max, l_infeasible), true, "Bounded nested max found");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)11, "Bounded nested max");
+        l_variable_values = l_bounded_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)3, "Bounded nested X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)1, "Bounded nested X2");
+        l_bounded_simplex.pop();
+        l_bounded_simplex.pop();
+        l_ok &= quicky_test::check_expected(l_bounded_simplex.get_total_nb_equation(), 1u, "Bounded fixing equations");
+        simplex::simplex_counting_listener<t_coef> l_bounded_listener;
+        l_ok &= quicky_test::check_expected(l_bounded_simplex.find_max(l_max, l_infinite, &l_bounded_listener), true, "Bounded root max found again");
+        l_ok &= quicky_test::check_expected(l_max, (t_coef)22, "Bounded root max again");
+        l_variable_values = l_bounded_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)6, "Bounded root X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)2, "Bounded root X2");
+        l_ok &= quicky_test::check_expected(l_bounded_listener.get_nb_pivots(), 0u, "Bounded restored pivots");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_presolve()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    bool l_infinite = false;
+    {
+        // Max Z = 3 * X1 + 2 * X2 - X3 + X4
+        //         X1 + X2 + X3 <= 8
+        //         X1 + X2 + X3 <= 10 : duplicate
+        //         0 <= 5 : empty
+        //         2 * X4 = 4 : singleton fixing X4
+        //         X1 <= 6 : singleton
+        //         X1 + 2 * X2 + X4 <= 14
+        // X3 and X5 are dominated
+        simplex::simplex_presolve<t_coef> l_presolve(5, 5, 1, 0);
+        l_presolve.set_Z_coef(0, (t_coef)3);
+        l_presolve.set_Z_coef(1, (t_coef)2);
+        l_presolve.set_Z_coef(2, (t_coef)-1);
+        l_presolve.set_Z_coef(3, (t_coef)1);
+        for(unsigned int l_row_index = 0; l_row_index < 2; ++l_row_index)
+        {
+            l_presolve.set_A_coef(l_row_index, 0, (t_coef)1);
+            l_presolve.set_A_coef(l_row_index, 1, (t_coef)1);
+            l_presolve.set_A_coef(l_row_index, 2, (t_coef)1);
+            l_presolve.define_equation_type(l_row_index, simplex::t_equation_type::INEQUATION_LT);
+        }
+        l_presolve.set_B_coef(0, (t_coef)8);
+        l_presolve.set_B_coef(1, (t_coef)10);
+        l_presolve.set_B_coef(2, (t_coef)5);
+        l_presolve.define_equation_type(2, simplex::t_equation_type::INEQUATION_LT);
+        l_presolve.set_A_coef(3, 3, (t_coef)2);
+        l_presolve.set_B_coef(3, (t_coef)4);
+        l_presolve.define_equation_type(3, simplex::t_equation_type::EQUATION);
+        l_presolve.set_A_coef(4, 0, (t_coef)1);
+        l_presolve.set_B_coef(4, (t_coef)6);
+        l_presolve.define_equation_type(4, simplex::t_equation_type::INEQUATION_LT);
+        l_presolve.set_A_coef(5, 0, (t_coef)1);
+        l_presolve.set_A_coef(5, 1, (t_coef)2);
+        l_presolve.set_A_coef(5, 3, (t_coef)1);
+        l_presolve.set_B_coef(5, (t_coef)14);
+        l_presolve.define_equation_type(5, simplex::t_equation_type::INEQUATION_LT);
+
+        simplex::simplex_counting_listener<t_coef> l_listener;
+        l_ok &= quicky_test::check_expected(l_presolve.presolve(l_infinite, &l_listener), true, "Presolve done");
+        const simplex::simplex_presolve_report & l_report = l_presolve.get_report();
+        l_ok &= quicky_test::check_expected(l_report.m_nb_empty_rows, 1u, "Empty rows");
+        l_ok &= quicky_test::check_expected(l_report.m_nb_singleton_rows, 2u, "Singleton rows");
+        l_ok &= quicky_test::check_expected(l_report.m_nb_duplicate_rows, 1u, "Duplicate rows");
+        l_ok &= quicky_test::check_expected(l_report.m_nb_fixed_columns, 1u, "Fixed columns");
+        l_ok &= quicky_test::check_expected(l_report.m_nb_dominated_columns, 2u, "Dominated columns");
+
+        // X1 upper bound is given as a variable bound to solvers supporting
+        // them and as an inequation to other ones
+        l_ok &= quicky_test::check_expected(l_presolve.get_nb_variables(), 2u, "Reduced variables");
+        l_ok &= quicky_test::check_expected(l_presolve.get_nb_inequations_lt(), 3u, "Reduced inequations");
+        l_ok &= quicky_test::check_expected(l_presolve.template get_nb_inequations_lt<SIMPLEX_TYPE>(), simplex::simplex_native_bounds<SIMPLEX_TYPE>::value ? 2u : 3u, "Reduced solver inequations");
+        l_ok &= quicky_test::check_expected(l_presolve.get_nb_equations(), 0u, "Reduced equations");
+        SIMPLEX_TYPE l_simplex(l_presolve.get_nb_variables(),
+                               l_presolve.template get_nb_inequations_lt<SIMPLEX_TYPE>(),
+                               l_presolve.get_nb_equations(),
+                               l_presolve.get_nb_inequations_gt()
+                              );
+        l_presolve.fill(l_simplex);
+        t_coef l_max = 0;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Reduced max found");
+        l_ok &= quicky_test::check_expected(l_presolve.postsolve_max(l_max), (t_coef)24, "Original max");
+        std::vector<t_coef> l_variable_values = l_presolve.postsolve(l_simplex.get_variable_values());
+        const int l_expected_values[5] = {6, 2, 0, 2, 0};
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_variable_values[l_index], (t_coef)l_expected_values[l_index], "Original X" + std::to_string(l_index + 1));
+        }
+    }
+    {
+        // 0 = 1
+        simplex::simplex_presolve<t_coef> l_presolve(1, 0, 1, 0);
+        l_presolve.set_Z_coef(0, (t_coef)1);
+        l_presolve.set_B_coef(0, (t_coef)1);
+        l_presolve.define_equation_type(0, simplex::t_equation_type::EQUATION);
+        l_ok &= quicky_test::check_expected(l_presolve.presolve(l_infinite), false, "Presolve infeasible");
+        l_ok &= quicky_test::check_expected(l_infinite, false, "Presolve infeasible infinite");
+    }
+    {
+        // X2 can increase infinitely
+        simplex::simplex_presolve<t_coef> l_presolve(2, 1, 0, 0);
+        l_presolve.set_Z_coef(0, (t_coef)1);
+        l_presolve.set_Z_coef(1, (t_coef)1);
+        l_presolve.set_A_coef(0, 0, (t_coef)1);
+        l_presolve.set_B_coef(0, (t_coef)3);
+        l_presolve.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+        l_ok &= quicky_test::check_expected(l_presolve.presolve(l_infinite), false, "Presolve unbounded");
+        l_ok &= quicky_test::check_expected(l_infinite, true, "Presolve unbounded infinite");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_presolve_case3()
+{
+    bool l_ok = true;
+    simplex::simplex_presolve<double> l_presolve(18, 46, 0, 0);
+    fill_test_case3(l_presolve);
+    bool l_infinite = false;
+    simplex::simplex_listener<double> l_listener(simplex::simplex_identity_solver<double>(1, 1), std::cout);
+    l_ok &= quicky_test::check_expected(l_presolve.presolve(l_infinite, &l_listener), true, "Case 3 presolve done");
+
+    simplex::simplex_solver<double> l_original(18, 46, 0, 0);
+    fill_test_case3(l_original);
+    {
+        simplex::simplex_solver<double> l_simplex(l_presolve.get_nb_variables(),
+                                                  l_presolve.get_nb_inequations_lt<simplex::simplex_solver<double>>(),
+                                                  l_presolve.get_nb_equations(),
+                                                  l_presolve.get_nb_inequations_gt()
+                                                 );
+        l_presolve.fill(l_simplex);
+        double l_max = 0;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Case 3 reduced max found");
+        l_ok &= quicky_test::check_expected(l_presolve.postsolve_max(l_max), 3.0, "Case 3 original max");
+        l_ok &= quicky_test::check_expected(l_original.check_variables(l_presolve.postsolve(l_simplex.get_variable_values())), true, "Case 3 original solution");
+    }
+    {
+        simplex::simplex_identity_solver<double> l_simplex(l_presolve.get_nb_variables(), l_presolve.get_nb_inequations_lt());
+        l_presolve.fill(l_simplex);
+        double l_max = 0;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Case 3 identity max found");
+        l_ok &= quicky_test::check_expected(l_presolve.postsolve_max(l_max), 3.0, "Case 3 identity original max");
+        l_ok &= quicky_test::check_expected(l_original.check_variables(l_presolve.postsolve(l_simplex.get_variable_values())), true, "Case 3 identity original solution");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with a badly scaled version of model
+ * Max Z = 3 * X + 5 * Y
+ *         X <= 4
+ *         2 * Y <= 12
+ *         3 * X + 2 * Y <= 18
+ * First equation is multiplied by 1e-6, last one by 1e6 and X is replaced by
+ * 1000 * U
+ * @param p_simplex simplex to fill
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_badly_scaled_model(SIMPLEX_TYPE & p_simplex)
+{
+    p_simplex.set_Z_coef(0, 3000.0);
+    p_simplex.set_Z_coef(1, 5.0);
+    p_simplex.set_A_coef(0, 0, 1e-3);
+    p_simplex.set_B_coef(0, 4e-6);
+    p_simplex.set_A_coef(1, 1, 2.0);
+    p_simplex.set_B_coef(1, 12.0);
+    p_simplex.set_A_coef(2, 0, 3e9);
+    p_simplex.set_A_coef(2, 1, 2e6);
+    p_simplex.set_B_coef(2, 18e6);
+    for(unsigned int l_equation_index = 0; l_equation_index < 3; ++l_equation_index)
+    {
+        p_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Check that a floating point value is close to expected one
+ * @param p_value value to check
+ * @param p_expected expected value
+ * @param p_name name of checked value
+ * @return true if value is close enough
+ */
+bool
+check_close(double p_value,
+            double p_expected,
+            const std::string & p_name
+           )
+{
+    bool l_ok = std::abs(p_value - p_expected) <= 1e-9 * std::max(1.0, std::abs(p_expected));
+    if(!l_ok)
+    {
+        std::cout << "[KO] " << p_name << " : " << p_value << " expected " << p_expected << std::endl;
+    }
+    return quicky_test::check_expected(l_ok, true, p_name);
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_scaling(bool p_bounds)
+{
+    bool l_ok = true;
+    double l_max = 0;
+    bool l_infinite = false;
+    {
+        SIMPLEX_TYPE l_simplex(2, 3, 0, 0);
+        fill_badly_scaled_model(l_simplex);
+        l_simplex.set_scaling(true);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Scaled max found");
+        l_ok &= check_close(l_max, 36.0, "Scaled max");
+        std::vector<double> l_values = l_simplex.get_variable_values();
+        l_ok &= check_close(l_values[0], 2e-3, "Scaled U");
+        l_ok &= check_close(l_values[1], 6.0, "Scaled Y");
+
+        // Y <= 3 : X reaches its bound
+        l_simplex.update_B_coef(1, 6.0);
+        bool l_infeasible = true;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), true, "Scaled dual max found");
+        l_ok &= check_close(l_max, 27.0, "Scaled dual max");
+        l_values = l_simplex.get_variable_values();
+        l_ok &= check_close(l_values[0], 4e-3, "Scaled dual U");
+        l_ok &= check_close(l_values[1], 3.0, "Scaled dual Y");
+
+        bool l_exception = false;
+        try
+        {
+            l_simplex.set_scaling(false);
+        }
+        catch(quicky_exception::quicky_logic_exception & e)
+        {
+            l_exception = true;
+        }
+        l_ok &= quicky_test::check_expected(l_exception, true, "Scaling fixed after search");
+    }
+    if(p_bounds)
+    {
+        // 1 <= Y <= 5
+        SIMPLEX_TYPE l_simplex(2, 3, 0, 0);
+        fill_badly_scaled_model(l_simplex);
+        l_simplex.set_variable_lower_bound(1, 1.0);
+        l_simplex.set_variable_upper_bound(1, 5.0);
+        l_simplex.set_scaling(true);
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Scaled bounded max found");
+        l_ok &= check_close(l_max, 33.0, "Scaled bounded max");
+        std::vector<double> l_values = l_simplex.get_variable_values();
+        l_ok &= check_close(l_values[0], 8e-3 / 3, "Scaled bounded U");
+        l_ok &= check_close(l_values[1], 5.0, "Scaled bounded Y");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_degeneracy(bool p_perturbation)
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Beale example multiplied by 4: first pivots are degenerate so that a
+    // low stall threshold switches to Bland's rule
+    // Max Z = 3 * X1 - 80 * X2 + 2 * X3 - 24 * X4
+    //         X1 - 32 * X2 - 4 * X3 + 36 * X4 <= 0
+    //         X1 - 24 * X2 - X3 + 6 * X4 <= 0
+    //         X3 <= 1
+    SIMPLEX_TYPE l_simplex(4, 3, 0, 0);
+    const int l_Z_coefs[4] = {3, -80, 2, -24};
+    const int l_A_coefs[3][4] = {{1, -32, -4, 36}, {1, -24, -1, 6}, {0, 0, 1, 0}};
+    const int l_B_coefs[3] = {0, 0, 1};
+    for(unsigned int l_variable_index = 0; l_variable_index < 4; ++l_variable_index)
+    {
+        l_simplex.set_Z_coef(l_variable_index, (t_coef)l_Z_coefs[l_variable_index]);
+    }
+    for(unsigned int l_equation_index = 0; l_equation_index < 3; ++l_equation_index)
+    {
+        for(unsigned int l_variable_index = 0; l_variable_index < 4; ++l_variable_index)
+        {
+            if(l_A_coefs[l_equation_index][l_variable_index])
+            {
+                l_simplex.set_A_coef(l_equation_index, l_variable_index, (t_coef)l_A_coefs[l_equation_index][l_variable_index]);
+            }
+        }
+        l_simplex.set_B_coef(l_equation_index, (t_coef)l_B_coefs[l_equation_index]);
+        l_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+    l_simplex.set_stall_threshold(3);
+    l_simplex.set_perturbation(p_perturbation);
+
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Degenerate max found");
+    l_ok &= check_close((double)l_max, 5.0, "Degenerate max");
+    std::vector<t_coef> l_values = l_simplex.get_variable_values();
+    const int l_expected_values[4] = {1, 0, 1, 0};
+    for(unsigned int l_index = 0; l_index < 4; ++l_index)
+    {
+        l_ok &= check_close((double)l_values[l_index], l_expected_values[l_index], "Degenerate X" + std::to_string(l_index + 1));
+    }
+    l_ok &= quicky_test::check_expected(l_simplex.get_nb_degenerate_pivots() <= l_simplex.get_nb_pivots(), true, "Degenerate pivots counted among pivots");
+    if(p_perturbation)
+    {
+        // Perturbed B coefficients are never null during primal iterations
+        l_ok &= quicky_test::check_expected(l_simplex.get_nb_degenerate_pivots(), 0u, "No degenerate pivot");
+    }
+    else
+    {
+        l_ok &= quicky_test::check_expected(l_simplex.get_nb_degenerate_pivots() > 0, true, "Degenerate pivots");
+    }
+    l_ok &= quicky_test::check_expected(l_simplex.get_degenerate_pivot_ratio() == (double)l_simplex.get_nb_degenerate_pivots() / l_simplex.get_nb_pivots(), true, "Degenerate pivot ratio");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with a model of 3 variables and 2 inequations whose optimum 10
+ * needs at least 2 pivots, or with an unbounded model
+ * @param p_simplex simplex to fill
+ * @param p_unbounded indicate if model should be unbounded
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_solve_options_model(SIMPLEX_TYPE & p_simplex,
+                         bool p_unbounded
+                        )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    const int l_Z_coefs[2][3] = {{1, 4, 3}, {1, 1, 1}};
+    const int l_A_coefs[2][2][3] = {{{2, 2, 1}, {1, 2, 2}}, {{-1, 1, 0}, {0, 0, 1}}};
+    const int l_B_coefs[2][2] = {{4, 6}, {1, 2}};
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        p_simplex.set_Z_coef(l_index, (t_coef)l_Z_coefs[p_unbounded][l_index]);
+    }
+    for(unsigned int l_row_index = 0; l_row_index < 2; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 3; ++l_index)
+        {
+            if(l_A_coefs[p_unbounded][l_row_index][l_index])
+            {
+                p_simplex.set_A_coef(l_row_index, l_index, (t_coef)l_A_coefs[p_unbounded][l_row_index][l_index]);
+            }
+        }
+        p_simplex.set_B_coef(l_row_index, (t_coef)l_B_coefs[p_unbounded][l_row_index]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Create simplex filled with solve options model
+ * @param p_unbounded indicate if model should be unbounded
+ * @return created simplex
+ */
+template <typename SIMPLEX_TYPE>
+std::unique_ptr<SIMPLEX_TYPE>
+create_solve_options_model(bool p_unbounded)
+{
+    std::unique_ptr<SIMPLEX_TYPE> l_simplex(new SIMPLEX_TYPE(3, 2, 0, 0));
+    fill_solve_options_model(*l_simplex, p_unbounded);
+    for(unsigned int l_row_index = 0; l_row_index < 2; ++l_row_index)
+    {
+        l_simplex->define_equation_type(l_row_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+    return l_simplex;
+}
+
+//------------------------------------------------------------------------------
+template <>
+std::unique_ptr<simplex::simplex_identity_solver<double>>
+create_solve_options_model<simplex::simplex_identity_solver<double>>(bool p_unbounded)
+{
+    std::unique_ptr<simplex::simplex_identity_solver<double>> l_simplex(new simplex::simplex_identity_solver<double>(3, 2));
+    fill_solve_options_model(*l_simplex, p_unbounded);
+    return l_simplex;
+}
+
+//------------------------------------------------------------------------------
+template <>
+std::unique_ptr<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>
+create_solve_options_model<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>>(bool p_unbounded)
+{
+    std::unique_ptr<simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>> l_simplex(new simplex::simplex_identity_solver<double,simplex::simplex_column_array<double>>(3, 2));
+    fill_solve_options_model(*l_simplex, p_unbounded);
+    return l_simplex;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_solve_options()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    t_coef l_max = 0;
+
+    simplex::simplex_solve_options<t_coef> l_options;
+    std::unique_ptr<SIMPLEX_TYPE> l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::OPTIMAL, "No limit status");
+    l_ok &= check_close((double)l_max, 10.0, "No limit max");
+
+    l_options.m_iteration_limit = 0;
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::ITERATION_LIMIT, "Iteration limit status");
+    l_ok &= check_close((double)l_max, 0.0, "Iteration limit objective");
+    l_options.m_iteration_limit = std::numeric_limits<unsigned int>::max();
+
+    l_options.m_time_limit = std::chrono::microseconds(0);
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::TIME_LIMIT, "Time limit status");
+    l_options.m_time_limit = std::chrono::microseconds::max();
+
+    std::atomic<bool> l_cancel(true);
+    l_options.m_cancel = &l_cancel;
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::CANCELLED, "Cancel status");
+    l_cancel = false;
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::OPTIMAL, "Not cancelled status");
+    l_options.m_cancel = NULL;
+
+    // First pivot already gives an objective value of at least 5
+    l_options.m_use_cutoff = true;
+    l_options.m_cutoff = 5;
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::CUTOFF, "Cutoff status");
+    l_ok &= quicky_test::check_expected(!(l_max < 5) && l_max < 10, true, "Cutoff objective");
+    l_options.m_use_cutoff = false;
+
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(true);
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_options), simplex::t_solve_status::UNBOUNDED, "Unbounded status");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_find_min()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    const int l_Z_coefs[3] = {-1, -4, -3};
+
+    // Min of opposite objective function of solve options model is -10
+    std::unique_ptr<SIMPLEX_TYPE> l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_simplex->set_Z_coef(l_index, (t_coef)l_Z_coefs[l_index]);
+    }
+    t_coef l_min = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex->find_min(l_min, l_infinite), true, "Min found");
+    l_ok &= quicky_test::check_expected(l_infinite, false, "Min not infinite");
+    l_ok &= check_close((double)l_min, -10.0, "Min");
+    std::vector<t_coef> l_values = l_simplex->get_variable_values();
+    const int l_expected_values[3] = {0, 1, 2};
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_ok &= check_close((double)l_values[l_index], l_expected_values[l_index], "Min X" + std::to_string(l_index));
+    }
+
+    // Objective function is restored so that max can be searched from min
+    t_coef l_max = -1;
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_infinite), true, "Max after min found");
+    l_ok &= check_close((double)l_max, 0.0, "Max after min");
+
+    // Cutoff is an upper bound when searching min
+    simplex::simplex_solve_options<t_coef> l_options;
+    l_options.m_use_cutoff = true;
+    l_options.m_cutoff = -5;
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        l_simplex->set_Z_coef(l_index, (t_coef)l_Z_coefs[l_index]);
+    }
+    l_ok &= quicky_test::check_expected(l_simplex->find_min(l_min, l_options), simplex::t_solve_status::CUTOFF, "Min cutoff status");
+    l_ok &= quicky_test::check_expected(!(l_min > -5) && l_min > -10, true, "Min cutoff objective");
+
+    // Min of unbounded model objective function is 0
+    l_simplex = create_solve_options_model<SIMPLEX_TYPE>(true);
+    l_ok &= quicky_test::check_expected(l_simplex->find_min(l_min, l_infinite), true, "Min of unbounded max found");
+    l_ok &= check_close((double)l_min, 0.0, "Min of unbounded max");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_find_min_gt()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Min Z = 2 * X1 + 3 * X2
+    //         X1 + X2 >= 4
+    //         X1 + 3 * X2 >= 6
+    SIMPLEX_TYPE l_simplex(2, 0, 0, 2);
+    l_simplex.set_Z_coef(0, (t_coef)2);
+    l_simplex.set_Z_coef(1, (t_coef)3);
+    const int l_A_coefs[2][2] = {{1, 1}, {1, 3}};
+    const int l_B_coefs[2] = {4, 6};
+    for(unsigned int l_equation_index = 0; l_equation_index < 2; ++l_equation_index)
+    {
+        for(unsigned int l_variable_index = 0; l_variable_index < 2; ++l_variable_index)
+        {
+            l_simplex.set_A_coef(l_equation_index, l_variable_index, (t_coef)l_A_coefs[l_equation_index][l_variable_index]);
+        }
+        l_simplex.set_B_coef(l_equation_index, (t_coef)l_B_coefs[l_equation_index]);
+        l_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_GT);
+    }
+    t_coef l_min = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_min(l_min, l_infinite), true, "Min GT found");
+    l_ok &= check_close((double)l_min, 9.0, "Min GT");
+    std::vector<t_coef> l_values = l_simplex.get_variable_values();
+    l_ok &= check_close((double)l_values[0], 3.0, "Min GT X1");
+    l_ok &= check_close((double)l_values[1], 1.0, "Min GT X2");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_dual_values()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Optimum 10 with X2 = 1 and X3 = 2 in base
+    std::unique_ptr<SIMPLEX_TYPE> l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_infinite), true, "Dual values max found");
+    std::vector<t_coef> l_duals = l_simplex->get_dual_values();
+    l_ok &= quicky_test::check_expected(l_duals.size(), (size_t)2, "Number of dual values");
+    l_ok &= check_close((double)l_duals[0], 1.0, "Dual value 0");
+    l_ok &= check_close((double)l_duals[1], 1.0, "Dual value 1");
+    std::vector<t_coef> l_costs = l_simplex->get_reduced_costs();
+    l_ok &= quicky_test::check_expected(l_costs.size(), (size_t)3, "Number of reduced costs");
+    l_ok &= check_close((double)l_costs[0], -2.0, "Reduced cost X1");
+    l_ok &= check_close((double)l_costs[1], 0.0, "Reduced cost X2");
+    l_ok &= check_close((double)l_costs[2], 0.0, "Reduced cost X3");
+
+    // Equation without adjustment variable uses column of its artificial
+    // variable. Optimum 37 with X1 = 7 and X2 = 3
+    SIMPLEX_TYPE l_mixed_simplex(3, 1, 1, 1);
+    fill_basis_model(l_mixed_simplex, 1);
+    l_ok &= quicky_test::check_expected(l_mixed_simplex.find_max(l_max, l_infinite), true, "Mixed dual values max found");
+    l_duals = l_mixed_simplex.get_dual_values();
+    l_ok &= quicky_test::check_expected(l_duals.size(), (size_t)3, "Number of mixed dual values");
+    l_ok &= check_close((double)l_duals[0], 4.0, "Mixed dual value 0");
+    l_ok &= check_close((double)l_duals[1], 0.0, "Mixed dual value 1");
+    l_ok &= check_close((double)l_duals[2], -1.0, "Mixed dual value 2");
+    l_costs = l_mixed_simplex.get_reduced_costs();
+    l_ok &= check_close((double)l_costs[0], 0.0, "Mixed reduced cost X1");
+    l_ok &= check_close((double)l_costs[1], 0.0, "Mixed reduced cost X2");
+    l_ok &= check_close((double)l_costs[2], -2.0, "Mixed reduced cost X3");
+
+    if(std::is_integral<t_coef>::value)
+    {
+        // Max Z = X1
+        //         2 * X1 <= 4
+        // Dual value 1/2 is not an overflow so promotion cannot fix it
+        SIMPLEX_TYPE l_fractional_simplex(1, 1, 0, 0);
+        l_fractional_simplex.set_Z_coef(0, (t_coef)1);
+        l_fractional_simplex.set_A_coef(0, 0, (t_coef)2);
+        l_fractional_simplex.set_B_coef(0, (t_coef)4);
+        l_fractional_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+        l_ok &= quicky_test::check_expected(l_fractional_simplex.find_max(l_max, l_infinite), true, "Fractional dual max found");
+        bool l_overflow = false;
+        bool l_thrown = false;
+        try
+        {
+            l_fractional_simplex.get_dual_values();
+        }
+        catch(const simplex::simplex_overflow_exception &)
+        {
+            l_overflow = true;
+        }
+        catch(const quicky_exception::quicky_runtime_exception &)
+        {
+            l_thrown = true;
+        }
+        l_ok &= quicky_test::check_expected(l_overflow, false, "Fractional dual is not an overflow");
+        l_ok &= quicky_test::check_expected(l_thrown, true, "Fractional dual detected");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Compare search results of an identity solver and general solver
+ * @param p_identity identity solver
+ * @param p_simplex general solver filled with same model
+ * @param p_duals expected dual values, general solver cannot compute them
+ * for equations without adjustment variable
+ * @param p_name name of model
+ * @return true if both solvers give same optimum and values and if dual
+ * values are the expected ones
+ */
+template <typename IDENTITY_TYPE>
+bool
+compare_identity(IDENTITY_TYPE & p_identity,
+                 simplex::simplex_solver<double> & p_simplex,
+                 const std::vector<double> & p_duals,
+                 const std::string & p_name
+                )
+{
+    bool l_ok = true;
+    double l_identity_max = 0;
+    double l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(p_identity.find_max(l_identity_max, l_infinite), true, p_name + " identity max found");
+    l_ok &= quicky_test::check_expected(p_simplex.find_max(l_max, l_infinite), true, p_name + " max found");
+    l_ok &= check_close(l_identity_max, l_max, p_name + " max");
+    std::vector<double> l_identity_values = p_identity.get_variable_values();
+    std::vector<double> l_values = p_simplex.get_variable_values();
+    std::vector<double> l_identity_duals = p_identity.get_dual_values();
+    std::vector<double> l_identity_costs = p_identity.get_reduced_costs();
+    std::vector<double> l_costs = p_simplex.get_reduced_costs();
+    for(unsigned int l_index = 0; l_index < l_values.size(); ++l_index)
+    {
+        l_ok &= check_close(l_identity_values[l_index], l_values[l_index], p_name + " X" + std::to_string(l_index));
+        l_ok &= check_close(l_identity_costs[l_index], l_costs[l_index], p_name + " reduced cost X" + std::to_string(l_index));
+    }
+    for(unsigned int l_index = 0; l_index < p_duals.size(); ++l_index)
+    {
+        l_ok &= check_close(l_identity_duals[l_index], p_duals[l_index], p_name + " dual value " + std::to_string(l_index));
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename IDENTITY_TYPE>
+bool test_identity_mixed()
+{
+    bool l_ok = true;
+    {
+        IDENTITY_TYPE l_identity(3, 1, 1, 1);
+        fill_basis_model(l_identity, 1);
+        simplex::simplex_solver<double> l_simplex(3, 1, 1, 1);
+        fill_basis_model(l_simplex, 1);
+        l_ok &= compare_identity(l_identity, l_simplex, {4.0, 0.0, -1.0}, "Mixed");
+    }
+    {
+        // Max Z = - X1 - X2
+        //         - X1 - X2 <= -3
+        //         X1 <= 5
+        //         X2 - X1 = -1
+        const int l_A_coefs[3][2] = {{-1, -1}, {1, 0}, {-1, 1}};
+        const int l_B_coefs[3] = {-3, 5, -1};
+        IDENTITY_TYPE l_identity(2, 2, 1, 0);
+        simplex::simplex_solver<double> l_simplex(2, 2, 1, 0);
+        for(unsigned int l_equation_index = 0; l_equation_index < 3; ++l_equation_index)
+        {
+            simplex::t_equation_type l_type = l_equation_index < 2 ? simplex::t_equation_type::INEQUATION_LT : simplex::t_equation_type::EQUATION;
+            for(unsigned int l_variable_index = 0; l_variable_index < 2; ++l_variable_index)
+            {
+                l_identity.set_A_coef(l_equation_index, l_variable_index, l_A_coefs[l_equation_index][l_variable_index]);
+                l_simplex.set_A_coef(l_equation_index, l_variable_index, l_A_coefs[l_equation_index][l_variable_index]);
+            }
+            l_identity.set_B_coef(l_equation_index, l_B_coefs[l_equation_index]);
+            l_simplex.set_B_coef(l_equation_index, l_B_coefs[l_equation_index]);
+            l_identity.define_equation_type(l_equation_index, l_type);
+            l_simplex.define_equation_type(l_equation_index, l_type);
+        }
+        for(unsigned int l_variable_index = 0; l_variable_index < 2; ++l_variable_index)
+        {
+            l_identity.set_Z_coef(l_variable_index, -1);
+            l_simplex.set_Z_coef(l_variable_index, -1);
+        }
+        l_ok &= compare_identity(l_identity, l_simplex, {1.0, 0.0, 0.0}, "Negative B");
+    }
+    {
+        // Search stopped during first phase can be resumed
+        IDENTITY_TYPE l_identity(3, 1, 1, 1);
+        fill_basis_model(l_identity, 1);
+        simplex::simplex_solve_options<double> l_options;
+        l_options.m_iteration_limit = 1;
+        double l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_identity.find_max(l_max, l_options), simplex::t_solve_status::ITERATION_LIMIT, "Stopped first phase status");
+        l_ok &= quicky_test::check_expected(l_identity.find_max(l_max, l_infinite), true, "Resumed first phase max found");
+        l_ok &= check_close(l_max, 37.0, "Resumed first phase max");
+    }
+    {
+        // Redundant equations
+        // Max Z = X1 + 2 * X2
+        //         X1 + X2 = 4
+        //         2 * X1 + 2 * X2 = 8
+        //         X1 <= 3
+        IDENTITY_TYPE l_identity(2, 1, 2, 0);
+        l_identity.set_Z_coef(0, 1);
+        l_identity.set_Z_coef(1, 2);
+        l_identity.set_A_coef(0, 0, 1);
+        l_identity.set_A_coef(0, 1, 1);
+        l_identity.set_B_coef(0, 4);
+        l_identity.define_equation_type(0, simplex::t_equation_type::EQUATION);
+        l_identity.set_A_coef(1, 0, 2);
+        l_identity.set_A_coef(1, 1, 2);
+        l_identity.set_B_coef(1, 8);
+        l_identity.define_equation_type(1, simplex::t_equation_type::EQUATION);
+        l_identity.set_A_coef(2, 0, 1);
+        l_identity.set_B_coef(2, 3);
+        double l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_identity.find_max(l_max, l_infinite), true, "Redundant max found");
+        l_ok &= check_close(l_max, 8.0, "Redundant max");
+        std::vector<double> l_values = l_identity.get_variable_values();
+        l_ok &= check_close(l_values[0], 0.0, "Redundant X1");
+        l_ok &= check_close(l_values[1], 4.0, "Redundant X2");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with a model mixing inequations and equations. Rows are
+ * inequations lower than, then equations then inequations greater than
+ * @param p_simplex simplex to fill
+ * @param p_Z_coefs objective function coefficients
+ * @param p_A_coefs equations coefficients, one vector per row
+ * @param p_B_coefs right hand side of rows
+ * @param p_nb_inequations_lt number of inequations lower than
+ * @param p_nb_equations number of equations
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_mixed_model(SIMPLEX_TYPE & p_simplex,
+                 const std::vector<double> & p_Z_coefs,
+                 const std::vector<std::vector<double>> & p_A_coefs,
+                 const std::vector<double> & p_B_coefs,
+                 unsigned int p_nb_inequations_lt,
+                 unsigned int p_nb_equations
+                )
+{
+    for(unsigned int l_variable_index = 0; l_variable_index < p_Z_coefs.size(); ++l_variable_index)
+    {
+        p_simplex.set_Z_coef(l_variable_index, p_Z_coefs[l_variable_index]);
+    }
+    for(unsigned int l_equation_index = 0; l_equation_index < p_A_coefs.size(); ++l_equation_index)
+    {
+        for(unsigned int l_variable_index = 0; l_variable_index < p_Z_coefs.size(); ++l_variable_index)
+        {
+            if(p_A_coefs[l_equation_index][l_variable_index])
+            {
+                p_simplex.set_A_coef(l_equation_index, l_variable_index, p_A_coefs[l_equation_index][l_variable_index]);
+            }
+        }
+        p_simplex.set_B_coef(l_equation_index, p_B_coefs[l_equation_index]);
+        simplex::t_equation_type l_type = l_equation_index < p_nb_inequations_lt ? simplex::t_equation_type::INEQUATION_LT
+                                        : (l_equation_index < p_nb_inequations_lt + p_nb_equations ? simplex::t_equation_type::EQUATION : simplex::t_equation_type::INEQUATION_GT);
+        p_simplex.define_equation_type(l_equation_index, l_type);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Compare search status and optimum of an identity solver and general solver
+ * on a model mixing inequations and equations
+ * @return true if both solvers give same status and optimum
+ */
+template <typename IDENTITY_TYPE>
+bool
+compare_identity_mixed(const std::vector<double> & p_Z_coefs,
+                       const std::vector<std::vector<double>> & p_A_coefs,
+                       const std::vector<double> & p_B_coefs,
+                       unsigned int p_nb_inequations_lt,
+                       unsigned int p_nb_equations,
+                       const std::string & p_name
+                      )
+{
+    unsigned int l_nb_variables = (unsigned int)p_Z_coefs.size();
+    unsigned int l_nb_inequations_gt = (unsigned int)p_A_coefs.size() - p_nb_inequations_lt - p_nb_equations;
+    IDENTITY_TYPE l_identity(l_nb_variables, p_nb_inequations_lt, p_nb_equations, l_nb_inequations_gt);
+    fill_mixed_model(l_identity, p_Z_coefs, p_A_coefs, p_B_coefs, p_nb_inequations_lt, p_nb_equations);
+    simplex::simplex_solver<double> l_simplex(l_nb_variables, p_nb_inequations_lt, p_nb_equations, l_nb_inequations_gt);
+    fill_mixed_model(l_simplex, p_Z_coefs, p_A_coefs, p_B_coefs, p_nb_inequations_lt, p_nb_equations);
+    simplex::simplex_solve_options<double> l_options;
+    double l_identity_max = 0;
+    double l_max = 0;
+    simplex::t_solve_status l_identity_status = l_identity.find_max(l_identity_max, l_options);
+    simplex::t_solve_status l_status = l_simplex.find_max(l_max, l_options);
+    bool l_ok = quicky_test::check_expected(l_identity_status, l_status, p_name + " status");
+    if(simplex::t_solve_status::OPTIMAL == l_status)
+    {
+        l_ok &= check_close(l_identity_max, l_max, p_name + " max");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename IDENTITY_TYPE>
+bool test_identity_random_mixed()
+{
+    bool l_ok = true;
+    // Max Z = 2 * X1 + 3 * X2 + 3 * X3
+    //         -X2 + 4 * X3 = 0
+    //         3 * X1 + X2 + 3 * X3 >= 3
+    //         4 * X1 - X2 + 2 * X3 >= 3
+    std::vector<double> l_Z_coefs = {2, 3, 3};
+    std::vector<std::vector<double>> l_A_coefs = {{0, -1, 4}, {3, 1, 3}, {4, -1, 2}};
+    std::vector<double> l_B_coefs = {0, 3, 3};
+    l_ok &= compare_identity_mixed<IDENTITY_TYPE>(l_Z_coefs, l_A_coefs, l_B_coefs, 0, 1, "Unbounded mixed");
+    // Same model with X1 + X2 + X3 <= 30 and 4 * X1 >= 2
+    l_A_coefs.insert(l_A_coefs.begin(), {1, 1, 1});
+    l_A_coefs.push_back({4, 0, 0});
+    l_B_coefs.insert(l_B_coefs.begin(), 30);
+    l_B_coefs.push_back(2);
+    l_ok &= compare_identity_mixed<IDENTITY_TYPE>(l_Z_coefs, l_A_coefs, l_B_coefs, 1, 1, "Bounded mixed");
+    // Random models with 3 rows of each type
+    for(unsigned int l_seed = 1; l_seed <= 500; ++l_seed)
+    {
+        std::mt19937 l_generator(l_seed);
+        std::uniform_int_distribution<int> l_Z_distribution(-2, 5);
+        std::uniform_int_distribution<int> l_A_distribution(-2, 5);
+        std::uniform_int_distribution<int> l_B_distribution(0, 30);
+        std::vector<double> l_random_Z_coefs(10);
+        std::vector<std::vector<double>> l_random_A_coefs(9, std::vector<double>(10));
+        std::vector<double> l_random_B_coefs(9);
+        for(auto & l_coef: l_random_Z_coefs)
+        {
+            l_coef = l_Z_distribution(l_generator);
+        }
+        for(unsigned int l_equation_index = 0; l_equation_index < 9; ++l_equation_index)
+        {
+            for(auto & l_coef: l_random_A_coefs[l_equation_index])
+            {
+                l_coef = l_A_distribution(l_generator);
+            }
+            l_random_B_coefs[l_equation_index] = l_B_distribution(l_generator);
+        }
+        l_ok &= compare_identity_mixed<IDENTITY_TYPE>(l_random_Z_coefs, l_random_A_coefs, l_random_B_coefs, 3, 3, "Random mixed " + std::to_string(l_seed));
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_infeasible_restart()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // Max Z = 2 * X1 + 3 * X2
+    //         X1 + X2 <= 4
+    //         X1 >= 5
+    SIMPLEX_TYPE l_simplex(2, 1, 0, 1);
+    l_simplex.set_Z_coef(0, (t_coef)2);
+    l_simplex.set_Z_coef(1, (t_coef)3);
+    l_simplex.set_A_coef(0, 0, (t_coef)1);
+    l_simplex.set_A_coef(0, 1, (t_coef)1);
+    l_simplex.set_B_coef(0, (t_coef)4);
+    l_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+    l_simplex.set_A_coef(1, 0, (t_coef)1);
+    l_simplex.set_B_coef(1, (t_coef)5);
+    l_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_GT);
+
+    t_coef l_max = 0;
+    bool l_infinite = true;
+    bool l_infeasible = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), false, "Infeasible max found");
+    l_ok &= quicky_test::check_expected(l_infinite, false, "Infeasible infinite");
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), false, "Infeasible max found again");
+    l_ok &= quicky_test::check_expected(l_simplex.find_max_dual(l_max, l_infeasible), false, "Infeasible dual max found");
+    l_ok &= quicky_test::check_expected(l_infeasible, true, "Infeasible dual");
+
+    // X1 >= 2 makes problem feasible
+    l_simplex.update_B_coef(1, (t_coef)2);
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Restart max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)10, "Restart max");
+    std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)2, "Restart X1");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)2, "Restart X2");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Search max by calls limited to one iteration until search ends
+ * @param p_simplex simplex where search is done
+ * @param p_max reference on variable where to store max
+ * @return status of last call
+ */
+template <typename SIMPLEX_TYPE>
+simplex::t_solve_status
+find_max_by_single_iterations(SIMPLEX_TYPE & p_simplex,
+                              typename SIMPLEX_TYPE::t_coef_type & p_max
+                             )
+{
+    simplex::simplex_solve_options<typename SIMPLEX_TYPE::t_coef_type> l_options;
+    l_options.m_iteration_limit = 1;
+    simplex::t_solve_status l_status = simplex::t_solve_status::ITERATION_LIMIT;
+    for(unsigned int l_nb_call = 0; l_nb_call < 1000 && simplex::t_solve_status::ITERATION_LIMIT == l_status; ++l_nb_call)
+    {
+        l_status = p_simplex.find_max(p_max, l_options);
+    }
+    return l_status;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_first_phase_resume()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    t_coef l_max = 0;
+    {
+        // Model of phase 1 test with optimum 37
+        SIMPLEX_TYPE l_simplex(3, 1, 1, 1);
+        fill_basis_model(l_simplex, 1);
+        l_ok &= quicky_test::check_expected(find_max_by_single_iterations(l_simplex, l_max), simplex::t_solve_status::OPTIMAL, "Resumed mixed status");
+        l_ok &= check_close((double)l_max, 37.0, "Resumed mixed max");
+        std::vector<t_coef> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= check_close((double)l_variable_values[0], 7.0, "Resumed mixed X1");
+        l_ok &= check_close((double)l_variable_values[1], 3.0, "Resumed mixed X2");
+    }
+    {
+        // Max Z = X1 + X2
+        //         X1 + X2 = 10
+        //         X1 + X2 <= 5
+        SIMPLEX_TYPE l_simplex(2, 1, 1, 0);
+        fill_mixed_model(l_simplex, {1, 1}, {{1, 1}, {1, 1}}, {5, 10}, 1, 1);
+        l_ok &= quicky_test::check_expected(find_max_by_single_iterations(l_simplex, l_max), simplex::t_solve_status::INFEASIBLE, "Resumed infeasible status");
+    }
+    if(std::is_floating_point<t_coef>::value)
+    {
+        // Random models with 3 rows of each type compared to a search
+        // without limit
+        for(unsigned int l_seed = 1; l_seed <= 100; ++l_seed)
+        {
+            std::mt19937 l_generator(l_seed);
+            std::uniform_int_distribution<int> l_A_distribution(-2, 5);
+            std::uniform_int_distribution<int> l_B_distribution(0, 30);
+            std::vector<double> l_Z_coefs(10);
+            std::vector<std::vector<double>> l_A_coefs(9, std::vector<double>(10));
+            std::vector<double> l_B_coefs(9);
+            for(auto & l_coef: l_Z_coefs)
+            {
+                l_coef = l_A_distribution(l_generator);
+            }
+            for(unsigned int l_equation_index = 0; l_equation_index < 9; ++l_equation_index)
+            {
+                for(auto & l_coef: l_A_coefs[l_equation_index])
+                {
+                    l_coef = l_A_distribution(l_generator);
+                }
+                l_B_coefs[l_equation_index] = l_B_distribution(l_generator);
+            }
+            SIMPLEX_TYPE l_simplex(10, 3, 3, 3);
+            fill_mixed_model(l_simplex, l_Z_coefs, l_A_coefs, l_B_coefs, 3, 3);
+            simplex::simplex_solver<double> l_reference(10, 3, 3, 3);
+            fill_mixed_model(l_reference, l_Z_coefs, l_A_coefs, l_B_coefs, 3, 3);
+            double l_reference_max = 0;
+            simplex::t_solve_status l_reference_status = l_reference.find_max(l_reference_max, simplex::simplex_solve_options<double>());
+            std::string l_name = "Resumed random " + std::to_string(l_seed);
+            l_ok &= quicky_test::check_expected(find_max_by_single_iterations(l_simplex, l_max), l_reference_status, l_name + " status");
+            if(simplex::t_solve_status::OPTIMAL == l_reference_status)
+            {
+                l_ok &= check_close((double)l_max, l_reference_max, l_name + " max");
+            }
+        }
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Check allowable decrease and increase of a range
+ * @param p_range range to check
+ * @param p_decrease expected decrease, negative if not limited
+ * @param p_increase expected increase, negative if not limited
+ * @param p_name name of checked range
+ * @return true if range is the expected one
+ */
+template <typename COEF_TYPE>
+bool
+check_range(const simplex::simplex_range<COEF_TYPE> & p_range,
+            double p_decrease,
+            double p_increase,
+            const std::string & p_name
+           )
+{
+    bool l_ok = quicky_test::check_expected(p_range.m_decrease_limited, p_decrease >= 0, p_name + " decrease limited");
+    l_ok &= quicky_test::check_expected(p_range.m_increase_limited, p_increase >= 0, p_name + " increase limited");
+    if(p_range.m_decrease_limited && p_decrease >= 0)
+    {
+        l_ok &= check_close((double)p_range.m_decrease, p_decrease, p_name + " decrease");
+    }
+    if(p_range.m_increase_limited && p_increase >= 0)
+    {
+        l_ok &= check_close((double)p_range.m_increase, p_increase, p_name + " increase");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_sensitivity_ranges(bool p_scaling)
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    {
+        // Optimum 10 with X2 = 1 and X3 = 2 in base
+        std::unique_ptr<SIMPLEX_TYPE> l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+        l_simplex->set_scaling(p_scaling);
+        t_coef l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_infinite), true, "Ranges max found");
+        l_ok &= check_close((double)l_max, 10.0, "Ranges max");
+        std::vector<simplex::simplex_range<t_coef>> l_ranges = l_simplex->get_B_coef_ranges();
+        l_ok &= quicky_test::check_expected(l_ranges.size(), (size_t)2, "Number of B ranges");
+        l_ok &= check_range(l_ranges[0], 1.0, 2.0, "B range 0");
+        l_ok &= check_range(l_ranges[1], 2.0, 2.0, "B range 1");
+        l_ranges = l_simplex->get_Z_coef_ranges();
+        l_ok &= quicky_test::check_expected(l_ranges.size(), (size_t)3, "Number of Z ranges");
+        l_ok &= check_range(l_ranges[0], -1.0, 2.0, "Z range X1");
+        l_ok &= check_range(l_ranges[1], 1.0, 2.0, "Z range X2");
+        l_ok &= check_range(l_ranges[2], 1.0, 1.0, "Z range X3");
+    }
+    {
+        // Min Z = 2 * X1 + 3 * X2
+        //         X1 + X2 >= 4
+        //         X1 + 3 * X2 >= 6
+        SIMPLEX_TYPE l_simplex(2, 0, 0, 2);
+        l_simplex.set_scaling(p_scaling);
+        l_simplex.set_Z_coef(0, (t_coef)2);
+        l_simplex.set_Z_coef(1, (t_coef)3);
+        const int l_A_coefs[2][2] = {{1, 1}, {1, 3}};
+        const int l_B_coefs[2] = {4, 6};
+        for(unsigned int l_equation_index = 0; l_equation_index < 2; ++l_equation_index)
+        {
+            for(unsigned int l_variable_index = 0; l_variable_index < 2; ++l_variable_index)
+            {
+                l_simplex.set_A_coef(l_equation_index, l_variable_index, (t_coef)l_A_coefs[l_equation_index][l_variable_index]);
+            }
+            l_simplex.set_B_coef(l_equation_index, (t_coef)l_B_coefs[l_equation_index]);
+            l_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_GT);
+        }
+        t_coef l_min = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_min(l_min, l_infinite), true, "Ranges min found");
+        l_ok &= check_close((double)l_min, 9.0, "Ranges min");
+        std::vector<t_coef> l_duals = l_simplex.get_dual_values();
+        l_ok &= check_close((double)l_duals[0], 1.5, "Min dual value 0");
+        l_ok &= check_close((double)l_duals[1], 0.5, "Min dual value 1");
+        std::vector<simplex::simplex_range<t_coef>> l_ranges = l_simplex.get_B_coef_ranges();
+        l_ok &= check_range(l_ranges[0], 2.0, 2.0, "Min B range 0");
+        l_ok &= check_range(l_ranges[1], 2.0, 6.0, "Min B range 1");
+        l_ranges = l_simplex.get_Z_coef_ranges();
+        l_ok &= check_range(l_ranges[0], 1.0, 1.0, "Min Z range X1");
+        l_ok &= check_range(l_ranges[1], 1.0, 3.0, "Min Z range X2");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool test_sensitivity_bounds()
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    // With X3 <= 1.5 optimum 9.5 has X2 = 1.25 in base and X3 at its upper
+    // bound
+    std::unique_ptr<SIMPLEX_TYPE> l_simplex = create_solve_options_model<SIMPLEX_TYPE>(false);
+    l_simplex->set_variable_upper_bound(2, (t_coef)1.5);
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex->find_max(l_max, l_infinite), true, "Bounded sensitivity max found");
+    l_ok &= check_close((double)l_max, 9.5, "Bounded sensitivity max");
+    std::vector<t_coef> l_duals = l_simplex->get_dual_values();
+    l_ok &= check_close((double)l_duals[0], 2.0, "Bounded dual value 0");
+    l_ok &= check_close((double)l_duals[1], 0.0, "Bounded dual value 1");
+    std::vector<t_coef> l_costs = l_simplex->get_reduced_costs();
+    l_ok &= check_close((double)l_costs[0], -3.0, "Bounded reduced cost X1");
+    l_ok &= check_close((double)l_costs[1], 0.0, "Bounded reduced cost X2");
+    l_ok &= check_close((double)l_costs[2], 1.0, "Bounded reduced cost X3");
+    std::vector<simplex::simplex_range<t_coef>> l_ranges = l_simplex->get_B_coef_ranges();
+    l_ok &= check_range(l_ranges[0], 2.5, 0.5, "Bounded B range 0");
+    l_ranges = l_simplex->get_Z_coef_ranges();
+    l_ok &= check_range(l_ranges[2], 1.0, -1.0, "Bounded Z range X3");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with test case 1 model, base variables are defined only if
+ * requested
+ * @param p_simplex simplex to fill
+ * @param p_define_base indicate if base variables should be defined
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_test_case1(SIMPLEX_TYPE & p_simplex,
+                bool p_define_base
+               )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    const int l_Z_coefs[] = {1, 4, 3};
+    const int l_coefs[2][5] = {{2, 2, 1, 1, 0}, {1, 2, 2, 0, 1}};
+    const int l_B_coefs[] = {4, 6};
+    for(unsigned int l_index = 0; l_index < 3; ++l_index)
+    {
+        p_simplex.set_Z_coef(l_index, (t_coef)l_Z_coefs[l_index]);
+    }
+    for(unsigned int l_row_index = 0; l_row_index < 2; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            if(l_coefs[l_row_index][l_index])
+            {
+                p_simplex.set_A_coef(l_row_index, l_index, (t_coef)l_coefs[l_row_index][l_index]);
+            }
+        }
+        p_simplex.set_B_coef(l_row_index, (t_coef)l_B_coefs[l_row_index]);
+        p_simplex.define_equation_type(l_row_index, simplex::t_equation_type::EQUATION);
+    }
+    if(p_define_base)
+    {
+        p_simplex.define_base_variable(3);
+        p_simplex.define_base_variable(4);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with generated model mixing inequations: the first half of
+ * rows are A x <= b, the second half are A x >= b with b small enough so that
+ * model stays feasible but adjustment variables do not define a feasible base
+ * @param p_simplex simplex to fill
+ * @param p_nb_variables number of variables
+ * @param p_nb_equations number of inequations of each type
+ * @param p_seed seed of random generator
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_random_mixed_model(SIMPLEX_TYPE & p_simplex,
+                        unsigned int p_nb_variables,
+                        unsigned int p_nb_equations,
+                        unsigned int p_seed
+                       )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef_type;
+    fill_random_model(p_simplex, p_nb_variables, p_nb_equations, p_seed);
+    std::mt19937 l_generator(p_seed + 1000);
+    std::uniform_int_distribution<int> l_A_distribution(1, 9);
+    std::uniform_int_distribution<int> l_B_distribution(1, 10);
+    std::bernoulli_distribution l_density_distribution(0.3);
+    for(unsigned int l_equation_index = p_nb_equations;
+        l_equation_index < 2 * p_nb_equations;
+        ++l_equation_index
+       )
+    {
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < p_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(l_density_distribution(l_generator))
+            {
+                p_simplex.set_A_coef(l_equation_index, l_variable_index, (t_coef_type)l_A_distribution(l_generator));
+            }
+        }
+        p_simplex.set_B_coef(l_equation_index, (t_coef_type)l_B_distribution(l_generator));
+        p_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_GT);
+    }
+}
+
+//------------------------------------------------------------------------------
+void bench_phase_1()
+{
+    std::cout << "Base\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    {
+        simplex::simplex_solver<double> l_simplex(5, 0, 2, 0);
+        fill_test_case1(l_simplex, true);
+        bench_simplex("hand", "test_case1", l_simplex);
+    }
+    {
+        simplex::simplex_solver<double> l_simplex(5, 0, 2, 0);
+        fill_test_case1(l_simplex, false);
+        bench_simplex("automatic", "test_case1", l_simplex);
+    }
+    const unsigned int l_sizes[][2] = {{60, 40}, {240, 160}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        std::string l_name = std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations);
+        {
+            simplex::simplex_solver<double> l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+            fill_random_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+            bench_simplex("hand", "random_" + l_name, l_simplex);
+        }
+        {
+            simplex::simplex_solver<double> l_simplex(l_nb_variables, l_nb_equations, 0, l_nb_equations);
+            fill_random_mixed_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+            bench_simplex("automatic", "mixed_" + l_name, l_simplex);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Fill simplex with a random model whose equations and variables are
+ * multiplied by random powers of 10
+ * @param p_simplex simplex to fill
+ * @param p_nb_variables number of variables
+ * @param p_nb_equations number of inequations
+ * @param p_seed seed of random generator
+ */
+template <typename SIMPLEX_TYPE>
+void
+fill_random_badly_scaled_model(SIMPLEX_TYPE & p_simplex,
+                               unsigned int p_nb_variables,
+                               unsigned int p_nb_equations,
+                               unsigned int p_seed
+                              )
+{
+    std::mt19937 l_generator(p_seed);
+    std::uniform_int_distribution<int> l_Z_distribution(1, 10);
+    std::uniform_int_distribution<int> l_A_distribution(1, 9);
+    std::uniform_int_distribution<int> l_B_distribution(100, 1000);
+    std::uniform_int_distribution<int> l_exponent_distribution(-4, 4);
+    std::bernoulli_distribution l_density_distribution(0.3);
+    std::vector<double> l_column_scales(p_nb_variables);
+    for(unsigned int l_variable_index = 0;
+        l_variable_index < p_nb_variables;
+        ++l_variable_index
+       )
+    {
+        l_column_scales[l_variable_index] = std::pow(10.0, l_exponent_distribution(l_generator));
+        p_simplex.set_Z_coef(l_variable_index, l_Z_distribution(l_generator) * l_column_scales[l_variable_index]);
+    }
+    for(unsigned int l_equation_index = 0;
+        l_equation_index < p_nb_equations;
+        ++l_equation_index
+       )
+    {
+        double l_row_scale = std::pow(10.0, l_exponent_distribution(l_generator));
+        for(unsigned int l_variable_index = 0;
+            l_variable_index < p_nb_variables;
+            ++l_variable_index
+           )
+        {
+            if(l_density_distribution(l_generator))
+            {
+                p_simplex.set_A_coef(l_equation_index, l_variable_index, l_A_distribution(l_generator) * l_row_scale * l_column_scales[l_variable_index]);
+            }
+        }
+        p_simplex.set_B_coef(l_equation_index, l_B_distribution(l_generator) * l_row_scale);
+        p_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+    }
+}
+
+//------------------------------------------------------------------------------
+void bench_scaling()
+{
+    std::cout << "Scaling\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    const unsigned int l_sizes[][2] = {{30, 20}, {60, 40}, {120, 80}, {240, 160}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        std::string l_name = "badly_scaled_" + std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations);
+        for(unsigned int l_scaling = 0; l_scaling < 2; ++l_scaling)
+        {
+            // Dantzig pricing compares reduced costs so its choices depend
+            // on scaling
+            simplex::simplex_solver<double, simplex::simplex_array<double>, simplex::simplex_pricing_dantzig<double>> l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+            fill_random_badly_scaled_model(l_simplex, l_nb_variables, l_nb_equations, 1 + l_index);
+            l_simplex.set_scaling(l_scaling);
+            bench_simplex(l_scaling ? "scaled" : "raw", l_name, l_simplex);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+void
+bench_integer_type(const std::string & p_name)
+{
+    {
+        SIMPLEX_TYPE l_simplex(18, 46, 0, 0);
+        fill_test_case3(l_simplex);
+        bench_simplex(p_name, "test_case3", l_simplex);
+    }
+    // Integer solvers overflow quickly so models stay small
+    const unsigned int l_sizes[][2] = {{6, 12}, {10, 20}, {15, 30}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        SIMPLEX_TYPE l_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_simplex, l_nb_variables, l_nb_equations, 2 + l_index);
+        bench_simplex(p_name, "random_" + std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations), l_simplex);
+    }
+}
+
+//------------------------------------------------------------------------------
+void bench_integer()
+{
+    std::cout << "Pivot\tModel\tIterations\tTime(us)\tMax" << std::endl;
+    bench_integer_type<simplex::simplex_solver_integer<int64_t>>("integer");
+    bench_integer_type<simplex::simplex_solver_integer_ppcm<int64_t>>("ppcm");
+    bench_integer_type<simplex::simplex_solver_integer_bareiss<int64_t>>("bareiss");
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Check that each line of array starts on a cache line
+ * @param p_array array to check
+ * @param p_name name of check
+ * @return true if lines are aligned
+ */
+template <typename ARRAY_TYPE>
+bool
+check_row_alignment(const ARRAY_TYPE & p_array,
+                    const std::string & p_name
+                   )
+{
+    bool l_aligned = true;
+    for(unsigned int l_row_index = 0; l_row_index < p_array.get_nb_equations(); ++l_row_index)
+    {
+        l_aligned &= 0 == reinterpret_cast<uintptr_t>(p_array.get_row(l_row_index)) % simplex::simplex_cache_line_size;
+    }
+    return quicky_test::check_expected(l_aligned, true, p_name);
+}
+
+//------------------------------------------------------------------------------
+template <typename COEF_TYPE, typename ALLOCATOR>
+bool test_array_storage(const ALLOCATOR & p_allocator,
+                        const std::string & p_name
+                       )
+{
+    bool l_ok = true;
+    simplex::simplex_array<COEF_TYPE, ALLOCATOR> l_array(3, 5, p_allocator);
+    l_ok &= check_row_alignment(l_array, p_name + " aligned rows");
+    for(unsigned int l_row_index = 0; l_row_index < 3; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 5; ++l_index)
+        {
+            l_array.set_A_coef(l_row_index, l_index, COEF_TYPE(10 * l_row_index + l_index + 1));
+        }
+    }
+    // Reallocations keep alignment and coefficients
+    l_array.insert_variables(2, 13);
+    l_array.add_equations(4);
+    l_ok &= check_row_alignment(l_array, p_name + " aligned rows after growth");
+    bool l_same = true;
+    for(unsigned int l_row_index = 0; l_row_index < 7; ++l_row_index)
+    {
+        for(unsigned int l_index = 0; l_index < 18; ++l_index)
+        {
+            COEF_TYPE l_expected(0);
+            if(l_row_index < 3 && (l_index < 2 || l_index >= 15))
+            {
+                l_expected = COEF_TYPE(10 * l_row_index + (l_index < 2 ? l_index : l_index - 13) + 1);
+            }
+            const COEF_TYPE & l_coef = l_array.get_A_coef(l_row_index, l_index);
+            l_same &= !(l_expected < l_coef) && !(l_coef < l_expected);
+        }
+    }
+    l_ok &= quicky_test::check_expected(l_same, true, p_name + " coefficients after growth");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_array_allocators()
+{
+    bool l_ok = true;
+    l_ok &= test_array_storage<double>(simplex::simplex_aligned_allocator<double>(), "aligned double");
+    l_ok &= test_array_storage<float>(simplex::simplex_aligned_allocator<float>(), "aligned float");
+    l_ok &= test_array_storage<quicky_utils::fract<ext_int<int32_t>>>(simplex::simplex_aligned_allocator<quicky_utils::fract<ext_int<int32_t>>>(), "aligned fract");
+    l_ok &= test_array_storage<double>(simplex::simplex_huge_page_allocator<double>(), "huge page");
+    {
+        simplex::simplex_arena l_arena(4096);
+        l_ok &= test_array_storage<double>(simplex::simplex_arena_allocator<double>(l_arena), "arena");
+        l_ok &= quicky_test::check_expected(l_arena.get_allocated_size() > 0, true, "Arena used");
+        l_arena.clear();
+        l_ok &= quicky_test::check_expected(l_arena.get_allocated_size(), (size_t)0, "Arena cleared");
+    }
+    {
+        // Large enough to be backed by huge pages
+        simplex::simplex_array<double, simplex::simplex_huge_page_allocator<double>> l_array(1024, 1000);
+        l_ok &= check_row_alignment(l_array, "huge page large array");
+        l_array.set_A_coef(1023, 999, 1.0);
+        l_ok &= check_close(l_array.get_A_coef(1023, 999), 1.0, "huge page large array coefficient");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Solve same random models with row-major and column-major storage
+ * @tparam ROW_SIMPLEX_TYPE solver using row-major storage
+ * @tparam COLUMN_SIMPLEX_TYPE same solver using column-major storage
+ * @return true if both layouts give the same pivots and results
+ */
+template <typename ROW_SIMPLEX_TYPE, typename COLUMN_SIMPLEX_TYPE>
+bool test_array_layout()
+{
+    bool l_ok = true;
+    // Wide, square and tall tableaus
+    const unsigned int l_sizes[][2] = {{40, 8}, {20, 20}, {8, 40}};
+    for(unsigned int l_index = 0;
+        l_index < sizeof(l_sizes) / sizeof(l_sizes[0]);
+        ++l_index
+       )
+    {
+        unsigned int l_nb_variables = l_sizes[l_index][0];
+        unsigned int l_nb_equations = l_sizes[l_index][1];
+        std::string l_name = std::to_string(l_nb_variables) + "x" + std::to_string(l_nb_equations);
+        ROW_SIMPLEX_TYPE l_row_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_row_simplex, l_nb_variables, l_nb_equations, 11 + l_index);
+        COLUMN_SIMPLEX_TYPE l_column_simplex(l_nb_variables, l_nb_equations, 0, 0);
+        fill_random_model(l_column_simplex, l_nb_variables, l_nb_equations, 11 + l_index);
+
+        typedef typename ROW_SIMPLEX_TYPE::t_coef_type t_coef;
+        t_coef l_row_max = 0;
+        t_coef l_column_max = 0;
+        bool l_row_infinite = false;
+        bool l_column_infinite = false;
+        simplex::simplex_counting_listener<t_coef> l_row_listener;
+        simplex::simplex_counting_listener<t_coef> l_column_listener;
+        bool l_row_found = l_row_simplex.find_max(l_row_max, l_row_infinite, &l_row_listener);
+        bool l_column_found = l_column_simplex.find_max(l_column_max, l_column_infinite, &l_column_listener);
+        // Same formulas are used whatever the layout so results are identical
+        l_ok &= quicky_test::check_expected(l_column_found, l_row_found, l_name + " found");
+        l_ok &= quicky_test::check_expected(l_column_infinite, l_row_infinite, l_name + " infinite");
+        l_ok &= quicky_test::check_expected(l_column_max, l_row_max, l_name + " max");
+        l_ok &= quicky_test::check_expected(l_column_listener.get_nb_pivots(), l_row_listener.get_nb_pivots(), l_name + " pivots");
+        l_ok &= quicky_test::check_expected(l_column_simplex.get_variable_values() == l_row_simplex.get_variable_values(), true, l_name + " variables");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Solver giving access to its array to check storage of columns
+ */
+class implicit_slack_solver: public simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>
+{
+  public:
+    implicit_slack_solver(unsigned int p_nb_variables,
+                          unsigned int p_nb_inequations_lt,
+                          unsigned int p_nb_equations,
+                          unsigned int p_nb_inequations_gt
+                         ):
+        simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>(p_nb_variables, p_nb_inequations_lt, p_nb_equations, p_nb_inequations_gt)
+    {
+    }
+
+    using simplex::simplex_solver<double,simplex::simplex_implicit_slack_array<double>>::get_array;
+};
+
+//------------------------------------------------------------------------------
+bool test_implicit_slack_array()
+{
+    bool l_ok = true;
+    simplex::simplex_implicit_slack_array<double> l_array(4, 6);
+    l_array.set_B_coef(2, 7.0);
+    l_array.set_Z_coef(5, 3.0);
+    // Unit columns are not stored
+    l_array.set_A_coef(0, 0, 1.0);
+    l_array.set_A_coef(1, 1, 2.0);
+    l_array.set_A_coef(1, 1, -1.0);
+    l_ok &= quicky_test::check_expected(l_array.get_nb_explicit_columns(), 0u, "Unit columns implicit");
+    l_ok &= check_close(l_array.get_A_coef(1, 1), -1.0, "Implicit coefficient");
+    l_ok &= check_close(l_array.get_A_coef(2, 1), 0.0, "Implicit null coefficient");
+    // Second non null coefficient makes column explicit
+    l_array.set_A_coef(3, 1, 4.0);
+    l_ok &= quicky_test::check_expected(l_array.is_explicit(1), true, "Column explicit");
+    l_ok &= check_close(l_array.get_A_coef(1, 1), -1.0, "Explicit coefficient");
+    l_ok &= check_close(l_array.get_A_coef(3, 1), 4.0, "Explicit added coefficient");
+    // Back to unit column as entering column at end of a pivot
+    l_array.set_A_coef(1, 1, 0.0);
+    l_ok &= quicky_test::check_expected(l_array.is_explicit(1), false, "Column implicit again");
+    l_ok &= check_close(l_array.get_A_coef(3, 1), 4.0, "Remaining coefficient");
+    l_ok &= check_close(l_array.get_A_coef(1, 1), 0.0, "Removed coefficient");
+    // Released slot is reused
+    l_array.set_A_coef(0, 4, 1.0);
+    l_array.set_A_coef(2, 4, 2.0);
+    l_array.set_A_coef(3, 4, 3.0);
+    l_ok &= quicky_test::check_expected(l_array.get_nb_slots(), 1u, "Slot reused");
+    l_ok &= check_close(l_array.get_A_coef(1, 4), 0.0, "Reused slot is null");
+    // Shift of columns keeps coefficients
+    l_array.insert_variables(1, 2);
+    l_ok &= check_close(l_array.get_A_coef(3, 3), 4.0, "Implicit column shifted");
+    l_ok &= check_close(l_array.get_A_coef(2, 6), 2.0, "Explicit column shifted");
+    l_ok &= check_close(l_array.get_Z_coef(7), 3.0, "Z coefficient shifted");
+    l_array.remove_variables(5, 2);
+    l_ok &= quicky_test::check_expected(l_array.get_nb_explicit_columns(), 0u, "Explicit column removed");
+    l_ok &= check_close(l_array.get_Z_coef(5), 3.0, "Z coefficient after removal");
+    // Removing rows can make a column implicit
+    l_array.set_A_coef(0, 4, 1.0);
+    l_array.set_A_coef(3, 4, 2.0);
+    l_array.remove_equations(1);
+    l_ok &= quicky_test::check_expected(l_array.is_explicit(4), false, "Column implicit after row removal");
+    l_ok &= check_close(l_array.get_A_coef(0, 4), 1.0, "Coefficient after row removal");
+    l_ok &= check_close(l_array.get_A_coef(2, 0), 0.0, "Null column after row removal");
+    l_ok &= check_close(l_array.get_B_coef(2), 7.0, "B coefficient");
+
+    // Only non base columns are stored once solved
+    implicit_slack_solver l_simplex(18, 46, 0, 0);
+    fill_test_case3(l_simplex);
+    l_ok &= quicky_test::check_expected(l_simplex.get_array().get_nb_explicit_columns() <= 18, true, "Structural columns stored");
+    double l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Implicit slack solved");
+    l_ok &= check_close(l_max, 3.0, "Implicit slack max");
+    l_ok &= quicky_test::check_expected(l_simplex.get_array().get_nb_explicit_columns() <= 18, true, "Non base columns stored");
+    // Leaving column is stored before entering one is released
+    l_ok &= quicky_test::check_expected(l_simplex.get_array().get_nb_slots() <= 19, true, "Slots used by pivots");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_integer_bareiss()
+{
+    bool l_ok = true;
+    // Seeds 0 and 1 generate unbounded models
+    for(unsigned int l_seed = 2; l_seed < 8; ++l_seed)
+    {
+        simplex::simplex_solver_integer_ppcm<int64_t> l_ppcm(6, 12, 0, 0);
+        simplex::simplex_solver_integer_bareiss<int64_t> l_bareiss(6, 12, 0, 0);
+        fill_random_model(l_ppcm, 6, 12, l_seed);
+        fill_random_model(l_bareiss, 6, 12, l_seed);
+        int64_t l_ppcm_max = 0;
+        int64_t l_bareiss_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_ppcm.find_max(l_ppcm_max, l_infinite), true, "PPCM max found");
+        l_ok &= quicky_test::check_expected(l_bareiss.find_max(l_bareiss_max, l_infinite), true, "Bareiss max found");
+        l_ok &= quicky_test::check_expected(l_bareiss_max, l_ppcm_max, "Bareiss max");
+        // Divider is the absolute value of last pivot
+        l_ok &= quicky_test::check_expected(l_bareiss.get_divider() > 0, true, "Bareiss divider positive");
+        std::vector<int64_t> l_ppcm_values = l_ppcm.get_variable_values();
+        std::vector<int64_t> l_bareiss_values = l_bareiss.get_variable_values();
+        for(unsigned int l_index = 0; l_index < l_ppcm_values.size(); ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_bareiss_values[l_index], l_ppcm_values[l_index], "Bareiss variable[" + std::to_string(l_index) + "]");
+        }
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Max Z = 3 * X1 + 2 * X2
+ * k * X1 +     k * X2 <= 4 * k
+ * k * X1 + 3 * k * X2 <= 6 * k
+ * First pivot multiplies coefficients by k so large k overflows tableau
+ */
+template <typename SIMPLEX_TYPE>
+void fill_scaled_model(SIMPLEX_TYPE & p_simplex
+                      ,const typename SIMPLEX_TYPE::t_coef_type & p_k
+                      )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    p_simplex.set_Z_coef(0, (t_coef)3);
+    p_simplex.set_Z_coef(1, (t_coef)2);
+    p_simplex.set_A_coef(0, 0, p_k);
+    p_simplex.set_A_coef(0, 1, p_k);
+    p_simplex.set_B_coef(0, (t_coef)4 * p_k);
+    p_simplex.set_A_coef(1, 0, p_k);
+    p_simplex.set_A_coef(1, 1, (t_coef)3 * p_k);
+    p_simplex.set_B_coef(1, (t_coef)6 * p_k);
+    p_simplex.define_equation_type(0, simplex::t_equation_type::INEQUATION_LT);
+    p_simplex.define_equation_type(1, simplex::t_equation_type::INEQUATION_LT);
+}
+
+//------------------------------------------------------------------------------
+template <typename SIMPLEX_TYPE>
+bool check_scaled_model(SIMPLEX_TYPE & p_simplex
+                       ,const std::string & p_name
+                       )
+{
+    typedef typename SIMPLEX_TYPE::t_coef_type t_coef;
+    bool l_ok = true;
+    t_coef l_max = 0;
+    bool l_infinite = false;
+    l_ok &= quicky_test::check_expected(p_simplex.find_max(l_max, l_infinite), true, p_name + " max found");
+    l_ok &= quicky_test::check_expected(l_max, (t_coef)12, p_name + " max");
+    std::vector<t_coef> l_variable_values = p_simplex.get_variable_values();
+    l_ok &= quicky_test::check_expected(l_variable_values[0], (t_coef)4, p_name + " variable[0]");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], (t_coef)0, p_name + " variable[1]");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_integer_promoting()
+{
+    bool l_ok = true;
+    {
+        // Unchecked products used to silently wrap around
+        simplex::simplex_solver_integer<int32_t> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, 70000);
+        bool l_thrown = false;
+        try
+        {
+            int32_t l_max = 0;
+            bool l_infinite = false;
+            l_simplex.find_max(l_max, l_infinite);
+        }
+        catch(const simplex::simplex_overflow_exception &)
+        {
+            l_thrown = true;
+        }
+        l_ok &= quicky_test::check_expected(l_thrown, true, "Integer overflow detected");
+    }
+    {
+        simplex::simplex_solver_integer_promoting<int32_t> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, 7);
+        l_ok &= check_scaled_model(l_simplex, "No promotion");
+        l_ok &= quicky_test::check_expected(l_simplex.get_coef_width(), 32u, "No promotion width");
+    }
+    {
+        simplex::simplex_solver_integer_promoting<int32_t> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, 70000);
+        simplex::simplex_counting_listener<int32_t> l_listener;
+        int32_t l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite, &l_listener), true, "Promotion to 64 bits max found");
+        l_ok &= quicky_test::check_expected(l_max, 12, "Promotion to 64 bits max");
+        l_ok &= quicky_test::check_expected(l_simplex.get_coef_width(), 64u, "Promotion to 64 bits width");
+        std::vector<int32_t> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], 4, "Promotion to 64 bits variable[0]");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], 0, "Promotion to 64 bits variable[1]");
+        l_ok &= quicky_test::check_expected(l_simplex.check_variables({4, 0}), true, "Promotion to 64 bits check");
+    }
+    {
+        simplex::simplex_solver_integer_promoting<int32_t,simplex::simplex_solver_integer_ppcm> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, 70000);
+        l_ok &= check_scaled_model(l_simplex, "Promotion ppcm");
+    }
+    {
+        simplex::simplex_solver_integer_promoting<int32_t,simplex::simplex_solver_integer_bareiss> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, 70000);
+        l_ok &= check_scaled_model(l_simplex, "Promotion bareiss");
+    }
+    // Random models whose base equation system overflowed 32 bits when
+    // computing variable values
+    for(unsigned int l_seed = 1; l_seed <= 50; ++l_seed)
+    {
+        std::mt19937 l_generator(l_seed);
+        std::uniform_int_distribution<int32_t> l_A_distribution(0, 5);
+        std::uniform_int_distribution<int32_t> l_B_distribution(1, 30);
+        simplex::simplex_solver_integer_promoting<int32_t> l_simplex(10, 10, 0, 0);
+        for(unsigned int l_variable_index = 0; l_variable_index < 10; ++l_variable_index)
+        {
+            l_simplex.set_Z_coef(l_variable_index, l_A_distribution(l_generator));
+        }
+        for(unsigned int l_equation_index = 0; l_equation_index < 10; ++l_equation_index)
+        {
+            for(unsigned int l_variable_index = 0; l_variable_index < 10; ++l_variable_index)
+            {
+                int32_t l_coef = l_A_distribution(l_generator);
+                if(l_coef)
+                {
+                    l_simplex.set_A_coef(l_equation_index, l_variable_index, l_coef);
+                }
+            }
+            l_simplex.set_B_coef(l_equation_index, l_B_distribution(l_generator));
+            l_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+        }
+        std::string l_name = "Promotion random " + std::to_string(l_seed);
+        int32_t l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, l_name + " max found");
+        std::vector<int32_t> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values.size(), (size_t)10, l_name + " variables");
+        l_ok &= quicky_test::check_expected(l_simplex.check_variables(l_variable_values), true, l_name + " check");
+    }
+    {
+        simplex::simplex_solver_integer_promoting<int64_t> l_simplex(2, 2, 0, 0);
+        fill_scaled_model(l_simplex, (int64_t)7000000000);
+#ifdef SIMPLEX_INT128
+        l_ok &= check_scaled_model(l_simplex, "Promotion to 128 bits");
+        l_ok &= quicky_test::check_expected(l_simplex.get_coef_width(), 128u, "Promotion to 128 bits width");
+#else // SIMPLEX_INT128
+        l_ok &= check_scaled_model(l_simplex, "Promotion to arbitrary precision");
+        l_ok &= quicky_test::check_expected(l_simplex.get_coef_width(), 0u, "Promotion to arbitrary precision width");
+#endif // SIMPLEX_INT128
+    }
+    {
+        // Pivots overflow 128 bits so that arbitrary precision is needed
+        const int64_t l_A_coefs[4][4] = {{350898113783, 911358047912, 470752132491, 74425040072},
+                                         {635231218314, 89453193645, 556178899123, 789651969507},
+                                         {418668529359, 249777923417, 291864660528, 803236322168},
+                                         {269939504160, 286041815354, 748990781505, 458124551222}
+                                        };
+        const int64_t l_B_coefs[4] = {569847148703000, 221633673994000, 474593805686000, 306186676738000};
+        const int64_t l_Z_coefs[4] = {14, 68, 46, 18};
+        simplex::simplex_solver_integer_promoting<int64_t> l_simplex(4, 4, 0, 0);
+        for(unsigned int l_equation_index = 0; l_equation_index < 4; ++l_equation_index)
+        {
+            l_simplex.set_Z_coef(l_equation_index, l_Z_coefs[l_equation_index]);
+            for(unsigned int l_variable_index = 0; l_variable_index < 4; ++l_variable_index)
+            {
+                l_simplex.set_A_coef(l_equation_index, l_variable_index, l_A_coefs[l_equation_index][l_variable_index]);
+            }
+            l_simplex.set_B_coef(l_equation_index, l_B_coefs[l_equation_index]);
+            l_simplex.define_equation_type(l_equation_index, simplex::t_equation_type::INEQUATION_LT);
+        }
+        int64_t l_max = 0;
+        bool l_infinite = false;
+        l_ok &= quicky_test::check_expected(l_simplex.find_max(l_max, l_infinite), true, "Arbitrary precision max found");
+        l_ok &= quicky_test::check_expected(l_max, (int64_t)45370, "Arbitrary precision max");
+        l_ok &= quicky_test::check_expected(l_simplex.get_coef_width(), 0u, "Arbitrary precision width");
+        std::vector<int64_t> l_variable_values = l_simplex.get_variable_values();
+        l_ok &= quicky_test::check_expected(l_variable_values[0], (int64_t)0, "Arbitrary precision X1");
+        l_ok &= quicky_test::check_expected(l_variable_values[1], (int64_t)556, "Arbitrary precision X2");
+        l_ok &= quicky_test::check_expected(l_variable_values[2], (int64_t)110, "Arbitrary precision X3");
+        l_ok &= quicky_test::check_expected(l_variable_values[3], (int64_t)139, "Arbitrary precision X4");
+        l_ok &= quicky_test::check_expected(l_simplex.check_variables(l_variable_values), true, "Arbitrary precision check");
+    }
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_simplex_identity_solver()
+{
+    bool l_ok = true;
+    // Example
+    // Max Z -1 * X1 - 4 * X2 - 3 * X3           = 0
+    //        2 * X1 + 2 * X2 + 1 * X3 + E1      = 4
+    //            X1 + 2 * X2 + 2 * X3 +    + E2 = 6
+    simplex::simplex_identity_solver<double> l_identity_solver(3,2);
+    l_identity_solver.set_Z_coef(0, 1);
+    l_identity_solver.set_Z_coef(1, 4);
+    l_identity_solver.set_Z_coef(2, 3);
+    l_identity_solver.set_B_coef(0, 4);
+    l_identity_solver.set_B_coef(1, 6);
+    l_identity_solver.set_A_coef(0, 0, 2);
+    l_identity_solver.set_A_coef(0, 1, 2);
+    l_identity_solver.set_A_coef(0, 2, 1);
+    l_identity_solver.set_A_coef(1, 0, 1);
+    l_identity_solver.set_A_coef(1, 1, 2);
+    l_identity_solver.set_A_coef(1, 2, 2);
+    l_identity_solver.display_array(std::cout);
+
+    double l_max = 0;
+    bool l_infinite = false;
+    simplex::simplex_listener<double> l_listener(l_identity_solver);
+    if(l_identity_solver.find_max(l_max,l_infinite,&l_listener))
+    {
+        std::cout << "Max = " << l_max << std::endl ;
+    }
+    else if(l_infinite)
+    {
+        std::cout << "Inifinite Max" << std::endl;
+    }
+    else
+    {
+        std::cout << "No Max found !?" << std::endl;
+    }
+    l_ok &= quicky_test::check_expected(l_max, 10.0, "Result of test_simplex_identity_solver");
+    std::vector<double> l_variable_values = l_identity_solver.get_variable_values();
+    assert(3 == l_variable_values.size());
+    l_ok &= quicky_test::check_expected(l_variable_values[0], 0.0, "Variable[0]");
+    l_ok &= quicky_test::check_expected(l_variable_values[1], 1.0, "Variable[1]");
+    l_ok &= quicky_test::check_expected(l_variable_values[2], 2.0, "Variable[2]");
+    return l_ok;
+}
+
+//------------------------------------------------------------------------------
+bool test_simplex_solver_glpk()
+{
+    bool l_ok = true;
+    simplex::simplex_solver_glpk l_glpk(3, 3, 0 , 0);
+    l_glpk.set_Z_coef(0, 10.0);
+    l_glpk.set_Z_coef(1, 6.0);
+    l_glpk.set_Z_coef(2, 4.0);
+    l_glpk.set_B_coef(0, 100.0);
+    l_glpk.set_B_coef(1, 600.0);
+    l_glpk.set_B_coef(2, 300.0);
+    l_glpk.define_equation_type(0, simplex::equation_type::INEQUATION_LT);
+    l_glpk.define_equation_type(1, simplex::equation_type::INEQUATION_LT);
+    l_glpk.define_equation_type(2, simplex::equation_type::INEQUATION_LT);
+    l_glpk.set_A_coef(0, 0, 1.0);
+    l_glpk.set_A_coef(0, 1, 1.0);
+    l_glpk.set_A_coef(0, 2, 1.0);
+    l_glpk.set_A_coef(1, 0, 10.0);
+    l_glpk.set_A_coef(1, 1, 4.0);
+    l_glpk.set_A_coef(1, 2, 5.0);
+    l_glpk.set_A_coef(2, 0, 2.0);
+    l_glpk.set_A_coef(2, 1, 2.0);
+    l_glpk.set_A_coef(2, 2, 6.0);
+
+    simplex_listener<double> l_listener(l_glpk);
+
+    double l_max;
+    bool l_infinite;
+    l_glpk.find_max(l_max, l_infinite, &l_listener);
+
+    // Compare string representation to avoid double representation issue
+    std::string l_result = std::to_string(l_max);
+    l_ok = quicky_test::check_expected(l_result, std::string("733.333333"), "test simplex_solver_glpk");
+
+    // MIP search is stopped before searching first subproblem
+    simplex::simplex_solver_glpk::use_mip(true);
+    simplex::simplex_solve_options<double> l_options;
+    l_options.m_iteration_limit = 0;
+    l_ok &= quicky_test::check_expected(l_glpk.find_max(l_max, l_options, &l_listener), simplex::t_solve_status::ITERATION_LIMIT, "glpk MIP iteration limit");
+    simplex::simplex_solver_glpk::use_mip(false);
     return l_ok;
 }
 #endif // SIMPLEX_SELF_TEST